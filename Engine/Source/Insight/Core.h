@@ -1,5 +1,8 @@
 #pragma once
 
+#include <stdint.h>
+#include <stddef.h>
+
 #if defined IE_PLATFORM_WINDOWS
 	#if defined IE_DYNAMIC_LINK
 		#if defined IE_BUILD_DLL
@@ -10,6 +13,9 @@
 	#else
 		#define INSIGHT_API 
 	#endif
+#else
+	// Engine sources built outside the engine, see 'PortableEngineFiles' in premake5.lua.
+	#define INSIGHT_API
 #endif // IE_PLATFORM_WINDOWS
 
 #if defined IE_ENGINE_DIST || defined IE_GAME_DIST
@@ -20,6 +26,13 @@
 	#define IE_ENABLE_ASSERTS
 #endif // IE_DEBUG
 
+// Count every general-heap allocation so steady-state frames can be verified
+// to be allocation free. See 'Frame_Allocator.h'. Debug only, the replaced
+// operator new costs several atomics per allocation.
+#if defined IE_DEBUG
+	#define IE_TRACK_HEAP_ALLOCATIONS
+#endif
+
 #if defined IE_ENABLE_ASSERTS
 	#define IE_ASSERT(x, ...) {if( !(x) ) { IE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
 	#define IE_CORE_ASSERT(x, ...) { if(!(x)) { IE_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
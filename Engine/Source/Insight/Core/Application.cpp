@@ -8,6 +8,9 @@
 #include "Platform/Windows/Windows_Window.h"
 #include "Insight/Core/ieException.h"
 #include "Insight/Rendering/Renderer.h"
+#include "Insight/Systems/Memory/Frame_Allocator.h"
+#include "Insight/Systems/Thread_Pool.h"
+#include "Insight/Utilities/Scene_Benchmark.h"
 
 #if defined IE_PLATFORM_WINDOWS
 #include "Platform/Windows/DirectX_12/D3D12_ImGui_Layer.h"
@@ -62,6 +65,9 @@ namespace Insight {
 		// Initize the main file system
 		FileSystem::Init(ProjectName);
 
+		// Start the workers used for background asset imports
+		ThreadPool::Init();
+
 		// Create and initialize the renderer
 		Renderer::SetSettingsAndCreateContext(FileSystem::LoadGraphicsSettingsFromJson());
 		Renderer::Init();
@@ -72,10 +78,12 @@ namespace Insight {
 		// Load the Scene
 		std::string DocumentPath = FileSystem::ProjectDirectory;
 		DocumentPath += "/Assets/Scenes/";
-		DocumentPath += TargetSceneName;
+		DocumentPath += SceneBenchmark::IsEnabled() ? SceneBenchmark::GetSceneName() : TargetSceneName;
+		SceneBenchmark::BeginLoad();
 		if (!m_pGameLayer->LoadScene(DocumentPath)) {
 			throw ieException("Failed to initialize scene");
 		}
+		SceneBenchmark::EndLoad();
 		
 		// Push core app layer to the layer stack
 		PushEngineLayers();
@@ -89,6 +97,12 @@ namespace Insight {
 		IE_ADD_FOR_GAME_DIST(
 			BeginPlay(AppBeginPlayEvent{})
 		);
+		// Benchmarks tick the scene the same way a play session does.
+		IE_STRIP_FOR_GAME_DIST(
+			if (SceneBenchmark::IsEnabled()) {
+				BeginPlay(AppBeginPlayEvent{});
+			}
+		);
 
 		while(m_Running) {
 
@@ -119,11 +133,27 @@ namespace Insight {
 
 			m_pGameLayer->PostRender();
 			m_pWindow->EndFrame();
+
+			FrameAllocator::EndFrame();
+			MemoryTracker::EndFrame();
+
+			if (SceneBenchmark::IsEnabled() && !SceneBenchmark::EndFrame()) {
+				m_Running = false;
+			}
+		}
+
+		if (SceneBenchmark::IsEnabled()) {
+			// Put the scene back the way it was loaded so the save measures the same data every run.
+			IE_STRIP_FOR_GAME_DIST(EndPlay(AppEndPlayEvent{});)
+			SceneBenchmark::Finish(m_pGameLayer->GetScene());
 		}
 	}
 
 	void Application::Shutdown()
 	{
+		// Let a save that is still being written finish before the workers go away.
+		FileSystem::WaitForPendingSave();
+		ThreadPool::Shutdown();
 	}
 
 	void Application::OnEvent(Event & e)
@@ -205,7 +235,7 @@ namespace Insight {
 
 	bool Application::SaveScene(SceneSaveEvent& e)
 	{
-		return FileSystem::WriteSceneToJson(m_pGameLayer->GetScene());
+		return FileSystem::SaveSceneAsync(m_pGameLayer->GetScene());
 	}
 
 	bool Application::BeginPlay(AppBeginPlayEvent& e)
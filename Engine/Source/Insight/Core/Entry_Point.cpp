@@ -2,6 +2,7 @@
 
 #include "ClientApp.h"
 #include "Insight/Core/ieException.h"
+#include "Insight/Utilities/Scene_Benchmark.h"
 
 // Copyright 2020 Garrett Courtney
 
@@ -25,6 +26,11 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
 	}
 	IE_CORE_TRACE("Logger Initialized");
 
+	// Benchmarks run without showing the window.
+	if (Insight::SceneBenchmark::ParseCommandLine(lpCmdLine)) {
+		nCmdShow = SW_HIDE;
+	}
+
 	auto app = Insight::CreateApplication();
 
 	try {
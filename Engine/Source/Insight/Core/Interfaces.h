@@ -1,11 +1,14 @@
 #pragma once
 
+#include "Insight/Core/Ref_Counted.h"
+
 namespace Insight {
 
 
 	class AActor;
 	class ActorComponent;
 	class Model;
+	class ModelAsset;
 	class Texture;
 
 	typedef unsigned int ActorId;
@@ -17,13 +20,18 @@ namespace Insight {
 
 	typedef shared_ptr<AActor> StrongActorPtr;
 	typedef weak_ptr<AActor> WeakActorPtr;
-	typedef shared_ptr<ActorComponent> StrongActorComponentPtr;
+	// Engine resources are intrusively reference counted. See 'Ref_Counted.h'.
+	// Weak handles are plain non-owning pointers, a strong handle can always be
+	// re-created from them while the object is alive.
+	typedef TRef<ActorComponent> StrongActorComponentPtr;
 	typedef unique_ptr<ActorComponent> UniqueActorComponentPtr;
-	typedef weak_ptr<ActorComponent> WeakActorComponentPtr;
-	typedef shared_ptr<Model> StrongModelPtr;
-	typedef weak_ptr<Model> WeakModelPtr;
-	typedef shared_ptr<Texture> StrongTexturePtr;
-	typedef weak_ptr<Texture> WeakTexturePtr;
+	typedef ActorComponent* WeakActorComponentPtr;
+	typedef TRef<Model> StrongModelPtr;
+	typedef Model* WeakModelPtr;
+	typedef TRef<const ModelAsset> StrongModelAssetPtr;
+	typedef const ModelAsset* WeakModelAssetPtr;
+	typedef TRef<Texture> StrongTexturePtr;
+	typedef Texture* WeakTexturePtr;
 
 	enum class eRenderPass
 	{
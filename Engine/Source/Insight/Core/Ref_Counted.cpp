@@ -0,0 +1,50 @@
+#include <ie_pch.h>
+
+#include "Ref_Counted.h"
+
+namespace Insight {
+
+	static thread_local uint32_t s_BulkReleaseDepth = 0U;
+	static thread_local std::vector<const IRefCounted*>* s_pPendingReleases = nullptr;
+
+	void IRefCounted::Dispose(const IRefCounted* pObject)
+	{
+		if (s_BulkReleaseDepth > 0U) {
+			s_pPendingReleases->push_back(pObject);
+			return;
+		}
+		delete pObject;
+	}
+
+	ScopedBulkRelease::ScopedBulkRelease()
+	{
+		if (s_BulkReleaseDepth++ == 0U) {
+			s_pPendingReleases = new std::vector<const IRefCounted*>();
+			s_pPendingReleases->reserve(1024);
+		}
+	}
+
+	ScopedBulkRelease::~ScopedBulkRelease()
+	{
+		if (--s_BulkReleaseDepth > 0U) {
+			return;
+		}
+
+		// Destroying an object may release handles it owns. Those land back in the
+		// pending list, so keep draining until nothing new was queued.
+		std::vector<const IRefCounted*> Releasing;
+		s_BulkReleaseDepth++;
+		while (!s_pPendingReleases->empty()) {
+			Releasing.swap(*s_pPendingReleases);
+			for (const IRefCounted* pObject : Releasing) {
+				delete pObject;
+			}
+			Releasing.clear();
+		}
+		s_BulkReleaseDepth--;
+
+		delete s_pPendingReleases;
+		s_pPendingReleases = nullptr;
+	}
+
+}
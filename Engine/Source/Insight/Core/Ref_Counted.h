@@ -0,0 +1,160 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <atomic>
+
+/*
+	Intrusive reference counting for engine resources.
+
+	The reference count lives inside the object itself so a handle is a single pointer,
+	the object is a single allocation and copying a handle never touches a separate
+	control block. Objects choose how they are counted through a policy:
+		SingleThreadRefCountPolicy - Plain integer. For objects that only ever live on
+									 one thread (actors, components).
+		ThreadSafeRefCountPolicy   - Atomic integer. For resources shared between the
+									 main thread and loading threads (models, textures).
+
+	Example usage:
+		class MyResource : public TRefCounted<ThreadSafeRefCountPolicy> { ... };
+		TRef<MyResource> Resource = MakeRef<MyResource>();
+*/
+
+namespace Insight {
+
+	struct SingleThreadRefCountPolicy
+	{
+		typedef uint32_t CountType;
+
+		static inline uint32_t Increment(CountType& Count) { return ++Count; }
+		static inline uint32_t Decrement(CountType& Count) { return --Count; }
+		static inline uint32_t Load(const CountType& Count) { return Count; }
+	};
+
+	struct ThreadSafeRefCountPolicy
+	{
+		typedef std::atomic<uint32_t> CountType;
+
+		static inline uint32_t Increment(CountType& Count) { return Count.fetch_add(1, std::memory_order_relaxed) + 1; }
+		static inline uint32_t Decrement(CountType& Count) { return Count.fetch_sub(1, std::memory_order_acq_rel) - 1; }
+		static inline uint32_t Load(const CountType& Count) { return Count.load(std::memory_order_relaxed); }
+	};
+
+	// Common base for every reference counted object. Only used so objects
+	// with different count policies can be destroyed through one pointer type.
+	class INSIGHT_API IRefCounted
+	{
+	public:
+		virtual ~IRefCounted() = default;
+
+		// Destroys an object whose reference count reached zero. If a 'ScopedBulkRelease'
+		// is active on the calling thread the object is queued and destroyed when the
+		// outermost scope closes, otherwise it is deleted immediately.
+		static void Dispose(const IRefCounted* pObject);
+	};
+
+	template <typename RefCountPolicy>
+	class TRefCounted : public IRefCounted
+	{
+	public:
+		inline void AddRef() const { RefCountPolicy::Increment(m_RefCount); }
+		inline void Release() const
+		{
+			if (RefCountPolicy::Decrement(m_RefCount) == 0) {
+				IRefCounted::Dispose(this);
+			}
+		}
+		inline uint32_t GetRefCount() const { return RefCountPolicy::Load(m_RefCount); }
+
+	protected:
+		TRefCounted() : m_RefCount(0) {}
+		// Copying an object must never copy the handles pointing at it.
+		TRefCounted(const TRefCounted&) : m_RefCount(0) {}
+		TRefCounted& operator = (const TRefCounted&) { return *this; }
+		virtual ~TRefCounted() = default;
+
+	private:
+		mutable typename RefCountPolicy::CountType m_RefCount;
+	};
+
+	// Strong handle to an intrusively reference counted object. Can be constructed
+	// from a raw pointer at any time because the count lives inside the object.
+	template <typename T>
+	class TRef
+	{
+	public:
+		TRef() : m_pObject(nullptr) {}
+		TRef(std::nullptr_t) : m_pObject(nullptr) {}
+		TRef(T* pObject) : m_pObject(pObject) { if (m_pObject) m_pObject->AddRef(); }
+		TRef(const TRef& Other) : m_pObject(Other.m_pObject) { if (m_pObject) m_pObject->AddRef(); }
+		TRef(TRef&& Other) noexcept : m_pObject(Other.m_pObject) { Other.m_pObject = nullptr; }
+		template <typename U>
+		TRef(const TRef<U>& Other) : m_pObject(Other.Get()) { if (m_pObject) m_pObject->AddRef(); }
+		template <typename U>
+		TRef(TRef<U>&& Other) noexcept : m_pObject(Other.Detach()) {}
+		~TRef() { if (m_pObject) m_pObject->Release(); }
+
+		TRef& operator = (const TRef& Other) { TRef(Other).Swap(*this); return *this; }
+		TRef& operator = (TRef&& Other) noexcept { TRef(std::move(Other)).Swap(*this); return *this; }
+		TRef& operator = (T* pObject) { TRef(pObject).Swap(*this); return *this; }
+		TRef& operator = (std::nullptr_t) { Reset(); return *this; }
+
+		inline T* Get() const { return m_pObject; }
+		inline T* operator -> () const { return m_pObject; }
+		inline T& operator * () const { return *m_pObject; }
+		inline explicit operator bool() const { return m_pObject != nullptr; }
+
+		// Drop this handle's reference.
+		inline void Reset() { if (m_pObject) { m_pObject->Release(); m_pObject = nullptr; } }
+		// Give up ownership of the object without releasing it.
+		inline T* Detach() { T* pObject = m_pObject; m_pObject = nullptr; return pObject; }
+		inline void Swap(TRef& Other) { std::swap(m_pObject, Other.m_pObject); }
+
+	private:
+		T* m_pObject;
+	};
+
+	template <typename T, typename U> inline bool operator == (const TRef<T>& A, const TRef<U>& B) { return A.Get() == B.Get(); }
+	template <typename T, typename U> inline bool operator != (const TRef<T>& A, const TRef<U>& B) { return A.Get() != B.Get(); }
+	template <typename T> inline bool operator == (const TRef<T>& A, const T* B) { return A.Get() == B; }
+	template <typename T> inline bool operator != (const TRef<T>& A, const T* B) { return A.Get() != B; }
+	template <typename T> inline bool operator == (const TRef<T>& A, std::nullptr_t) { return A.Get() == nullptr; }
+	template <typename T> inline bool operator != (const TRef<T>& A, std::nullptr_t) { return A.Get() != nullptr; }
+
+	template <typename T, typename... Args>
+	inline TRef<T> MakeRef(Args&&... args)
+	{
+		return TRef<T>(new T(std::forward<Args>(args)...));
+	}
+
+	template <typename T, typename U>
+	inline TRef<T> StaticRefCast(const TRef<U>& Ref)
+	{
+		return TRef<T>(static_cast<T*>(Ref.Get()));
+	}
+
+	// Defers destruction of every object released on this thread while the scope
+	// is alive, then destroys them together when the outermost scope exits. Used
+	// when flushing a scene so thousands of handles dropping to zero do not interleave
+	// destruction with the teardown of the managers holding them.
+	class INSIGHT_API ScopedBulkRelease
+	{
+	public:
+		ScopedBulkRelease();
+		~ScopedBulkRelease();
+
+		ScopedBulkRelease(const ScopedBulkRelease&) = delete;
+		ScopedBulkRelease& operator = (const ScopedBulkRelease&) = delete;
+	};
+
+}
+
+namespace std {
+
+	template <typename T>
+	struct hash<Insight::TRef<T>>
+	{
+		size_t operator()(const Insight::TRef<T>& Ref) const { return hash<T*>()(Ref.Get()); }
+	};
+
+}
@@ -21,17 +21,55 @@ namespace Insight {
 		Destroy();
 	}
 
-	bool Scene::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	// Prefab instances write a reference to their prefab and what they override instead of a full record.
+	// An instance that cannot be diffed against its prefab is saved as a full record instead, so it is
+	// never dropped from the file. Returns false if not even the full record could be written.
+	static bool WriteActorRecordToJson(SceneNode* pNode, JsonRecordWriter& Writer)
+	{
+		AActor* pActor = dynamic_cast<AActor*>(pNode);
+		if (pActor && pActor->GetPrefab()) {
+			if (pActor->GetPrefab()->WriteInstanceToJson(*pActor, Writer)) {
+				return true;
+			}
+			IE_CORE_WARN("Saving actor \"{0}\" as a full record, it will no longer be linked to its prefab when loaded.", pActor->GetDisplayName());
+		}
+		if (!pNode->WriteToJson(Writer)) {
+			IE_CORE_ERROR("Failed to write actor \"{0}\".", pNode->GetDisplayName());
+			return false;
+		}
+		return true;
+	}
+
+	bool Scene::WriteToJson(JsonRecordWriter& Writer)
 	{
+		bool Succeeded = true;
 		Writer.StartObject();
 		Writer.Key("Set");
 		Writer.StartArray();
 		{
-			m_pSceneRoot->WriteToJson(Writer);
+			for (SceneNode* pNode : m_pSceneRoot->m_Children) {
+				Succeeded = WriteActorRecordToJson(pNode, Writer) && Succeeded;
+			}
 		}
 		Writer.EndArray();
 		Writer.EndObject();
-		return true;
+		return Succeeded;
+	}
+
+	bool Scene::WriteActorsToJson(const std::vector<AActor*>& Actors, JsonRecordWriter& Writer)
+	{
+		bool Succeeded = true;
+		Writer.StartObject();
+		Writer.Key("Set");
+		Writer.StartArray();
+		{
+			for (AActor* pActor : Actors) {
+				Succeeded = WriteActorRecordToJson(pActor, Writer) && Succeeded;
+			}
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+		return Succeeded;
 	}
 
 	bool Scene::Init(const std::string fileName)
@@ -73,7 +111,7 @@ namespace Insight {
 		m_pPlayerStart->SetCanBeFileParsed(false);
 		m_pSceneRoot->AddChild(m_pPlayerStart);
 		// Load the scene from .iescene folder containing all .json resource files
-		FileSystem::LoadSceneFromJson(fileName, this);
+		FileSystem::LoadScene(fileName, this);
 
 		// Tell the renderer to set init commands to the gpu
 		Renderer::PostInit();
@@ -87,6 +125,9 @@ namespace Insight {
 
 	void Scene::BeginPlay()
 	{
+		// Shipping builds never return to the editor, there is nothing to restore.
+		IE_STRIP_FOR_GAME_DIST(m_PlaySnapshot.Capture(*m_pSceneRoot);)
+
 		m_pCamera->SetParent(m_pPlayerCharacter);
 		m_pPlayerStart->SpawnPlayer(m_pPlayerCharacter);
 		m_pCamera->SetViewTarget(m_pPlayerCharacter->GetViewTarget());
@@ -101,9 +142,12 @@ namespace Insight {
 		m_pCamera->SetParent(m_pSceneRoot);
 		m_pCamera->SetViewTarget(m_EditorViewTarget);
 
-		m_pPlayerCharacter->GetTransformRef().SetPosition(0.0f, 0.0f, 0.0f);
-
-		m_pSceneRoot->EditorEndPlay();
+		uint32_t NumDestroyed = 0U;
+		m_PlaySnapshot.Restore(*m_pSceneRoot, NumDestroyed);
+		if (NumDestroyed > 0U) {
+			// The selection may have been one of the actors spawned during play.
+			IE_STRIP_FOR_GAME_DIST(Application::Get().GetEditorLayer().SetSelectedActor(nullptr);)
+		}
 	}
 
 	void Scene::Tick(const float& DeltaMs)
@@ -126,6 +170,9 @@ namespace Insight {
 	{
 		Renderer::OnPreFrameRender();
 		m_pSceneRoot->CalculateParent(XMMatrixIdentity());
+		if (m_pCamera) {
+			GeometryManager::CullMeshlets(*m_pCamera);
+		}
 		GeometryManager::GatherGeometry();
 	}
 
@@ -152,8 +199,16 @@ namespace Insight {
 
 	bool Scene::FlushAndOpenNewScene(const std::string& NewScene)
 	{
-		Destroy();
-		m_ResourceManager.FlushAllResources();
+		{
+			// Release every actor, component and resource of the old scene in one pass.
+			ScopedBulkRelease BulkRelease;
+			Destroy();
+			m_ResourceManager.FlushAllResources();
+			m_SavedChunkSizes.clear();
+			m_SavedChunkFiles.clear();
+			m_SaveGeneration = 0U;
+			m_PlaySnapshot.Clear();
+		}
 		if (!Init(NewScene)) {
 			IE_CORE_ERROR("Failed to flush current scene \"{0}\" and load new scene with filepath: \"{1}\"", m_DisplayName, NewScene);
 			return false;
@@ -3,6 +3,7 @@
 #include <Insight/Core.h>
 
 #include "Scene_Node.h"
+#include "Scene_Snapshot.h"
 #include "Insight/Rendering/Renderer.h"
 #include "Insight/Systems/Managers/Resource_Manager.h"
 #include "Insight/Systems/File_System.h"
@@ -25,7 +26,17 @@ namespace Insight {
 		// other game actors in the world are children too.
 		SceneNode* GetRootNode() const { return m_pSceneRoot; }
 		// Write scene out to JSON file.
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer);
+		bool WriteToJson(JsonRecordWriter& writer);
+		// Write a set of actors in the same format as 'WriteToJson'. Used for the scene's actor chunk files.
+		// Returns false if any actor failed to write, the chunk must not be saved then.
+		static bool WriteActorsToJson(const std::vector<AActor*>& Actors, JsonRecordWriter& writer);
+		// Number of actors in each actor chunk file as of the last load or save.
+		std::vector<uint32_t>& GetSavedChunkSizes() { return m_SavedChunkSizes; }
+		// Path of each actor chunk file relative to the scene folder, as listed in Meta.json.
+		std::vector<std::string>& GetSavedChunkFiles() { return m_SavedChunkFiles; }
+		// Generation of the last load or save. Each save writes its chunks under a new one.
+		uint32_t GetSaveGeneration() const { return m_SaveGeneration; }
+		void SetSaveGeneration(uint32_t Generation) { m_SaveGeneration = Generation; }
 
 		// Initialize the scene
 		bool Init(const std::string fileName);
@@ -84,6 +95,11 @@ namespace Insight {
 
 		SceneNode* m_pSceneRoot = nullptr;
 		std::string m_DisplayName;
+		std::vector<uint32_t> m_SavedChunkSizes;
+		std::vector<std::string> m_SavedChunkFiles;
+		uint32_t m_SaveGeneration = 0U;
+		// State of the scene when the current play session began.
+		SceneSnapshot m_PlaySnapshot;
 		
 	private:
 		ResourceManager m_ResourceManager;
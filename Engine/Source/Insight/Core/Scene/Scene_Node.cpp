@@ -5,6 +5,7 @@
 #include "imgui.h"
 #include "Scene_Node.h"
 #include "Insight/Core/Scene/Scene.h"
+#include "Insight/Runtime/Reflection.h"
 
 namespace Insight {
 
@@ -36,7 +37,7 @@ namespace Insight {
 		}
 	}
 
-	bool SceneNode::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool SceneNode::WriteToJson(JsonRecordWriter& Writer)
 	{
 		size_t numChildrenObjects = m_Children.size();
 		for (size_t i = 0; i < numChildrenObjects; ++i) {
@@ -50,6 +51,20 @@ namespace Insight {
 		return false;
 	}
 
+	bool SceneNode::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		size_t numChildrenObjects = m_Children.size();
+		for (size_t i = 0; i < numChildrenObjects; ++i) {
+			m_Children[i]->WriteToCooked(Builder);
+		}
+		return false;
+	}
+
+	bool SceneNode::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		return false;
+	}
+
 	void SceneNode::RenderSceneHeirarchy()
 	{
 		size_t numChildrenObjects = m_Children.size();
@@ -108,12 +123,34 @@ namespace Insight {
 	{
 	}
 
-	void SceneNode::EditorEndPlay()
+	struct SceneNodeSnapshot
 	{
-		m_RootTransform.EditorEndPlay();
-		for (auto i = m_Children.begin(); i != m_Children.end(); ++i) {
-			(*i)->EditorEndPlay();
+		ieSymbol DisplayName;
+		ieVector3 Position;
+		ieVector3 Rotation;
+		ieVector3 Scale;
+	};
+
+	void SceneNode::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		const SceneNodeSnapshot Record = {
+			m_DisplayName,
+			m_RootTransform.GetPosition(),
+			m_RootTransform.GetRotation(),
+			m_RootTransform.GetScale(),
+		};
+		Reflection::WriteBinary(Record, Snapshot);
+	}
+
+	bool SceneNode::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		SceneNodeSnapshot Record;
+		if (!Reflection::ReadBinary(Record, pData, pEnd)) {
+			return false;
 		}
+		m_DisplayName = Record.DisplayName;
+		m_RootTransform.SetPositionRotationScale(Record.Position, Record.Rotation, Record.Scale);
+		return true;
 	}
 
 	void SceneNode::Destroy()
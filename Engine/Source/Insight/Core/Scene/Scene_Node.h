@@ -3,10 +3,15 @@
 #include "Insight/Core.h"
 
 #include "Insight/Math/Transform.h"
+#include "Insight/Utilities/String_Interner.h"
+#include "Insight/Systems/Json_Record_Writer.h"
 
 namespace Insight {
 	
 	class Scene;
+	class CookedSceneView;
+	class CookedSceneBuilder;
+	struct CookedActor;
 
 	class INSIGHT_API SceneNode
 	{
@@ -23,16 +28,20 @@ namespace Insight {
 		const ieTransform& GetTransform() { return m_RootTransform; }
 		ieTransform& GetTransformRef() { return m_RootTransform; }
 		const char* GetDisplayName() { return m_DisplayName.c_str(); }
-		void SetDisplayName(std::string Name) { m_DisplayName = Name; }
+		ieSymbol GetDisplayNameSymbol() const { return m_DisplayName; }
+		void SetDisplayName(ieSymbol Name) { m_DisplayName = Name; }
 		void SetCanBeFileParsed(bool CanBeParsed) { m_CanBeFileParsed = CanBeParsed; }
+		bool GetCanBeFileParsed() const { return m_CanBeFileParsed; }
 
 		void AddChild(SceneNode* childNode);
 		void RemoveChild(SceneNode* ChildNode);
 		std::vector<SceneNode*>::const_iterator GetChildIteratorStart() { return m_Children.begin(); }
 		std::vector<SceneNode*>::const_iterator GetChildIteratorEnd() { return m_Children.end(); }
 
-		virtual bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer);
+		virtual bool WriteToJson(JsonRecordWriter& Writer);
 		virtual bool LoadFromJson(const rapidjson::Value& JsonActor);
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder);
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor);
 
 		virtual void RenderSceneHeirarchy();
 		virtual bool OnInit();
@@ -46,13 +55,17 @@ namespace Insight {
 		virtual void Tick(const float& DeltaMs);
 		virtual void Exit();
 
-		virtual void EditorEndPlay();
+		// Play-in-editor snapshot, see SceneSnapshot. Append the state a play session can
+		// change, ReadFromSnapshot reads it back in the same order. Returns false if the
+		// record is too short.
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot);
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd);
 
 		std::vector<SceneNode*> m_Children;
 	protected:
 		SceneNode* m_Parent = nullptr;
 		ieTransform m_RootTransform;
-		std::string m_DisplayName;
+		ieSymbol m_DisplayName;
 		bool m_CanBeFileParsed = true;
 	};
 
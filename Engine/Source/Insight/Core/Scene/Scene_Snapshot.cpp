@@ -0,0 +1,112 @@
+#include <ie_pch.h>
+
+#include "Scene_Snapshot.h"
+
+#include "Insight/Core/Scene/Scene_Node.h"
+
+#include <unordered_set>
+
+namespace Insight {
+
+	void SceneSnapshot::Capture(SceneNode& Root)
+	{
+		Profiling::ScopedTimer timer("SceneSnapshot::Capture");
+
+		Clear();
+		m_NumChildren.push_back(static_cast<uint32_t>(Root.m_Children.size()));
+		m_Children.insert(m_Children.end(), Root.m_Children.begin(), Root.m_Children.end());
+		for (SceneNode* pChild : Root.m_Children) {
+			CaptureSubtree(*pChild);
+		}
+		MemoryTracker::RecordAllocation(eMemoryCategory::SceneGraph, m_Data.capacity());
+
+		IE_CORE_INFO("Captured play snapshot of {0} nodes ({1} bytes).", m_Nodes.size(), m_Data.size());
+	}
+
+	void SceneSnapshot::CaptureSubtree(SceneNode& Node)
+	{
+		m_Nodes.push_back(&Node);
+		Node.WriteToSnapshot(m_Data);
+		m_RecordEnds.push_back(static_cast<uint32_t>(m_Data.size()));
+
+		m_NumChildren.push_back(static_cast<uint32_t>(Node.m_Children.size()));
+		m_Children.insert(m_Children.end(), Node.m_Children.begin(), Node.m_Children.end());
+		for (SceneNode* pChild : Node.m_Children) {
+			CaptureSubtree(*pChild);
+		}
+	}
+
+	bool SceneSnapshot::Restore(SceneNode& Root, uint32_t& OutNumDestroyed)
+	{
+		OutNumDestroyed = 0U;
+		if (IsEmpty()) {
+			return false;
+		}
+		Profiling::ScopedTimer timer("SceneSnapshot::Restore");
+
+		// Anything that is not in the snapshot was spawned during play. Captured nodes may have
+		// been moved under a spawned one, so the whole current tree is searched.
+		const std::unordered_set<SceneNode*> Captured(m_Nodes.begin(), m_Nodes.end());
+		std::vector<SceneNode*> Spawned;
+		std::vector<SceneNode*> Pending(1, &Root);
+		while (!Pending.empty()) {
+			SceneNode* pNode = Pending.back();
+			Pending.pop_back();
+			for (SceneNode* pChild : pNode->m_Children) {
+				if (Captured.find(pChild) == Captured.end()) {
+					Spawned.push_back(pChild);
+				}
+				Pending.push_back(pChild);
+			}
+		}
+
+		// Put the hierarchy back first so spawned nodes no longer own anything that was captured.
+		SceneNode* const* pChildren = m_Children.data();
+		for (size_t i = 0; i < m_NumChildren.size(); ++i) {
+			SceneNode* pParent = (i == 0) ? &Root : m_Nodes[i - 1];
+			pParent->m_Children.assign(pChildren, pChildren + m_NumChildren[i]);
+			for (SceneNode* pChild : pParent->m_Children) {
+				pChild->SetParent(pParent);
+			}
+			pChildren += m_NumChildren[i];
+		}
+		// Every spawned descendant is in the list itself, detach them all before any is destroyed.
+		for (SceneNode* pNode : Spawned) {
+			pNode->m_Children.clear();
+		}
+		for (SceneNode* pNode : Spawned) {
+			pNode->Destroy();
+			delete pNode;
+		}
+		OutNumDestroyed = static_cast<uint32_t>(Spawned.size());
+
+		bool Succeeded = true;
+		const uint8_t* pBegin = m_Data.data();
+		uint32_t RecordStart = 0U;
+		for (size_t i = 0; i < m_Nodes.size(); ++i) {
+			// Each record is read from its own range, so one bad record cannot misalign the rest.
+			const uint8_t* pData = pBegin + RecordStart;
+			if (!m_Nodes[i]->ReadFromSnapshot(pData, pBegin + m_RecordEnds[i])) {
+				IE_CORE_ERROR("Failed to restore actor \"{0}\" from the play snapshot.", m_Nodes[i]->GetDisplayName());
+				Succeeded = false;
+			}
+			RecordStart = m_RecordEnds[i];
+		}
+
+		IE_CORE_INFO("Restored {0} nodes from the play snapshot, destroyed {1} spawned during play.", m_Nodes.size(), OutNumDestroyed);
+		Clear();
+		return Succeeded;
+	}
+
+	void SceneSnapshot::Clear()
+	{
+		MemoryTracker::RecordFree(eMemoryCategory::SceneGraph, m_Data.capacity());
+		m_Nodes.clear();
+		m_Children.clear();
+		m_NumChildren.clear();
+		m_RecordEnds.clear();
+		m_Data.clear();
+		m_Data.shrink_to_fit();
+	}
+
+}
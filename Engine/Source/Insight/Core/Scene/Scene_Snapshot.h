@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+/*
+	In-memory binary copy of the scene's editable state. It is taken when a play session
+	begins and restored when it ends, so nothing the game changes leaks back into the
+	edited scene.
+
+	Every node under the scene root, at any depth, appends its state to one contiguous
+	buffer through SceneNode::WriteToSnapshot, actors follow theirs with a record for each
+	of their components. The records are trivially copyable structs, so capturing or
+	restoring an actor is a handful of memcpys and a single matrix rebuild. Nodes spawned
+	during play are destroyed on restore and every captured node gets its children back
+	in their original order.
+
+	Example usage:
+		m_PlaySnapshot.Capture(*m_pSceneRoot);	// Scene::BeginPlay
+		uint32_t NumDestroyed = 0U;
+		m_PlaySnapshot.Restore(*m_pSceneRoot, NumDestroyed);	// Scene::EndPlaySession
+*/
+
+namespace Insight {
+
+	class SceneNode;
+
+	class INSIGHT_API SceneSnapshot
+	{
+	public:
+		// Replaces any previous snapshot.
+		void Capture(SceneNode& Root);
+		// Put the root's subtree back the way it was when the snapshot was captured and clear
+		// the snapshot. Returns false if there was nothing to restore or an actor's state could not
+		// be read back. 'OutNumDestroyed' is the number of actors spawned since the capture.
+		bool Restore(SceneNode& Root, uint32_t& OutNumDestroyed);
+		void Clear();
+
+		inline bool IsEmpty() const { return m_Nodes.empty(); }
+		inline size_t GetSizeInBytes() const { return m_Data.size(); }
+
+	private:
+		void CaptureSubtree(SceneNode& Node);
+
+	private:
+		// Every node below the root at capture time, depth first.
+		std::vector<SceneNode*> m_Nodes;
+		// Children of the root followed by the children of each node in m_Nodes, in order.
+		std::vector<SceneNode*> m_Children;
+		// Number of children the root and each node in m_Nodes had.
+		std::vector<uint32_t> m_NumChildren;
+		// Offset one past the end of each node's record in m_Data.
+		std::vector<uint32_t> m_RecordEnds;
+		std::vector<uint8_t> m_Data;
+	};
+
+}
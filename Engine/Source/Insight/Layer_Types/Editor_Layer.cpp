@@ -14,6 +14,7 @@
 #include "Insight/Core/Application.h"
 #include "Insight/Core/Scene/Scene_Node.h"
 #include "Insight/Core/Scene/Scene.h"
+#include "Insight/Systems/File_System.h"
 
 #include "Insight/Input/Input.h"
 #include "imgui.h"
@@ -54,6 +55,21 @@ namespace Insight {
 		RenderSceneHeirarchy();
 		RenderInspector();
 		RenderCreatorWindow();
+		RenderSaveProgress();
+		MemoryTracker::OnImGuiRender();
+	}
+
+	void EditorLayer::RenderSaveProgress()
+	{
+		if (!FileSystem::IsSaveInProgress()) {
+			return;
+		}
+
+		ImGui::Begin("Saving Scene", nullptr, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_AlwaysAutoResize);
+		{
+			ImGui::ProgressBar(FileSystem::GetSaveProgress(), ImVec2(250.0f, 0.0f));
+		}
+		ImGui::End();
 	}
 
 	void EditorLayer::RenderSceneHeirarchy()
@@ -76,6 +92,12 @@ namespace Insight {
 
 				RenderSelectionGizmo();
 				m_pSelectedActor->OnImGuiRender();
+
+				// Any edit made through the details panel dirties the actor's save chunk.
+				// The actor may have deleted itself, deletions are picked up by the save.
+				if (m_pSelectedActor != nullptr && ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && ImGui::IsAnyItemActive()) {
+					m_pSelectedActor->MarkSaveDirty();
+				}
 			}
 		}
 		ImGui::End();
@@ -108,6 +130,10 @@ namespace Insight {
 		//TODO if(Raycast::LastRayCast::Succeeded) than run this line if false than skip it (disbles the guizmo)
 		ImGuizmo::Manipulate(*viewMat.m, *projMat.m, mCurrentGizmoOperation, mCurrentGizmoMode, *objectMat.m, *deltaMat.m, NULL, NULL, NULL);
 
+		if (ImGuizmo::IsUsing()) {
+			m_pSelectedActor->MarkSaveDirty();
+		}
+
 		if (ImGuizmo::IsOver())
 		{
 			float pos[3] = { 0.0f, 0.0f, 0.0f };
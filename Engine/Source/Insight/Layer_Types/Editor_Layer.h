@@ -35,6 +35,7 @@ namespace Insight {
 		void RenderInspector();
 		void RenderSelectionGizmo();
 		void RenderCreatorWindow();
+		void RenderSaveProgress();
 	private:
 		AActor*		m_pSelectedActor = nullptr;
 		SceneNode*	m_pSceneRootRef = nullptr;
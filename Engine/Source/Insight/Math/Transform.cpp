@@ -1,7 +1,6 @@
 #include <ie_pch.h>
 
 #include "Transform.h"
-#include "Insight/Core/Application.h"
 
 namespace Insight {
 
@@ -66,11 +65,11 @@ namespace Insight {
 		return *this;
 	}
 
-	void ieTransform::EditorEndPlay()
+	void ieTransform::SetPositionRotationScale(const ieVector3& Position, const ieVector3& Rotation, const ieVector3& Scale)
 	{
-		m_Position = m_EditorPlayOriginPosition;
-		m_Rotation = m_EditorPlayOriginRotation;
-		m_Scale = m_EditorPlayOriginScale;
+		m_Position = Position;
+		m_Rotation = Rotation;
+		m_Scale = Scale;
 
 		UpdateIfTransformed(true);
 	}
@@ -153,14 +152,13 @@ namespace Insight {
 
 	void ieTransform::UpdateIfTransformed(bool ForceUpdate)
 	{
-		if ((m_Transformed && !Application::Get().IsPlaySessionUnderWay()) || ForceUpdate)
+		if (m_Transformed || ForceUpdate)
 		{
 			TranslateLocalMatrix();
 			ScaleLocalMatrix();
 			RotateLocalMatrix();
 
 			UpdateLocalMatrix();
-			UpdateEditorOriginPositionRotationScale();
 
 			m_Transformed = false;
 		}
@@ -205,11 +203,4 @@ namespace Insight {
 		m_LocalDown = XMVector3TransformCoord(Vector3::Down, m_RotationMat);
 	}
 
-	void ieTransform::UpdateEditorOriginPositionRotationScale()
-	{
-		m_EditorPlayOriginPosition = m_Position;
-		m_EditorPlayOriginRotation = m_Rotation;
-		m_EditorPlayOriginScale = m_Scale;
-	}
-
 }
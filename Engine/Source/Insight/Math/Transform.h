@@ -19,9 +19,6 @@ namespace Insight {
 
 		ieTransform& operator = (const ieTransform& transform);
 
-		void EditorEndPlay();
-		void EditorInit() { UpdateEditorOriginPositionRotationScale(); }
-
 		inline const ieVector3& GetPosition()		const { return m_Position; }
 		inline const ieVector3& GetRotation()		const { return m_Rotation; }
 		inline const ieVector3& GetScale()		const { return m_Scale; }
@@ -37,6 +34,8 @@ namespace Insight {
 		inline void SetPosition(const ieVector3& vector)	{ m_Position = vector; TranslateLocalMatrix(); UpdateLocalMatrix(); }
 		inline void SetRotation(const ieVector3& vector)	{ m_Rotation = vector; RotateLocalMatrix(); UpdateLocalMatrix(); }
 		inline void SetScale(const ieVector3& vector)		{ m_Scale = vector; ScaleLocalMatrix(); UpdateLocalMatrix(); }
+		// Set all three and rebuild the local matrix once.
+		void SetPositionRotationScale(const ieVector3& Position, const ieVector3& Rotation, const ieVector3& Scale);
 
 		inline const ieVector3& GetLocalForward()		const { return m_LocalForward; }
 		inline const ieVector3& GetLocalBackward()	const { return m_LocalBackward; }
@@ -86,7 +85,6 @@ namespace Insight {
 		// DO NOT CALL UNLESS YOU KNOW WHAT YOU'RE DOING
 		void UpdateLocalDirectionVectors();
 
-		void UpdateEditorOriginPositionRotationScale();
 	protected:
 
 		bool m_Transformed = false;
@@ -111,10 +109,6 @@ namespace Insight {
 		ieVector3 m_Rotation = m_Rotation.Zero;
 		ieVector3 m_Scale = m_Scale.One;
 		
-		ieVector3 m_EditorPlayOriginPosition = m_Position;
-		ieVector3 m_EditorPlayOriginRotation = m_Rotation;
-		ieVector3 m_EditorPlayOriginScale = m_Scale;
-		
 		ieVector3 m_LocalForward = m_LocalForward.Forward;
 		ieVector3 m_LocalBackward = m_LocalBackward.Backward;
 		ieVector3 m_LocalLeft = m_LocalLeft.Left;
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <Insight/Core.h>
+#if defined IE_PLATFORM_WINDOWS
 #include <DirectXMath.h>
+#endif
 
 namespace Insight {
 
@@ -17,6 +19,23 @@ namespace Insight {
 		using ieFloat2x2 = glm::mat2x2;
 		using ieFloat3x3 = glm::mat3x3;
 		using ieFloat4x4 = glm::mat4x4;
+#else
+		// Engine sources built outside the engine, see 'PortableEngineFiles' in premake5.lua.
+		// Laid out like XMFLOAT4X4, so the same code reads it on every platform.
+		struct ieFloat4x4
+		{
+			union
+			{
+				struct
+				{
+					float _11, _12, _13, _14;
+					float _21, _22, _23, _24;
+					float _31, _32, _33, _34;
+					float _41, _42, _43, _44;
+				};
+				float m[4][4];
+			};
+		};
 #endif
 	}
 
@@ -1,77 +1,12 @@
 #pragma once
 
 #include <Insight/Core.h>
+
+#include "Insight/Math/ie_Float_Vectors.h"
 #include <DirectX12/TK/Inc/SimpleMath.h>
 
 namespace Insight {
 
-	namespace Math {
-		
-		/*
-			Lightweight platform independent vector library.
-			Meant to serve as shader resources for a graphics API,
-			avoid using for general math operations.
-		*/
-
-		// Vector 2 with two 32-bit floating point components
-		struct ieFloat2
-		{
-			float x;
-			float y;
-
-			ieFloat2() = default;
-
-			ieFloat2(const ieFloat2&) = default;
-			ieFloat2& operator=(const ieFloat2&) = default;
-
-			ieFloat2(ieFloat2&&) = default;
-			ieFloat2& operator=(ieFloat2&&) = default;
-
-			constexpr ieFloat2(float _X, float _Y)
-				: x(_X), y(_Y) {}
-		};
-
-		// Vector 3 with three 32-bit floating point components
-		struct ieFloat3
-		{
-			float x;
-			float y;
-			float z;
-
-			ieFloat3() = default;
-
-			ieFloat3(const ieFloat3&) = default;
-			ieFloat3& operator=(const ieFloat3&) = default;
-
-			ieFloat3(ieFloat3&&) = default;
-			ieFloat3& operator=(ieFloat3&&) = default;
-
-			constexpr ieFloat3(float _X, float _Y, float _Z)
-				: x(_X), y(_Y), z(_Z) {}
-		};
-
-		// Vector 4 with four 32-bit floating point components
-		struct ieFloat4
-		{
-			float x;
-			float y;
-			float z;
-			float w;
-
-			ieFloat4() = default;
-
-			ieFloat4(const ieFloat4&) = default;
-			ieFloat4& operator=(const ieFloat4&) = default;
-
-			ieFloat4(ieFloat4&&) = default;
-			ieFloat4& operator=(ieFloat4&&) = default;
-
-			constexpr ieFloat4(float _X, float _Y, float _Z, float _W)
-				: x(_X), y(_Y), z(_Z), w(_W) {}
-		};
-
-	} // End namespace Math
-
 	namespace Math {
 
 		/*
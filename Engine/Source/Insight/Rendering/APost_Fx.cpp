@@ -8,6 +8,7 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(APostFx, "PostFxVolume");
 
 
 
@@ -25,34 +26,86 @@ namespace Insight {
 	{
 		AActor::LoadFromJson(JsonPostFx);
 
-		bool vnEnabled, caEnabled, fgEnabled;
-
+		// The vignette, film grain and chromatic aberration groups use distinct keys, so
+		// reading each of them into the same record fills it in.
+		CookedPostFx Properties = GetProperties();
 		const rapidjson::Value& postFx = JsonPostFx["PostFx"];
+		for (rapidjson::SizeType i = 0; i < postFx.Size(); ++i) {
+			Reflection::ReadJson(postFx[i], Properties);
+		}
+		SetProperties(Properties);
 
-		const rapidjson::Value& vignette = postFx[0];
-		json::get_float(vignette, "vnInnerRadius", m_TempInnerRadius);
-		json::get_float(vignette, "vnOuterRadius", m_TempOuterRadius);
-		json::get_float(vignette, "vnOpacity", m_ShaderCB.vnOpacity);
-		json::get_bool(vignette, "vnEnabled", vnEnabled);
+		return true;
+	}
 
-		const rapidjson::Value& filmGrain = postFx[1];
-		json::get_float(filmGrain, "fgStrength", m_ShaderCB.fgStrength);
-		json::get_bool(filmGrain, "fgEnabled", fgEnabled);
+	bool APostFx::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		AActor::LoadFromCooked(Scene, Actor);
+
+		const CookedPostFx* pCooked = Scene.GetPayload<CookedPostFx>(Actor);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked post-fx volume \"{0}\" has an invalid payload.", SceneNode::GetDisplayName());
+			return false;
+		}
+		SetProperties(*pCooked);
+
+		return true;
+	}
+
+	bool APostFx::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		AActor::BeginCookedActor(Builder, HashTypeName("PostFxVolume"));
+		Builder.SetActorPayload(GetProperties());
+		Builder.EndActor();
+		return true;
+	}
 
-		const rapidjson::Value& chromAb = postFx[2];
-		json::get_float(chromAb, "caIntensity", m_ShaderCB.caIntensity);
-		json::get_bool(chromAb, "caEnabled", caEnabled);
+	CookedPostFx APostFx::GetProperties() const
+	{
+		CookedPostFx Properties = {};
+		Properties.VignetteInnerRadius = m_ShaderCB.vnInnerRadius;
+		Properties.VignetteOuterRadius = m_ShaderCB.vnOuterRadius;
+		Properties.VignetteOpacity = m_ShaderCB.vnOpacity;
+		Properties.VignetteEnabled = m_ShaderCB.vnEnabled ? 1U : 0U;
+		Properties.FilmGrainStrength = m_ShaderCB.fgStrength;
+		Properties.FilmGrainEnabled = m_ShaderCB.fgEnabled ? 1U : 0U;
+		Properties.ChromaticAberrationIntensity = m_ShaderCB.caIntensity;
+		Properties.ChromaticAberrationEnabled = m_ShaderCB.caEnabled ? 1U : 0U;
+		return Properties;
+	}
 
-		m_ShaderCB.vnEnabled = static_cast<int>(vnEnabled);
-		m_ShaderCB.fgEnabled = static_cast<int>(fgEnabled);
-		m_ShaderCB.caEnabled = static_cast<int>(caEnabled);
+	void APostFx::SetProperties(const CookedPostFx& Properties)
+	{
+		m_TempInnerRadius = Properties.VignetteInnerRadius;
+		m_TempOuterRadius = Properties.VignetteOuterRadius;
+		m_ShaderCB.vnOpacity = Properties.VignetteOpacity;
+		m_ShaderCB.fgStrength = Properties.FilmGrainStrength;
+		m_ShaderCB.caIntensity = Properties.ChromaticAberrationIntensity;
+
+		m_ShaderCB.vnEnabled = static_cast<int>(Properties.VignetteEnabled != 0U);
+		m_ShaderCB.fgEnabled = static_cast<int>(Properties.FilmGrainEnabled != 0U);
+		m_ShaderCB.caEnabled = static_cast<int>(Properties.ChromaticAberrationEnabled != 0U);
 		m_ShaderCB.vnInnerRadius = m_TempInnerRadius;
 		m_ShaderCB.vnOuterRadius = m_TempOuterRadius;
-		
-		return true;
 	}
 
-	bool APostFx::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	void APostFx::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		AActor::WriteToSnapshot(Snapshot);
+		Reflection::WriteBinary(m_ShaderCB, Snapshot);
+		Reflection::WriteBinary(m_TempInnerRadius, Snapshot);
+		Reflection::WriteBinary(m_TempOuterRadius, Snapshot);
+	}
+
+	bool APostFx::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		return AActor::ReadFromSnapshot(pData, pEnd)
+			&& Reflection::ReadBinary(m_ShaderCB, pData, pEnd)
+			&& Reflection::ReadBinary(m_TempInnerRadius, pData, pEnd)
+			&& Reflection::ReadBinary(m_TempOuterRadius, pData, pEnd);
+	}
+
+	bool APostFx::WriteToJson(JsonRecordWriter& Writer)
 	{
 		// TODO this work should be done in the base Actor class
 
@@ -65,39 +118,7 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			AActor::WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			// Post-Fx Volume Attributes
 			Writer.Key("PostFx");
@@ -14,7 +14,11 @@ namespace Insight {
 		virtual ~APostFx();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonPostFx) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot) override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		virtual bool OnInit();
 		virtual bool OnPostInit();
@@ -33,6 +37,10 @@ namespace Insight {
 
 		CB_PS_PostFx GetConstantBuffer() { return m_ShaderCB; }
 
+	private:
+		CookedPostFx GetProperties() const;
+		void SetProperties(const CookedPostFx& Properties);
+
 	private:
 		CB_PS_PostFx m_ShaderCB;
 		float m_TempInnerRadius = 0.1f;
@@ -13,6 +13,7 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(ASkyLight, "SkyLight");
 
 
 	ASkyLight::ASkyLight(ActorId id, ActorType type)
@@ -33,27 +34,56 @@ namespace Insight {
 		json::get_string(sky[0], "Irradiance", irMap);
 		json::get_string(sky[0], "Environment", envMap);
 
+		CreateTextures(brdfLUT, irMap, envMap);
 
+		return true;
+	}
+
+	bool ASkyLight::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		const CookedSkyLight* pCooked = Scene.GetPayload<CookedSkyLight>(Actor);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked sky light \"{0}\" has an invalid payload.", SceneNode::GetDisplayName());
+			return false;
+		}
+
+		CreateTextures(Scene.GetString(pCooked->BrdfLUT), Scene.GetString(pCooked->Irradiance), Scene.GetString(pCooked->Environment));
+
+		return true;
+	}
+
+	bool ASkyLight::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		CookedSkyLight Cooked = {};
+		Cooked.BrdfLUT = Builder.AddString(m_BrdfLUT->GetAssetDirectoryRelPath().GetView());
+		Cooked.Irradiance = Builder.AddString(m_Irradiance->GetAssetDirectoryRelPath().GetView());
+		Cooked.Environment = Builder.AddString(m_Environment->GetAssetDirectoryRelPath().GetView());
+
+		AActor::BeginCookedActor(Builder, HashTypeName("SkyLight"));
+		Builder.SetActorPayload(Cooked);
+		Builder.EndActor();
+		return true;
+	}
+
+	void ASkyLight::CreateTextures(const std::string& brdfLUT, const std::string& irMap, const std::string& envMap)
+	{
 		Direct3D12Context* graphicsContext = reinterpret_cast<Direct3D12Context*>(&Renderer::Get());
 		CDescriptorHeapWrapper& cbvSrvheap = graphicsContext->GetCBVSRVDescriptorHeap();
 
 		Texture::IE_TEXTURE_INFO brdfInfo;
-		brdfInfo.Filepath = StringHelper::StringToWide(FileSystem::GetProjectRelativeAssetDirectory(brdfLUT));
-		brdfInfo.AssetDirectoryRelPath = brdfLUT;
+		brdfInfo.Filepath = brdfLUT;
 		brdfInfo.Type = Texture::eTextureType::SKY_BRDF_LUT;
 		brdfInfo.IsCubeMap = true;
 		brdfInfo.GenerateMipMaps = false;
 
 		Texture::IE_TEXTURE_INFO irMapInfo;
-		irMapInfo.Filepath = StringHelper::StringToWide(FileSystem::GetProjectRelativeAssetDirectory(irMap));
-		irMapInfo.AssetDirectoryRelPath = irMap;
+		irMapInfo.Filepath = irMap;
 		irMapInfo.Type = Texture::eTextureType::SKY_IRRADIENCE;
 		irMapInfo.IsCubeMap = true;
 		brdfInfo.GenerateMipMaps = false;
 
 		Texture::IE_TEXTURE_INFO envMapInfo;
-		envMapInfo.Filepath = StringHelper::StringToWide(FileSystem::GetProjectRelativeAssetDirectory(envMap));
-		envMapInfo.AssetDirectoryRelPath = envMap;
+		envMapInfo.Filepath = envMap;
 		envMapInfo.Type = Texture::eTextureType::SKY_ENVIRONMENT_MAP;
 		envMapInfo.IsCubeMap = true;
 		brdfInfo.GenerateMipMaps = false;
@@ -77,11 +107,9 @@ namespace Insight {
 			break;
 		}
 		}
-
-		return true;
 	}
 
-	bool ASkyLight::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool ASkyLight::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.StartObject(); // Start Write Actor
 		{
@@ -92,39 +120,7 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			AActor::WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			// Sky Attributes
 			Writer.Key("Sky");
@@ -15,7 +15,9 @@ namespace Insight {
 		virtual ~ASkyLight();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonSkyLight) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
 
 		virtual bool OnInit();
 		virtual bool OnPostInit();
@@ -36,6 +38,9 @@ namespace Insight {
 
 		/*CB_PS_SpotLight GetConstantBuffer() { return m_ShaderCB; }*/
 
+	private:
+		void CreateTextures(const std::string& brdfLUT, const std::string& irMap, const std::string& envMap);
+
 	private:
 		Texture* m_Irradiance;
 		Texture* m_Environment;
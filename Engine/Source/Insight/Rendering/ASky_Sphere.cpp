@@ -13,6 +13,7 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(ASkySphere, "SkySphere");
 
 
 	ASkySphere::ASkySphere(ActorId id, ActorType type)
@@ -33,11 +34,39 @@ namespace Insight {
 		const rapidjson::Value& sky = jsonSkySphere["Sky"];
 		json::get_string(sky[0], "Diffuse", diffuseMap);
 
-		
+		CreateTextures(diffuseMap);
+
+		return true;
+	}
+
+	bool ASkySphere::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		const CookedSkySphere* pCooked = Scene.GetPayload<CookedSkySphere>(Actor);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked sky sphere \"{0}\" has an invalid payload.", SceneNode::GetDisplayName());
+			return false;
+		}
+
+		CreateTextures(Scene.GetString(pCooked->Diffuse));
+
+		return true;
+	}
+
+	bool ASkySphere::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		CookedSkySphere Cooked = {};
+		Cooked.Diffuse = Builder.AddString(m_Diffuse->GetAssetDirectoryRelPath().GetView());
 
+		AActor::BeginCookedActor(Builder, HashTypeName("SkySphere"));
+		Builder.SetActorPayload(Cooked);
+		Builder.EndActor();
+		return true;
+	}
+
+	void ASkySphere::CreateTextures(const std::string& diffuseMap)
+	{
 		Texture::IE_TEXTURE_INFO diffuseInfo;
-		diffuseInfo.Filepath = StringHelper::StringToWide(FileSystem::GetProjectRelativeAssetDirectory(diffuseMap));
-		diffuseInfo.AssetDirectoryRelPath = diffuseMap;
+		diffuseInfo.Filepath = diffuseMap;
 		diffuseInfo.Type = Texture::eTextureType::SKY_DIFFUSE;
 		diffuseInfo.GenerateMipMaps = true;
 		diffuseInfo.IsCubeMap = true;
@@ -57,11 +86,9 @@ namespace Insight {
 			break;
 		}	
 		}
-
-		return true;
 	}
 
-	bool ASkySphere::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool ASkySphere::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.StartObject(); // Start Write Actor
 		{
@@ -72,39 +99,7 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			AActor::WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			// Sky Attributes
 			Writer.Key("Sky");
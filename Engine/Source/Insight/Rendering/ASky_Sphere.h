@@ -15,7 +15,9 @@ namespace Insight {
 		virtual ~ASkySphere();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonSkySphere) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
 		
 		virtual bool OnInit();
 		virtual bool OnPostInit();
@@ -35,6 +37,9 @@ namespace Insight {
 
 		virtual void OnImGuiRender() override;
 
+	private:
+		void CreateTextures(const std::string& diffuseMap);
+
 	private:
 		Texture* m_Diffuse;
 
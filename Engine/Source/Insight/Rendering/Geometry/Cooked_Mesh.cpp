@@ -0,0 +1,383 @@
+#include <ie_pch.h>
+
+#include "Cooked_Mesh.h"
+
+#include "Insight/Rendering/Geometry/Imported_Model.h"
+#include "Insight/Rendering/Geometry/Model_Asset.h"
+#include "Insight/Rendering/Geometry/Meshopt_Codec.h"
+#include "Insight/Systems/File_System.h"
+#include "Insight/Systems/Mapped_File.h"
+#include "Insight/Systems/Thread_Pool.h"
+
+// Models with fewer vertices than this encode and decode their meshes on the calling thread, see IE_MODEL_PARALLEL_VERTEX_THRESHOLD.
+#define IE_COOKED_MESH_PARALLEL_VERTEX_THRESHOLD 65536U
+
+namespace Insight {
+
+	static_assert(sizeof(CookedMeshHeader) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(CookedMeshRange) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(CookedMeshNode) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(Vertex3D) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(std::is_trivially_copyable_v<Vertex3D>, "Cooked vertices are copied as raw bytes.");
+	static_assert(sizeof(Indices::value_type) == sizeof(uint32_t), "Cooked indices are stored as 32-bit values.");
+
+	static inline uint32_t AlignUp4(uint32_t Value) { return (Value + 3U) & ~3U; }
+
+	struct EncodedMesh
+	{
+		std::vector<uint8_t> VertexData;
+		std::vector<uint8_t> IndexData;
+		bool IsEncoded = false;
+	};
+
+	// Compresses the mesh's streams. Returns false if the mesh should be stored raw because it did not get smaller.
+	// The codec's round trip is covered by Tools/Engine_Tests.
+	static bool EncodeMesh(const ImportedMesh& Mesh, EncodedMesh& OutEncoded)
+	{
+		const size_t NumVertices = Mesh.MeshVerticies.size();
+		const size_t NumIndices = Mesh.MeshIndices.size();
+		if (!MeshoptCodec::EncodeVertexBuffer(OutEncoded.VertexData, Mesh.MeshVerticies.data(), NumVertices, sizeof(Vertex3D))
+			|| !MeshoptCodec::EncodeIndexBuffer(OutEncoded.IndexData, Mesh.MeshIndices.data(), NumIndices, sizeof(uint32_t))) {
+			return false;
+		}
+		if (OutEncoded.VertexData.size() + OutEncoded.IndexData.size() >= NumVertices * sizeof(Vertex3D) + NumIndices * sizeof(uint32_t)) {
+			return false;
+		}
+		return true;
+	}
+
+	std::string CookedMesh::GetCookedPath(const std::string& SourcePath)
+	{
+		return SourcePath + IE_COOKED_MESH_EXTENSION;
+	}
+
+	bool CookedMesh::IsUpToDate(const std::string& SourcePath, const std::string& CookedPath)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA CookedAttributes;
+		if (!GetFileAttributesExA(CookedPath.c_str(), GetFileExInfoStandard, &CookedAttributes)) {
+			return false;
+		}
+		WIN32_FILE_ATTRIBUTE_DATA SourceAttributes;
+		if (!GetFileAttributesExA(SourcePath.c_str(), GetFileExInfoStandard, &SourceAttributes)) {
+			// Shipped builds may only carry the cooked file.
+			return true;
+		}
+		return CompareFileTime(&SourceAttributes.ftLastWriteTime, &CookedAttributes.ftLastWriteTime) <= 0;
+	}
+
+	bool CookedMesh::Write(const ImportedModel& Import, uint32_t ImportFlags, uint32_t AssetFlags, const std::string& Filepath)
+	{
+		Profiling::ScopedTimer timer("CookedMesh::Write");
+
+		size_t NumVertices = 0U;
+		for (const ImportedMesh& Mesh : Import.Meshes) {
+			NumVertices += Mesh.MeshVerticies.size();
+		}
+		std::vector<EncodedMesh> Encoded(Import.Meshes.size());
+		if (AssetFlags & IE_MODEL_ASSET_COMPRESS_GEOMETRY) {
+			auto Encode = [&Import, &Encoded, &Filepath](uint32_t i) {
+				Encoded[i].IsEncoded = EncodeMesh(Import.Meshes[i], Encoded[i]);
+				if (!Encoded[i].IsEncoded) {
+					IE_CORE_TRACE("Mesh {0} of \"{1}\" is stored uncompressed.", i, Filepath);
+				}
+			};
+			if (NumVertices >= IE_COOKED_MESH_PARALLEL_VERTEX_THRESHOLD) {
+				ThreadPool::ParallelFor(static_cast<uint32_t>(Import.Meshes.size()), Encode);
+			}
+			else {
+				for (uint32_t i = 0; i < Import.Meshes.size(); ++i) {
+					Encode(i);
+				}
+			}
+		}
+
+		// Each mesh's data starts 4 byte aligned so raw streams can be read in place.
+		std::vector<CookedMeshRange> Ranges;
+		Ranges.reserve(Import.Meshes.size());
+		uint32_t VertexDataSize = 0U;
+		uint32_t IndexDataSize = 0U;
+		uint32_t NumMeshlets = 0U;
+		uint64_t RawSize = 0U;
+		for (size_t i = 0; i < Import.Meshes.size(); ++i) {
+			const ImportedMesh& Mesh = Import.Meshes[i];
+			CookedMeshRange Range = {};
+			Range.NumVertices = static_cast<uint32_t>(Mesh.MeshVerticies.size());
+			Range.NumIndices = static_cast<uint32_t>(Mesh.MeshIndices.size());
+			Range.MaterialIndex = Mesh.MaterialIndex;
+			Range.FirstMeshlet = NumMeshlets;
+			Range.NumMeshlets = static_cast<uint32_t>(Mesh.Meshlets.size());
+			Range.Encoding = static_cast<uint32_t>(Encoded[i].IsEncoded ? eCookedStreamEncoding::Meshopt : eCookedStreamEncoding::Raw);
+			Range.VertexDataOffset = VertexDataSize;
+			Range.VertexDataSize = static_cast<uint32_t>(Encoded[i].IsEncoded ? Encoded[i].VertexData.size() : Mesh.MeshVerticies.size() * sizeof(Vertex3D));
+			Range.IndexDataOffset = IndexDataSize;
+			Range.IndexDataSize = static_cast<uint32_t>(Encoded[i].IsEncoded ? Encoded[i].IndexData.size() : Mesh.MeshIndices.size() * sizeof(uint32_t));
+			Ranges.push_back(Range);
+			VertexDataSize += AlignUp4(Range.VertexDataSize);
+			IndexDataSize += AlignUp4(Range.IndexDataSize);
+			NumMeshlets += Range.NumMeshlets;
+			RawSize += Mesh.MeshVerticies.size() * sizeof(Vertex3D) + Mesh.MeshIndices.size() * sizeof(uint32_t);
+		}
+
+		// Flatten the hierarchy breadth first, each node's children are placed together
+		// when the node itself is visited.
+		std::vector<CookedMeshNode> Nodes;
+		std::vector<uint32_t> NodeMeshes;
+		std::string Strings(1, '\0');
+		std::vector<const ImportedNode*> Queue;
+		if (Import.pRoot) {
+			Queue.push_back(Import.pRoot.get());
+			Nodes.emplace_back();
+		}
+		for (size_t i = 0; i < Queue.size(); ++i) {
+			const ImportedNode& Node = *Queue[i];
+			CookedMeshNode& Cooked = Nodes[i];
+			Cooked.Name = 0U;
+			if (!Node.Name.empty()) {
+				Cooked.Name = static_cast<CookedString>(Strings.size());
+				Strings.append(Node.Name);
+				Strings.push_back('\0');
+			}
+			memcpy(Cooked.LocalMatrix, &Node.LocalMatrix, sizeof(Cooked.LocalMatrix));
+			Cooked.FirstMesh = static_cast<uint32_t>(NodeMeshes.size());
+			Cooked.NumMeshes = static_cast<uint32_t>(Node.MeshIndices.size());
+			NodeMeshes.insert(NodeMeshes.end(), Node.MeshIndices.begin(), Node.MeshIndices.end());
+			Cooked.FirstChild = static_cast<uint32_t>(Queue.size());
+			Cooked.NumChildren = static_cast<uint32_t>(Node.Children.size());
+			for (const unique_ptr<ImportedNode>& pChild : Node.Children) {
+				Queue.push_back(pChild.get());
+			}
+			// May reallocate, 'Cooked' is not used past this point.
+			Nodes.resize(Queue.size());
+		}
+
+		CookedMeshHeader Header = {};
+		Header.Magic = IE_COOKED_MESH_MAGIC;
+		Header.Version = IE_COOKED_MESH_VERSION;
+		Header.ImportFlags = ImportFlags;
+		Header.AssetFlags = AssetFlags & IE_MODEL_ASSET_COOKED_FLAGS;
+		Header.VertexStride = sizeof(Vertex3D);
+
+		uint32_t Offset = sizeof(CookedMeshHeader);
+		auto PlaceTable = [&Offset](CookedTable& Table, uint32_t Count, uint32_t Stride) {
+			Table.Offset = Offset;
+			Table.Count = Count;
+			Offset += AlignUp4(Count * Stride);
+		};
+		PlaceTable(Header.Meshes, (uint32_t)Ranges.size(), sizeof(CookedMeshRange));
+		PlaceTable(Header.Nodes, (uint32_t)Nodes.size(), sizeof(CookedMeshNode));
+		PlaceTable(Header.NodeMeshes, (uint32_t)NodeMeshes.size(), sizeof(uint32_t));
+		PlaceTable(Header.VertexData, VertexDataSize, 1U);
+		PlaceTable(Header.IndexData, IndexDataSize, 1U);
+		PlaceTable(Header.Meshlets, NumMeshlets, sizeof(Meshlet));
+		PlaceTable(Header.Strings, (uint32_t)Strings.size(), 1U);
+		Header.FileSize = Offset;
+
+		std::vector<uint8_t> Bytes(Header.FileSize, 0U);
+		auto CopyTable = [&Bytes](uint32_t TableOffset, const void* pData, size_t Size) {
+			if (Size > 0U) {
+				memcpy(Bytes.data() + TableOffset, pData, Size);
+			}
+		};
+		memcpy(Bytes.data(), &Header, sizeof(CookedMeshHeader));
+		CopyTable(Header.Meshes.Offset, Ranges.data(), Ranges.size() * sizeof(CookedMeshRange));
+		CopyTable(Header.Nodes.Offset, Nodes.data(), Nodes.size() * sizeof(CookedMeshNode));
+		CopyTable(Header.NodeMeshes.Offset, NodeMeshes.data(), NodeMeshes.size() * sizeof(uint32_t));
+		for (size_t i = 0; i < Import.Meshes.size(); ++i) {
+			const ImportedMesh& Mesh = Import.Meshes[i];
+			const CookedMeshRange& Range = Ranges[i];
+			if (Encoded[i].IsEncoded) {
+				CopyTable(Header.VertexData.Offset + Range.VertexDataOffset, Encoded[i].VertexData.data(), Range.VertexDataSize);
+				CopyTable(Header.IndexData.Offset + Range.IndexDataOffset, Encoded[i].IndexData.data(), Range.IndexDataSize);
+			}
+			else {
+				CopyTable(Header.VertexData.Offset + Range.VertexDataOffset, Mesh.MeshVerticies.data(), Range.VertexDataSize);
+				CopyTable(Header.IndexData.Offset + Range.IndexDataOffset, Mesh.MeshIndices.data(), Range.IndexDataSize);
+			}
+			CopyTable(Header.Meshlets.Offset + Ranges[i].FirstMeshlet * sizeof(Meshlet), Mesh.Meshlets.data(), Mesh.Meshlets.size() * sizeof(Meshlet));
+		}
+		CopyTable(Header.Strings.Offset, Strings.data(), Strings.size());
+
+		if (!FileSystem::WriteFileAtomic(Filepath, Bytes.data(), Bytes.size())) {
+			IE_CORE_WARN("Failed to write cooked mesh: {0}", Filepath);
+			return false;
+		}
+		if (AssetFlags & IE_MODEL_ASSET_COMPRESS_GEOMETRY) {
+			IE_CORE_TRACE("Cooked \"{0}\": vertex and index data compressed from {1} to {2} bytes.", Filepath, RawSize, VertexDataSize + IndexDataSize);
+		}
+		return true;
+	}
+
+	static unique_ptr<ImportedNode> ReadNode_r(const CookedMeshHeader& Header, const uint8_t* pData, uint32_t NodeIndex)
+	{
+		const CookedMeshNode& Cooked = reinterpret_cast<const CookedMeshNode*>(pData + Header.Nodes.Offset)[NodeIndex];
+		const uint32_t* pNodeMeshes = reinterpret_cast<const uint32_t*>(pData + Header.NodeMeshes.Offset);
+
+		auto pNode = std::make_unique<ImportedNode>();
+		memcpy(&pNode->LocalMatrix, Cooked.LocalMatrix, sizeof(Cooked.LocalMatrix));
+		pNode->Name = reinterpret_cast<const char*>(pData + Header.Strings.Offset + Cooked.Name);
+		pNode->MeshIndices.assign(pNodeMeshes + Cooked.FirstMesh, pNodeMeshes + Cooked.FirstMesh + Cooked.NumMeshes);
+		pNode->Children.reserve(Cooked.NumChildren);
+		for (uint32_t i = 0; i < Cooked.NumChildren; ++i) {
+			pNode->Children.push_back(ReadNode_r(Header, pData, Cooked.FirstChild + i));
+		}
+		return pNode;
+	}
+
+	static bool ValidateCookedMesh(const uint8_t* pData, size_t Size, uint32_t ImportFlags, uint32_t AssetFlags)
+	{
+		if (Size < sizeof(CookedMeshHeader)) {
+			return false;
+		}
+		const CookedMeshHeader& Header = *reinterpret_cast<const CookedMeshHeader*>(pData);
+		if (Header.Magic != IE_COOKED_MESH_MAGIC || Header.Version != IE_COOKED_MESH_VERSION || Header.FileSize != Size
+			|| Header.ImportFlags != ImportFlags || Header.AssetFlags != (AssetFlags & IE_MODEL_ASSET_COOKED_FLAGS) || Header.VertexStride != sizeof(Vertex3D)) {
+			return false;
+		}
+		auto IsTableInBounds = [Size](const CookedTable& Table, uint32_t Stride) {
+			return (Table.Offset % 4U) == 0U && (uint64_t)Table.Offset + (uint64_t)Table.Count * Stride <= Size;
+		};
+		if (!IsTableInBounds(Header.Meshes, sizeof(CookedMeshRange))
+			|| !IsTableInBounds(Header.Nodes, sizeof(CookedMeshNode))
+			|| !IsTableInBounds(Header.NodeMeshes, sizeof(uint32_t))
+			|| !IsTableInBounds(Header.VertexData, 1U)
+			|| !IsTableInBounds(Header.IndexData, 1U)
+			|| !IsTableInBounds(Header.Meshlets, sizeof(Meshlet))
+			|| !IsTableInBounds(Header.Strings, 1U)) {
+			return false;
+		}
+		if (Header.Nodes.Count == 0U || Header.Strings.Count == 0U || pData[Header.Strings.Offset + Header.Strings.Count - 1] != '\0') {
+			return false;
+		}
+
+		const CookedMeshRange* pRanges = reinterpret_cast<const CookedMeshRange*>(pData + Header.Meshes.Offset);
+		const Meshlet* pMeshlets = reinterpret_cast<const Meshlet*>(pData + Header.Meshlets.Offset);
+		for (uint32_t i = 0; i < Header.Meshes.Count; ++i) {
+			const CookedMeshRange& Range = pRanges[i];
+			if ((uint64_t)Range.VertexDataOffset + Range.VertexDataSize > Header.VertexData.Count
+				|| (uint64_t)Range.IndexDataOffset + Range.IndexDataSize > Header.IndexData.Count
+				|| (uint64_t)Range.FirstMeshlet + Range.NumMeshlets > Header.Meshlets.Count) {
+				return false;
+			}
+			if (Range.Encoding == static_cast<uint32_t>(eCookedStreamEncoding::Raw)) {
+				// Read in place.
+				if ((Range.VertexDataOffset % 4U) != 0U || (Range.IndexDataOffset % 4U) != 0U
+					|| (uint64_t)Range.NumVertices * sizeof(Vertex3D) != Range.VertexDataSize
+					|| (uint64_t)Range.NumIndices * sizeof(uint32_t) != Range.IndexDataSize) {
+					return false;
+				}
+			}
+			else if (Range.Encoding == static_cast<uint32_t>(eCookedStreamEncoding::Meshopt)) {
+				// The decoders check the data itself. Every 64 vertex bytes take at least a byte of group
+				// headers and every triangle a code byte, which bounds what a corrupt count can allocate.
+				if ((uint64_t)Range.NumVertices * sizeof(Vertex3D) > (uint64_t)Range.VertexDataSize * 64U
+					|| Range.NumIndices / 3U > Range.IndexDataSize) {
+					return false;
+				}
+			}
+			else {
+				return false;
+			}
+			// Meshlets are drawn as ranges of the mesh's index buffer.
+			for (uint32_t j = 0; j < pRanges[i].NumMeshlets; ++j) {
+				const Meshlet& Cluster = pMeshlets[pRanges[i].FirstMeshlet + j];
+				if ((uint64_t)Cluster.FirstIndex + Cluster.NumIndices > pRanges[i].NumIndices) {
+					return false;
+				}
+			}
+		}
+		const uint32_t* pNodeMeshes = reinterpret_cast<const uint32_t*>(pData + Header.NodeMeshes.Offset);
+		for (uint32_t i = 0; i < Header.NodeMeshes.Count; ++i) {
+			if (pNodeMeshes[i] >= Header.Meshes.Count) {
+				return false;
+			}
+		}
+		// Children always come after their parent, which also rules out cycles when the tree is rebuilt.
+		const CookedMeshNode* pNodes = reinterpret_cast<const CookedMeshNode*>(pData + Header.Nodes.Offset);
+		for (uint32_t i = 0; i < Header.Nodes.Count; ++i) {
+			if (pNodes[i].Name >= Header.Strings.Count
+				|| (uint64_t)pNodes[i].FirstMesh + pNodes[i].NumMeshes > Header.NodeMeshes.Count
+				|| (pNodes[i].NumChildren > 0U && pNodes[i].FirstChild <= i)
+				|| (uint64_t)pNodes[i].FirstChild + pNodes[i].NumChildren > Header.Nodes.Count) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	shared_ptr<ImportedModel> CookedMesh::Read(const std::string& Filepath, uint32_t ImportFlags, uint32_t AssetFlags)
+	{
+		Profiling::ScopedTimer timer("CookedMesh::Read");
+
+		MappedFile File;
+		if (!File.Open(Filepath)) {
+			return nullptr;
+		}
+		const uint8_t* pData = File.GetData();
+		if (!ValidateCookedMesh(pData, File.GetSize(), ImportFlags, AssetFlags)) {
+			return nullptr;
+		}
+		const CookedMeshHeader& Header = *reinterpret_cast<const CookedMeshHeader*>(pData);
+
+		const CookedMeshRange* pRanges = reinterpret_cast<const CookedMeshRange*>(pData + Header.Meshes.Offset);
+		const uint8_t* pVertexData = pData + Header.VertexData.Offset;
+		const uint8_t* pIndexData = pData + Header.IndexData.Offset;
+		const Meshlet* pMeshlets = reinterpret_cast<const Meshlet*>(pData + Header.Meshlets.Offset);
+		auto pImport = make_shared<ImportedModel>();
+		pImport->Meshes.resize(Header.Meshes.Count);
+
+		size_t NumVertices = 0U;
+		size_t CompressedSize = 0U;
+		size_t DecodedSize = 0U;
+		for (uint32_t i = 0; i < Header.Meshes.Count; ++i) {
+			NumVertices += pRanges[i].NumVertices;
+			if (pRanges[i].Encoding == static_cast<uint32_t>(eCookedStreamEncoding::Meshopt)) {
+				CompressedSize += pRanges[i].VertexDataSize + pRanges[i].IndexDataSize;
+				DecodedSize += pRanges[i].NumVertices * sizeof(Vertex3D) + pRanges[i].NumIndices * sizeof(uint32_t);
+			}
+		}
+
+		std::atomic<bool> Failed(false);
+		auto ReadMesh = [pRanges, pVertexData, pIndexData, pMeshlets, &pImport, &Failed](uint32_t i) {
+			const CookedMeshRange& Range = pRanges[i];
+			ImportedMesh& Mesh = pImport->Meshes[i];
+			Mesh.MaterialIndex = Range.MaterialIndex;
+			Mesh.Meshlets.assign(pMeshlets + Range.FirstMeshlet, pMeshlets + Range.FirstMeshlet + Range.NumMeshlets);
+			if (Range.Encoding == static_cast<uint32_t>(eCookedStreamEncoding::Raw)) {
+				// One bulk copy per stream, straight from the mapping into the vectors the buffers are created from.
+				const Vertex3D* pVertices = reinterpret_cast<const Vertex3D*>(pVertexData + Range.VertexDataOffset);
+				const uint32_t* pIndices = reinterpret_cast<const uint32_t*>(pIndexData + Range.IndexDataOffset);
+				Mesh.MeshVerticies.assign(pVertices, pVertices + Range.NumVertices);
+				Mesh.MeshIndices.assign(pIndices, pIndices + Range.NumIndices);
+				return;
+			}
+			// Compressed streams are decoded from the mapping into the vectors.
+			Mesh.MeshVerticies.resize(Range.NumVertices);
+			Mesh.MeshIndices.resize(Range.NumIndices);
+			if (!MeshoptCodec::DecodeVertexBuffer(Mesh.MeshVerticies.data(), Range.NumVertices, sizeof(Vertex3D), pVertexData + Range.VertexDataOffset, Range.VertexDataSize)
+				|| !MeshoptCodec::DecodeIndexBuffer(Mesh.MeshIndices.data(), Range.NumIndices, sizeof(uint32_t), pIndexData + Range.IndexDataOffset, Range.IndexDataSize)) {
+				Failed = true;
+			}
+		};
+		const auto DecodeStart = std::chrono::high_resolution_clock::now();
+		if (NumVertices >= IE_COOKED_MESH_PARALLEL_VERTEX_THRESHOLD) {
+			ThreadPool::ParallelFor(Header.Meshes.Count, ReadMesh);
+		}
+		else {
+			for (uint32_t i = 0; i < Header.Meshes.Count; ++i) {
+				ReadMesh(i);
+			}
+		}
+		if (Failed) {
+			IE_CORE_WARN("Failed to decode cooked mesh: {0}", Filepath);
+			return nullptr;
+		}
+		if (CompressedSize > 0U) {
+			const float DecodeMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - DecodeStart).count();
+			IE_CORE_TRACE("Decoded \"{0}\": {1} bytes to {2} in {3}ms.", Filepath, CompressedSize, DecodedSize, DecodeMs);
+		}
+
+		pImport->pRoot = ReadNode_r(Header, pData, 0U);
+		return pImport;
+	}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Systems/Cooked_Scene.h"
+
+/*
+	Cooked binary mesh format.
+
+	The first time a model is imported through Assimp its processed and optimized vertex and
+	index streams, node hierarchy and material assignments are written next to the source file
+	as "<Source>.iemesh". Later imports read that file instead and skip Assimp entirely.
+	The cooked file is rebuilt whenever it is missing, older than its source, or was
+	written with different import or asset flags or an older version of this format.
+	Flattened models are cooked flat, a single root node over the merged meshes.
+
+	Models cooked with IE_MODEL_ASSET_COMPRESS_GEOMETRY store each mesh's vertex and index
+	data as MeshoptCodec bitstreams, decoded on load. Vertices come back bit for bit,
+	indices as the same triangles in the same order, some starting at another corner.
+	Tools/Engine_Tests checks both codecs round trip, the cook does not decode them again.
+
+	File layout:
+		CookedMeshHeader
+		CookedMeshRange[]	One per mesh, byte ranges into the vertex and index data, indexes into the meshlets
+		CookedMeshNode[]	Hierarchy, breadth first so every node's children are contiguous
+		uint32_t[]		Mesh indices referenced by the nodes
+		Vertex data		Every mesh's vertices, Vertex3D[] or compressed, back to back
+		Index data		Every mesh's uint32_t indices relative to its first vertex, raw or compressed
+		Meshlet[]		Every mesh's meshlets, index ranges relative to the mesh's first index
+		String table		Null terminated UTF-8, referenced by CookedString offsets
+
+	Example usage:
+		if (CookedMesh::IsUpToDate(SourcePath, CookedMesh::GetCookedPath(SourcePath))) {
+			shared_ptr<ImportedModel> pImport = CookedMesh::Read(CookedMesh::GetCookedPath(SourcePath), ImportFlags, AssetFlags);
+		}
+*/
+
+#define IE_COOKED_MESH_EXTENSION ".iemesh"
+#define IE_COOKED_MESH_MAGIC 0x484D4549U // "IEMH"
+#define IE_COOKED_MESH_VERSION 5U
+
+namespace Insight {
+
+	struct ImportedModel;
+
+	struct CookedMeshHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t FileSize;
+		// Assimp post processing flags the streams were produced with.
+		uint32_t ImportFlags;
+		// IE_MODEL_ASSET_COOKED_FLAGS the streams were produced with.
+		uint32_t AssetFlags;
+		uint32_t VertexStride;
+		CookedTable Meshes;
+		CookedTable Nodes;
+		CookedTable NodeMeshes;
+		// Counts are in bytes.
+		CookedTable VertexData;
+		CookedTable IndexData;
+		CookedTable Meshlets;
+		// Count is in bytes.
+		CookedTable Strings;
+	};
+
+	enum class eCookedStreamEncoding : uint32_t
+	{
+		Raw,
+		// MeshoptCodec vertex and index buffer bitstreams.
+		Meshopt,
+	};
+
+	struct CookedMeshRange
+	{
+		uint32_t NumVertices;
+		uint32_t NumIndices;
+		uint32_t MaterialIndex;
+		uint32_t FirstMeshlet;
+		uint32_t NumMeshlets;
+		// eCookedStreamEncoding of both of the mesh's streams.
+		uint32_t Encoding;
+		// Byte ranges of the mesh's streams, relative to the start of the vertex and index data.
+		uint32_t VertexDataOffset;
+		uint32_t VertexDataSize;
+		uint32_t IndexDataOffset;
+		uint32_t IndexDataSize;
+	};
+
+	struct CookedMeshNode
+	{
+		CookedString Name;
+		// Row major, as stored in XMFLOAT4X4.
+		float LocalMatrix[16];
+		uint32_t FirstMesh;
+		uint32_t NumMeshes;
+		uint32_t FirstChild;
+		uint32_t NumChildren;
+	};
+
+	class INSIGHT_API CookedMesh
+	{
+	public:
+		// Path of the cooked copy of a source model, given the source's absolute path.
+		static std::string GetCookedPath(const std::string& SourcePath);
+		// True if the cooked file exists and is not older than its source.
+		static bool IsUpToDate(const std::string& SourcePath, const std::string& CookedPath);
+
+		// Write the import to disk. The file is written next to the target and renamed over it.
+		// Only the IE_MODEL_ASSET_COOKED_FLAGS of 'AssetFlags' are stored.
+		static bool Write(const ImportedModel& Import, uint32_t ImportFlags, uint32_t AssetFlags, const std::string& Filepath);
+		// Returns nullptr if the file is missing, corrupt or was cooked with different import or asset flags.
+		static shared_ptr<ImportedModel> Read(const std::string& Filepath, uint32_t ImportFlags, uint32_t AssetFlags);
+	};
+
+}
@@ -0,0 +1,1061 @@
+#include <ie_pch.h>
+
+#include "Gltf_Loader.h"
+
+#include "Insight/Rendering/Geometry/Imported_Model.h"
+#include "Insight/Rendering/Geometry/Meshopt_Codec.h"
+#include "Insight/Systems/Mapped_File.h"
+#include "Insight/Systems/Thread_Pool.h"
+#include "Insight/Utilities/String_Helper.h"
+
+#define IE_GLB_MAGIC 0x46546C67U // "glTF"
+#define IE_GLB_CHUNK_JSON 0x4E4F534AU // "JSON"
+#define IE_GLB_CHUNK_BIN 0x004E4942U // "BIN\0"
+
+// Files with fewer vertices than this convert their primitives on the importing thread, see IE_MODEL_PARALLEL_VERTEX_THRESHOLD.
+#define IE_GLTF_PARALLEL_VERTEX_THRESHOLD 65536U
+
+// Accessor component types.
+#define IE_GLTF_BYTE 5120U
+#define IE_GLTF_UNSIGNED_BYTE 5121U
+#define IE_GLTF_SHORT 5122U
+#define IE_GLTF_UNSIGNED_SHORT 5123U
+#define IE_GLTF_UNSIGNED_INT 5125U
+#define IE_GLTF_FLOAT 5126U
+
+// Primitive modes.
+#define IE_GLTF_TRIANGLES 4U
+#define IE_GLTF_TRIANGLE_STRIP 5U
+#define IE_GLTF_TRIANGLE_FAN 6U
+
+namespace Insight {
+
+	struct GltfSpan
+	{
+		const uint8_t* pData = nullptr;
+		size_t Size = 0U;
+	};
+
+	// Everything primitives are read from. Filled before any primitive is converted and
+	// only read afterwards, so primitives can be converted in parallel.
+	struct GltfFile
+	{
+		std::string Filepath;
+		uint32_t ImportFlags = 0U;
+		rapidjson::Document Json;
+		MappedFile File;
+		std::vector<unique_ptr<MappedFile>> ExternalFiles;
+		// Buffers decoded from base64 and buffer views decoded from meshopt streams.
+		std::vector<std::vector<uint8_t>> OwnedData;
+		std::vector<GltfSpan> Buffers;
+		std::vector<GltfSpan> Views;
+		std::vector<uint32_t> ViewStrides;
+	};
+
+	struct GltfAccessor
+	{
+		// Null if the accessor has no buffer view, every element is then zero before sparse values are applied.
+		const uint8_t* pData = nullptr;
+		size_t Count = 0U;
+		size_t Stride = 0U;
+		uint32_t ComponentType = 0U;
+		uint32_t NumComponents = 0U;
+		bool IsNormalized = false;
+		const rapidjson::Value* pSparse = nullptr;
+	};
+
+	static const rapidjson::Value* FindMember(const rapidjson::Value& Object, const char* Name)
+	{
+		if (!Object.IsObject()) {
+			return nullptr;
+		}
+		auto Iter = Object.FindMember(Name);
+		return (Iter != Object.MemberEnd()) ? &Iter->value : nullptr;
+	}
+
+	static const rapidjson::Value* FindArray(const rapidjson::Value& Object, const char* Name)
+	{
+		const rapidjson::Value* pValue = FindMember(Object, Name);
+		return (pValue && pValue->IsArray()) ? pValue : nullptr;
+	}
+
+	static const rapidjson::Value* FindObject(const rapidjson::Value& Object, const char* Name)
+	{
+		const rapidjson::Value* pValue = FindMember(Object, Name);
+		return (pValue && pValue->IsObject()) ? pValue : nullptr;
+	}
+
+	static const rapidjson::Value* FindExtension(const rapidjson::Value& Object, const char* Name)
+	{
+		const rapidjson::Value* pExtensions = FindObject(Object, "extensions");
+		return pExtensions ? FindObject(*pExtensions, Name) : nullptr;
+	}
+
+	static uint64_t GetUint(const rapidjson::Value& Object, const char* Name, uint64_t Default)
+	{
+		const rapidjson::Value* pValue = FindMember(Object, Name);
+		return (pValue && pValue->IsUint64()) ? pValue->GetUint64() : Default;
+	}
+
+	static float GetFloat(const rapidjson::Value& Object, const char* Name, float Default)
+	{
+		const rapidjson::Value* pValue = FindMember(Object, Name);
+		return (pValue && pValue->IsNumber()) ? static_cast<float>(pValue->GetDouble()) : Default;
+	}
+
+	static std::string GetString(const rapidjson::Value& Object, const char* Name)
+	{
+		const rapidjson::Value* pValue = FindMember(Object, Name);
+		return (pValue && pValue->IsString()) ? std::string(pValue->GetString(), pValue->GetStringLength()) : std::string();
+	}
+
+	// Element 'Index' of the top level array 'Name', nullptr if out of range.
+	static const rapidjson::Value* GetElement(const GltfFile& File, const char* Name, uint64_t Index)
+	{
+		const rapidjson::Value* pArray = FindArray(File.Json, Name);
+		if (!pArray || Index >= pArray->Size()) {
+			return nullptr;
+		}
+		const rapidjson::Value& Element = (*pArray)[static_cast<rapidjson::SizeType>(Index)];
+		return Element.IsObject() ? &Element : nullptr;
+	}
+
+	static size_t GetArraySize(const GltfFile& File, const char* Name)
+	{
+		const rapidjson::Value* pArray = FindArray(File.Json, Name);
+		return pArray ? pArray->Size() : 0U;
+	}
+
+	static bool DecodeBase64(const char* pText, size_t Length, std::vector<uint8_t>& OutData)
+	{
+		auto DecodeChar = [](char Char) -> int {
+			if (Char >= 'A' && Char <= 'Z') return Char - 'A';
+			if (Char >= 'a' && Char <= 'z') return Char - 'a' + 26;
+			if (Char >= '0' && Char <= '9') return Char - '0' + 52;
+			if (Char == '+' || Char == '-') return 62;
+			if (Char == '/' || Char == '_') return 63;
+			return -1;
+		};
+		while (Length > 0U && pText[Length - 1U] == '=') {
+			--Length;
+		}
+		OutData.clear();
+		OutData.reserve(Length * 3U / 4U);
+		uint32_t Bits = 0U;
+		uint32_t NumBits = 0U;
+		for (size_t i = 0; i < Length; ++i) {
+			const int Value = DecodeChar(pText[i]);
+			if (Value < 0) {
+				return false;
+			}
+			Bits = (Bits << 6) | static_cast<uint32_t>(Value);
+			NumBits += 6U;
+			if (NumBits >= 8U) {
+				NumBits -= 8U;
+				OutData.push_back(static_cast<uint8_t>(Bits >> NumBits));
+			}
+		}
+		return true;
+	}
+
+	// Relative URIs may be percent encoded, "My%20Model.bin".
+	static std::string DecodeUri(const std::string& Uri)
+	{
+		std::string Decoded;
+		Decoded.reserve(Uri.size());
+		for (size_t i = 0; i < Uri.size(); ++i) {
+			if (Uri[i] == '%' && i + 2U < Uri.size() && isxdigit(static_cast<unsigned char>(Uri[i + 1U])) && isxdigit(static_cast<unsigned char>(Uri[i + 2U]))) {
+				Decoded.push_back(static_cast<char>(std::stoi(Uri.substr(i + 1U, 2U), nullptr, 16)));
+				i += 2U;
+			}
+			else {
+				Decoded.push_back(Uri[i]);
+			}
+		}
+		return Decoded;
+	}
+
+	// Splits a GLB into its JSON and binary chunks. The binary chunk is optional.
+	static bool ParseGlb(const uint8_t* pData, size_t Size, GltfSpan& OutJson, GltfSpan& OutBinary)
+	{
+		if (Size < 20U) {
+			return false;
+		}
+		uint32_t Header[3];
+		memcpy(Header, pData, sizeof(Header));
+		if (Header[0] != IE_GLB_MAGIC || Header[1] != 2U || Header[2] > Size) {
+			return false;
+		}
+		size_t Offset = 12U;
+		const size_t Length = Header[2];
+		while (Offset + 8U <= Length) {
+			uint32_t Chunk[2];
+			memcpy(Chunk, pData + Offset, sizeof(Chunk));
+			Offset += 8U;
+			if (Chunk[0] > Length - Offset) {
+				return false;
+			}
+			if (Chunk[1] == IE_GLB_CHUNK_JSON && !OutJson.pData) {
+				OutJson = { pData + Offset, Chunk[0] };
+			}
+			else if (Chunk[1] == IE_GLB_CHUNK_BIN && !OutBinary.pData) {
+				OutBinary = { pData + Offset, Chunk[0] };
+			}
+			// Chunks are 4 byte aligned.
+			Offset += (static_cast<size_t>(Chunk[0]) + 3U) & ~size_t(3U);
+		}
+		return OutJson.pData != nullptr;
+	}
+
+	static bool IsExtensionSupported(const std::string& Name)
+	{
+		// Material extensions do not change geometry, the rest are implemented below.
+		return Name == "EXT_meshopt_compression" || Name == "KHR_mesh_quantization" || Name == "KHR_texture_transform" || Name.compare(0, 14, "KHR_materials_") == 0;
+	}
+
+	static bool LoadBuffers(GltfFile& File, const GltfSpan& GlbBinary)
+	{
+		const std::string Directory = StringHelper::GetDirectoryFromPath(File.Filepath);
+		const size_t NumBuffers = GetArraySize(File, "buffers");
+		File.Buffers.resize(NumBuffers);
+		for (size_t i = 0; i < NumBuffers; ++i) {
+			const rapidjson::Value* pBuffer = GetElement(File, "buffers", i);
+			if (!pBuffer) {
+				return false;
+			}
+			// Fallback buffers only exist for loaders without meshopt support, and are often not shipped.
+			const rapidjson::Value* pMeshopt = FindExtension(*pBuffer, "EXT_meshopt_compression");
+			const rapidjson::Value* pFallback = pMeshopt ? FindMember(*pMeshopt, "fallback") : nullptr;
+			if (pFallback && pFallback->IsBool() && pFallback->GetBool()) {
+				continue;
+			}
+
+			const size_t ByteLength = GetUint(*pBuffer, "byteLength", 0U);
+			const std::string Uri = GetString(*pBuffer, "uri");
+			GltfSpan Span;
+			if (Uri.empty()) {
+				// Only the first buffer may refer to the GLB's binary chunk.
+				if (i != 0U || !GlbBinary.pData) {
+					IE_CORE_WARN("glTF \"{0}\": buffer {1} has no data.", File.Filepath, i);
+					return false;
+				}
+				Span = GlbBinary;
+			}
+			else if (Uri.compare(0, 5, "data:") == 0) {
+				const size_t DataStart = Uri.find(";base64,");
+				File.OwnedData.emplace_back();
+				if (DataStart == std::string::npos || !DecodeBase64(Uri.c_str() + DataStart + 8U, Uri.size() - DataStart - 8U, File.OwnedData.back())) {
+					IE_CORE_WARN("glTF \"{0}\": buffer {1} has an invalid data URI.", File.Filepath, i);
+					return false;
+				}
+				Span = { File.OwnedData.back().data(), File.OwnedData.back().size() };
+			}
+			else {
+				auto pExternal = std::make_unique<MappedFile>();
+				const std::string BufferPath = Directory.empty() ? DecodeUri(Uri) : Directory + "/" + DecodeUri(Uri);
+				if (!pExternal->Open(BufferPath)) {
+					IE_CORE_WARN("glTF \"{0}\": failed to open buffer \"{1}\".", File.Filepath, BufferPath);
+					return false;
+				}
+				Span = { pExternal->GetData(), pExternal->GetSize() };
+				File.ExternalFiles.push_back(std::move(pExternal));
+			}
+
+			if (Span.Size < ByteLength) {
+				IE_CORE_WARN("glTF \"{0}\": buffer {1} is shorter than its byteLength.", File.Filepath, i);
+				return false;
+			}
+			Span.Size = ByteLength;
+			File.Buffers[i] = Span;
+		}
+		return true;
+	}
+
+	static bool GetBufferRange(const GltfFile& File, uint64_t BufferIndex, uint64_t Offset, uint64_t Length, GltfSpan& OutSpan)
+	{
+		if (BufferIndex >= File.Buffers.size()) {
+			return false;
+		}
+		const GltfSpan& Buffer = File.Buffers[static_cast<size_t>(BufferIndex)];
+		if (!Buffer.pData || Offset > Buffer.Size || Length > Buffer.Size - Offset) {
+			return false;
+		}
+		OutSpan = { Buffer.pData + Offset, static_cast<size_t>(Length) };
+		return true;
+	}
+
+	// Decodes a view compressed with EXT_meshopt_compression into 'OutData'.
+	static bool DecodeMeshoptView(const GltfFile& File, const rapidjson::Value& Extension, std::vector<uint8_t>& OutData)
+	{
+		const uint64_t Count = GetUint(Extension, "count", 0U);
+		const uint64_t Stride = GetUint(Extension, "byteStride", 0U);
+		GltfSpan Source;
+		if (Stride == 0U || Stride > 256U || !GetBufferRange(File, GetUint(Extension, "buffer", UINT64_MAX), GetUint(Extension, "byteOffset", 0U), GetUint(Extension, "byteLength", 0U), Source)) {
+			return false;
+		}
+		OutData.resize(static_cast<size_t>(Count * Stride));
+
+		const std::string Mode = GetString(Extension, "mode");
+		bool Decoded = false;
+		if (Mode == "ATTRIBUTES") {
+			Decoded = MeshoptCodec::DecodeVertexBuffer(OutData.data(), Count, Stride, Source.pData, Source.Size);
+		}
+		else if (Mode == "TRIANGLES") {
+			Decoded = MeshoptCodec::DecodeIndexBuffer(OutData.data(), Count, Stride, Source.pData, Source.Size);
+		}
+		else if (Mode == "INDICES") {
+			Decoded = MeshoptCodec::DecodeIndexSequence(OutData.data(), Count, Stride, Source.pData, Source.Size);
+		}
+		if (!Decoded) {
+			return false;
+		}
+
+		const std::string Filter = GetString(Extension, "filter");
+		if (Filter.empty() || Filter == "NONE") {
+			return true;
+		}
+		if (Filter == "OCTAHEDRAL") {
+			return MeshoptCodec::DecodeFilterOctahedral(OutData.data(), Count, Stride);
+		}
+		if (Filter == "QUATERNION") {
+			return MeshoptCodec::DecodeFilterQuaternion(OutData.data(), Count, Stride);
+		}
+		if (Filter == "EXPONENTIAL") {
+			return MeshoptCodec::DecodeFilterExponential(OutData.data(), Count, Stride);
+		}
+		return false;
+	}
+
+	static bool LoadBufferViews(GltfFile& File)
+	{
+		const size_t NumViews = GetArraySize(File, "bufferViews");
+		File.Views.resize(NumViews);
+		File.ViewStrides.resize(NumViews);
+
+		std::vector<uint32_t> CompressedViews;
+		size_t CompressedBytes = 0U;
+		for (size_t i = 0; i < NumViews; ++i) {
+			const rapidjson::Value* pView = GetElement(File, "bufferViews", i);
+			if (!pView) {
+				return false;
+			}
+			File.ViewStrides[i] = static_cast<uint32_t>(GetUint(*pView, "byteStride", 0U));
+			if (const rapidjson::Value* pMeshopt = FindExtension(*pView, "EXT_meshopt_compression")) {
+				CompressedViews.push_back(static_cast<uint32_t>(i));
+				CompressedBytes += static_cast<size_t>(GetUint(*pMeshopt, "count", 0U) * GetUint(*pMeshopt, "byteStride", 0U));
+				continue;
+			}
+			if (!GetBufferRange(File, GetUint(*pView, "buffer", UINT64_MAX), GetUint(*pView, "byteOffset", 0U), GetUint(*pView, "byteLength", 0U), File.Views[i])) {
+				IE_CORE_WARN("glTF \"{0}\": buffer view {1} is out of range.", File.Filepath, i);
+				return false;
+			}
+		}
+		if (CompressedViews.empty()) {
+			return true;
+		}
+
+		// Compressed views are decoded up front, each into its own vector, so the primitives can read them from any thread.
+		const size_t FirstOwned = File.OwnedData.size();
+		File.OwnedData.resize(FirstOwned + CompressedViews.size());
+		std::atomic<bool> Failed(false);
+		auto DecodeView = [&File, &CompressedViews, &Failed, FirstOwned](uint32_t i) {
+			const uint32_t ViewIndex = CompressedViews[i];
+			const rapidjson::Value& Extension = *FindExtension(*GetElement(File, "bufferViews", ViewIndex), "EXT_meshopt_compression");
+			if (!DecodeMeshoptView(File, Extension, File.OwnedData[FirstOwned + i])) {
+				IE_CORE_WARN("glTF \"{0}\": failed to decode compressed buffer view {1}.", File.Filepath, ViewIndex);
+				Failed = true;
+			}
+		};
+		if (CompressedBytes >= IE_GLTF_PARALLEL_VERTEX_THRESHOLD * sizeof(Vertex3D)) {
+			ThreadPool::ParallelFor(static_cast<uint32_t>(CompressedViews.size()), DecodeView);
+		}
+		else {
+			for (uint32_t i = 0; i < CompressedViews.size(); ++i) {
+				DecodeView(i);
+			}
+		}
+		if (Failed) {
+			return false;
+		}
+		for (size_t i = 0; i < CompressedViews.size(); ++i) {
+			const std::vector<uint8_t>& Decoded = File.OwnedData[FirstOwned + i];
+			File.Views[CompressedViews[i]] = { Decoded.data(), Decoded.size() };
+		}
+		return true;
+	}
+
+	static uint32_t GetComponentSize(uint32_t ComponentType)
+	{
+		switch (ComponentType) {
+		case IE_GLTF_BYTE:
+		case IE_GLTF_UNSIGNED_BYTE:
+			return 1U;
+		case IE_GLTF_SHORT:
+		case IE_GLTF_UNSIGNED_SHORT:
+			return 2U;
+		case IE_GLTF_UNSIGNED_INT:
+		case IE_GLTF_FLOAT:
+			return 4U;
+		default:
+			return 0U;
+		}
+	}
+
+	static uint32_t GetNumComponents(const std::string& Type)
+	{
+		if (Type == "SCALAR") return 1U;
+		if (Type == "VEC2") return 2U;
+		if (Type == "VEC3") return 3U;
+		if (Type == "VEC4") return 4U;
+		return 0U;
+	}
+
+	static bool GetAccessor(const GltfFile& File, uint64_t Index, GltfAccessor& OutAccessor)
+	{
+		const rapidjson::Value* pAccessor = GetElement(File, "accessors", Index);
+		if (!pAccessor) {
+			return false;
+		}
+		OutAccessor.Count = static_cast<size_t>(GetUint(*pAccessor, "count", 0U));
+		OutAccessor.ComponentType = static_cast<uint32_t>(GetUint(*pAccessor, "componentType", 0U));
+		OutAccessor.NumComponents = GetNumComponents(GetString(*pAccessor, "type"));
+		const rapidjson::Value* pNormalized = FindMember(*pAccessor, "normalized");
+		OutAccessor.IsNormalized = pNormalized && pNormalized->IsBool() && pNormalized->GetBool();
+		OutAccessor.pSparse = FindObject(*pAccessor, "sparse");
+
+		const uint32_t ComponentSize = GetComponentSize(OutAccessor.ComponentType);
+		if (ComponentSize == 0U || OutAccessor.NumComponents == 0U) {
+			return false;
+		}
+		const size_t ElementSize = ComponentSize * OutAccessor.NumComponents;
+
+		const uint64_t ViewIndex = GetUint(*pAccessor, "bufferView", UINT64_MAX);
+		if (ViewIndex == UINT64_MAX) {
+			OutAccessor.pData = nullptr;
+			OutAccessor.Stride = ElementSize;
+			return true;
+		}
+		if (ViewIndex >= File.Views.size()) {
+			return false;
+		}
+		const GltfSpan& View = File.Views[static_cast<size_t>(ViewIndex)];
+		const size_t Offset = static_cast<size_t>(GetUint(*pAccessor, "byteOffset", 0U));
+		OutAccessor.Stride = File.ViewStrides[static_cast<size_t>(ViewIndex)] ? File.ViewStrides[static_cast<size_t>(ViewIndex)] : ElementSize;
+		if (OutAccessor.Count > 0U && (Offset > View.Size || (OutAccessor.Count - 1U) * OutAccessor.Stride + ElementSize > View.Size - Offset)) {
+			return false;
+		}
+		OutAccessor.pData = View.pData + Offset;
+		return true;
+	}
+
+	static inline float ReadComponent(const uint8_t* pData, uint32_t ComponentType, bool IsNormalized)
+	{
+		switch (ComponentType) {
+		case IE_GLTF_BYTE:
+		{
+			const float Value = static_cast<float>(static_cast<int8_t>(*pData));
+			return IsNormalized ? std::max(Value / 127.0f, -1.0f) : Value;
+		}
+		case IE_GLTF_UNSIGNED_BYTE:
+			return IsNormalized ? *pData / 255.0f : static_cast<float>(*pData);
+		case IE_GLTF_SHORT:
+		{
+			int16_t Value;
+			memcpy(&Value, pData, sizeof(Value));
+			return IsNormalized ? std::max(Value / 32767.0f, -1.0f) : static_cast<float>(Value);
+		}
+		case IE_GLTF_UNSIGNED_SHORT:
+		{
+			uint16_t Value;
+			memcpy(&Value, pData, sizeof(Value));
+			return IsNormalized ? Value / 65535.0f : static_cast<float>(Value);
+		}
+		case IE_GLTF_UNSIGNED_INT:
+		{
+			uint32_t Value;
+			memcpy(&Value, pData, sizeof(Value));
+			return static_cast<float>(Value);
+		}
+		default:
+		{
+			float Value;
+			memcpy(&Value, pData, sizeof(Value));
+			return Value;
+		}
+		}
+	}
+
+	static inline void ReadElement(const uint8_t* pElement, uint32_t ComponentType, bool IsNormalized, uint32_t NumComponents, float* pOut)
+	{
+		if (ComponentType == IE_GLTF_FLOAT) {
+			memcpy(pOut, pElement, NumComponents * sizeof(float));
+			return;
+		}
+		const uint32_t ComponentSize = GetComponentSize(ComponentType);
+		for (uint32_t c = 0; c < NumComponents; ++c) {
+			pOut[c] = ReadComponent(pElement + c * ComponentSize, ComponentType, IsNormalized);
+		}
+	}
+
+	static bool ReadIndexValues(const GltfFile& File, uint64_t ViewIndex, uint64_t Offset, uint32_t ComponentType, size_t Count, std::vector<uint32_t>& OutIndices)
+	{
+		const uint32_t ComponentSize = GetComponentSize(ComponentType);
+		if (ViewIndex >= File.Views.size() || ComponentType == IE_GLTF_BYTE || ComponentType == IE_GLTF_SHORT || ComponentType == IE_GLTF_FLOAT) {
+			return false;
+		}
+		const GltfSpan& View = File.Views[static_cast<size_t>(ViewIndex)];
+		if (Offset > View.Size || Count * ComponentSize > View.Size - Offset) {
+			return false;
+		}
+		const uint8_t* pData = View.pData + Offset;
+		OutIndices.resize(Count);
+		if (ComponentType == IE_GLTF_UNSIGNED_INT) {
+			memcpy(OutIndices.data(), pData, Count * sizeof(uint32_t));
+		}
+		else if (ComponentType == IE_GLTF_UNSIGNED_SHORT) {
+			for (size_t i = 0; i < Count; ++i) {
+				uint16_t Index;
+				memcpy(&Index, pData + i * sizeof(uint16_t), sizeof(Index));
+				OutIndices[i] = Index;
+			}
+		}
+		else {
+			for (size_t i = 0; i < Count; ++i) {
+				OutIndices[i] = pData[i];
+			}
+		}
+		return true;
+	}
+
+	// Sparse accessors replace some elements of their base data, stored as a list of element indices and a list of values.
+	static bool ApplySparse(const GltfFile& File, const GltfAccessor& Accessor, uint32_t NumComponents, uint8_t* pDest, size_t DestStride)
+	{
+		const rapidjson::Value& Sparse = *Accessor.pSparse;
+		const size_t Count = static_cast<size_t>(GetUint(Sparse, "count", 0U));
+		const rapidjson::Value* pIndices = FindObject(Sparse, "indices");
+		const rapidjson::Value* pValues = FindObject(Sparse, "values");
+		if (!pIndices || !pValues) {
+			return false;
+		}
+
+		std::vector<uint32_t> Indices;
+		if (!ReadIndexValues(File, GetUint(*pIndices, "bufferView", UINT64_MAX), GetUint(*pIndices, "byteOffset", 0U), static_cast<uint32_t>(GetUint(*pIndices, "componentType", 0U)), Count, Indices)) {
+			return false;
+		}
+
+		const uint64_t ValuesView = GetUint(*pValues, "bufferView", UINT64_MAX);
+		const size_t ValuesOffset = static_cast<size_t>(GetUint(*pValues, "byteOffset", 0U));
+		const size_t ElementSize = GetComponentSize(Accessor.ComponentType) * Accessor.NumComponents;
+		if (ValuesView >= File.Views.size() || ValuesOffset > File.Views[static_cast<size_t>(ValuesView)].Size || Count * ElementSize > File.Views[static_cast<size_t>(ValuesView)].Size - ValuesOffset) {
+			return false;
+		}
+		const uint8_t* pValueData = File.Views[static_cast<size_t>(ValuesView)].pData + ValuesOffset;
+		for (size_t i = 0; i < Count; ++i) {
+			if (Indices[i] >= Accessor.Count) {
+				return false;
+			}
+			float* pOut = reinterpret_cast<float*>(pDest + Indices[i] * DestStride);
+			ReadElement(pValueData + i * ElementSize, Accessor.ComponentType, Accessor.IsNormalized, NumComponents, pOut);
+		}
+		return true;
+	}
+
+	// Reads up to 'NumComponents' components of every element as floats, straight into a strided destination
+	// such as a field of Vertex3D. Components the accessor does not have are left untouched.
+	static bool ReadAccessorFloats(const GltfFile& File, uint64_t Index, uint32_t NumComponents, uint8_t* pDest, size_t DestStride, size_t ExpectedCount)
+	{
+		GltfAccessor Accessor;
+		if (!GetAccessor(File, Index, Accessor) || Accessor.Count != ExpectedCount) {
+			return false;
+		}
+		NumComponents = std::min(NumComponents, Accessor.NumComponents);
+		if (Accessor.pData) {
+			for (size_t i = 0; i < Accessor.Count; ++i) {
+				ReadElement(Accessor.pData + i * Accessor.Stride, Accessor.ComponentType, Accessor.IsNormalized, NumComponents, reinterpret_cast<float*>(pDest + i * DestStride));
+			}
+		}
+		else {
+			for (size_t i = 0; i < Accessor.Count; ++i) {
+				memset(pDest + i * DestStride, 0, NumComponents * sizeof(float));
+			}
+		}
+		return !Accessor.pSparse || ApplySparse(File, Accessor, NumComponents, pDest, DestStride);
+	}
+
+	static bool ReadAccessorIndices(const GltfFile& File, uint64_t Index, std::vector<uint32_t>& OutIndices)
+	{
+		GltfAccessor Accessor;
+		if (!GetAccessor(File, Index, Accessor) || Accessor.NumComponents != 1U || !Accessor.pData || Accessor.pSparse) {
+			return false;
+		}
+		const uint32_t ComponentSize = GetComponentSize(Accessor.ComponentType);
+		if (Accessor.Stride != ComponentSize) {
+			return false;
+		}
+		const uint64_t ViewIndex = GetUint(*GetElement(File, "accessors", Index), "bufferView", UINT64_MAX);
+		const size_t Offset = static_cast<size_t>(Accessor.pData - File.Views[static_cast<size_t>(ViewIndex)].pData);
+		return ReadIndexValues(File, ViewIndex, Offset, Accessor.ComponentType, Accessor.Count, OutIndices);
+	}
+
+	static inline ieFloat3 Subtract(const ieFloat3& A, const ieFloat3& B)
+	{
+		return ieFloat3(A.x - B.x, A.y - B.y, A.z - B.z);
+	}
+
+	static inline ieFloat3 Cross(const ieFloat3& A, const ieFloat3& B)
+	{
+		return ieFloat3(A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x);
+	}
+
+	static inline float Dot(const ieFloat3& A, const ieFloat3& B)
+	{
+		return A.x * B.x + A.y * B.y + A.z * B.z;
+	}
+
+	static inline ieFloat3 Normalize(const ieFloat3& Vector, const ieFloat3& Fallback)
+	{
+		const float Length = sqrtf(Dot(Vector, Vector));
+		return (Length > 1e-20f) ? ieFloat3(Vector.x / Length, Vector.y / Length, Vector.z / Length) : Fallback;
+	}
+
+	// Files without normals get flat normals, as the glTF specification asks, unless smooth normals were requested.
+	static void GenerateNormals(Verticies& MeshVerticies, Indices& MeshIndices, bool Smooth)
+	{
+		if (!Smooth) {
+			Verticies Unshared(MeshIndices.size());
+			for (size_t i = 0; i < MeshIndices.size(); ++i) {
+				Unshared[i] = MeshVerticies[MeshIndices[i]];
+				MeshIndices[i] = static_cast<uint32_t>(i);
+			}
+			MeshVerticies.swap(Unshared);
+		}
+
+		std::vector<ieFloat3> Normals(MeshVerticies.size(), ieFloat3(0.0f, 0.0f, 0.0f));
+		for (size_t i = 0; i + 2U < MeshIndices.size(); i += 3U) {
+			const ieFloat3& P0 = MeshVerticies[MeshIndices[i]].Position;
+			// Area weighted, the cross product's length is twice the triangle's area.
+			const ieFloat3 FaceNormal = Cross(Subtract(MeshVerticies[MeshIndices[i + 1U]].Position, P0), Subtract(MeshVerticies[MeshIndices[i + 2U]].Position, P0));
+			for (size_t Corner = 0; Corner < 3U; ++Corner) {
+				ieFloat3& Normal = Normals[MeshIndices[i + Corner]];
+				Normal = ieFloat3(Normal.x + FaceNormal.x, Normal.y + FaceNormal.y, Normal.z + FaceNormal.z);
+			}
+		}
+		for (size_t i = 0; i < MeshVerticies.size(); ++i) {
+			MeshVerticies[i].Normal = Normalize(Normals[i], ieFloat3(0.0f, 1.0f, 0.0f));
+		}
+	}
+
+	// Per vertex tangent frames from the texture coordinates. The bitangent follows the normal
+	// map's green channel, up in the texture, which is what glTF's tangent.w and Assimp's tangents both produce.
+	static void GenerateTangents(Verticies& MeshVerticies, const Indices& MeshIndices)
+	{
+		std::vector<ieFloat3> Tangents(MeshVerticies.size(), ieFloat3(0.0f, 0.0f, 0.0f));
+		std::vector<ieFloat3> BiTangents(MeshVerticies.size(), ieFloat3(0.0f, 0.0f, 0.0f));
+		for (size_t i = 0; i + 2U < MeshIndices.size(); i += 3U) {
+			const Vertex3D& V0 = MeshVerticies[MeshIndices[i]];
+			const Vertex3D& V1 = MeshVerticies[MeshIndices[i + 1U]];
+			const Vertex3D& V2 = MeshVerticies[MeshIndices[i + 2U]];
+			const ieFloat3 Edge1 = Subtract(V1.Position, V0.Position);
+			const ieFloat3 Edge2 = Subtract(V2.Position, V0.Position);
+			const float DU1 = V1.TexCoords.x - V0.TexCoords.x;
+			const float DV1 = V1.TexCoords.y - V0.TexCoords.y;
+			const float DU2 = V2.TexCoords.x - V0.TexCoords.x;
+			const float DV2 = V2.TexCoords.y - V0.TexCoords.y;
+			const float Determinant = DU1 * DV2 - DU2 * DV1;
+			if (fabsf(Determinant) < 1e-20f) {
+				continue;
+			}
+			const float R = 1.0f / Determinant;
+			const ieFloat3 Tangent((Edge1.x * DV2 - Edge2.x * DV1) * R, (Edge1.y * DV2 - Edge2.y * DV1) * R, (Edge1.z * DV2 - Edge2.z * DV1) * R);
+			// glTF's v points down the texture, negate so the bitangent points up it.
+			const ieFloat3 BiTangent(-(Edge2.x * DU1 - Edge1.x * DU2) * R, -(Edge2.y * DU1 - Edge1.y * DU2) * R, -(Edge2.z * DU1 - Edge1.z * DU2) * R);
+			for (size_t Corner = 0; Corner < 3U; ++Corner) {
+				const uint32_t Index = MeshIndices[i + Corner];
+				Tangents[Index] = ieFloat3(Tangents[Index].x + Tangent.x, Tangents[Index].y + Tangent.y, Tangents[Index].z + Tangent.z);
+				BiTangents[Index] = ieFloat3(BiTangents[Index].x + BiTangent.x, BiTangents[Index].y + BiTangent.y, BiTangents[Index].z + BiTangent.z);
+			}
+		}
+
+		for (size_t i = 0; i < MeshVerticies.size(); ++i) {
+			Vertex3D& Vertex = MeshVerticies[i];
+			const ieFloat3& N = Vertex.Normal;
+			// Gram-Schmidt against the normal, any perpendicular vector if the texture coordinates are degenerate.
+			const float NDotT = Dot(N, Tangents[i]);
+			const ieFloat3 Perpendicular = (fabsf(N.x) < 0.9f) ? ieFloat3(0.0f, N.z, -N.y) : ieFloat3(-N.z, 0.0f, N.x);
+			Vertex.Tangent = Normalize(ieFloat3(Tangents[i].x - N.x * NDotT, Tangents[i].y - N.y * NDotT, Tangents[i].z - N.z * NDotT), Normalize(Perpendicular, ieFloat3(1.0f, 0.0f, 0.0f)));
+			const ieFloat3 BiTangent = Cross(N, Vertex.Tangent);
+			const float Sign = (Dot(BiTangent, BiTangents[i]) < 0.0f) ? -1.0f : 1.0f;
+			Vertex.BiTangent = ieFloat3(BiTangent.x * Sign, BiTangent.y * Sign, BiTangent.z * Sign);
+		}
+	}
+
+	// KHR_texture_transform on the base color texture. gltfpack stores quantized texture coordinates
+	// and puts the dequantization here, it has to be applied for the coordinates to mean anything.
+	static void ApplyTextureTransform(const GltfFile& File, uint64_t MaterialIndex, Verticies& MeshVerticies)
+	{
+		const rapidjson::Value* pMaterial = GetElement(File, "materials", MaterialIndex);
+		const rapidjson::Value* pPbr = pMaterial ? FindObject(*pMaterial, "pbrMetallicRoughness") : nullptr;
+		const rapidjson::Value* pTexture = pPbr ? FindObject(*pPbr, "baseColorTexture") : nullptr;
+		const rapidjson::Value* pTransform = pTexture ? FindExtension(*pTexture, "KHR_texture_transform") : nullptr;
+		if (!pTransform) {
+			return;
+		}
+		// Only the first texture coordinate set is imported.
+		if (GetUint(*pTransform, "texCoord", GetUint(*pTexture, "texCoord", 0U)) != 0U) {
+			return;
+		}
+
+		float Offset[2] = { 0.0f, 0.0f };
+		float Scale[2] = { 1.0f, 1.0f };
+		const rapidjson::Value* pOffset = FindArray(*pTransform, "offset");
+		const rapidjson::Value* pScale = FindArray(*pTransform, "scale");
+		for (rapidjson::SizeType i = 0; i < 2U; ++i) {
+			if (pOffset && pOffset->Size() > i && (*pOffset)[i].IsNumber()) {
+				Offset[i] = static_cast<float>((*pOffset)[i].GetDouble());
+			}
+			if (pScale && pScale->Size() > i && (*pScale)[i].IsNumber()) {
+				Scale[i] = static_cast<float>((*pScale)[i].GetDouble());
+			}
+		}
+		const float Rotation = GetFloat(*pTransform, "rotation", 0.0f);
+		const float Cos = cosf(Rotation);
+		const float Sin = sinf(Rotation);
+
+		// Translation * Rotation * Scale, as in the extension's reference shader.
+		for (Vertex3D& Vertex : MeshVerticies) {
+			const float U = Vertex.TexCoords.x * Scale[0];
+			const float V = Vertex.TexCoords.y * Scale[1];
+			Vertex.TexCoords = ieFloat2(Cos * U - Sin * V + Offset[0], Sin * U + Cos * V + Offset[1]);
+		}
+	}
+
+	static bool ConvertPrimitive(const GltfFile& File, const rapidjson::Value& Primitive, ImportedMesh& OutMesh)
+	{
+		const rapidjson::Value* pAttributes = FindObject(Primitive, "attributes");
+		if (!pAttributes) {
+			return false;
+		}
+		GltfAccessor PositionAccessor;
+		if (!GetAccessor(File, GetUint(*pAttributes, "POSITION", UINT64_MAX), PositionAccessor)) {
+			return false;
+		}
+		const size_t NumVertices = PositionAccessor.Count;
+
+		Verticies& MeshVerticies = OutMesh.MeshVerticies;
+		Indices& MeshIndices = OutMesh.MeshIndices;
+		MeshVerticies.resize(NumVertices);
+		uint8_t* pVertices = reinterpret_cast<uint8_t*>(MeshVerticies.data());
+		if (!ReadAccessorFloats(File, GetUint(*pAttributes, "POSITION", UINT64_MAX), 3U, pVertices + offsetof(Vertex3D, Position), sizeof(Vertex3D), NumVertices)) {
+			return false;
+		}
+		const uint64_t NormalAccessor = GetUint(*pAttributes, "NORMAL", UINT64_MAX);
+		const bool HasNormals = (NormalAccessor != UINT64_MAX);
+		if (HasNormals && !ReadAccessorFloats(File, NormalAccessor, 3U, pVertices + offsetof(Vertex3D, Normal), sizeof(Vertex3D), NumVertices)) {
+			return false;
+		}
+		const uint64_t TexCoordAccessor = GetUint(*pAttributes, "TEXCOORD_0", UINT64_MAX);
+		const bool HasTexCoords = (TexCoordAccessor != UINT64_MAX);
+		if (HasTexCoords && !ReadAccessorFloats(File, TexCoordAccessor, 2U, pVertices + offsetof(Vertex3D, TexCoords), sizeof(Vertex3D), NumVertices)) {
+			return false;
+		}
+		// Tangents are ignored without normals, the specification defines them relative to the given normals.
+		const uint64_t TangentAccessor = GetUint(*pAttributes, "TANGENT", UINT64_MAX);
+		std::vector<float> Tangents;
+		if (HasNormals && TangentAccessor != UINT64_MAX) {
+			Tangents.assign(NumVertices * 4U, 1.0f);
+			if (!ReadAccessorFloats(File, TangentAccessor, 4U, reinterpret_cast<uint8_t*>(Tangents.data()), 4U * sizeof(float), NumVertices)) {
+				return false;
+			}
+		}
+
+		// Strips and fans are expanded to lists, anything else is not a triangle and left to Assimp.
+		std::vector<uint32_t> SourceIndices;
+		const uint64_t IndexAccessor = GetUint(Primitive, "indices", UINT64_MAX);
+		if (IndexAccessor != UINT64_MAX) {
+			if (!ReadAccessorIndices(File, IndexAccessor, SourceIndices)) {
+				return false;
+			}
+		}
+		else {
+			SourceIndices.resize(NumVertices);
+			for (size_t i = 0; i < NumVertices; ++i) {
+				SourceIndices[i] = static_cast<uint32_t>(i);
+			}
+		}
+		for (uint32_t Index : SourceIndices) {
+			if (Index >= NumVertices) {
+				return false;
+			}
+		}
+
+		const uint64_t Mode = GetUint(Primitive, "mode", IE_GLTF_TRIANGLES);
+		if (Mode == IE_GLTF_TRIANGLES) {
+			MeshIndices.assign(SourceIndices.begin(), SourceIndices.begin() + (SourceIndices.size() / 3U) * 3U);
+		}
+		else if (Mode == IE_GLTF_TRIANGLE_STRIP) {
+			MeshIndices.reserve(SourceIndices.size() > 2U ? (SourceIndices.size() - 2U) * 3U : 0U);
+			for (size_t i = 0; i + 2U < SourceIndices.size(); ++i) {
+				// Every other triangle is flipped to keep the winding consistent.
+				MeshIndices.push_back(SourceIndices[i]);
+				MeshIndices.push_back(SourceIndices[i + 1U + (i % 2U)]);
+				MeshIndices.push_back(SourceIndices[i + 2U - (i % 2U)]);
+			}
+		}
+		else if (Mode == IE_GLTF_TRIANGLE_FAN) {
+			MeshIndices.reserve(SourceIndices.size() > 2U ? (SourceIndices.size() - 2U) * 3U : 0U);
+			for (size_t i = 0; i + 2U < SourceIndices.size(); ++i) {
+				MeshIndices.push_back(SourceIndices[i + 1U]);
+				MeshIndices.push_back(SourceIndices[i + 2U]);
+				MeshIndices.push_back(SourceIndices[0]);
+			}
+		}
+		else {
+			return false;
+		}
+
+		const uint64_t MaterialIndex = GetUint(Primitive, "material", UINT64_MAX);
+		// Primitives without a material use the default material, which Assimp appends after the file's materials.
+		OutMesh.MaterialIndex = static_cast<uint32_t>((MaterialIndex != UINT64_MAX) ? MaterialIndex : GetArraySize(File, "materials"));
+		if (HasTexCoords && MaterialIndex != UINT64_MAX) {
+			ApplyTextureTransform(File, MaterialIndex, MeshVerticies);
+		}
+
+		if (!HasNormals) {
+			GenerateNormals(MeshVerticies, MeshIndices, (File.ImportFlags & aiProcess_GenSmoothNormals) != 0U);
+		}
+		if (!Tangents.empty()) {
+			for (size_t i = 0; i < NumVertices; ++i) {
+				Vertex3D& Vertex = MeshVerticies[i];
+				Vertex.Tangent = ieFloat3(Tangents[i * 4U], Tangents[i * 4U + 1U], Tangents[i * 4U + 2U]);
+				const ieFloat3 BiTangent = Cross(Vertex.Normal, Vertex.Tangent);
+				const float Sign = (Tangents[i * 4U + 3U] < 0.0f) ? -1.0f : 1.0f;
+				Vertex.BiTangent = ieFloat3(BiTangent.x * Sign, BiTangent.y * Sign, BiTangent.z * Sign);
+			}
+		}
+		else if (HasTexCoords && (File.ImportFlags & aiProcess_CalcTangentSpace)) {
+			GenerateTangents(MeshVerticies, MeshIndices);
+		}
+
+		// Same conversions as Assimp's aiProcess_ConvertToLeftHanded. Assimp's glTF importer flips v
+		// on import and FlipUVs flips it back, glTF's texture coordinates already start at the top left.
+		if (File.ImportFlags & aiProcess_MakeLeftHanded) {
+			for (Vertex3D& Vertex : MeshVerticies) {
+				Vertex.Position.z = -Vertex.Position.z;
+				Vertex.Normal.z = -Vertex.Normal.z;
+				Vertex.Tangent.z = -Vertex.Tangent.z;
+				Vertex.BiTangent.z = -Vertex.BiTangent.z;
+			}
+		}
+		if (HasTexCoords && !(File.ImportFlags & aiProcess_FlipUVs)) {
+			for (Vertex3D& Vertex : MeshVerticies) {
+				Vertex.TexCoords.y = 1.0f - Vertex.TexCoords.y;
+			}
+		}
+		if (File.ImportFlags & aiProcess_FlipWindingOrder) {
+			for (size_t i = 0; i + 2U < MeshIndices.size(); i += 3U) {
+				std::swap(MeshIndices[i + 1U], MeshIndices[i + 2U]);
+			}
+		}
+		return true;
+	}
+
+	static XMMATRIX GetNodeMatrix(const rapidjson::Value& Node)
+	{
+		// glTF matrices are column major with column vectors, loading them as rows gives the row vector matrix.
+		const rapidjson::Value* pMatrix = FindArray(Node, "matrix");
+		if (pMatrix && pMatrix->Size() == 16U) {
+			XMFLOAT4X4 Matrix;
+			for (rapidjson::SizeType i = 0; i < 16U; ++i) {
+				Matrix.m[i / 4U][i % 4U] = (*pMatrix)[i].IsNumber() ? static_cast<float>((*pMatrix)[i].GetDouble()) : 0.0f;
+			}
+			return XMLoadFloat4x4(&Matrix);
+		}
+
+		auto GetVector = [&Node](const char* Name, XMFLOAT4 Default, rapidjson::SizeType Size) {
+			const rapidjson::Value* pArray = FindArray(Node, Name);
+			if (pArray && pArray->Size() == Size) {
+				float* pComponents = &Default.x;
+				for (rapidjson::SizeType i = 0; i < Size; ++i) {
+					pComponents[i] = (*pArray)[i].IsNumber() ? static_cast<float>((*pArray)[i].GetDouble()) : pComponents[i];
+				}
+			}
+			return XMLoadFloat4(&Default);
+		};
+		const XMVECTOR Scale = GetVector("scale", XMFLOAT4(1.0f, 1.0f, 1.0f, 0.0f), 3U);
+		const XMVECTOR Rotation = GetVector("rotation", XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f), 4U);
+		const XMVECTOR Translation = GetVector("translation", XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f), 3U);
+		return XMMatrixMultiply(XMMatrixMultiply(XMMatrixScalingFromVector(Scale), XMMatrixRotationQuaternion(XMQuaternionNormalize(Rotation))), XMMatrixTranslationFromVector(Translation));
+	}
+
+	static unique_ptr<ImportedNode> ParseNode_r(const GltfFile& File, uint64_t NodeIndex, const std::vector<std::pair<uint32_t, uint32_t>>& MeshPrimitives, std::vector<bool>& Visited)
+	{
+		const rapidjson::Value* pNode = GetElement(File, "nodes", NodeIndex);
+		// Nodes may only have one parent, anything else is a broken file that would recurse forever.
+		if (!pNode || Visited[static_cast<size_t>(NodeIndex)]) {
+			return nullptr;
+		}
+		Visited[static_cast<size_t>(NodeIndex)] = true;
+
+		auto pImportedNode = std::make_unique<ImportedNode>();
+		pImportedNode->Name = GetString(*pNode, "name");
+		XMMATRIX LocalMatrix = GetNodeMatrix(*pNode);
+		if (File.ImportFlags & aiProcess_MakeLeftHanded) {
+			// Mirror z on both sides, like Assimp does for node transforms.
+			const XMMATRIX Mirror = XMMatrixScaling(1.0f, 1.0f, -1.0f);
+			LocalMatrix = XMMatrixMultiply(XMMatrixMultiply(Mirror, LocalMatrix), Mirror);
+		}
+		XMStoreFloat4x4(&pImportedNode->LocalMatrix, LocalMatrix);
+
+		const uint64_t MeshIndex = GetUint(*pNode, "mesh", UINT64_MAX);
+		if (MeshIndex < MeshPrimitives.size()) {
+			const std::pair<uint32_t, uint32_t>& Primitives = MeshPrimitives[static_cast<size_t>(MeshIndex)];
+			for (uint32_t i = 0; i < Primitives.second; ++i) {
+				pImportedNode->MeshIndices.push_back(Primitives.first + i);
+			}
+		}
+
+		if (const rapidjson::Value* pChildren = FindArray(*pNode, "children")) {
+			for (rapidjson::SizeType i = 0; i < pChildren->Size(); ++i) {
+				const rapidjson::Value& Child = (*pChildren)[i];
+				if (!Child.IsUint()) {
+					return nullptr;
+				}
+				unique_ptr<ImportedNode> pChild = ParseNode_r(File, Child.GetUint(), MeshPrimitives, Visited);
+				if (!pChild) {
+					return nullptr;
+				}
+				pImportedNode->Children.push_back(std::move(pChild));
+			}
+		}
+		return pImportedNode;
+	}
+
+	bool GltfLoader::CanLoad(const std::string& Filepath, uint32_t ImportFlags)
+	{
+		if (ImportFlags & ~static_cast<uint32_t>(IE_GLTF_SUPPORTED_IMPORT_FLAGS)) {
+			return false;
+		}
+		std::string Extension = StringHelper::GetFileExtension(Filepath);
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](char Char) { return static_cast<char>(tolower(static_cast<unsigned char>(Char))); });
+		return Extension == "gltf" || Extension == "glb";
+	}
+
+	shared_ptr<ImportedModel> GltfLoader::Load(const std::string& Filepath, uint32_t ImportFlags)
+	{
+		auto pFile = std::make_unique<GltfFile>();
+		GltfFile& File = *pFile;
+		File.Filepath = Filepath;
+		File.ImportFlags = ImportFlags;
+		if (!File.File.Open(Filepath)) {
+			IE_CORE_WARN("glTF \"{0}\": failed to open file.", Filepath);
+			return nullptr;
+		}
+
+		GltfSpan Json = { File.File.GetData(), File.File.GetSize() };
+		GltfSpan GlbBinary;
+		uint32_t Magic = 0U;
+		if (Json.Size >= sizeof(Magic)) {
+			memcpy(&Magic, Json.pData, sizeof(Magic));
+		}
+		if (Magic == IE_GLB_MAGIC) {
+			Json = GltfSpan();
+			if (!ParseGlb(File.File.GetData(), File.File.GetSize(), Json, GlbBinary)) {
+				IE_CORE_WARN("glTF \"{0}\": invalid GLB container.", Filepath);
+				return nullptr;
+			}
+		}
+		File.Json.Parse(reinterpret_cast<const char*>(Json.pData), Json.Size);
+		if (File.Json.HasParseError() || !File.Json.IsObject()) {
+			IE_CORE_WARN("glTF \"{0}\": invalid JSON.", Filepath);
+			return nullptr;
+		}
+		const rapidjson::Value* pAsset = FindObject(File.Json, "asset");
+		if (!pAsset || GetString(*pAsset, "version").compare(0, 2, "2.") != 0) {
+			IE_CORE_WARN("glTF \"{0}\": only glTF 2.0 is supported.", Filepath);
+			return nullptr;
+		}
+		if (const rapidjson::Value* pRequired = FindArray(File.Json, "extensionsRequired")) {
+			for (rapidjson::SizeType i = 0; i < pRequired->Size(); ++i) {
+				const rapidjson::Value& Extension = (*pRequired)[i];
+				if (!Extension.IsString() || !IsExtensionSupported(Extension.GetString())) {
+					IE_CORE_WARN("glTF \"{0}\": requires unsupported extension \"{1}\".", Filepath, Extension.IsString() ? Extension.GetString() : "");
+					return nullptr;
+				}
+			}
+		}
+
+		if (!LoadBuffers(File, GlbBinary) || !LoadBufferViews(File)) {
+			return nullptr;
+		}
+
+		// Every primitive becomes its own mesh, like in Assimp. Meshes map to a range of them.
+		std::vector<std::pair<uint32_t, uint32_t>> MeshPrimitives(GetArraySize(File, "meshes"));
+		std::vector<const rapidjson::Value*> Primitives;
+		size_t NumVertices = 0U;
+		for (size_t i = 0; i < MeshPrimitives.size(); ++i) {
+			const rapidjson::Value* pMesh = GetElement(File, "meshes", i);
+			const rapidjson::Value* pPrimitives = pMesh ? FindArray(*pMesh, "primitives") : nullptr;
+			if (!pPrimitives) {
+				IE_CORE_WARN("glTF \"{0}\": mesh {1} has no primitives.", Filepath, i);
+				return nullptr;
+			}
+			MeshPrimitives[i] = { static_cast<uint32_t>(Primitives.size()), pPrimitives->Size() };
+			for (rapidjson::SizeType j = 0; j < pPrimitives->Size(); ++j) {
+				const rapidjson::Value& Primitive = (*pPrimitives)[j];
+				Primitives.push_back(&Primitive);
+				const rapidjson::Value* pAttributes = FindObject(Primitive, "attributes");
+				const rapidjson::Value* pPosition = pAttributes ? GetElement(File, "accessors", GetUint(*pAttributes, "POSITION", UINT64_MAX)) : nullptr;
+				NumVertices += pPosition ? static_cast<size_t>(GetUint(*pPosition, "count", 0U)) : 0U;
+			}
+		}
+
+		shared_ptr<ImportedModel> pImport = std::make_shared<ImportedModel>();
+		pImport->Meshes.resize(Primitives.size());
+		std::atomic<bool> Failed(false);
+		auto ConvertMesh = [&File, &Primitives, &pImport, &Failed](uint32_t i) {
+			ScopedMemoryCategory MeshMemoryScope(eMemoryCategory::Geometry);
+			if (!ConvertPrimitive(File, *Primitives[i], pImport->Meshes[i])) {
+				IE_CORE_WARN("glTF \"{0}\": primitive {1} is invalid or not a triangle primitive.", File.Filepath, i);
+				Failed = true;
+			}
+		};
+		if (NumVertices >= IE_GLTF_PARALLEL_VERTEX_THRESHOLD) {
+			ThreadPool::ParallelFor(static_cast<uint32_t>(Primitives.size()), ConvertMesh);
+		}
+		else {
+			for (uint32_t i = 0; i < Primitives.size(); ++i) {
+				ConvertMesh(i);
+			}
+		}
+		if (Failed) {
+			return nullptr;
+		}
+
+		// The scene's root nodes go under a root of our own, the model's root transform is owned by its component.
+		pImport->pRoot = std::make_unique<ImportedNode>();
+		XMStoreFloat4x4(&pImport->pRoot->LocalMatrix, XMMatrixIdentity());
+		std::vector<bool> Visited(GetArraySize(File, "nodes"), false);
+		const rapidjson::Value* pScene = GetElement(File, "scenes", GetUint(File.Json, "scene", 0U));
+		const rapidjson::Value* pRootNodes = pScene ? FindArray(*pScene, "nodes") : nullptr;
+		pImport->pRoot->Name = pScene ? GetString(*pScene, "name") : std::string();
+		if (pRootNodes) {
+			for (rapidjson::SizeType i = 0; i < pRootNodes->Size(); ++i) {
+				const rapidjson::Value& RootNode = (*pRootNodes)[i];
+				unique_ptr<ImportedNode> pNode = RootNode.IsUint() ? ParseNode_r(File, RootNode.GetUint(), MeshPrimitives, Visited) : nullptr;
+				if (!pNode) {
+					IE_CORE_WARN("glTF \"{0}\": invalid node hierarchy.", Filepath);
+					return nullptr;
+				}
+				pImport->pRoot->Children.push_back(std::move(pNode));
+			}
+		}
+		else {
+			// Without scenes every mesh is shown once, untransformed.
+			for (uint32_t i = 0; i < pImport->Meshes.size(); ++i) {
+				pImport->pRoot->MeshIndices.push_back(i);
+			}
+		}
+		return pImport;
+	}
+
+}
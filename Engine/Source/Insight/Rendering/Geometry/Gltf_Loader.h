@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <assimp/postprocess.h>
+
+/*
+	Native glTF 2.0 loader, used instead of Assimp for ".gltf" and ".glb" files. Accessors
+	are read straight from the mapped file into the mesh's vertex and index streams, the
+	result is the same ImportedModel Assimp's path produces and is optimized and cooked
+	the same way.
+
+	Supported:
+		Embedded (GLB and base64 data URIs) and external buffers.
+		Triangle lists, strips and fans. Any accessor component type, normalized or not, and sparse accessors.
+		The node hierarchy of the default scene, matrices or TRS.
+		Material assignments, with KHR_texture_transform on the base color texture applied to the texture coordinates.
+		EXT_meshopt_compression and KHR_mesh_quantization, as written by gltfpack.
+
+	Assimp post processing flags outside IE_GLTF_SUPPORTED_IMPORT_FLAGS, files needing an
+	unknown extension and primitives other than triangles are left to Assimp, 'Load' returns
+	nullptr for them and the caller falls back to it.
+
+	Example usage:
+		shared_ptr<ImportedModel> pImport;
+		if (GltfLoader::CanLoad(SourcePath, ImportFlags)) {
+			pImport = GltfLoader::Load(SourcePath, ImportFlags);
+		}
+*/
+
+// Assimp post processing flags the loader reproduces itself.
+#define IE_GLTF_SUPPORTED_IMPORT_FLAGS (aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded)
+
+namespace Insight {
+
+	struct ImportedModel;
+
+	class INSIGHT_API GltfLoader
+	{
+	public:
+		// True for ".gltf" and ".glb" files imported with supported flags.
+		static bool CanLoad(const std::string& Filepath, uint32_t ImportFlags);
+		// Returns nullptr if the file is invalid or uses something only Assimp supports.
+		static shared_ptr<ImportedModel> Load(const std::string& Filepath, uint32_t ImportFlags);
+	};
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
+#include "Insight/Rendering/Geometry/Index_Buffer.h"
+#include "Insight/Rendering/Geometry/Meshlet_Builder.h"
+
+namespace Insight {
+
+	// Node of the model's hierarchy as read from the file. Meshes are referenced by index
+	// since the 'Mesh' objects are only created once the import is finished.
+	struct ImportedNode
+	{
+		XMFLOAT4X4 LocalMatrix;
+		std::string Name;
+		std::vector<uint32_t> MeshIndices;
+		std::vector<unique_ptr<ImportedNode>> Children;
+	};
+
+	struct ImportedMesh
+	{
+		Verticies MeshVerticies;
+		Indices MeshIndices;
+		// Index of the material the mesh was assigned in the source file.
+		uint32_t MaterialIndex = 0U;
+		// Clusters of 'MeshIndices', built once the mesh is final.
+		std::vector<Meshlet> Meshlets;
+	};
+
+	// Everything read from a model file, kept between 'Model::Import' and the creation of its 'ModelAsset'.
+	// Filled either by Assimp from the source file or from its cooked copy, see Cooked_Mesh.h.
+	struct ImportedModel
+	{
+		std::vector<ImportedMesh> Meshes;
+		unique_ptr<ImportedNode> pRoot;
+	};
+
+}
@@ -2,6 +2,8 @@
 
 #include <Insight/Core.h>
 
+#include <vector>
+
 
 namespace Insight {
 
@@ -10,20 +12,26 @@ namespace Insight {
 	class INSIGHT_API ieIndexBuffer
 	{
 	public:
-		ieIndexBuffer(Indices Indices)
-			: m_Indices(std::move(Indices)) {}
+		// 'Data' holds 16-bit indices if 'Is16Bit' is set, 32-bit otherwise. See VertexPacking::PackIndices.
+		ieIndexBuffer(std::vector<uint8_t> Data, bool Is16Bit)
+			: m_Data(std::move(Data)), m_Is16Bit(Is16Bit), m_NumIndices(static_cast<uint32_t>(m_Data.size() / (Is16Bit ? sizeof(uint16_t) : sizeof(uint32_t)))), m_BufferSize(static_cast<uint32_t>(m_Data.size())) {}
 		virtual ~ieIndexBuffer() = default;
 
 		virtual void Destroy() {}
 
 		uint32_t GetNumIndices() { return m_NumIndices; }
 		uint32_t GetBufferSize() { return m_BufferSize; }
+		bool Is16Bit() const { return m_Is16Bit; }
 	protected:
 		virtual bool CreateResources() { return true; }
+		// Free the index data once it has been copied to GPU or upload memory.
+		void ReleaseCPUData() { std::vector<uint8_t>().swap(m_Data); }
 
 	protected:
-		Indices			m_Indices;
-		unsigned long	m_NumIndices = 0;
+		// Only valid until the buffer's resources are created.
+		std::vector<uint8_t> m_Data;
+		bool			m_Is16Bit = false;
+		uint32_t		m_NumIndices = 0U;
 		uint32_t		m_BufferSize = 0U;
 	};
 
@@ -5,21 +5,11 @@
 #include "Insight/Core/Application.h"
 #include "Insight/Rendering/Renderer.h"
 
-#include "Platform/Windows/DirectX_11/Geometry/D3D11_Index_Buffer.h"
-#include "Platform/Windows/DirectX_11/Geometry/D3D11_Vertex_Buffer.h"
-#include "Platform/Windows/DirectX_12/Geometry/D3D12_Index_Buffer.h"
-#include "Platform/Windows/DirectX_12/Geometry/D3D12_Vertex_Buffer.h"
-
 #include "imgui.h"
 
 namespace Insight {
 
 
-	Mesh::Mesh(Verticies Verticies, Indices Indices)
-	{
-		Init(Verticies, Indices);
-	}
-
 	Mesh::~Mesh()
 	{
 		Destroy();
@@ -27,13 +17,6 @@ namespace Insight {
 
 	void Mesh::Destroy()
 	{
-		delete m_pVertexBuffer;
-		delete m_pIndexBuffer;
-	}
-
-	void Mesh::Init(Verticies& Verticies, Indices& Indices)
-	{
-		CreateBuffers(Verticies, Indices);
 	}
 
 	void Mesh::PreRender(const XMMATRIX& parentMat)
@@ -54,61 +37,54 @@ namespace Insight {
 
 	uint32_t Mesh::GetVertexCount()
 	{
-		return m_pVertexBuffer->GetNumVerticies();
+		return m_pGeometry->GetVertexCount();
 	}
 
 	uint32_t Mesh::GetVertexBufferSize()
 	{
-		return m_pVertexBuffer->GetBufferSize();
+		return m_pGeometry->GetVertexBufferSize();
 	}
 
 	uint32_t Mesh::GetIndexCount()
 	{
-		return m_pIndexBuffer->GetBufferSize();
+		return m_pGeometry->GetIndexCount();
 	}
 
 	uint32_t Mesh::GetIndexBufferSize()
 	{
-		return m_pIndexBuffer->GetBufferSize();
+		return m_pGeometry->GetIndexBufferSize();
 	}
 
 	void Mesh::Render(ID3D12GraphicsCommandList* pCommandList)
 	{
-		Renderer::SetVertexBuffers(0, 1, m_pVertexBuffer);
-		Renderer::SetIndexBuffer(m_pIndexBuffer);
-		Renderer::DrawIndexedInstanced(m_pIndexBuffer->GetNumIndices(), 1, 0, 0, 0);
+		m_pGeometry->Render(pCommandList);
 	}
 
-	void Mesh::OnImGuiRender()
+	void Mesh::CullMeshlets(const MeshletCuller::View& View)
 	{
+		m_VisibleRanges.clear();
+		// A single meshlet is the whole mesh, culling it would only save what the GPU's own clipping already does.
+		m_HasCulledRanges = m_pGeometry->GetMeshlets().size() > 1U;
+		if (!m_HasCulledRanges) {
+			return;
+		}
+		XMFLOAT4X4 World;
+		XMStoreFloat4x4(&World, m_Transform.GetWorldMatrixRef());
+		MeshletCuller::Cull(m_pGeometry->GetMeshlets(), World, View, m_VisibleRanges);
 	}
 
-	void Mesh::CreateBuffers(Verticies& Verticies, Indices& Indices)
+	void Mesh::RenderVisible(ID3D12GraphicsCommandList* pCommandList)
 	{
-		switch (Renderer::GetAPI()) {
-		case Renderer::eTargetRenderAPI::D3D_11:
-		{
-			m_pVertexBuffer = new D3D11VertexBuffer(Verticies);
-			m_pIndexBuffer = new D3D11IndexBuffer(Indices);
-			break;
-		}
-		case Renderer::eTargetRenderAPI::D3D_12:
-		{
-			m_pVertexBuffer = new D3D12VertexBuffer(Verticies);
-			m_pIndexBuffer = new D3D12IndexBuffer(Indices);
-			break;
-		}
-		case Renderer::eTargetRenderAPI::INVALID:
-		{
-			IE_CORE_FATAL(L"Mesh trying to be created before the renderer has been initialized.");
-			break;
-		}
-		default:
-		{
-			IE_CORE_ERROR("Failed to determine vertex buffer type for mesh.");
-			break;
+		if (m_HasCulledRanges) {
+			m_pGeometry->RenderRanges(m_VisibleRanges);
 		}
+		else {
+			m_pGeometry->Render(pCommandList);
 		}
 	}
-}
 
+	void Mesh::OnImGuiRender()
+	{
+	}
+
+}
@@ -6,21 +6,26 @@
 
 #include "Platform/Windows/DirectX_Shared/Constant_Buffer_Types.h"
 
-#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
-#include "Insight/Rendering/Geometry/Index_Buffer.h"
+#include "Insight/Rendering/Geometry/Model_Asset.h"
 
 namespace Insight {
 
-
+	// One instance of a mesh in a model. The geometry is shared with every other
+	// model loaded from the same asset, only the transform and constant buffer are per instance.
 	class INSIGHT_API Mesh
 	{
 	public:
-		Mesh(Verticies Verticies, Indices Indices);
+		Mesh(const MeshGeometry& Geometry)
+			: m_pGeometry(&Geometry) {}
 		//Mesh(Mesh&& mesh) noexcept;
 		~Mesh();
 
 		void PreRender(const XMMATRIX& parentMat);
 		void Render(ID3D12GraphicsCommandList* pCommandList);
+		// Cull the mesh's meshlets against the view, call after PreRender so the world matrix is current.
+		void CullMeshlets(const MeshletCuller::View& View);
+		// Draw only the meshlets that survived the last CullMeshlets, or the whole mesh if it was not culled.
+		void RenderVisible(ID3D12GraphicsCommandList* pCommandList);
 		void Destroy();
 		void OnImGuiRender();
 
@@ -35,16 +40,15 @@ namespace Insight {
 		uint32_t GetIndexBufferSize();
 
 	private:
-		void Init(Verticies& verticies, Indices& indices);
-		void CreateBuffers(Verticies& Verticies, Indices& Indices);
-
-	private:
-		ieVertexBuffer* m_pVertexBuffer;
-		ieIndexBuffer* m_pIndexBuffer;
+		// Owned by the model's asset, which outlives this mesh.
+		const MeshGeometry* m_pGeometry;
 
 		ieTransform					m_Transform;
 		CB_VS_PerObject				m_ConstantBufferPerObject = {};
 
+		std::vector<MeshletIndexRange> m_VisibleRanges;
+		bool						m_HasCulledRanges = false;
+
 		bool						m_CastsShadows = true;
 	};
 }
@@ -2,13 +2,15 @@
 
 #include <Insight/Core.h>
 
+#include "Insight/Utilities/String_Interner.h"
+
 namespace Insight {
 
 	class INSIGHT_API MeshNode
 	{
 	public:
-		MeshNode(std::vector<Mesh*> meshChildren, ieTransform transform, std::string displayName = "Default Mesh Node")
-			: m_MeshChildren(meshChildren), m_Transform(transform), m_DisplayName(displayName) {}
+		MeshNode(std::vector<Mesh*> meshChildren, ieTransform transform, ieSymbol displayName = "Default Mesh Node")
+			: m_MeshChildren(std::move(meshChildren)), m_Transform(transform), m_DisplayName(displayName) {}
 		~MeshNode() {}
 
 		void PreRender(XMMATRIX& parentMat, UINT32& gpuAddressOffset);
@@ -24,7 +26,7 @@ namespace Insight {
 		std::vector<unique_ptr<MeshNode>> m_Children;
 		std::vector<Mesh*> m_MeshChildren;
 		ieTransform m_Transform;
-		std::string m_DisplayName;
+		ieSymbol m_DisplayName;
 		
 		int ConstantBufferPerObjectAlignedSize = (sizeof(CB_VS_PerObject) + 255) & ~255;
 	};
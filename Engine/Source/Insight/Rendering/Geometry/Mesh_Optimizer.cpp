@@ -0,0 +1,481 @@
+// No precompiled header, this file is also built by Engine_Tests. See 'PortableEngineFiles' in premake5.lua.
+#include "Mesh_Optimizer.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <unordered_map>
+
+// Post-transform cache simulated when measuring ACMR and ATVR and when looking for overdraw cluster boundaries.
+#define IE_MESH_OPTIMIZER_FIFO_CACHE_SIZE 16U
+// Cache modelled by the vertex cache optimizer's scoring.
+#define IE_MESH_OPTIMIZER_LRU_CACHE_SIZE 32U
+// Width and height in pixels of each view rasterized when measuring overdraw.
+#define IE_MESH_OPTIMIZER_OVERDRAW_GRID 256
+
+namespace Insight {
+
+	static const uint32_t s_InvalidIndex = ~0U;
+
+	struct OptimizerFloat3
+	{
+		float x, y, z;
+	};
+
+	static inline OptimizerFloat3 Subtract(const ieFloat3& A, const ieFloat3& B) { return { A.x - B.x, A.y - B.y, A.z - B.z }; }
+	static inline OptimizerFloat3 Cross(const OptimizerFloat3& A, const OptimizerFloat3& B) { return { A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x }; }
+
+	void MeshOptimizer::Optimize(Verticies& MeshVerticies, Indices& MeshIndices)
+	{
+		if (MeshIndices.empty() || MeshIndices.size() % 3 != 0) {
+			return;
+		}
+		WeldVertices(MeshVerticies, MeshIndices);
+		OptimizeVertexCache(MeshIndices, MeshVerticies.size());
+		OptimizeOverdraw(MeshVerticies, MeshIndices);
+		OptimizeVertexFetch(MeshVerticies, MeshIndices);
+	}
+
+
+	// ----------------
+	// Vertex Welding
+	// ----------------
+
+	uint32_t MeshOptimizer::WeldVertices(Verticies& MeshVerticies, Indices& MeshIndices)
+	{
+		struct VertexHash
+		{
+			size_t operator()(const Vertex3D* pVertex) const
+			{
+				// FNV-1a over the raw bytes, vertices are only merged if they are bit-identical.
+				const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pVertex);
+				uint32_t Hash = 2166136261U;
+				for (size_t i = 0; i < sizeof(Vertex3D); ++i) {
+					Hash = (Hash ^ pBytes[i]) * 16777619U;
+				}
+				return Hash;
+			}
+		};
+		struct VertexEqual
+		{
+			bool operator()(const Vertex3D* pA, const Vertex3D* pB) const { return memcmp(pA, pB, sizeof(Vertex3D)) == 0; }
+		};
+
+		std::unordered_map<const Vertex3D*, uint32_t, VertexHash, VertexEqual> Lookup;
+		Lookup.reserve(MeshVerticies.size());
+		std::vector<uint32_t> Remap(MeshVerticies.size());
+		Verticies Welded;
+		Welded.reserve(MeshVerticies.size());
+		for (size_t i = 0; i < MeshVerticies.size(); ++i) {
+			auto Result = Lookup.emplace(&MeshVerticies[i], static_cast<uint32_t>(Welded.size()));
+			if (Result.second) {
+				Welded.push_back(MeshVerticies[i]);
+			}
+			Remap[i] = Result.first->second;
+		}
+
+		const uint32_t NumRemoved = static_cast<uint32_t>(MeshVerticies.size() - Welded.size());
+		if (NumRemoved > 0U) {
+			for (Indices::value_type& Index : MeshIndices) {
+				Index = Remap[Index];
+			}
+			MeshVerticies.swap(Welded);
+		}
+		return NumRemoved;
+	}
+
+
+	// -------------------------
+	// Vertex Cache Optimization
+	// -------------------------
+
+	// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation".
+	static float ScoreVertex(int32_t CachePosition, uint32_t NumRemainingTriangles)
+	{
+		if (NumRemainingTriangles == 0U) {
+			return -1.0f;
+		}
+
+		float Score = 0.0f;
+		if (CachePosition >= 0) {
+			// The last triangle's vertices get a fixed score so the next triangle does not just reuse its edge.
+			if (CachePosition < 3) {
+				Score = 0.75f;
+			}
+			else {
+				const float Scale = 1.0f / (IE_MESH_OPTIMIZER_LRU_CACHE_SIZE - 3U);
+				Score = powf(1.0f - (CachePosition - 3) * Scale, 1.5f);
+			}
+		}
+		// Favour vertices with few triangles left so they are finished off and leave the cache.
+		Score += 2.0f * powf(static_cast<float>(NumRemainingTriangles), -0.5f);
+		return Score;
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(Indices& MeshIndices, size_t NumVertices)
+	{
+		const uint32_t NumTriangles = static_cast<uint32_t>(MeshIndices.size() / 3U);
+		if (NumTriangles < 2U) {
+			return;
+		}
+
+		// Triangles using each vertex. The first 'NumRemaining[v]' entries of a vertex's range are the ones not emitted yet.
+		std::vector<uint32_t> NumRemaining(NumVertices, 0U);
+		for (Indices::value_type Index : MeshIndices) {
+			++NumRemaining[Index];
+		}
+		std::vector<uint32_t> AdjacencyOffsets(NumVertices + 1U, 0U);
+		for (size_t i = 0; i < NumVertices; ++i) {
+			AdjacencyOffsets[i + 1U] = AdjacencyOffsets[i] + NumRemaining[i];
+		}
+		std::vector<uint32_t> Adjacency(MeshIndices.size());
+		{
+			std::vector<uint32_t> Cursors(AdjacencyOffsets.begin(), AdjacencyOffsets.end() - 1);
+			for (uint32_t i = 0; i < MeshIndices.size(); ++i) {
+				Adjacency[Cursors[MeshIndices[i]]++] = i / 3U;
+			}
+		}
+
+		std::vector<float> VertexScores(NumVertices);
+		for (size_t i = 0; i < NumVertices; ++i) {
+			VertexScores[i] = ScoreVertex(-1, NumRemaining[i]);
+		}
+		auto ScoreTriangle = [&MeshIndices, &VertexScores](uint32_t Triangle) {
+			return VertexScores[MeshIndices[Triangle * 3U]] + VertexScores[MeshIndices[Triangle * 3U + 1U]] + VertexScores[MeshIndices[Triangle * 3U + 2U]];
+		};
+		std::vector<uint8_t> IsEmitted(NumTriangles, 0U);
+		uint32_t BestTriangle = 0U;
+		float BestScore = ScoreTriangle(0U);
+		for (uint32_t i = 1; i < NumTriangles; ++i) {
+			const float Score = ScoreTriangle(i);
+			if (Score > BestScore) {
+				BestScore = Score;
+				BestTriangle = i;
+			}
+		}
+
+		Indices Output;
+		Output.reserve(MeshIndices.size());
+		uint32_t Cache[IE_MESH_OPTIMIZER_LRU_CACHE_SIZE + 3U];
+		uint32_t CacheSize = 0U;
+		uint32_t DeadEndCursor = 0U;
+		while (Output.size() < MeshIndices.size()) {
+			// Nothing in the cache has triangles left, continue with the first triangle not emitted yet.
+			if (BestTriangle == s_InvalidIndex) {
+				while (IsEmitted[DeadEndCursor]) {
+					++DeadEndCursor;
+				}
+				BestTriangle = DeadEndCursor;
+			}
+
+			const uint32_t Corners[3] = {
+				static_cast<uint32_t>(MeshIndices[BestTriangle * 3U]),
+				static_cast<uint32_t>(MeshIndices[BestTriangle * 3U + 1U]),
+				static_cast<uint32_t>(MeshIndices[BestTriangle * 3U + 2U])
+			};
+			IsEmitted[BestTriangle] = 1U;
+			for (uint32_t Corner = 0; Corner < 3U; ++Corner) {
+				const uint32_t Vertex = Corners[Corner];
+				Output.push_back(Vertex);
+
+				uint32_t* pTriangles = &Adjacency[AdjacencyOffsets[Vertex]];
+				for (uint32_t i = 0; i < NumRemaining[Vertex]; ++i) {
+					if (pTriangles[i] == BestTriangle) {
+						pTriangles[i] = pTriangles[NumRemaining[Vertex] - 1U];
+						--NumRemaining[Vertex];
+						break;
+					}
+				}
+			}
+
+			// Most recently used first. Entries pushed past the modelled size are kept for one
+			// iteration so their scores drop back to uncached.
+			uint32_t NewCache[IE_MESH_OPTIMIZER_LRU_CACHE_SIZE + 3U];
+			uint32_t NewCacheSize = 0U;
+			for (uint32_t Corner = 0; Corner < 3U; ++Corner) {
+				if (std::find(NewCache, NewCache + NewCacheSize, Corners[Corner]) == NewCache + NewCacheSize) {
+					NewCache[NewCacheSize++] = Corners[Corner];
+				}
+			}
+			for (uint32_t i = 0; i < CacheSize; ++i) {
+				if (std::find(Corners, Corners + 3, Cache[i]) == Corners + 3) {
+					NewCache[NewCacheSize++] = Cache[i];
+				}
+			}
+
+			for (uint32_t i = 0; i < NewCacheSize; ++i) {
+				const int32_t CachePosition = (i < IE_MESH_OPTIMIZER_LRU_CACHE_SIZE) ? static_cast<int32_t>(i) : -1;
+				VertexScores[NewCache[i]] = ScoreVertex(CachePosition, NumRemaining[NewCache[i]]);
+			}
+
+			// Only triangles touching the cache changed score, the best of them is emitted next.
+			BestTriangle = s_InvalidIndex;
+			BestScore = -1.0f;
+			for (uint32_t i = 0; i < NewCacheSize; ++i) {
+				const uint32_t Vertex = NewCache[i];
+				const uint32_t* pTriangles = &Adjacency[AdjacencyOffsets[Vertex]];
+				for (uint32_t j = 0; j < NumRemaining[Vertex]; ++j) {
+					const uint32_t Triangle = pTriangles[j];
+					const float Score = ScoreTriangle(Triangle);
+					if (Score > BestScore) {
+						BestScore = Score;
+						BestTriangle = Triangle;
+					}
+				}
+			}
+
+			CacheSize = std::min(NewCacheSize, IE_MESH_OPTIMIZER_LRU_CACHE_SIZE);
+			memcpy(Cache, NewCache, CacheSize * sizeof(uint32_t));
+		}
+
+		MeshIndices.swap(Output);
+	}
+
+
+	// ----------------------
+	// Overdraw Optimization
+	// ----------------------
+
+	void MeshOptimizer::OptimizeOverdraw(const Verticies& MeshVerticies, Indices& MeshIndices, float CacheThreshold)
+	{
+		const uint32_t NumTriangles = static_cast<uint32_t>(MeshIndices.size() / 3U);
+		if (NumTriangles < 2U) {
+			return;
+		}
+
+		// Split where the simulated cache misses on every corner, reordering whole clusters
+		// between those points costs little cache efficiency.
+		std::vector<uint32_t> ClusterStarts;
+		{
+			std::vector<uint32_t> Timestamps(MeshVerticies.size(), 0U);
+			uint32_t Time = IE_MESH_OPTIMIZER_FIFO_CACHE_SIZE + 1U;
+			for (uint32_t i = 0; i < NumTriangles; ++i) {
+				uint32_t NumMisses = 0U;
+				for (uint32_t Corner = 0; Corner < 3U; ++Corner) {
+					const Indices::value_type Index = MeshIndices[i * 3U + Corner];
+					if (Time - Timestamps[Index] > IE_MESH_OPTIMIZER_FIFO_CACHE_SIZE) {
+						Timestamps[Index] = Time++;
+						++NumMisses;
+					}
+				}
+				if (i == 0U || NumMisses == 3U) {
+					ClusterStarts.push_back(i);
+				}
+			}
+		}
+		if (ClusterStarts.size() < 2U) {
+			return;
+		}
+		const uint32_t NumClusters = static_cast<uint32_t>(ClusterStarts.size());
+		ClusterStarts.push_back(NumTriangles);
+
+		// Area weighted centroid and normal of every cluster and of the whole mesh.
+		std::vector<OptimizerFloat3> ClusterCentroids(NumClusters);
+		std::vector<OptimizerFloat3> ClusterNormals(NumClusters);
+		OptimizerFloat3 MeshCentroid = { 0.0f, 0.0f, 0.0f };
+		float MeshArea = 0.0f;
+		for (uint32_t Cluster = 0; Cluster < NumClusters; ++Cluster) {
+			OptimizerFloat3 Centroid = { 0.0f, 0.0f, 0.0f };
+			OptimizerFloat3 Normal = { 0.0f, 0.0f, 0.0f };
+			float ClusterArea = 0.0f;
+			for (uint32_t i = ClusterStarts[Cluster]; i < ClusterStarts[Cluster + 1U]; ++i) {
+				const ieFloat3& A = MeshVerticies[MeshIndices[i * 3U]].Position;
+				const ieFloat3& B = MeshVerticies[MeshIndices[i * 3U + 1U]].Position;
+				const ieFloat3& C = MeshVerticies[MeshIndices[i * 3U + 2U]].Position;
+				// Clockwise front faces, so this points out of the surface.
+				const OptimizerFloat3 Face = Cross(Subtract(B, A), Subtract(C, A));
+				const float Area = sqrtf(Face.x * Face.x + Face.y * Face.y + Face.z * Face.z);
+				Normal.x += Face.x;
+				Normal.y += Face.y;
+				Normal.z += Face.z;
+				Centroid.x += (A.x + B.x + C.x) * Area;
+				Centroid.y += (A.y + B.y + C.y) * Area;
+				Centroid.z += (A.z + B.z + C.z) * Area;
+				ClusterArea += Area;
+			}
+			MeshCentroid.x += Centroid.x;
+			MeshCentroid.y += Centroid.y;
+			MeshCentroid.z += Centroid.z;
+			MeshArea += ClusterArea;
+
+			const float CentroidScale = (ClusterArea > 0.0f) ? 1.0f / (ClusterArea * 3.0f) : 0.0f;
+			ClusterCentroids[Cluster] = { Centroid.x * CentroidScale, Centroid.y * CentroidScale, Centroid.z * CentroidScale };
+			const float NormalLength = sqrtf(Normal.x * Normal.x + Normal.y * Normal.y + Normal.z * Normal.z);
+			const float NormalScale = (NormalLength > 0.0f) ? 1.0f / NormalLength : 0.0f;
+			ClusterNormals[Cluster] = { Normal.x * NormalScale, Normal.y * NormalScale, Normal.z * NormalScale };
+		}
+		const float MeshCentroidScale = (MeshArea > 0.0f) ? 1.0f / (MeshArea * 3.0f) : 0.0f;
+		MeshCentroid = { MeshCentroid.x * MeshCentroidScale, MeshCentroid.y * MeshCentroidScale, MeshCentroid.z * MeshCentroidScale };
+
+		// Clusters on the outside facing away from the centre are likely to occlude the rest, draw them first.
+		std::vector<float> SortKeys(NumClusters);
+		for (uint32_t Cluster = 0; Cluster < NumClusters; ++Cluster) {
+			const OptimizerFloat3& Centroid = ClusterCentroids[Cluster];
+			const OptimizerFloat3& Normal = ClusterNormals[Cluster];
+			SortKeys[Cluster] = (Centroid.x - MeshCentroid.x) * Normal.x + (Centroid.y - MeshCentroid.y) * Normal.y + (Centroid.z - MeshCentroid.z) * Normal.z;
+		}
+		std::vector<uint32_t> ClusterOrder(NumClusters);
+		for (uint32_t i = 0; i < NumClusters; ++i) {
+			ClusterOrder[i] = i;
+		}
+		std::stable_sort(ClusterOrder.begin(), ClusterOrder.end(), [&SortKeys](uint32_t A, uint32_t B) { return SortKeys[A] > SortKeys[B]; });
+
+		Indices Output;
+		Output.reserve(MeshIndices.size());
+		for (uint32_t Cluster : ClusterOrder) {
+			Output.insert(Output.end(), MeshIndices.begin() + ClusterStarts[Cluster] * 3U, MeshIndices.begin() + ClusterStarts[Cluster + 1U] * 3U);
+		}
+
+		float InputACMR = 0.0f, OutputACMR = 0.0f, ATVR = 0.0f;
+		AnalyzeVertexCache(MeshIndices, MeshVerticies.size(), InputACMR, ATVR);
+		AnalyzeVertexCache(Output, MeshVerticies.size(), OutputACMR, ATVR);
+		if (OutputACMR <= InputACMR * CacheThreshold) {
+			MeshIndices.swap(Output);
+		}
+	}
+
+
+	// --------------------------
+	// Vertex Fetch Optimization
+	// --------------------------
+
+	void MeshOptimizer::OptimizeVertexFetch(Verticies& MeshVerticies, Indices& MeshIndices)
+	{
+		std::vector<uint32_t> Remap(MeshVerticies.size(), s_InvalidIndex);
+		Verticies Output;
+		Output.reserve(MeshVerticies.size());
+		for (Indices::value_type& Index : MeshIndices) {
+			if (Remap[Index] == s_InvalidIndex) {
+				Remap[Index] = static_cast<uint32_t>(Output.size());
+				Output.push_back(MeshVerticies[Index]);
+			}
+			Index = Remap[Index];
+		}
+		MeshVerticies.swap(Output);
+	}
+
+
+	// ----------
+	// Analysis
+	// ----------
+
+	MeshOptimizer::Stats MeshOptimizer::Analyze(const Verticies& MeshVerticies, const Indices& MeshIndices)
+	{
+		Stats Result;
+		Result.NumVertices = static_cast<uint32_t>(MeshVerticies.size());
+		Result.NumTriangles = static_cast<uint32_t>(MeshIndices.size() / 3U);
+		AnalyzeVertexCache(MeshIndices, MeshVerticies.size(), Result.ACMR, Result.ATVR);
+		Result.Overdraw = AnalyzeOverdraw(MeshVerticies, MeshIndices);
+		return Result;
+	}
+
+	void MeshOptimizer::AnalyzeVertexCache(const Indices& MeshIndices, size_t NumVertices, float& OutACMR, float& OutATVR)
+	{
+		// A vertex hits if it was transformed within the last 'CacheSize' misses.
+		std::vector<uint32_t> Timestamps(NumVertices, 0U);
+		uint32_t Time = IE_MESH_OPTIMIZER_FIFO_CACHE_SIZE + 1U;
+		uint32_t NumMisses = 0U;
+		for (Indices::value_type Index : MeshIndices) {
+			if (Time - Timestamps[Index] > IE_MESH_OPTIMIZER_FIFO_CACHE_SIZE) {
+				Timestamps[Index] = Time++;
+				++NumMisses;
+			}
+		}
+		const size_t NumTriangles = MeshIndices.size() / 3U;
+		OutACMR = (NumTriangles > 0U) ? static_cast<float>(NumMisses) / NumTriangles : 0.0f;
+		OutATVR = (NumVertices > 0U) ? static_cast<float>(NumMisses) / NumVertices : 0.0f;
+	}
+
+	float MeshOptimizer::AnalyzeOverdraw(const Verticies& MeshVerticies, const Indices& MeshIndices)
+	{
+		if (MeshVerticies.empty() || MeshIndices.size() < 3U) {
+			return 0.0f;
+		}
+
+		float Min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (const Vertex3D& Vertex : MeshVerticies) {
+			const float Position[3] = { Vertex.Position.x, Vertex.Position.y, Vertex.Position.z };
+			for (uint32_t Axis = 0; Axis < 3U; ++Axis) {
+				Min[Axis] = std::min(Min[Axis], Position[Axis]);
+				Max[Axis] = std::max(Max[Axis], Position[Axis]);
+			}
+		}
+		const float Extent = std::max(std::max(Max[0] - Min[0], Max[1] - Min[1]), Max[2] - Min[2]);
+		const float Scale = (Extent > 0.0f) ? (IE_MESH_OPTIMIZER_OVERDRAW_GRID - 1) / Extent : 0.0f;
+
+		const int32_t Grid = IE_MESH_OPTIMIZER_OVERDRAW_GRID;
+		std::vector<float> DepthBuffer(Grid * Grid);
+		uint64_t NumShaded = 0U;
+		uint64_t NumCovered = 0U;
+
+		// Look down each axis from both sides with back faces culled and a less-than depth test,
+		// so drawing occluders first directly lowers the count.
+		for (uint32_t View = 0; View < 6U; ++View) {
+			const uint32_t DepthAxis = View / 2U;
+			const uint32_t AxisU = (DepthAxis + 1U) % 3U;
+			const uint32_t AxisV = (DepthAxis + 2U) % 3U;
+			const float Direction = (View % 2U == 0U) ? 1.0f : -1.0f;
+			std::fill(DepthBuffer.begin(), DepthBuffer.end(), FLT_MAX);
+
+			for (size_t i = 0; i + 2U < MeshIndices.size(); i += 3U) {
+				const ieFloat3* pCorners[3] = {
+					&MeshVerticies[MeshIndices[i]].Position,
+					&MeshVerticies[MeshIndices[i + 1U]].Position,
+					&MeshVerticies[MeshIndices[i + 2U]].Position
+				};
+				const OptimizerFloat3 Face = Cross(Subtract(*pCorners[1], *pCorners[0]), Subtract(*pCorners[2], *pCorners[0]));
+				const float FaceAxis[3] = { Face.x, Face.y, Face.z };
+				// The viewer looks along 'Direction', front faces point back at it.
+				if (FaceAxis[DepthAxis] * Direction >= 0.0f) {
+					continue;
+				}
+
+				float X[3], Y[3], Z[3];
+				for (uint32_t Corner = 0; Corner < 3U; ++Corner) {
+					const float Position[3] = { pCorners[Corner]->x, pCorners[Corner]->y, pCorners[Corner]->z };
+					X[Corner] = (Position[AxisU] - Min[AxisU]) * Scale;
+					Y[Corner] = (Position[AxisV] - Min[AxisV]) * Scale;
+					Z[Corner] = Position[DepthAxis] * Direction;
+				}
+				const float Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+				if (fabsf(Area) < 1e-6f) {
+					continue;
+				}
+				const float InvArea = 1.0f / Area;
+
+				const int32_t MinX = std::max(0, static_cast<int32_t>(std::min(std::min(X[0], X[1]), X[2])));
+				const int32_t MaxX = std::min(Grid - 1, static_cast<int32_t>(std::max(std::max(X[0], X[1]), X[2])));
+				const int32_t MinY = std::max(0, static_cast<int32_t>(std::min(std::min(Y[0], Y[1]), Y[2])));
+				const int32_t MaxY = std::min(Grid - 1, static_cast<int32_t>(std::max(std::max(Y[0], Y[1]), Y[2])));
+				for (int32_t PixelY = MinY; PixelY <= MaxY; ++PixelY) {
+					const float SampleY = PixelY + 0.5f;
+					for (int32_t PixelX = MinX; PixelX <= MaxX; ++PixelX) {
+						const float SampleX = PixelX + 0.5f;
+						// Barycentrics from the edge functions, normalized so they are positive inside either winding.
+						const float W0 = ((X[2] - X[1]) * (SampleY - Y[1]) - (Y[2] - Y[1]) * (SampleX - X[1])) * InvArea;
+						const float W1 = ((X[0] - X[2]) * (SampleY - Y[2]) - (Y[0] - Y[2]) * (SampleX - X[2])) * InvArea;
+						const float W2 = 1.0f - W0 - W1;
+						if (W0 < 0.0f || W1 < 0.0f || W2 < 0.0f) {
+							continue;
+						}
+						const float Depth = W0 * Z[0] + W1 * Z[1] + W2 * Z[2];
+						float& Stored = DepthBuffer[PixelY * Grid + PixelX];
+						if (Depth < Stored) {
+							Stored = Depth;
+							++NumShaded;
+						}
+					}
+				}
+			}
+
+			for (float Depth : DepthBuffer) {
+				NumCovered += (Depth != FLT_MAX) ? 1U : 0U;
+			}
+		}
+
+		return (NumCovered > 0U) ? static_cast<float>(NumShaded) / NumCovered : 0.0f;
+	}
+
+}
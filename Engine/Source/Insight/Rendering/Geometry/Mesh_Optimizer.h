@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
+#include "Insight/Rendering/Geometry/Index_Buffer.h"
+
+/*
+	Offline optimization of imported triangle lists. Runs once per mesh when a model is
+	imported from its source file, the result is what gets cooked, so cooked loads pay
+	nothing for it. Has no renderer dependencies and can run on any thread.
+
+	Stages, in order:
+		WeldVertices		Merge bit-identical vertices, Assimp emits one per face corner.
+		OptimizeVertexCache	Reorder triangles for the post-transform cache (Forsyth's algorithm).
+		OptimizeOverdraw	Reorder clusters of triangles so outward facing ones draw first.
+		OptimizeVertexFetch	Reorder vertices by first use and drop unreferenced ones.
+
+	Example usage:
+		MeshOptimizer::Stats Before = MeshOptimizer::Analyze(MeshVerticies, MeshIndices);
+		MeshOptimizer::Optimize(MeshVerticies, MeshIndices);
+		MeshOptimizer::Stats After = MeshOptimizer::Analyze(MeshVerticies, MeshIndices);
+*/
+
+namespace Insight {
+
+	class INSIGHT_API MeshOptimizer
+	{
+	public:
+		struct Stats
+		{
+			uint32_t NumVertices = 0U;
+			uint32_t NumTriangles = 0U;
+			// Average cache miss ratio, vertex shader invocations per triangle. 0.5 is ideal, 3.0 is worst.
+			float ACMR = 0.0f;
+			// Average transformed vertex ratio, vertex shader invocations per vertex. 1.0 is ideal.
+			float ATVR = 0.0f;
+			// Pixels shaded per pixel covered, averaged over six axis aligned views. 1.0 is ideal.
+			float Overdraw = 0.0f;
+		};
+
+	public:
+		// Run every stage.
+		static void Optimize(Verticies& MeshVerticies, Indices& MeshIndices);
+
+		// Returns the number of vertices removed.
+		static uint32_t WeldVertices(Verticies& MeshVerticies, Indices& MeshIndices);
+		static void OptimizeVertexCache(Indices& MeshIndices, size_t NumVertices);
+		// Expects indices already ordered by OptimizeVertexCache. The order is kept if
+		// reordering would make the cache miss ratio worse than 'CacheThreshold' times the input's.
+		static void OptimizeOverdraw(const Verticies& MeshVerticies, Indices& MeshIndices, float CacheThreshold = 1.05f);
+		static void OptimizeVertexFetch(Verticies& MeshVerticies, Indices& MeshIndices);
+
+		// Simulates a FIFO post-transform cache and rasterizes the mesh in software,
+		// results match between runs and machines.
+		static Stats Analyze(const Verticies& MeshVerticies, const Indices& MeshIndices);
+		static void AnalyzeVertexCache(const Indices& MeshIndices, size_t NumVertices, float& OutACMR, float& OutATVR);
+		static float AnalyzeOverdraw(const Verticies& MeshVerticies, const Indices& MeshIndices);
+	};
+
+}
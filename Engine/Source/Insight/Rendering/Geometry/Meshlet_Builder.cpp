@@ -0,0 +1,123 @@
+// No precompiled header, this file is also built by Engine_Tests. See 'PortableEngineFiles' in premake5.lua.
+#include "Meshlet_Builder.h"
+
+#include <float.h>
+#include <math.h>
+#include <algorithm>
+#include <type_traits>
+
+// Facing directions closer than this to perpendicular to the cone axis make the cone too wide to cull with.
+#define IE_MESHLET_MIN_CONE_DOT 0.1f
+
+namespace Insight {
+
+	static_assert(sizeof(Meshlet) % 4 == 0, "Meshlets are cooked as raw records.");
+	static_assert(std::is_trivially_copyable_v<Meshlet>, "Meshlets are cooked as raw records.");
+
+	void MeshletBuilder::Build(const Verticies& MeshVerticies, const Indices& MeshIndices, std::vector<Meshlet>& OutMeshlets, uint32_t MaxVertices, uint32_t MaxTriangles)
+	{
+		OutMeshlets.clear();
+		const uint32_t NumIndices = static_cast<uint32_t>(MeshIndices.size() - MeshIndices.size() % 3U);
+		if (NumIndices == 0U) {
+			return;
+		}
+		OutMeshlets.reserve(NumIndices / (MaxTriangles * 3U) + 1U);
+
+		// Meshlet that last used each vertex, counts the unique vertices without clearing a set per meshlet.
+		std::vector<uint32_t> LastMeshlet(MeshVerticies.size(), UINT32_MAX);
+		uint32_t MeshletIndex = 0U;
+		uint32_t NumMeshletVertices = 0U;
+		Meshlet Current;
+
+		for (uint32_t i = 0; i < NumIndices; i += 3U) {
+			uint32_t NumNewVertices = 0U;
+			for (uint32_t Corner = 0; Corner < 3U; ++Corner) {
+				NumNewVertices += (LastMeshlet[MeshIndices[i + Corner]] != MeshletIndex) ? 1U : 0U;
+			}
+			// Two corners of a degenerate triangle can share a vertex, counting it twice only closes the meshlet early.
+			if (Current.NumIndices > 0U && (NumMeshletVertices + NumNewVertices > MaxVertices || Current.NumIndices / 3U + 1U > MaxTriangles)) {
+				ComputeBounds(MeshVerticies, MeshIndices, Current);
+				OutMeshlets.push_back(Current);
+				Current = Meshlet();
+				Current.FirstIndex = i;
+				++MeshletIndex;
+				NumMeshletVertices = 0U;
+			}
+			for (uint32_t Corner = 0; Corner < 3U; ++Corner) {
+				uint32_t& Last = LastMeshlet[MeshIndices[i + Corner]];
+				if (Last != MeshletIndex) {
+					Last = MeshletIndex;
+					++NumMeshletVertices;
+				}
+			}
+			Current.NumIndices += 3U;
+		}
+		ComputeBounds(MeshVerticies, MeshIndices, Current);
+		OutMeshlets.push_back(Current);
+	}
+
+	void MeshletBuilder::ComputeBounds(const Verticies& MeshVerticies, const Indices& MeshIndices, Meshlet& InOutMeshlet)
+	{
+		const uint32_t First = InOutMeshlet.FirstIndex;
+		const uint32_t Last = InOutMeshlet.FirstIndex + InOutMeshlet.NumIndices;
+
+		// Sphere around the bounding box, deterministic and close enough for small clusters.
+		ieFloat3 Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		ieFloat3 Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (uint32_t i = First; i < Last; ++i) {
+			const ieFloat3& Position = MeshVerticies[MeshIndices[i]].Position;
+			Min = ieFloat3(std::min(Min.x, Position.x), std::min(Min.y, Position.y), std::min(Min.z, Position.z));
+			Max = ieFloat3(std::max(Max.x, Position.x), std::max(Max.y, Position.y), std::max(Max.z, Position.z));
+		}
+		const ieFloat3 Center((Min.x + Max.x) * 0.5f, (Min.y + Max.y) * 0.5f, (Min.z + Max.z) * 0.5f);
+		float RadiusSq = 0.0f;
+		for (uint32_t i = First; i < Last; ++i) {
+			const ieFloat3& Position = MeshVerticies[MeshIndices[i]].Position;
+			const float X = Position.x - Center.x, Y = Position.y - Center.y, Z = Position.z - Center.z;
+			RadiusSq = std::max(RadiusSq, X * X + Y * Y + Z * Z);
+		}
+		InOutMeshlet.Center = Center;
+		InOutMeshlet.Radius = sqrtf(RadiusSq);
+
+		// Face normals come from the winding, which way is out is taken from the vertex normals
+		// so the cone does not depend on the front face convention.
+		std::vector<ieFloat3> FaceNormals;
+		FaceNormals.reserve((Last - First) / 3U);
+		ieFloat3 Sum(0.0f, 0.0f, 0.0f);
+		for (uint32_t i = First; i + 2U < Last; i += 3U) {
+			const Vertex3D& A = MeshVerticies[MeshIndices[i]];
+			const Vertex3D& B = MeshVerticies[MeshIndices[i + 1U]];
+			const Vertex3D& C = MeshVerticies[MeshIndices[i + 2U]];
+			const ieFloat3 AB(B.Position.x - A.Position.x, B.Position.y - A.Position.y, B.Position.z - A.Position.z);
+			const ieFloat3 AC(C.Position.x - A.Position.x, C.Position.y - A.Position.y, C.Position.z - A.Position.z);
+			ieFloat3 Normal(AB.y * AC.z - AB.z * AC.y, AB.z * AC.x - AB.x * AC.z, AB.x * AC.y - AB.y * AC.x);
+			const float Length = sqrtf(Normal.x * Normal.x + Normal.y * Normal.y + Normal.z * Normal.z);
+			if (Length < 1e-12f) {
+				continue;
+			}
+			const float VertexNormalDot = Normal.x * (A.Normal.x + B.Normal.x + C.Normal.x) + Normal.y * (A.Normal.y + B.Normal.y + C.Normal.y) + Normal.z * (A.Normal.z + B.Normal.z + C.Normal.z);
+			const float Scale = (VertexNormalDot < 0.0f ? -1.0f : 1.0f) / Length;
+			Normal = ieFloat3(Normal.x * Scale, Normal.y * Scale, Normal.z * Scale);
+			FaceNormals.push_back(Normal);
+			Sum = ieFloat3(Sum.x + Normal.x, Sum.y + Normal.y, Sum.z + Normal.z);
+		}
+
+		InOutMeshlet.ConeAxis = ieFloat3(0.0f, 0.0f, 0.0f);
+		InOutMeshlet.ConeCutoff = 1.0f;
+		const float SumLength = sqrtf(Sum.x * Sum.x + Sum.y * Sum.y + Sum.z * Sum.z);
+		if (SumLength < 1e-6f) {
+			return;
+		}
+		const ieFloat3 Axis(Sum.x / SumLength, Sum.y / SumLength, Sum.z / SumLength);
+		float MinDot = 1.0f;
+		for (const ieFloat3& Normal : FaceNormals) {
+			MinDot = std::min(MinDot, Normal.x * Axis.x + Normal.y * Axis.y + Normal.z * Axis.z);
+		}
+		InOutMeshlet.ConeAxis = Axis;
+		if (MinDot > IE_MESHLET_MIN_CONE_DOT) {
+			// Sine of the cone's half angle, the cosine of the complementary angle the eye has to be in.
+			InOutMeshlet.ConeCutoff = sqrtf(1.0f - MinDot * MinDot);
+		}
+	}
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
+#include "Insight/Rendering/Geometry/Index_Buffer.h"
+
+/*
+	Splits meshes into meshlets, small clusters of neighbouring triangles with the bounds
+	needed to cull them on their own. Runs at import after the MeshOptimizer and the
+	result is cooked with the mesh. The index buffer is not reordered, every meshlet is a
+	contiguous range of it, so the culled mesh is drawn with one DrawIndexedInstanced per
+	run of visible meshlets. See MeshletCuller.
+
+	Example usage:
+		std::vector<Meshlet> Meshlets;
+		MeshletBuilder::Build(MeshVerticies, MeshIndices, Meshlets);
+*/
+
+#define IE_MESHLET_MAX_VERTICES 64U
+#define IE_MESHLET_MAX_TRIANGLES 124U
+
+namespace Insight {
+
+	struct Meshlet
+	{
+		// Range of the mesh's index buffer holding this meshlet's triangles.
+		uint32_t FirstIndex = 0U;
+		uint32_t NumIndices = 0U;
+		// Bounding sphere, in model space.
+		ieFloat3 Center = {};
+		float Radius = 0.0f;
+		// Cone around every triangle's facing direction. All of them face away from any eye where
+		// dot(Center - Eye, ConeAxis) >= ConeCutoff * length(Center - Eye) + Radius.
+		// A cutoff of 1 means the triangles face too many ways for the meshlet to ever be back facing.
+		ieFloat3 ConeAxis = {};
+		float ConeCutoff = 1.0f;
+	};
+
+	class INSIGHT_API MeshletBuilder
+	{
+	public:
+		// Split a triangle list into meshlets in index order. Expects triangles already ordered
+		// for the vertex cache, which keeps neighbouring triangles together.
+		static void Build(const Verticies& MeshVerticies, const Indices& MeshIndices, std::vector<Meshlet>& OutMeshlets,
+			uint32_t MaxVertices = IE_MESHLET_MAX_VERTICES, uint32_t MaxTriangles = IE_MESHLET_MAX_TRIANGLES);
+		// Fill in the bounding sphere and normal cone of a meshlet from its index range.
+		static void ComputeBounds(const Verticies& MeshVerticies, const Indices& MeshIndices, Meshlet& InOutMeshlet);
+	};
+
+}
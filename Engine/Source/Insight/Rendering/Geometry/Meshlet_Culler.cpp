@@ -0,0 +1,175 @@
+// No precompiled header, this file is also built by Engine_Tests. See 'PortableEngineFiles' in premake5.lua.
+#include "Meshlet_Culler.h"
+
+#include <float.h>
+#include <math.h>
+#include <algorithm>
+
+namespace Insight {
+
+	static inline ieFloat3 Normalize(const ieFloat3& V)
+	{
+		const float Length = sqrtf(V.x * V.x + V.y * V.y + V.z * V.z);
+		return (Length > 0.0f) ? ieFloat3(V.x / Length, V.y / Length, V.z / Length) : V;
+	}
+
+	static inline ieFloat3 Cross(const ieFloat3& A, const ieFloat3& B)
+	{
+		return ieFloat3(A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x);
+	}
+
+	static inline float Dot(const ieFloat3& A, const ieFloat3& B)
+	{
+		return A.x * B.x + A.y * B.y + A.z * B.z;
+	}
+
+	static inline ieFloat4 MakePlane(const ieFloat3& Normal, const ieFloat3& Point)
+	{
+		return ieFloat4(Normal.x, Normal.y, Normal.z, -Dot(Normal, Point));
+	}
+
+	MeshletCuller::View MeshletCuller::MakeView(const Math::ieFloat4x4& ViewProjection, const ieFloat3& Eye)
+	{
+		// Clip space planes pulled back through the matrix. With row vectors clip = v * M, so
+		// each plane is a sum of the matrix's columns. Depth is [0, w] as in Direct3D.
+		const Math::ieFloat4x4& M = ViewProjection;
+		auto Column = [&M](int j) { return ieFloat4(M.m[0][j], M.m[1][j], M.m[2][j], M.m[3][j]); };
+		const ieFloat4 X = Column(0), Y = Column(1), Z = Column(2), W = Column(3);
+
+		View Result;
+		Result.Eye = Eye;
+		Result.Planes[0] = ieFloat4(W.x + X.x, W.y + X.y, W.z + X.z, W.w + X.w);
+		Result.Planes[1] = ieFloat4(W.x - X.x, W.y - X.y, W.z - X.z, W.w - X.w);
+		Result.Planes[2] = ieFloat4(W.x + Y.x, W.y + Y.y, W.z + Y.z, W.w + Y.w);
+		Result.Planes[3] = ieFloat4(W.x - Y.x, W.y - Y.y, W.z - Y.z, W.w - Y.w);
+		Result.Planes[4] = Z;
+		Result.Planes[5] = ieFloat4(W.x - Z.x, W.y - Z.y, W.z - Z.z, W.w - Z.w);
+		for (ieFloat4& Plane : Result.Planes) {
+			const float Length = sqrtf(Plane.x * Plane.x + Plane.y * Plane.y + Plane.z * Plane.z);
+			if (Length > 0.0f) {
+				Plane = ieFloat4(Plane.x / Length, Plane.y / Length, Plane.z / Length, Plane.w / Length);
+			}
+		}
+		return Result;
+	}
+
+	MeshletCuller::View MeshletCuller::MakeLookAtView(const ieFloat3& Eye, const ieFloat3& Target, float FieldOfView, float NearZ, float FarZ)
+	{
+		const ieFloat3 Forward = Normalize(ieFloat3(Target.x - Eye.x, Target.y - Eye.y, Target.z - Eye.z));
+		const ieFloat3 WorldUp = (fabsf(Forward.y) > 0.99f) ? ieFloat3(0.0f, 0.0f, 1.0f) : ieFloat3(0.0f, 1.0f, 0.0f);
+		const ieFloat3 Right = Normalize(Cross(WorldUp, Forward));
+		const ieFloat3 Up = Cross(Forward, Right);
+		const float Sin = sinf(FieldOfView * 0.5f);
+		const float Cos = cosf(FieldOfView * 0.5f);
+
+		// Side planes pass through the eye, tilted in from the forward direction by half the field of view.
+		auto SidePlane = [&](const ieFloat3& Side) {
+			return MakePlane(ieFloat3(Side.x * Cos + Forward.x * Sin, Side.y * Cos + Forward.y * Sin, Side.z * Cos + Forward.z * Sin), Eye);
+		};
+		View Result;
+		Result.Eye = Eye;
+		Result.Planes[0] = SidePlane(Right);
+		Result.Planes[1] = SidePlane(ieFloat3(-Right.x, -Right.y, -Right.z));
+		Result.Planes[2] = SidePlane(Up);
+		Result.Planes[3] = SidePlane(ieFloat3(-Up.x, -Up.y, -Up.z));
+		Result.Planes[4] = MakePlane(Forward, ieFloat3(Eye.x + Forward.x * NearZ, Eye.y + Forward.y * NearZ, Eye.z + Forward.z * NearZ));
+		Result.Planes[5] = MakePlane(ieFloat3(-Forward.x, -Forward.y, -Forward.z), ieFloat3(Eye.x + Forward.x * FarZ, Eye.y + Forward.y * FarZ, Eye.z + Forward.z * FarZ));
+		return Result;
+	}
+
+	MeshletCuller::Stats MeshletCuller::Cull(const std::vector<Meshlet>& Meshlets, const Math::ieFloat4x4& World, const View& InView, std::vector<MeshletIndexRange>& OutRanges)
+	{
+		const Math::ieFloat4x4& M = World;
+		const float ScaleX = sqrtf(M._11 * M._11 + M._12 * M._12 + M._13 * M._13);
+		const float ScaleY = sqrtf(M._21 * M._21 + M._22 * M._22 + M._23 * M._23);
+		const float ScaleZ = sqrtf(M._31 * M._31 + M._32 * M._32 + M._33 * M._33);
+		const float MaxScale = std::max(ScaleX, std::max(ScaleY, ScaleZ));
+		const float MinScale = std::min(ScaleX, std::min(ScaleY, ScaleZ));
+		// Non-uniform scale bends the normals, the cones no longer bound them.
+		const bool CanCullBackFaces = MinScale > 0.0f && MaxScale <= MinScale * 1.001f;
+
+		Stats Result;
+		for (const Meshlet& Cluster : Meshlets) {
+			const uint32_t NumTriangles = Cluster.NumIndices / 3U;
+			Result.NumTriangles += NumTriangles;
+
+			const ieFloat3& C = Cluster.Center;
+			const ieFloat3 Center(C.x * M._11 + C.y * M._21 + C.z * M._31 + M._41, C.x * M._12 + C.y * M._22 + C.z * M._32 + M._42, C.x * M._13 + C.y * M._23 + C.z * M._33 + M._43);
+			const float Radius = Cluster.Radius * MaxScale;
+
+			bool IsOutside = false;
+			for (const ieFloat4& Plane : InView.Planes) {
+				if (Plane.x * Center.x + Plane.y * Center.y + Plane.z * Center.z + Plane.w < -Radius) {
+					IsOutside = true;
+					break;
+				}
+			}
+			if (IsOutside) {
+				Result.NumFrustumCulled += NumTriangles;
+				continue;
+			}
+
+			if (CanCullBackFaces && Cluster.ConeCutoff < 1.0f) {
+				const ieFloat3& A = Cluster.ConeAxis;
+				const ieFloat3 Axis = Normalize(ieFloat3(A.x * M._11 + A.y * M._21 + A.z * M._31, A.x * M._12 + A.y * M._22 + A.z * M._32, A.x * M._13 + A.y * M._23 + A.z * M._33));
+				const ieFloat3 ToCenter(Center.x - InView.Eye.x, Center.y - InView.Eye.y, Center.z - InView.Eye.z);
+				if (Dot(ToCenter, Axis) >= Cluster.ConeCutoff * sqrtf(Dot(ToCenter, ToCenter)) + Radius) {
+					Result.NumBackFaceCulled += NumTriangles;
+					continue;
+				}
+			}
+
+			if (!OutRanges.empty() && OutRanges.back().FirstIndex + OutRanges.back().NumIndices == Cluster.FirstIndex) {
+				OutRanges.back().NumIndices += Cluster.NumIndices;
+			}
+			else {
+				OutRanges.push_back(MeshletIndexRange{ Cluster.FirstIndex, Cluster.NumIndices });
+			}
+		}
+		return Result;
+	}
+
+	std::vector<MeshletCuller::Stats> MeshletCuller::AnalyzeViews(const std::vector<Meshlet>& Meshlets)
+	{
+		std::vector<Stats> Results;
+		if (Meshlets.empty()) {
+			return Results;
+		}
+
+		ieFloat3 Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		ieFloat3 Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const Meshlet& Cluster : Meshlets) {
+			const ieFloat3& C = Cluster.Center;
+			const float R = Cluster.Radius;
+			Min = ieFloat3(std::min(Min.x, C.x - R), std::min(Min.y, C.y - R), std::min(Min.z, C.z - R));
+			Max = ieFloat3(std::max(Max.x, C.x + R), std::max(Max.y, C.y + R), std::max(Max.z, C.z + R));
+		}
+		const ieFloat3 Center((Min.x + Max.x) * 0.5f, (Min.y + Max.y) * 0.5f, (Min.z + Max.z) * 0.5f);
+		float Radius = 1e-3f;
+		for (const Meshlet& Cluster : Meshlets) {
+			const ieFloat3 Offset(Cluster.Center.x - Center.x, Cluster.Center.y - Center.y, Cluster.Center.z - Center.z);
+			Radius = std::max(Radius, sqrtf(Dot(Offset, Offset)) + Cluster.Radius);
+		}
+
+		// Close and narrow enough that the view does not fit the whole mesh, so both tests have work to do.
+		const float Distance = Radius * 1.5f;
+		static const float Directions[14][3] = {
+			{ 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+			{ 1, 1, 1 }, { 1, 1, -1 }, { 1, -1, 1 }, { 1, -1, -1 }, { -1, 1, 1 }, { -1, 1, -1 }, { -1, -1, 1 }, { -1, -1, -1 },
+		};
+		Math::ieFloat4x4 Identity = {};
+		Identity._11 = Identity._22 = Identity._33 = Identity._44 = 1.0f;
+
+		std::vector<MeshletIndexRange> Ranges;
+		Results.reserve(14);
+		for (const float* pDirection : Directions) {
+			const ieFloat3 Direction = Normalize(ieFloat3(pDirection[0], pDirection[1], pDirection[2]));
+			const ieFloat3 Eye(Center.x + Direction.x * Distance, Center.y + Direction.y * Distance, Center.z + Direction.z * Distance);
+			const View EyeView = MakeLookAtView(Eye, Center, 3.14159265f * (40.0f / 180.0f), Radius * 0.01f, Radius * 10.0f);
+			Ranges.clear();
+			Results.push_back(Cull(Meshlets, Identity, EyeView, Ranges));
+		}
+		return Results;
+	}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Rendering/Geometry/Meshlet_Builder.h"
+#include "Insight/Math/ie_Matricies.h"
+
+/*
+	CPU culling of a mesh's meshlets against a view. Meshlets outside the frustum or
+	facing away from the eye are dropped, the rest are returned as index ranges with
+	neighbouring meshlets merged, ready to be drawn. Only the scene pass is culled, the
+	shadow pass sees the mesh from the light and draws it whole.
+
+	'AnalyzeViews' is a deterministic harness: it culls a mesh from a fixed set of eyes
+	around its bounds and reports what each view removed. Tools/Engine_Tests checks its
+	counts on fixed meshes, so changes to the builder or the tests show up there.
+
+	Example usage:
+		const MeshletCuller::View View = MeshletCuller::MakeView(ViewProjection, EyePosition);
+		std::vector<MeshletIndexRange> Ranges;
+		MeshletCuller::Cull(Geometry.GetMeshlets(), World, View, Ranges);
+*/
+
+namespace Insight {
+
+	using Math::ieFloat4;
+
+	struct MeshletIndexRange
+	{
+		uint32_t FirstIndex;
+		uint32_t NumIndices;
+	};
+
+	class INSIGHT_API MeshletCuller
+	{
+	public:
+		struct View
+		{
+			ieFloat3 Eye;
+			// Left, right, bottom, top, near, far. xyz is the normal pointing into the frustum.
+			ieFloat4 Planes[6];
+		};
+
+		struct Stats
+		{
+			uint32_t NumTriangles = 0U;
+			uint32_t NumFrustumCulled = 0U;
+			uint32_t NumBackFaceCulled = 0U;
+		};
+
+	public:
+		// 'ViewProjection' is row major and transforms row vectors, as the camera's matrices do.
+		static View MakeView(const Math::ieFloat4x4& ViewProjection, const ieFloat3& Eye);
+		// Square perspective view. 'FieldOfView' is in radians.
+		static View MakeLookAtView(const ieFloat3& Eye, const ieFloat3& Target, float FieldOfView, float NearZ, float FarZ);
+
+		// Append the index ranges of the meshlets visible in 'InView' to 'OutRanges'. 'World' places
+		// the mesh in the view's space. The normal cones are only used if 'World' scales uniformly.
+		static Stats Cull(const std::vector<Meshlet>& Meshlets, const Math::ieFloat4x4& World, const View& InView, std::vector<MeshletIndexRange>& OutRanges);
+
+		// Cull from fourteen eyes around the meshlets' bounds, along the axes and the diagonals.
+		static std::vector<Stats> AnalyzeViews(const std::vector<Meshlet>& Meshlets);
+	};
+
+}
@@ -0,0 +1,838 @@
+// No precompiled header, this file is also built by Engine_Tests. See 'PortableEngineFiles' in premake5.lua.
+#include "Meshopt_Codec.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <emmintrin.h>
+
+// Bitstream constants, these are fixed by the format and must match meshoptimizer's encoder.
+#define IE_MESHOPT_VERTEX_HEADER 0xA0U
+#define IE_MESHOPT_INDEX_HEADER 0xE0U
+#define IE_MESHOPT_SEQUENCE_HEADER 0xD0U
+#define IE_MESHOPT_BYTE_GROUP_SIZE 16U
+#define IE_MESHOPT_VERTEX_BLOCK_SIZE_BYTES 8192U
+#define IE_MESHOPT_VERTEX_BLOCK_MAX_SIZE 256U
+#define IE_MESHOPT_TAIL_MAX_SIZE 32U
+
+namespace Insight {
+
+	static inline size_t GetVertexBlockSize(size_t VertexSize)
+	{
+		const size_t BlockSize = (IE_MESHOPT_VERTEX_BLOCK_SIZE_BYTES / VertexSize) & ~size_t(IE_MESHOPT_BYTE_GROUP_SIZE - 1U);
+		return std::min<size_t>(BlockSize, IE_MESHOPT_VERTEX_BLOCK_MAX_SIZE);
+	}
+
+	// Packed values that are all ones are outliers, replaced in order by the bytes after the packed data.
+	static inline const uint8_t* FillOutliers(const uint8_t* pOutliers, const uint8_t* pEnd, uint8_t* pOut, __m128i Values, __m128i Sentinel)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pOut), Values);
+		uint32_t OutlierMask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Values, Sentinel)));
+		if (OutlierMask != 0U) {
+			// Branchless, how many outliers a group has is not predictable.
+			for (size_t i = 0; i < IE_MESHOPT_BYTE_GROUP_SIZE; ++i) {
+				const uint32_t IsOutlier = (OutlierMask >> i) & 1U;
+				pOut[i] = IsOutlier ? *pOutliers : pOut[i];
+				pOutliers += IsOutlier;
+			}
+		}
+		return (pOutliers <= pEnd) ? pOutliers : nullptr;
+	}
+
+	// One group of 16 bytes packed at 0, 2, 4 or 8 bits per byte, most significant bits first.
+	// Reads up to 24 bytes past 'pData' before checking against 'pEnd', the vertex stream's
+	// tail keeps that inside the buffer. Returns nullptr if the group runs past 'pEnd'.
+	static const uint8_t* DecodeBytesGroup(const uint8_t* pData, const uint8_t* pEnd, uint8_t* pOut, uint32_t BitsLog2)
+	{
+		switch (BitsLog2) {
+		case 0U:
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pOut), _mm_setzero_si128());
+			return pData;
+		case 1U:
+		{
+			int32_t Packed;
+			memcpy(&Packed, pData, sizeof(Packed));
+			// Spread each byte's four values over four bytes, two shift and interleave steps.
+			const __m128i Sel2 = _mm_cvtsi32_si128(Packed);
+			const __m128i Sel22 = _mm_unpacklo_epi8(_mm_srli_epi16(Sel2, 4), Sel2);
+			const __m128i Sel2222 = _mm_unpacklo_epi8(_mm_srli_epi16(Sel22, 2), Sel22);
+			const __m128i Sentinel = _mm_set1_epi8(3);
+			return FillOutliers(pData + 4, pEnd, pOut, _mm_and_si128(Sel2222, Sentinel), Sentinel);
+		}
+		case 2U:
+		{
+			const __m128i Sel4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pData));
+			const __m128i Sel44 = _mm_unpacklo_epi8(_mm_srli_epi16(Sel4, 4), Sel4);
+			const __m128i Sentinel = _mm_set1_epi8(15);
+			return FillOutliers(pData + 8, pEnd, pOut, _mm_and_si128(Sel44, Sentinel), Sentinel);
+		}
+		default:
+			if (static_cast<size_t>(pEnd - pData) < IE_MESHOPT_BYTE_GROUP_SIZE) {
+				return nullptr;
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pOut), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
+			return pData + IE_MESHOPT_BYTE_GROUP_SIZE;
+		}
+	}
+
+	// 'Size' bytes in groups of 16, preceded by two bits per group giving its packing.
+	static const uint8_t* DecodeBytes(const uint8_t* pData, const uint8_t* pEnd, uint8_t* pOut, size_t Size)
+	{
+		const size_t HeaderSize = (Size / IE_MESHOPT_BYTE_GROUP_SIZE + 3U) / 4U;
+		if (static_cast<size_t>(pEnd - pData) < HeaderSize) {
+			return nullptr;
+		}
+		const uint8_t* pHeader = pData;
+		pData += HeaderSize;
+		for (size_t i = 0; i < Size; i += IE_MESHOPT_BYTE_GROUP_SIZE) {
+			const size_t Group = i / IE_MESHOPT_BYTE_GROUP_SIZE;
+			const uint32_t BitsLog2 = (pHeader[Group / 4U] >> ((Group % 4U) * 2U)) & 3U;
+			pData = DecodeBytesGroup(pData, pEnd, pOut + i, BitsLog2);
+			if (!pData) {
+				return nullptr;
+			}
+		}
+		return pData;
+	}
+
+	static inline __m128i UnZigZag8(__m128i Value)
+	{
+		const __m128i Sign = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(Value, _mm_set1_epi8(1)));
+		return _mm_xor_si128(Sign, _mm_and_si128(_mm_srli_epi16(Value, 1), _mm_set1_epi8(127)));
+	}
+
+	// Up to 16 bytes of one vertex, 'Size' is a multiple of 4.
+	static inline void StoreVertexBytes(uint8_t* pOut, __m128i Bytes, size_t Size)
+	{
+		if (Size == 16U) {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pOut), Bytes);
+			return;
+		}
+		if (Size >= 8U) {
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pOut), Bytes);
+			pOut += 8;
+			Size -= 8U;
+			Bytes = _mm_srli_si128(Bytes, 8);
+		}
+		if (Size == 4U) {
+			const int32_t Word = _mm_cvtsi128_si32(Bytes);
+			memcpy(pOut, &Word, sizeof(Word));
+		}
+	}
+
+	// Every byte of a vertex is stored as its own stream of zigzag deltas from the previous
+	// vertex. Sixteen streams are decoded at a time. Each four are transposed so a 32-bit lane
+	// holds four bytes of one vertex and summed across the lanes, then the four words of a
+	// vertex are put back together and written with a single store.
+	static const uint8_t* DecodeVertexBlock(const uint8_t* pData, const uint8_t* pEnd, uint8_t* pVertexData, size_t VertexCount, size_t VertexSize, uint8_t* pLastVertex)
+	{
+		const size_t VertexCountAligned = (VertexCount + IE_MESHOPT_BYTE_GROUP_SIZE - 1U) & ~size_t(IE_MESHOPT_BYTE_GROUP_SIZE - 1U);
+		alignas(16) uint8_t Deltas[16][IE_MESHOPT_VERTEX_BLOCK_MAX_SIZE];
+		for (size_t k = 0; k < VertexSize; k += 16U) {
+			const size_t NumStreams = std::min<size_t>(16U, VertexSize - k);
+			const size_t NumWords = NumStreams / 4U;
+			for (size_t j = 0; j < NumStreams; ++j) {
+				pData = DecodeBytes(pData, pEnd, Deltas[j], VertexCountAligned);
+				if (!pData) {
+					return nullptr;
+				}
+			}
+
+			__m128i Previous[4];
+			for (size_t q = 0; q < NumWords; ++q) {
+				int32_t LastBytes;
+				memcpy(&LastBytes, pLastVertex + k + q * 4U, sizeof(LastBytes));
+				Previous[q] = _mm_set1_epi32(LastBytes);
+			}
+
+			uint8_t* pOut = pVertexData + k;
+			for (size_t i = 0; i < VertexCount; i += IE_MESHOPT_BYTE_GROUP_SIZE) {
+				// Sums[q][w] is word 'q' of vertices i + 4w to i + 4w + 3.
+				__m128i Sums[4][4];
+				for (size_t q = 0; q < 4U; ++q) {
+					if (q >= NumWords) {
+						Sums[q][0] = Sums[q][1] = Sums[q][2] = Sums[q][3] = _mm_setzero_si128();
+						continue;
+					}
+					const __m128i R0 = UnZigZag8(_mm_load_si128(reinterpret_cast<const __m128i*>(Deltas[q * 4U + 0U] + i)));
+					const __m128i R1 = UnZigZag8(_mm_load_si128(reinterpret_cast<const __m128i*>(Deltas[q * 4U + 1U] + i)));
+					const __m128i R2 = UnZigZag8(_mm_load_si128(reinterpret_cast<const __m128i*>(Deltas[q * 4U + 2U] + i)));
+					const __m128i R3 = UnZigZag8(_mm_load_si128(reinterpret_cast<const __m128i*>(Deltas[q * 4U + 3U] + i)));
+					const __m128i R01Low = _mm_unpacklo_epi8(R0, R1);
+					const __m128i R23Low = _mm_unpacklo_epi8(R2, R3);
+					const __m128i R01High = _mm_unpackhi_epi8(R0, R1);
+					const __m128i R23High = _mm_unpackhi_epi8(R2, R3);
+					const __m128i Words[4] = {
+						_mm_unpacklo_epi16(R01Low, R23Low), _mm_unpackhi_epi16(R01Low, R23Low),
+						_mm_unpacklo_epi16(R01High, R23High), _mm_unpackhi_epi16(R01High, R23High)
+					};
+					for (size_t w = 0; w < 4U; ++w) {
+						__m128i Sum = _mm_add_epi8(Words[w], _mm_slli_si128(Words[w], 4));
+						Sum = _mm_add_epi8(Sum, _mm_slli_si128(Sum, 8));
+						Sum = _mm_add_epi8(Sum, Previous[q]);
+						Previous[q] = _mm_shuffle_epi32(Sum, 0xFF);
+						Sums[q][w] = Sum;
+					}
+				}
+
+				// Padding vertices of the last group decode from zero deltas and are not written.
+				const size_t NumGroupVertices = std::min<size_t>(IE_MESHOPT_BYTE_GROUP_SIZE, VertexCount - i);
+				for (size_t w = 0; w * 4U < NumGroupVertices; ++w) {
+					const __m128i T0 = _mm_unpacklo_epi32(Sums[0][w], Sums[1][w]);
+					const __m128i T1 = _mm_unpacklo_epi32(Sums[2][w], Sums[3][w]);
+					const __m128i T2 = _mm_unpackhi_epi32(Sums[0][w], Sums[1][w]);
+					const __m128i T3 = _mm_unpackhi_epi32(Sums[2][w], Sums[3][w]);
+					const __m128i Vertices[4] = {
+						_mm_unpacklo_epi64(T0, T1), _mm_unpackhi_epi64(T0, T1),
+						_mm_unpacklo_epi64(T2, T3), _mm_unpackhi_epi64(T2, T3)
+					};
+					const size_t NumLanes = std::min<size_t>(4U, NumGroupVertices - w * 4U);
+					for (size_t Lane = 0; Lane < NumLanes; ++Lane) {
+						StoreVertexBytes(pOut, Vertices[Lane], NumStreams);
+						pOut += VertexSize;
+					}
+				}
+			}
+		}
+		memcpy(pLastVertex, pVertexData + VertexSize * (VertexCount - 1U), VertexSize);
+		return pData;
+	}
+
+	static inline uint8_t ZigZag8(uint8_t Value)
+	{
+		return static_cast<uint8_t>((static_cast<int8_t>(Value) >> 7) ^ (Value << 1));
+	}
+
+	// Encoded size of one group at 'Bits' per byte, outliers included. SIZE_MAX if the group does not fit.
+	static size_t MeasureBytesGroup(const uint8_t* pDeltas, uint32_t Bits)
+	{
+		if (Bits == 0U) {
+			for (size_t i = 0; i < IE_MESHOPT_BYTE_GROUP_SIZE; ++i) {
+				if (pDeltas[i] != 0U) {
+					return SIZE_MAX;
+				}
+			}
+			return 0U;
+		}
+		if (Bits == 8U) {
+			return IE_MESHOPT_BYTE_GROUP_SIZE;
+		}
+		// All ones marks an outlier, so values equal to it are outliers as well.
+		const uint32_t Sentinel = (1U << Bits) - 1U;
+		size_t Size = Bits * IE_MESHOPT_BYTE_GROUP_SIZE / 8U;
+		for (size_t i = 0; i < IE_MESHOPT_BYTE_GROUP_SIZE; ++i) {
+			Size += (pDeltas[i] >= Sentinel) ? 1U : 0U;
+		}
+		return Size;
+	}
+
+	static void EncodeBytesGroup(std::vector<uint8_t>& OutBuffer, const uint8_t* pDeltas, uint32_t Bits)
+	{
+		if (Bits == 0U) {
+			return;
+		}
+		if (Bits == 8U) {
+			OutBuffer.insert(OutBuffer.end(), pDeltas, pDeltas + IE_MESHOPT_BYTE_GROUP_SIZE);
+			return;
+		}
+		const uint32_t Sentinel = (1U << Bits) - 1U;
+		const size_t ValuesPerByte = 8U / Bits;
+		for (size_t i = 0; i < IE_MESHOPT_BYTE_GROUP_SIZE; i += ValuesPerByte) {
+			uint32_t Byte = 0U;
+			for (size_t k = 0; k < ValuesPerByte; ++k) {
+				Byte = (Byte << Bits) | std::min<uint32_t>(pDeltas[i + k], Sentinel);
+			}
+			OutBuffer.push_back(static_cast<uint8_t>(Byte));
+		}
+		for (size_t i = 0; i < IE_MESHOPT_BYTE_GROUP_SIZE; ++i) {
+			if (pDeltas[i] >= Sentinel) {
+				OutBuffer.push_back(pDeltas[i]);
+			}
+		}
+	}
+
+	// Each group gets the smallest of the four packings.
+	static void EncodeBytes(std::vector<uint8_t>& OutBuffer, const uint8_t* pDeltas, size_t Size)
+	{
+		const size_t HeaderOffset = OutBuffer.size();
+		OutBuffer.resize(HeaderOffset + (Size / IE_MESHOPT_BYTE_GROUP_SIZE + 3U) / 4U, 0U);
+		for (size_t i = 0; i < Size; i += IE_MESHOPT_BYTE_GROUP_SIZE) {
+			uint32_t BestBitsLog2 = 3U;
+			size_t BestSize = MeasureBytesGroup(pDeltas + i, 8U);
+			for (uint32_t BitsLog2 = 0U; BitsLog2 < 3U; ++BitsLog2) {
+				const size_t GroupSize = MeasureBytesGroup(pDeltas + i, BitsLog2 == 0U ? 0U : (1U << BitsLog2));
+				if (GroupSize < BestSize) {
+					BestBitsLog2 = BitsLog2;
+					BestSize = GroupSize;
+				}
+			}
+			const size_t Group = i / IE_MESHOPT_BYTE_GROUP_SIZE;
+			OutBuffer[HeaderOffset + Group / 4U] |= static_cast<uint8_t>(BestBitsLog2 << ((Group % 4U) * 2U));
+			EncodeBytesGroup(OutBuffer, pDeltas + i, BestBitsLog2 == 0U ? 0U : (1U << BestBitsLog2));
+		}
+	}
+
+	static void EncodeVertexBlock(std::vector<uint8_t>& OutBuffer, const uint8_t* pVertexData, size_t VertexCount, size_t VertexSize, uint8_t* pLastVertex)
+	{
+		const size_t VertexCountAligned = (VertexCount + IE_MESHOPT_BYTE_GROUP_SIZE - 1U) & ~size_t(IE_MESHOPT_BYTE_GROUP_SIZE - 1U);
+		uint8_t Deltas[IE_MESHOPT_VERTEX_BLOCK_MAX_SIZE];
+		for (size_t k = 0; k < VertexSize; ++k) {
+			// The padding up to the next group decodes as zero deltas and is never written out.
+			memset(Deltas, 0, VertexCountAligned);
+			uint8_t Previous = pLastVertex[k];
+			for (size_t i = 0; i < VertexCount; ++i) {
+				const uint8_t Value = pVertexData[i * VertexSize + k];
+				Deltas[i] = ZigZag8(static_cast<uint8_t>(Value - Previous));
+				Previous = Value;
+			}
+			EncodeBytes(OutBuffer, Deltas, VertexCountAligned);
+		}
+		memcpy(pLastVertex, pVertexData + VertexSize * (VertexCount - 1U), VertexSize);
+	}
+
+	bool MeshoptCodec::EncodeVertexBuffer(std::vector<uint8_t>& OutBuffer, const void* pVertices, size_t VertexCount, size_t VertexSize)
+	{
+		if (VertexSize == 0U || VertexSize > 256U || VertexSize % 4U != 0U) {
+			return false;
+		}
+		const uint8_t* pVertexData = static_cast<const uint8_t*>(pVertices);
+		OutBuffer.clear();
+		OutBuffer.reserve(VertexCount * VertexSize / 2U + 64U);
+		OutBuffer.push_back(static_cast<uint8_t>(IE_MESHOPT_VERTEX_HEADER));
+
+		// The first block's deltas are taken from the first vertex, which the decoder reads from the tail.
+		uint8_t FirstVertex[256] = {};
+		if (VertexCount > 0U) {
+			memcpy(FirstVertex, pVertexData, VertexSize);
+		}
+		uint8_t LastVertex[256];
+		memcpy(LastVertex, FirstVertex, VertexSize);
+
+		const size_t BlockSize = GetVertexBlockSize(VertexSize);
+		for (size_t VertexOffset = 0; VertexOffset < VertexCount; VertexOffset += BlockSize) {
+			const size_t NumBlockVertices = std::min(BlockSize, VertexCount - VertexOffset);
+			EncodeVertexBlock(OutBuffer, pVertexData + VertexOffset * VertexSize, NumBlockVertices, VertexSize, LastVertex);
+		}
+
+		// Tail, zero padded so a group decoded at the end of the data can always read ahead.
+		const size_t TailSize = std::max<size_t>(VertexSize, IE_MESHOPT_TAIL_MAX_SIZE);
+		OutBuffer.resize(OutBuffer.size() + TailSize - VertexSize, 0U);
+		OutBuffer.insert(OutBuffer.end(), FirstVertex, FirstVertex + VertexSize);
+		return true;
+	}
+
+	bool MeshoptCodec::DecodeVertexBuffer(void* pDestination, size_t VertexCount, size_t VertexSize, const uint8_t* pBuffer, size_t BufferSize)
+	{
+		if (VertexSize == 0U || VertexSize > 256U || VertexSize % 4U != 0U) {
+			return false;
+		}
+		if (BufferSize < 1U || (pBuffer[0] & 0xF0U) != IE_MESHOPT_VERTEX_HEADER || (pBuffer[0] & 0x0FU) != 0U) {
+			return false;
+		}
+
+		// The first vertex is stored at the end of the stream, every block starts from the previous block's last vertex.
+		const size_t TailSize = std::max<size_t>(VertexSize, IE_MESHOPT_TAIL_MAX_SIZE);
+		if (BufferSize - 1U < TailSize) {
+			return false;
+		}
+		const uint8_t* pData = pBuffer + 1;
+		const uint8_t* pDataEnd = pBuffer + BufferSize - TailSize;
+		uint8_t LastVertex[256];
+		memcpy(LastVertex, pBuffer + BufferSize - VertexSize, VertexSize);
+
+		uint8_t* pVertexData = static_cast<uint8_t*>(pDestination);
+		const size_t BlockSize = GetVertexBlockSize(VertexSize);
+		for (size_t VertexOffset = 0; VertexOffset < VertexCount; VertexOffset += BlockSize) {
+			const size_t NumBlockVertices = std::min(BlockSize, VertexCount - VertexOffset);
+			pData = DecodeVertexBlock(pData, pDataEnd, pVertexData + VertexOffset * VertexSize, NumBlockVertices, VertexSize, LastVertex);
+			if (!pData) {
+				return false;
+			}
+		}
+		// Everything up to the tail must have been read.
+		return pData == pDataEnd;
+	}
+
+	static inline uint32_t DecodeVByte(const uint8_t*& pData)
+	{
+		const uint8_t Lead = *pData++;
+		if (Lead < 128U) {
+			return Lead;
+		}
+		uint32_t Result = Lead & 127U;
+		uint32_t Shift = 7U;
+		for (int i = 0; i < 4; ++i) {
+			const uint8_t Group = *pData++;
+			Result |= static_cast<uint32_t>(Group & 127U) << Shift;
+			Shift += 7U;
+			if (Group < 128U) {
+				break;
+			}
+		}
+		return Result;
+	}
+
+	// Free indices are zigzag deltas from the last free index.
+	static inline uint32_t DecodeIndex(const uint8_t*& pData, uint32_t Last)
+	{
+		const uint32_t Value = DecodeVByte(pData);
+		const uint32_t Delta = (Value >> 1) ^ (0U - (Value & 1U));
+		return Last + Delta;
+	}
+
+	static inline void WriteTriangle(void* pDestination, size_t Offset, size_t IndexSize, uint32_t A, uint32_t B, uint32_t C)
+	{
+		if (IndexSize == 2U) {
+			uint16_t* pIndices = static_cast<uint16_t*>(pDestination) + Offset;
+			pIndices[0] = static_cast<uint16_t>(A);
+			pIndices[1] = static_cast<uint16_t>(B);
+			pIndices[2] = static_cast<uint16_t>(C);
+		}
+		else {
+			uint32_t* pIndices = static_cast<uint32_t*>(pDestination) + Offset;
+			pIndices[0] = A;
+			pIndices[1] = B;
+			pIndices[2] = C;
+		}
+	}
+
+	static inline void EncodeVByte(std::vector<uint8_t>& OutBuffer, uint32_t Value)
+	{
+		do {
+			OutBuffer.push_back(static_cast<uint8_t>((Value & 127U) | (Value > 127U ? 128U : 0U)));
+			Value >>= 7;
+		} while (Value != 0U);
+	}
+
+	static inline void EncodeIndex(std::vector<uint8_t>& OutBuffer, uint32_t Index, uint32_t Last)
+	{
+		const uint32_t Delta = Index - Last;
+		EncodeVByte(OutBuffer, (Delta << 1) ^ (0U - (Delta >> 31)));
+	}
+
+	static inline uint32_t ReadIndex(const void* pIndices, size_t Offset, size_t IndexSize)
+	{
+		return (IndexSize == 2U) ? static_cast<const uint16_t*>(pIndices)[Offset] : static_cast<const uint32_t*>(pIndices)[Offset];
+	}
+
+	bool MeshoptCodec::EncodeIndexBuffer(std::vector<uint8_t>& OutBuffer, const void* pIndices, size_t IndexCount, size_t IndexSize)
+	{
+		if (IndexCount % 3U != 0U || (IndexSize != 2U && IndexSize != 4U)) {
+			return false;
+		}
+		// Codes for the three vertex case that fit in the triangle's code byte, the rest take a
+		// byte of their own. Stored at the end of the stream, where it also pads the last triangle.
+		static const uint8_t s_CodeAuxTable[16] = { 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xA9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00 };
+		static const uint32_t s_TriangleOrder[3][3] = { { 0U, 1U, 2U }, { 1U, 2U, 0U }, { 2U, 0U, 1U } };
+
+		// Same FIFOs as the decoder. Entries are looked up newest first, the index found is what gets coded.
+		uint32_t EdgeFifo[16][2];
+		uint32_t VertexFifo[16];
+		memset(EdgeFifo, -1, sizeof(EdgeFifo));
+		memset(VertexFifo, -1, sizeof(VertexFifo));
+		size_t EdgeFifoOffset = 0U;
+		size_t VertexFifoOffset = 0U;
+		auto PushEdge = [&EdgeFifo, &EdgeFifoOffset](uint32_t A, uint32_t B) {
+			EdgeFifo[EdgeFifoOffset][0] = A;
+			EdgeFifo[EdgeFifoOffset][1] = B;
+			EdgeFifoOffset = (EdgeFifoOffset + 1U) & 15U;
+		};
+		auto PushVertex = [&VertexFifo, &VertexFifoOffset](uint32_t V) {
+			VertexFifo[VertexFifoOffset] = V;
+			VertexFifoOffset = (VertexFifoOffset + 1U) & 15U;
+		};
+		// Returns the FIFO index times four plus the rotation that puts the matching edge first, or -1.
+		auto FindEdge = [&EdgeFifo, &EdgeFifoOffset](uint32_t A, uint32_t B, uint32_t C) {
+			for (int i = 0; i < 16; ++i) {
+				const size_t Index = (EdgeFifoOffset - 1U - i) & 15U;
+				const uint32_t E0 = EdgeFifo[Index][0];
+				const uint32_t E1 = EdgeFifo[Index][1];
+				if (E0 == A && E1 == B) return (i << 2) | 0;
+				if (E0 == B && E1 == C) return (i << 2) | 1;
+				if (E0 == C && E1 == A) return (i << 2) | 2;
+			}
+			return -1;
+		};
+		auto FindVertex = [&VertexFifo, &VertexFifoOffset](uint32_t V) {
+			for (int i = 0; i < 16; ++i) {
+				if (VertexFifo[(VertexFifoOffset - 1U - i) & 15U] == V) {
+					return i;
+				}
+			}
+			return -1;
+		};
+
+		const size_t TriangleCount = IndexCount / 3U;
+		OutBuffer.assign(1U + TriangleCount, 0U);
+		OutBuffer.reserve(1U + TriangleCount * 3U + 16U);
+		OutBuffer[0] = static_cast<uint8_t>(IE_MESHOPT_INDEX_HEADER | 1U);
+		size_t CodeOffset = 1U;
+
+		uint32_t Next = 0U;
+		uint32_t Last = 0U;
+		const int FecMax = 13;
+
+		for (size_t i = 0; i < IndexCount; i += 3U) {
+			const uint32_t Triangle[3] = { ReadIndex(pIndices, i, IndexSize), ReadIndex(pIndices, i + 1U, IndexSize), ReadIndex(pIndices, i + 2U, IndexSize) };
+
+			// Triangles may be rotated so the shared edge or the next new vertex comes first, the winding is kept.
+			const int Fer = FindEdge(Triangle[0], Triangle[1], Triangle[2]);
+			if (Fer >= 0 && (Fer >> 2) < 15) {
+				const uint32_t* pOrder = s_TriangleOrder[Fer & 3];
+				const uint32_t A = Triangle[pOrder[0]];
+				const uint32_t B = Triangle[pOrder[1]];
+				const uint32_t C = Triangle[pOrder[2]];
+
+				const int Fe = Fer >> 2;
+				const int Fc = FindVertex(C);
+				int Fec = (Fc >= 1 && Fc < FecMax) ? Fc : ((C == Next) ? (++Next, 0) : 15);
+				// Strip-like runs of free indices code the last one plus or minus one without a delta.
+				if (Fec == 15 && C + 1U == Last) {
+					Fec = 13;
+					Last = C;
+				}
+				if (Fec == 15 && C == Last + 1U) {
+					Fec = 14;
+					Last = C;
+				}
+				OutBuffer[CodeOffset++] = static_cast<uint8_t>((Fe << 4) | Fec);
+				if (Fec == 15) {
+					EncodeIndex(OutBuffer, C, Last);
+					Last = C;
+				}
+				// A and B are usually in the vertex FIFO already and the third edge is in the edge FIFO.
+				if (Fec == 0 || Fec >= FecMax) {
+					PushVertex(C);
+				}
+				PushEdge(C, B);
+				PushEdge(A, C);
+			}
+			else {
+				const int Rotation = (Triangle[1] == Next) ? 1 : (Triangle[2] == Next) ? 2 : 0;
+				const uint32_t* pOrder = s_TriangleOrder[Rotation];
+				const uint32_t A = Triangle[pOrder[0]];
+				const uint32_t B = Triangle[pOrder[1]];
+				const uint32_t C = Triangle[pOrder[2]];
+
+				// A triangle 0, 1, 2 after the start restarts the numbering, used by concatenated index buffers.
+				// The vertex FIFO is cleared so nothing from before the restart is referenced.
+				const bool IsReset = (A == 0U && B == 1U && C == 2U && Next > 0U);
+				if (IsReset) {
+					Next = 0U;
+					memset(VertexFifo, -1, sizeof(VertexFifo));
+				}
+
+				const int Fb = FindVertex(B);
+				const int Fc = FindVertex(C);
+				const int Fea = (A == Next) ? (++Next, 0) : 15;
+				const int Feb = (Fb >= 0 && Fb < 14) ? Fb + 1 : ((B == Next) ? (++Next, 0) : 15);
+				const int Fec = (Fc >= 0 && Fc < 14) ? Fc + 1 : ((C == Next) ? (++Next, 0) : 15);
+
+				const uint8_t CodeAux = static_cast<uint8_t>((Feb << 4) | Fec);
+				int CodeAuxIndex = -1;
+				for (int j = 0; j < 14 && CodeAuxIndex < 0; ++j) {
+					CodeAuxIndex = (s_CodeAuxTable[j] == CodeAux) ? j : -1;
+				}
+				if (Fea == 0 && CodeAuxIndex >= 0 && !IsReset) {
+					OutBuffer[CodeOffset++] = static_cast<uint8_t>(0xF0U | CodeAuxIndex);
+				}
+				else {
+					OutBuffer[CodeOffset++] = static_cast<uint8_t>(0xF0U | 14U | Fea);
+					OutBuffer.push_back(CodeAux);
+				}
+				if (Fea == 15) {
+					EncodeIndex(OutBuffer, A, Last);
+					Last = A;
+				}
+				if (Feb == 15) {
+					EncodeIndex(OutBuffer, B, Last);
+					Last = B;
+				}
+				if (Fec == 15) {
+					EncodeIndex(OutBuffer, C, Last);
+					Last = C;
+				}
+				if (Fea == 0 || Fea == 15) {
+					PushVertex(A);
+				}
+				if (Feb == 0 || Feb == 15) {
+					PushVertex(B);
+				}
+				if (Fec == 0 || Fec == 15) {
+					PushVertex(C);
+				}
+				PushEdge(B, A);
+				PushEdge(C, B);
+				PushEdge(A, C);
+			}
+		}
+
+		OutBuffer.insert(OutBuffer.end(), s_CodeAuxTable, s_CodeAuxTable + 16U);
+		return true;
+	}
+
+	bool MeshoptCodec::DecodeIndexBuffer(void* pDestination, size_t IndexCount, size_t IndexSize, const uint8_t* pBuffer, size_t BufferSize)
+	{
+		if (IndexCount % 3U != 0U || (IndexSize != 2U && IndexSize != 4U)) {
+			return false;
+		}
+		// Header, one code byte per triangle and the 16 byte auxiliary code table.
+		if (BufferSize < 1U + IndexCount / 3U + 16U) {
+			return false;
+		}
+		if ((pBuffer[0] & 0xF0U) != IE_MESHOPT_INDEX_HEADER) {
+			return false;
+		}
+		const uint32_t Version = pBuffer[0] & 0x0FU;
+		if (Version > 1U) {
+			return false;
+		}
+
+		// The encoder keeps a FIFO of recent edges and one of recent vertices, triangles are
+		// coded as references into them. The pushes below must match the encoder exactly.
+		uint32_t EdgeFifo[16][2];
+		uint32_t VertexFifo[16];
+		memset(EdgeFifo, -1, sizeof(EdgeFifo));
+		memset(VertexFifo, -1, sizeof(VertexFifo));
+		size_t EdgeFifoOffset = 0U;
+		size_t VertexFifoOffset = 0U;
+		auto PushEdge = [&EdgeFifo, &EdgeFifoOffset](uint32_t A, uint32_t B) {
+			EdgeFifo[EdgeFifoOffset][0] = A;
+			EdgeFifo[EdgeFifoOffset][1] = B;
+			EdgeFifoOffset = (EdgeFifoOffset + 1U) & 15U;
+		};
+		auto PushVertex = [&VertexFifo, &VertexFifoOffset](uint32_t V, bool Condition = true) {
+			VertexFifo[VertexFifoOffset] = V;
+			VertexFifoOffset = (VertexFifoOffset + (Condition ? 1U : 0U)) & 15U;
+		};
+
+		uint32_t Next = 0U;
+		uint32_t Last = 0U;
+		// Version 1 codes the last free index plus or minus one as 13 and 14.
+		const uint32_t FecMax = (Version >= 1U) ? 13U : 15U;
+
+		const uint8_t* pCode = pBuffer + 1;
+		const uint8_t* pData = pCode + IndexCount / 3U;
+		const uint8_t* pDataSafeEnd = pBuffer + BufferSize - 16U;
+		const uint8_t* pCodeAuxTable = pDataSafeEnd;
+
+		for (size_t i = 0; i < IndexCount; i += 3U) {
+			// A triangle reads at most 16 bytes, one auxiliary code and three 5 byte free indices,
+			// which can only run into the code table after the data.
+			if (pData > pDataSafeEnd) {
+				return false;
+			}
+			const uint8_t CodeTri = *pCode++;
+
+			if (CodeTri < 0xF0U) {
+				// Edge from the FIFO plus one vertex.
+				const uint32_t Fe = CodeTri >> 4;
+				const uint32_t A = EdgeFifo[(EdgeFifoOffset - 1U - Fe) & 15U][0];
+				const uint32_t B = EdgeFifo[(EdgeFifoOffset - 1U - Fe) & 15U][1];
+				const uint32_t Fec = CodeTri & 15U;
+
+				if (Fec < FecMax) {
+					const bool IsNew = (Fec == 0U);
+					const uint32_t C = IsNew ? Next : VertexFifo[(VertexFifoOffset - 1U - Fec) & 15U];
+					Next += IsNew ? 1U : 0U;
+					WriteTriangle(pDestination, i, IndexSize, A, B, C);
+					PushVertex(C, IsNew);
+					PushEdge(C, B);
+					PushEdge(A, C);
+				}
+				else {
+					// 13 and 14 decode to -1 and 1.
+					const uint32_t C = (Fec != 15U) ? Last + (Fec - (Fec ^ 3U)) : DecodeIndex(pData, Last);
+					Last = C;
+					WriteTriangle(pDestination, i, IndexSize, A, B, C);
+					PushVertex(C);
+					PushEdge(C, B);
+					PushEdge(A, C);
+				}
+			}
+			else if (CodeTri < 0xFEU) {
+				// Three vertices, coded through the auxiliary table. 'Next' advances for every
+				// vertex before any index is decoded, matching the encoder.
+				const uint8_t CodeAux = pCodeAuxTable[CodeTri & 15U];
+				const uint32_t Feb = CodeAux >> 4;
+				const uint32_t Fec = CodeAux & 15U;
+
+				const uint32_t A = Next++;
+				const bool IsNewB = (Feb == 0U);
+				const uint32_t B = IsNewB ? Next : VertexFifo[(VertexFifoOffset - Feb) & 15U];
+				Next += IsNewB ? 1U : 0U;
+				const bool IsNewC = (Fec == 0U);
+				const uint32_t C = IsNewC ? Next : VertexFifo[(VertexFifoOffset - Fec) & 15U];
+				Next += IsNewC ? 1U : 0U;
+
+				WriteTriangle(pDestination, i, IndexSize, A, B, C);
+				PushVertex(A);
+				PushVertex(B, IsNewB);
+				PushVertex(C, IsNewC);
+				PushEdge(B, A);
+				PushEdge(C, B);
+				PushEdge(A, C);
+			}
+			else {
+				// Three vertices with a full auxiliary code byte, any of them may be a free index.
+				const uint8_t CodeAux = *pData++;
+				const uint32_t Fea = (CodeTri == 0xFEU) ? 0U : 15U;
+				const uint32_t Feb = CodeAux >> 4;
+				const uint32_t Fec = CodeAux & 15U;
+
+				// A zero code byte outside the table restarts the vertex numbering.
+				if (CodeAux == 0U) {
+					Next = 0U;
+				}
+
+				uint32_t A = (Fea == 0U) ? Next++ : 0U;
+				uint32_t B = (Feb == 0U) ? Next++ : VertexFifo[(VertexFifoOffset - Feb) & 15U];
+				uint32_t C = (Fec == 0U) ? Next++ : VertexFifo[(VertexFifoOffset - Fec) & 15U];
+
+				if (Fea == 15U) {
+					Last = A = DecodeIndex(pData, Last);
+				}
+				if (Feb == 15U) {
+					Last = B = DecodeIndex(pData, Last);
+				}
+				if (Fec == 15U) {
+					Last = C = DecodeIndex(pData, Last);
+				}
+
+				WriteTriangle(pDestination, i, IndexSize, A, B, C);
+				PushVertex(A);
+				PushVertex(B, (Feb == 0U) || (Feb == 15U));
+				PushVertex(C, (Fec == 0U) || (Fec == 15U));
+				PushEdge(B, A);
+				PushEdge(C, B);
+				PushEdge(A, C);
+			}
+		}
+
+		// Everything up to the code table must have been read.
+		return pData == pDataSafeEnd;
+	}
+
+	bool MeshoptCodec::DecodeIndexSequence(void* pDestination, size_t IndexCount, size_t IndexSize, const uint8_t* pBuffer, size_t BufferSize)
+	{
+		if (IndexSize != 2U && IndexSize != 4U) {
+			return false;
+		}
+		// Header, at least one byte per index and a 4 byte tail.
+		if (BufferSize < 1U + IndexCount + 4U) {
+			return false;
+		}
+		if ((pBuffer[0] & 0xF0U) != IE_MESHOPT_SEQUENCE_HEADER || (pBuffer[0] & 0x0FU) > 1U) {
+			return false;
+		}
+
+		const uint8_t* pData = pBuffer + 1;
+		const uint8_t* pDataSafeEnd = pBuffer + BufferSize - 4U;
+		// Each index is a delta from one of two baselines, the low bit picks which.
+		uint32_t Last[2] = { 0U, 0U };
+		for (size_t i = 0; i < IndexCount; ++i) {
+			// An index reads at most 5 bytes, the tail covers the overrun.
+			if (pData >= pDataSafeEnd) {
+				return false;
+			}
+			uint32_t Value = DecodeVByte(pData);
+			const uint32_t Baseline = Value & 1U;
+			Value >>= 1;
+			const uint32_t Delta = (Value >> 1) ^ (0U - (Value & 1U));
+			const uint32_t Index = Last[Baseline] + Delta;
+			Last[Baseline] = Index;
+
+			if (IndexSize == 2U) {
+				static_cast<uint16_t*>(pDestination)[i] = static_cast<uint16_t>(Index);
+			}
+			else {
+				static_cast<uint32_t*>(pDestination)[i] = Index;
+			}
+		}
+		return pData == pDataSafeEnd;
+	}
+
+	template <typename T>
+	static void DecodeFilterOctahedral(T* pData, size_t Count)
+	{
+		const float Max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+		for (size_t i = 0; i < Count; ++i) {
+			T* pVector = pData + i * 4U;
+			// z is stored as the octahedral coordinates' scale, reconstruct it and unfold the lower hemisphere.
+			float X = static_cast<float>(pVector[0]);
+			float Y = static_cast<float>(pVector[1]);
+			const float Z = static_cast<float>(pVector[2]) - fabsf(X) - fabsf(Y);
+			const float T0 = (Z >= 0.0f) ? 0.0f : Z;
+			X += (X >= 0.0f) ? T0 : -T0;
+			Y += (Y >= 0.0f) ? T0 : -T0;
+
+			const float Scale = Max / sqrtf(X * X + Y * Y + Z * Z);
+			pVector[0] = static_cast<T>(static_cast<int>(X * Scale + (X >= 0.0f ? 0.5f : -0.5f)));
+			pVector[1] = static_cast<T>(static_cast<int>(Y * Scale + (Y >= 0.0f ? 0.5f : -0.5f)));
+			pVector[2] = static_cast<T>(static_cast<int>(Z * Scale + (Z >= 0.0f ? 0.5f : -0.5f)));
+		}
+	}
+
+	bool MeshoptCodec::DecodeFilterOctahedral(void* pData, size_t Count, size_t Stride)
+	{
+		if (Stride == 4U) {
+			Insight::DecodeFilterOctahedral(static_cast<int8_t*>(pData), Count);
+			return true;
+		}
+		if (Stride == 8U) {
+			Insight::DecodeFilterOctahedral(static_cast<int16_t*>(pData), Count);
+			return true;
+		}
+		return false;
+	}
+
+	bool MeshoptCodec::DecodeFilterQuaternion(void* pData, size_t Count, size_t Stride)
+	{
+		if (Stride != 8U) {
+			return false;
+		}
+		const float Scale = 1.0f / sqrtf(2.0f);
+		int16_t* pComponents = static_cast<int16_t*>(pData);
+		for (size_t i = 0; i < Count; ++i) {
+			int16_t* pQuat = pComponents + i * 4U;
+			// The low two bits of the last component are the index of the dropped component, the rest is the scale.
+			const int ScaleBits = pQuat[3] | 3;
+			const float ComponentScale = Scale / static_cast<float>(ScaleBits);
+			const float X = pQuat[0] * ComponentScale;
+			const float Y = pQuat[1] * ComponentScale;
+			const float Z = pQuat[2] * ComponentScale;
+			const float WW = 1.0f - X * X - Y * Y - Z * Z;
+			const float W = sqrtf(WW >= 0.0f ? WW : 0.0f);
+
+			auto ToInt16 = [](float Value) { return static_cast<int16_t>(static_cast<int>(Value * 32767.0f + (Value >= 0.0f ? 0.5f : -0.5f))); };
+			const int Dropped = pQuat[3] & 3;
+			pQuat[(Dropped + 1) & 3] = ToInt16(X);
+			pQuat[(Dropped + 2) & 3] = ToInt16(Y);
+			pQuat[(Dropped + 3) & 3] = ToInt16(Z);
+			pQuat[(Dropped + 0) & 3] = ToInt16(W);
+		}
+		return true;
+	}
+
+	bool MeshoptCodec::DecodeFilterExponential(void* pData, size_t Count, size_t Stride)
+	{
+		if (Stride == 0U || Stride % 4U != 0U) {
+			return false;
+		}
+		uint32_t* pValues = static_cast<uint32_t*>(pData);
+		const size_t NumValues = Count * (Stride / 4U);
+		for (size_t i = 0; i < NumValues; ++i) {
+			const uint32_t Value = pValues[i];
+			// Sign extended 24-bit mantissa and 8-bit exponent, the result is Mantissa * 2^Exponent.
+			const int32_t Mantissa = static_cast<int32_t>(Value << 8) >> 8;
+			const int32_t Exponent = static_cast<int32_t>(Value) >> 24;
+			const uint32_t PowerBits = static_cast<uint32_t>(Exponent + 127) << 23;
+			float Power;
+			memcpy(&Power, &PowerBits, sizeof(Power));
+			const float Result = Power * static_cast<float>(Mantissa);
+			memcpy(&pValues[i], &Result, sizeof(Result));
+		}
+		return true;
+	}
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <vector>
+
+/*
+	Meshoptimizer's vertex and index compression, the bitstreams used by glTF's
+	EXT_meshopt_compression extension and by compressed cooked meshes. The codecs are
+	lossless, the filters are the lossy part and are undone in place after the bitstream is
+	decoded. The index buffer codec keeps every triangle and the triangle order but may
+	start a triangle at a different corner. Has no renderer dependencies and can run on
+	any thread.
+
+	Supported bitstreams:
+		Vertex buffers		Version 0, header 0xA0.
+		Index buffers		Triangle lists, versions 0 and 1, header 0xE0.
+		Index sequences		Any index list, version 0, header 0xD0. Decode only.
+
+	Example usage:
+		std::vector<uint8_t> Decoded(Count * Stride);
+		if (MeshoptCodec::DecodeVertexBuffer(Decoded.data(), Count, Stride, pEncoded, EncodedSize)) {
+			MeshoptCodec::DecodeFilterOctahedral(Decoded.data(), Count, Stride);
+		}
+*/
+
+namespace Insight {
+
+	class INSIGHT_API MeshoptCodec
+	{
+	public:
+		// Encoders, 'OutBuffer' is replaced with the bitstream. Same size limits as the decoders.
+		static bool EncodeVertexBuffer(std::vector<uint8_t>& OutBuffer, const void* pVertices, size_t VertexCount, size_t VertexSize);
+		static bool EncodeIndexBuffer(std::vector<uint8_t>& OutBuffer, const void* pIndices, size_t IndexCount, size_t IndexSize);
+
+		// 'VertexSize' must be a multiple of 4 and at most 256 bytes.
+		static bool DecodeVertexBuffer(void* pDestination, size_t VertexCount, size_t VertexSize, const uint8_t* pBuffer, size_t BufferSize);
+		// 'IndexCount' must be a multiple of 3, 'IndexSize' is 2 or 4 bytes.
+		static bool DecodeIndexBuffer(void* pDestination, size_t IndexCount, size_t IndexSize, const uint8_t* pBuffer, size_t BufferSize);
+		// 'IndexSize' is 2 or 4 bytes.
+		static bool DecodeIndexSequence(void* pDestination, size_t IndexCount, size_t IndexSize, const uint8_t* pBuffer, size_t BufferSize);
+
+		// Filters, applied in place to decoded vertex data. Return false if 'Stride' is not one the filter supports.
+		// Octahedral unit vectors, 4 signed 8 or 16-bit components.
+		static bool DecodeFilterOctahedral(void* pData, size_t Count, size_t Stride);
+		// Quaternions with the largest component dropped, 4 signed 16-bit components.
+		static bool DecodeFilterQuaternion(void* pData, size_t Count, size_t Stride);
+		// Floats stored as a 24-bit mantissa and an 8-bit exponent, 32-bit components.
+		static bool DecodeFilterExponential(void* pData, size_t Count, size_t Stride);
+	};
+
+}
@@ -4,13 +4,219 @@
 #include "Insight/Utilities/String_Helper.h"
 #include "Insight/Systems/File_System.h"
 #include "Insight/Rendering/Material.h"
+#include "Insight/Rendering/Geometry/Imported_Model.h"
+#include "Insight/Rendering/Geometry/Cooked_Mesh.h"
+#include "Insight/Rendering/Geometry/Mesh_Optimizer.h"
+#include "Insight/Rendering/Geometry/Meshlet_Builder.h"
+#include "Insight/Rendering/Geometry/Gltf_Loader.h"
+#include "Insight/Systems/Managers/Geometry_Manager.h"
+#include "Insight/Systems/Thread_Pool.h"
 
 #include "imgui.h"
 
+// Files with fewer vertices than this convert their meshes on the importing thread.
+// Import batches already spread files over the workers, splitting small files only adds overhead.
+#define IE_MODEL_PARALLEL_VERTEX_THRESHOLD 65536U
+
 namespace Insight {
 
 	static std::mutex s_MeshMutex;
 
+	static unique_ptr<ImportedNode> ParseNode_r(aiNode* pNode)
+	{
+		auto pImportedNode = std::make_unique<ImportedNode>();
+		// The root's transform is left out, the model's root transform is owned by its component.
+		if (pNode->mParent) {
+			XMStoreFloat4x4(&pImportedNode->LocalMatrix, XMMatrixTranspose(XMMATRIX(&pNode->mTransformation.a1)));
+		}
+		else {
+			XMStoreFloat4x4(&pImportedNode->LocalMatrix, XMMatrixIdentity());
+		}
+		pImportedNode->Name = pNode->mName.C_Str();
+		pImportedNode->MeshIndices.assign(pNode->mMeshes, pNode->mMeshes + pNode->mNumMeshes);
+
+		pImportedNode->Children.reserve(pNode->mNumChildren);
+		for (UINT i = 0; i < pNode->mNumChildren; ++i) {
+			pImportedNode->Children.push_back(ParseNode_r(pNode->mChildren[i]));
+		}
+
+		return pImportedNode;
+	}
+
+	static void ProcessMesh(aiMesh* pMesh, Verticies& verticies, Indices& indices)
+	{
+		using namespace DirectX;
+		verticies.reserve(pMesh->mNumVertices);
+		indices.reserve(pMesh->mNumFaces * 3U);
+		
+		// Load Verticies
+		for (UINT i = 0; i < pMesh->mNumVertices; i++) {
+
+			Vertex3D vertex;
+
+			// Position
+			vertex.Position.x = pMesh->mVertices[i].x;
+			vertex.Position.y = pMesh->mVertices[i].y;
+			vertex.Position.z = pMesh->mVertices[i].z;
+
+			// Normals
+			vertex.Normal.x = (float)pMesh->mNormals[i].x;
+			vertex.Normal.y = (float)pMesh->mNormals[i].y;
+			vertex.Normal.z = (float)pMesh->mNormals[i].z;
+
+
+			// Texture Coords/Tangents
+			if (pMesh->mTextureCoords[0]) {
+
+				vertex.TexCoords.x = (float)pMesh->mTextureCoords[0][i].x;
+				vertex.TexCoords.y = (float)pMesh->mTextureCoords[0][i].y;
+
+				vertex.Tangent.x = pMesh->mTangents[i].x;
+				vertex.Tangent.y = pMesh->mTangents[i].y;
+				vertex.Tangent.z = pMesh->mTangents[i].z;
+
+				vertex.BiTangent.x = pMesh->mBitangents[i].x;
+				vertex.BiTangent.y = pMesh->mBitangents[i].y;
+				vertex.BiTangent.z = pMesh->mBitangents[i].z;
+				
+			} else {
+
+				vertex.TexCoords = ieFloat2(0.0f, 0.0f);
+				vertex.Tangent = ieFloat3(0.0f, 0.0f, 0.0f);
+				vertex.BiTangent = ieFloat3(0.0f, 0.0f, 0.0f);
+			}
+
+			verticies.push_back(vertex);
+		}
+
+		// Load Indices
+		for (UINT i = 0; i < pMesh->mNumFaces; i++) {
+
+			aiFace face = pMesh->mFaces[i];
+			for (unsigned int j = 0; j < face.mNumIndices; j++) {
+
+				indices.push_back(face.mIndices[j]);
+			}
+		}
+
+	}
+
+	struct FlatMeshInstance
+	{
+		uint32_t MeshIndex;
+		// Node transforms from the mesh's node up to the model root.
+		XMFLOAT4X4 RelativeMatrix;
+	};
+
+	static void GatherMeshInstances_r(const ImportedNode& Node, FXMMATRIX ParentMatrix, std::vector<FlatMeshInstance>& OutInstances)
+	{
+		const XMMATRIX RelativeMatrix = XMMatrixMultiply(XMLoadFloat4x4(&Node.LocalMatrix), ParentMatrix);
+		for (uint32_t MeshIndex : Node.MeshIndices) {
+			FlatMeshInstance Instance;
+			Instance.MeshIndex = MeshIndex;
+			XMStoreFloat4x4(&Instance.RelativeMatrix, RelativeMatrix);
+			OutInstances.push_back(Instance);
+		}
+		for (const unique_ptr<ImportedNode>& pChild : Node.Children) {
+			GatherMeshInstances_r(*pChild, RelativeMatrix, OutInstances);
+		}
+	}
+
+	// Bake every node's transform into the vertices of its meshes and merge the meshes that
+	// share a material, leaving a single root node. Per frame the model then updates one
+	// matrix per material instead of walking its nodes. Meshes referenced by several
+	// nodes are duplicated, once per reference.
+	static void FlattenHierarchy(ImportedModel& Import)
+	{
+		std::vector<FlatMeshInstance> Instances;
+		GatherMeshInstances_r(*Import.pRoot, XMMatrixIdentity(), Instances);
+
+		std::vector<ImportedMesh> Merged;
+		std::unordered_map<uint32_t, uint32_t> MaterialToMerged;
+		for (const FlatMeshInstance& Instance : Instances) {
+			const ImportedMesh& Source = Import.Meshes[Instance.MeshIndex];
+			auto Iter = MaterialToMerged.find(Source.MaterialIndex);
+			if (Iter == MaterialToMerged.end()) {
+				Iter = MaterialToMerged.emplace(Source.MaterialIndex, static_cast<uint32_t>(Merged.size())).first;
+				Merged.emplace_back();
+				Merged.back().MaterialIndex = Source.MaterialIndex;
+			}
+			ImportedMesh& Target = Merged[Iter->second];
+
+			const XMMATRIX Matrix = XMLoadFloat4x4(&Instance.RelativeMatrix);
+			const XMMATRIX NormalMatrix = XMMatrixTranspose(XMMatrixInverse(nullptr, Matrix));
+			const unsigned long BaseVertex = static_cast<unsigned long>(Target.MeshVerticies.size());
+			Target.MeshVerticies.reserve(Target.MeshVerticies.size() + Source.MeshVerticies.size());
+			for (Vertex3D Vertex : Source.MeshVerticies) {
+				XMFLOAT3* pPosition = reinterpret_cast<XMFLOAT3*>(&Vertex.Position);
+				XMFLOAT3* pNormal = reinterpret_cast<XMFLOAT3*>(&Vertex.Normal);
+				XMFLOAT3* pTangent = reinterpret_cast<XMFLOAT3*>(&Vertex.Tangent);
+				XMFLOAT3* pBiTangent = reinterpret_cast<XMFLOAT3*>(&Vertex.BiTangent);
+				XMStoreFloat3(pPosition, XMVector3TransformCoord(XMLoadFloat3(pPosition), Matrix));
+				XMStoreFloat3(pNormal, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(pNormal), NormalMatrix)));
+				// Zero for meshes without texture coordinates, normalizing keeps them zero.
+				XMStoreFloat3(pTangent, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(pTangent), Matrix)));
+				XMStoreFloat3(pBiTangent, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(pBiTangent), Matrix)));
+				Target.MeshVerticies.push_back(Vertex);
+			}
+
+			// A mirroring transform turns the triangles inside out, swap their winding back.
+			const bool IsMirrored = XMVectorGetX(XMMatrixDeterminant(Matrix)) < 0.0f;
+			Target.MeshIndices.reserve(Target.MeshIndices.size() + Source.MeshIndices.size());
+			for (size_t i = 0; i + 2 < Source.MeshIndices.size(); i += 3) {
+				Target.MeshIndices.push_back(BaseVertex + Source.MeshIndices[i]);
+				Target.MeshIndices.push_back(BaseVertex + Source.MeshIndices[IsMirrored ? i + 2 : i + 1]);
+				Target.MeshIndices.push_back(BaseVertex + Source.MeshIndices[IsMirrored ? i + 1 : i + 2]);
+			}
+		}
+
+		auto pRoot = std::make_unique<ImportedNode>();
+		XMStoreFloat4x4(&pRoot->LocalMatrix, XMMatrixIdentity());
+		pRoot->Name = Import.pRoot->Name;
+		for (uint32_t i = 0; i < Merged.size(); ++i) {
+			pRoot->MeshIndices.push_back(i);
+		}
+		Import.Meshes = std::move(Merged);
+		Import.pRoot = std::move(pRoot);
+	}
+
+	shared_ptr<ImportedModel> Model::ImportWithAssimp(const std::string& SourcePath, uint32_t ImportFlags)
+	{
+		Assimp::Importer Importer;
+		const aiScene* pScene = Importer.ReadFile(SourcePath, ImportFlags);
+
+		if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode) {
+			IE_CORE_ERROR("Assimp import error: {0}", Importer.GetErrorString());
+			return nullptr;
+		}
+
+		shared_ptr<ImportedModel> pImport = std::make_shared<ImportedModel>();
+		pImport->Meshes.resize(pScene->mNumMeshes);
+		auto ConvertMesh = [pScene, &pImport](uint32_t i) {
+			ScopedMemoryCategory MeshMemoryScope(eMemoryCategory::Geometry);
+			ImportedMesh& Mesh = pImport->Meshes[i];
+			ProcessMesh(pScene->mMeshes[i], Mesh.MeshVerticies, Mesh.MeshIndices);
+			Mesh.MaterialIndex = pScene->mMeshes[i]->mMaterialIndex;
+		};
+
+		// Each mesh only reads its own aiMesh and writes its own ImportedMesh, so large files convert them in parallel.
+		uint32_t NumVertices = 0U;
+		for (uint32_t i = 0; i < pScene->mNumMeshes; ++i) {
+			NumVertices += pScene->mMeshes[i]->mNumVertices;
+		}
+		if (NumVertices >= IE_MODEL_PARALLEL_VERTEX_THRESHOLD) {
+			ThreadPool::ParallelFor(pScene->mNumMeshes, ConvertMesh);
+		}
+		else {
+			for (uint32_t i = 0; i < pScene->mNumMeshes; ++i) {
+				ConvertMesh(i);
+			}
+		}
+
+		pImport->pRoot = ParseNode_r(pScene->mRootNode);
+		return pImport;
+	}
+
 	Model::Model(const std::string& Path, Material* Material)
 	{
 		Create(Path, Material);
@@ -18,6 +224,7 @@ namespace Insight {
 
 	Model::Model(Model&& model) noexcept
 	{
+		m_pAsset = std::move(model.m_pAsset);
 		m_Meshes = std::move(model.m_Meshes);
 		m_pRoot = std::move(model.m_pRoot);
 
@@ -35,16 +242,16 @@ namespace Insight {
 		//Destroy();
 	}
 
-	bool Model::Create(const std::string& path, Material* pMaterial)
+	bool Model::Create(const std::string& path, Material* pMaterial, uint32_t AssetFlags)
 	{
 		m_pMaterial = pMaterial;
 
-		m_AssetDirectoryRelativePath = path;
-		m_Directory = FileSystem::GetProjectRelativeAssetDirectory(path);
-		m_FileName = StringHelper::GetFilenameFromDirectory(m_Directory);
-		SceneNode::SetDisplayName("Static Mesh");
-
-		return LoadModelFromFile(m_Directory);
+		const ModelAssetKey Key(AssetPath(path), IE_MODEL_DEFAULT_IMPORT_FLAGS, AssetFlags);
+		StrongModelAssetPtr pAsset = GeometryManager::FindModelAsset(Key);
+		if (!pAsset) {
+			pAsset = GeometryManager::AddModelAsset(Key, Import(path, Key.ImportFlags, Key.AssetFlags));
+		}
+		return CreateFromAsset(path, pAsset, pMaterial);
 	}
 
 	void Model::OnImGuiRender()
@@ -102,107 +309,115 @@ namespace Insight {
 		}
 	}
 
-	bool Model::LoadModelFromFile(const std::string& path)
+	shared_ptr<ImportedModel> Model::Import(const std::string& path, uint32_t ImportFlags, uint32_t AssetFlags)
 	{
-		Assimp::Importer Importer;
-		const aiScene* pScene = Importer.ReadFile(
-			path, 
-			aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded 
-		);
-
-		if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode) {
-			IE_CORE_ERROR("Assimp import error: {0}", Importer.GetErrorString());
-			return false;
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::Geometry);
+
+		// Cooked meshes are read straight into the mesh streams, Assimp is only needed for source files.
+		const std::string SourcePath = FileSystem::GetProjectRelativeAssetDirectory(path);
+		const std::string CookedPath = CookedMesh::GetCookedPath(SourcePath);
+		if (CookedMesh::IsUpToDate(SourcePath, CookedPath)) {
+			shared_ptr<ImportedModel> pCooked = CookedMesh::Read(CookedPath, ImportFlags, AssetFlags);
+			if (pCooked) {
+				return pCooked;
+			}
+			IE_CORE_WARN("Cooked mesh for \"{0}\" is invalid or out of date, importing the source file.", path);
 		}
 
-		for (size_t i = 0; i < pScene->mNumMeshes; ++i) {
-			m_Meshes.push_back(std::move(ProcessMesh(pScene->mMeshes[i], pScene)));
+		// glTF files are read natively, anything the native loader can not handle still goes through Assimp.
+		shared_ptr<ImportedModel> pImport;
+		if (GltfLoader::CanLoad(SourcePath, ImportFlags)) {
+			pImport = GltfLoader::Load(SourcePath, ImportFlags);
+			if (!pImport) {
+				IE_CORE_WARN("Falling back to Assimp for \"{0}\".", path);
+			}
+		}
+		if (!pImport) {
+			pImport = ImportWithAssimp(SourcePath, ImportFlags);
+			if (!pImport) {
+				return nullptr;
+			}
 		}
 
-		m_pRoot = ParseNode_r(pScene->mRootNode);
-		return true;
-	}
+		auto OptimizeMesh = [&pImport](uint32_t i) {
+			ScopedMemoryCategory MeshMemoryScope(eMemoryCategory::Geometry);
+			ImportedMesh& Mesh = pImport->Meshes[i];
 
-	unique_ptr<MeshNode> Model::ParseNode_r(aiNode* pNode)
-	{
-		ieTransform transform;
-		if (pNode->mParent) {
-			transform.SetLocalMatrix(XMMatrixTranspose(XMMATRIX(&pNode->mTransformation.a1)));
+			// Optimized once here, the cooked file stores the result. Tools/Engine_Tests measures what the stages gain.
+			MeshOptimizer::Optimize(Mesh.MeshVerticies, Mesh.MeshIndices);
+		};
+
+		size_t NumVertices = 0U;
+		for (const ImportedMesh& Mesh : pImport->Meshes) {
+			NumVertices += Mesh.MeshVerticies.size();
+		}
+		const uint32_t NumMeshes = static_cast<uint32_t>(pImport->Meshes.size());
+		if (NumVertices >= IE_MODEL_PARALLEL_VERTEX_THRESHOLD) {
+			ThreadPool::ParallelFor(NumMeshes, OptimizeMesh);
+		}
+		else {
+			for (uint32_t i = 0; i < NumMeshes; ++i) {
+				OptimizeMesh(i);
+			}
 		}
 
-		// Create a pointer to all the meshes this node owns
-		std::vector<Mesh*> curMeshPtrs;
-		curMeshPtrs.reserve(pNode->mNumMeshes);
-		for (UINT i = 0; i < pNode->mNumMeshes; i++) {
-			const auto meshIndex = pNode->mMeshes[i];
-			curMeshPtrs.push_back(m_Meshes.at(meshIndex).get());
+		if (AssetFlags & IE_MODEL_ASSET_FLATTEN_HIERARCHY) {
+			const size_t NumSourceMeshes = pImport->Meshes.size();
+			FlattenHierarchy(*pImport);
+			IE_CORE_TRACE("Flattened \"{0}\": {1} meshes merged into {2}.", path, NumSourceMeshes, pImport->Meshes.size());
 		}
-		
-		auto pMeshNode = std::make_unique<MeshNode>(curMeshPtrs, transform, pNode->mName.C_Str());
-		for (UINT i = 0; i < pNode->mNumChildren; ++i) {
-			pMeshNode->AddChild(ParseNode_r(pNode->mChildren[i]));
+
+		// Built last, flattening changes the meshes.
+		for (size_t i = 0; i < pImport->Meshes.size(); ++i) {
+			ImportedMesh& Mesh = pImport->Meshes[i];
+			MeshletBuilder::Build(Mesh.MeshVerticies, Mesh.MeshIndices, Mesh.Meshlets);
 		}
 
-		return pMeshNode;
+		// Cook on the first load so the next one skips Assimp. A failed cook only costs the next load another import.
+		CookedMesh::Write(*pImport, ImportFlags, AssetFlags, CookedPath);
+		return pImport;
 	}
 
-	unique_ptr<Mesh> Model::ProcessMesh(aiMesh* pMesh, const aiScene* pScene)
+	bool Model::CreateFromAsset(const std::string& path, const StrongModelAssetPtr& pAsset, Material* pMaterial)
 	{
-		using namespace DirectX;
-		std::vector<Vertex3D> verticies; verticies.reserve(pMesh->mNumVertices);
-		std::vector<DWORD> indices;
-		
-		// Load Verticies
-		for (UINT i = 0; i < pMesh->mNumVertices; i++) {
-
-			Vertex3D vertex;
-
-			// Position
-			vertex.Position.x = pMesh->mVertices[i].x;
-			vertex.Position.y = pMesh->mVertices[i].y;
-			vertex.Position.z = pMesh->mVertices[i].z;
-
-			// Normals
-			vertex.Normal.x = (float)pMesh->mNormals[i].x;
-			vertex.Normal.y = (float)pMesh->mNormals[i].y;
-			vertex.Normal.z = (float)pMesh->mNormals[i].z;
-
-
-			// Texture Coords/Tangents
-			if (pMesh->mTextureCoords[0]) {
-
-				vertex.TexCoords.x = (float)pMesh->mTextureCoords[0][i].x;
-				vertex.TexCoords.y = (float)pMesh->mTextureCoords[0][i].y;
-
-				vertex.Tangent.x = pMesh->mTangents[i].x;
-				vertex.Tangent.y = pMesh->mTangents[i].y;
-				vertex.Tangent.z = pMesh->mTangents[i].z;
-
-				vertex.BiTangent.x = pMesh->mBitangents[i].x;
-				vertex.BiTangent.y = pMesh->mBitangents[i].y;
-				vertex.BiTangent.z = pMesh->mBitangents[i].z;
-				
-			} else {
+		m_AssetDirectoryRelativePath = path;
+		m_Directory = FileSystem::GetProjectRelativeAssetDirectory(path);
+		m_FileName = StringHelper::GetFilenameFromDirectory(m_Directory);
+		m_pMaterial = pMaterial;
+		SceneNode::SetDisplayName("Static Mesh");
 
-				vertex.TexCoords = ieFloat2(0.0f, 0.0f);
-				vertex.Tangent = ieFloat3(0.0f, 0.0f, 0.0f);
-				vertex.BiTangent = ieFloat3(0.0f, 0.0f, 0.0f);
-			}
+		if (!pAsset) {
+			return false;
+		}
 
-			verticies.push_back(vertex);
+		// Only the per-instance state is created here, the buffers belong to the asset.
+		m_pAsset = pAsset;
+		m_Meshes.reserve(pAsset->GetNumMeshes());
+		for (size_t i = 0; i < pAsset->GetNumMeshes(); ++i) {
+			m_Meshes.push_back(std::make_unique<Mesh>(pAsset->GetMesh(i)));
 		}
+		m_pRoot = BuildNode_r(pAsset->GetRootNode());
 
-		// Load Indices
-		for (UINT i = 0; i < pMesh->mNumFaces; i++) {
+		return true;
+	}
 
-			aiFace face = pMesh->mFaces[i];
-			for (unsigned int j = 0; j < face.mNumIndices; j++) {
+	unique_ptr<MeshNode> Model::BuildNode_r(const ImportedNode& Node)
+	{
+		// Create a pointer to all the meshes this node owns
+		std::vector<Mesh*> curMeshPtrs;
+		curMeshPtrs.reserve(Node.MeshIndices.size());
+		for (uint32_t meshIndex : Node.MeshIndices) {
+			curMeshPtrs.push_back(m_Meshes.at(meshIndex).get());
+		}
 
-				indices.push_back(face.mIndices[j]);
-			}
+		ieTransform Transform;
+		Transform.SetLocalMatrix(XMLoadFloat4x4(&Node.LocalMatrix));
+		auto pMeshNode = std::make_unique<MeshNode>(std::move(curMeshPtrs), Transform, Node.Name.c_str());
+		for (const unique_ptr<ImportedNode>& child : Node.Children) {
+			pMeshNode->AddChild(BuildNode_r(*child));
 		}
 
-		return std::make_unique<Mesh>(verticies, indices);
+		return pMeshNode;
 	}
 
 }
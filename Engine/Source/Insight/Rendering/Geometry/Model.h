@@ -2,18 +2,30 @@
 
 #include "Mesh.h"
 
+#include "Insight/Core/Ref_Counted.h"
+
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
 #include "Insight/Core/Scene/Scene_Node.h"
 #include "Insight/Rendering/Geometry/Mesh_Node.h"
+#include "Insight/Rendering/Geometry/Model_Asset.h"
+
+// Post processing applied to source imports unless asked otherwise. Part of the cooked
+// mesh header and of the model cache key, changing it makes every cooked mesh stale.
+#define IE_MODEL_DEFAULT_IMPORT_FLAGS (aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded)
+// Models are only used by static mesh components, their node hierarchy is never animated.
+// Cooked geometry is compressed, loads are bound by reading the file rather than decoding it.
+#define IE_MODEL_DEFAULT_ASSET_FLAGS (IE_MODEL_ASSET_FLATTEN_HIERARCHY | IE_MODEL_ASSET_COMPRESS_GEOMETRY)
 
 namespace Insight {
 
 	class Material;
+	struct ImportedNode;
+	struct ImportedModel;
 	
-	class INSIGHT_API Model : public SceneNode
+	class INSIGHT_API Model : public SceneNode, public TRefCounted<ThreadSafeRefCountPolicy>
 	{
 	public:
 		Model(const std::string& Path, Material* Material);
@@ -21,12 +33,23 @@ namespace Insight {
 		Model(Model&& Model) noexcept;
 		~Model();
 
-		bool Create(const std::string& path, Material* pMaterial);
+		// Load the model through the GeometryManager's model cache, the file is only
+		// imported if no other model currently holds its geometry. 'AssetFlags' are IE_MODEL_ASSET_* flags.
+		bool Create(const std::string& path, Material* pMaterial, uint32_t AssetFlags = IE_MODEL_DEFAULT_ASSET_FLAGS);
+		// Read and convert a model file without touching the renderer. Safe to call from any
+		// thread. Returns nullptr on failure.
+		static shared_ptr<ImportedModel> Import(const std::string& path, uint32_t ImportFlags = IE_MODEL_DEFAULT_IMPORT_FLAGS, uint32_t AssetFlags = IE_MODEL_DEFAULT_ASSET_FLAGS);
+		// Read a source file through Assimp only, skipping the cooked mesh and the glTF loader. The
+		// meshes are converted but not optimized. 'SourcePath' is absolute. Returns nullptr on failure.
+		static shared_ptr<ImportedModel> ImportWithAssimp(const std::string& SourcePath, uint32_t ImportFlags = IE_MODEL_DEFAULT_IMPORT_FLAGS);
+		// Create this model's mesh instances over a shared asset. Must be called on the main thread.
+		bool CreateFromAsset(const std::string& path, const StrongModelAssetPtr& pAsset, Material* pMaterial);
 		void OnImGuiRender();
 		void RenderSceneHeirarchy();
 		void BindResources();
 
 		ieTransform& GetMeshRootTransformRef() { return m_pRoot->GetTransformRef(); }
+		const StrongModelAssetPtr& GetAsset() const { return m_pAsset; }
 
 		Material& GetMaterialRef() { return *m_pMaterial; }
 		std::string GetDirectory() { return m_Directory; }
@@ -46,11 +69,11 @@ namespace Insight {
 		void Destroy();
 
 	private:
-		bool LoadModelFromFile(const std::string& path);
-		unique_ptr<MeshNode> ParseNode_r(aiNode* pNode);
-		unique_ptr<Mesh> ProcessMesh(aiMesh* pMesh, const aiScene* pScene);
+		unique_ptr<MeshNode> BuildNode_r(const ImportedNode& Node);
 
 	private:
+		// Geometry shared with every other model loaded from the same file.
+		StrongModelAssetPtr m_pAsset;
 		std::vector<unique_ptr<Mesh>> m_Meshes;
 		unique_ptr<MeshNode> m_pRoot;
 		
@@ -0,0 +1,122 @@
+#include <ie_pch.h>
+
+#include "Model_Asset.h"
+
+#include "Insight/Rendering/Renderer.h"
+#include "Insight/Rendering/Geometry/Imported_Model.h"
+#include "Insight/Rendering/Geometry/Vertex_Packing.h"
+#include "Insight/Systems/Managers/Geometry_Manager.h"
+
+#include "Platform/Windows/DirectX_11/Geometry/D3D11_Index_Buffer.h"
+#include "Platform/Windows/DirectX_11/Geometry/D3D11_Vertex_Buffer.h"
+#include "Platform/Windows/DirectX_12/Geometry/D3D12_Index_Buffer.h"
+#include "Platform/Windows/DirectX_12/Geometry/D3D12_Vertex_Buffer.h"
+
+namespace Insight {
+
+	// ---------------
+	// Mesh Geometry
+	// ---------------
+
+	MeshGeometry::MeshGeometry(Verticies Verticies, Indices Indices, std::vector<Meshlet> Meshlets, uint32_t AssetFlags)
+		: m_Meshlets(std::move(Meshlets))
+	{
+		m_VertexLayout = VertexPacking::ChooseLayout(Verticies, (AssetFlags & IE_MODEL_ASSET_FULL_PRECISION_TEXCOORDS) != 0U);
+		const uint32_t VertexStride = VertexPacking::GetVertexStride(m_VertexLayout);
+		std::vector<uint8_t> VertexData;
+		VertexPacking::PackVertices(Verticies, m_VertexLayout, VertexData);
+		const bool Use16BitIndices = VertexPacking::CanUse16BitIndices(Verticies.size());
+		std::vector<uint8_t> IndexData;
+		VertexPacking::PackIndices(Indices, Use16BitIndices, IndexData);
+
+		switch (Renderer::GetAPI()) {
+		case Renderer::eTargetRenderAPI::D3D_11:
+		{
+			m_pVertexBuffer = new D3D11VertexBuffer(std::move(VertexData), VertexStride);
+			m_pIndexBuffer = new D3D11IndexBuffer(std::move(IndexData), Use16BitIndices);
+			break;
+		}
+		case Renderer::eTargetRenderAPI::D3D_12:
+		{
+			m_pVertexBuffer = new D3D12VertexBuffer(std::move(VertexData), VertexStride);
+			m_pIndexBuffer = new D3D12IndexBuffer(std::move(IndexData), Use16BitIndices);
+			break;
+		}
+		case Renderer::eTargetRenderAPI::INVALID:
+		{
+			IE_CORE_FATAL(L"Mesh trying to be created before the renderer has been initialized.");
+			break;
+		}
+		default:
+		{
+			IE_CORE_ERROR("Failed to determine vertex buffer type for mesh.");
+			break;
+		}
+		}
+		if (m_pVertexBuffer && m_pIndexBuffer) {
+			m_VideoMemoryBytes = static_cast<uint64_t>(m_pVertexBuffer->GetBufferSize()) + m_pIndexBuffer->GetBufferSize();
+			MemoryTracker::RecordAllocation(eMemoryCategory::Geometry, m_VideoMemoryBytes);
+		}
+
+		// Otherwise the full precision data is freed along with the arguments, the buffers
+		// have already released their packed copies.
+		if (AssetFlags & IE_MODEL_ASSET_RETAIN_CPU_GEOMETRY) {
+			m_Verticies = std::move(Verticies);
+			m_Indices = std::move(Indices);
+			m_HasCPUGeometry = true;
+		}
+	}
+
+	MeshGeometry::~MeshGeometry()
+	{
+		if (m_VideoMemoryBytes > 0U) {
+			MemoryTracker::RecordFree(eMemoryCategory::Geometry, m_VideoMemoryBytes);
+		}
+		delete m_pVertexBuffer;
+		delete m_pIndexBuffer;
+	}
+
+	void MeshGeometry::Render(ID3D12GraphicsCommandList* pCommandList) const
+	{
+		Renderer::SetVertexLayout(m_VertexLayout);
+		Renderer::SetVertexBuffers(0, 1, m_pVertexBuffer);
+		Renderer::SetIndexBuffer(m_pIndexBuffer);
+		Renderer::DrawIndexedInstanced(m_pIndexBuffer->GetNumIndices(), 1, 0, 0, 0);
+	}
+
+	void MeshGeometry::RenderRanges(const std::vector<MeshletIndexRange>& Ranges) const
+	{
+		if (Ranges.empty()) {
+			return;
+		}
+		Renderer::SetVertexLayout(m_VertexLayout);
+		Renderer::SetVertexBuffers(0, 1, m_pVertexBuffer);
+		Renderer::SetIndexBuffer(m_pIndexBuffer);
+		for (const MeshletIndexRange& Range : Ranges) {
+			Renderer::DrawIndexedInstanced(Range.NumIndices, 1, Range.FirstIndex, 0, 0);
+		}
+	}
+
+
+	// -------------
+	// Model Asset
+	// -------------
+
+	ModelAsset::ModelAsset(const ModelAssetKey& Key, ImportedModel& Import)
+		: m_Key(Key)
+	{
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::Geometry);
+
+		m_Meshes.reserve(Import.Meshes.size());
+		for (ImportedMesh& Mesh : Import.Meshes) {
+			m_Meshes.push_back(std::make_unique<MeshGeometry>(std::move(Mesh.MeshVerticies), std::move(Mesh.MeshIndices), std::move(Mesh.Meshlets), Key.AssetFlags));
+		}
+		m_pRoot = std::move(Import.pRoot);
+	}
+
+	ModelAsset::~ModelAsset()
+	{
+		GeometryManager::OnModelAssetDestroyed(this);
+	}
+
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Core/Interfaces.h"
+#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
+#include "Insight/Rendering/Geometry/Index_Buffer.h"
+#include "Insight/Rendering/Geometry/Meshlet_Culler.h"
+#include "Insight/Systems/Asset_Path.h"
+
+/*
+	Immutable geometry shared by every model loaded from the same file with the same
+	import settings. Owns the GPU vertex and index buffers and the node hierarchy they
+	were imported with. Per-instance state (transforms, constant buffers, material)
+	lives on the Model, which keeps the asset alive through a StrongModelAssetPtr.
+
+	Assets are looked up and created through the GeometryManager's model cache, so
+	fifty actors referencing the same .fbx import and upload it once. The cache only
+	holds weak handles, an asset removes itself from it when its last model releases it.
+
+	Mesh data is moved from the import into the GPU buffers and freed once uploaded,
+	only the GPU copy stays resident. Systems that need to read the triangles on the CPU
+	(picking, collision cooking) ask for an asset that retains them with
+	IE_MODEL_ASSET_RETAIN_CPU_GEOMETRY.
+
+	Example usage:
+		const ModelAssetKey Key(Path, IE_MODEL_DEFAULT_IMPORT_FLAGS, IE_MODEL_DEFAULT_ASSET_FLAGS);
+		StrongModelAssetPtr pAsset = GeometryManager::FindModelAsset(Key);
+		if (!pAsset) {
+			pAsset = GeometryManager::AddModelAsset(Key, Model::Import(Path, Key.ImportFlags, Key.AssetFlags));
+		}
+*/
+
+// Engine side processing of a model asset, on top of Assimp's post processing flags.
+// Bake the node hierarchy into the vertices and merge the meshes that share a material.
+// Changes what is cooked.
+#define IE_MODEL_ASSET_FLATTEN_HIERARCHY	(1U << 0)
+// Keep the mesh data in system memory after upload, see MeshGeometry::GetVerticies.
+#define IE_MODEL_ASSET_RETAIN_CPU_GEOMETRY	(1U << 1)
+// Store the cooked vertex and index streams compressed, losslessly, see CookedMesh.
+// Smaller files for a decode on load. Changes what is cooked.
+#define IE_MODEL_ASSET_COMPRESS_GEOMETRY	(1U << 2)
+// Upload full float texture coordinates for every mesh, see PackedVertex3DFullPrecisionUV.
+// Meshes that lose too much in half floats get them without the flag.
+#define IE_MODEL_ASSET_FULL_PRECISION_TEXCOORDS	(1U << 3)
+// Flags that change the cooked streams, the rest only affect the runtime asset.
+#define IE_MODEL_ASSET_COOKED_FLAGS			(IE_MODEL_ASSET_FLATTEN_HIERARCHY | IE_MODEL_ASSET_COMPRESS_GEOMETRY)
+
+namespace Insight {
+
+	struct ImportedNode;
+	struct ImportedModel;
+
+	// Vertex and index buffers of one mesh in a model file.
+	class INSIGHT_API MeshGeometry
+	{
+	public:
+		// Without IE_MODEL_ASSET_RETAIN_CPU_GEOMETRY in 'AssetFlags' the vertices and indices are freed once
+		// the GPU buffers are created. The meshlets are always kept, they are what the mesh is culled with.
+		MeshGeometry(Verticies Verticies, Indices Indices, std::vector<Meshlet> Meshlets, uint32_t AssetFlags);
+		~MeshGeometry();
+
+		MeshGeometry(const MeshGeometry&) = delete;
+		MeshGeometry& operator = (const MeshGeometry&) = delete;
+
+		void Render(ID3D12GraphicsCommandList* pCommandList) const;
+		// Draw only the given ranges of the index buffer, see MeshletCuller.
+		void RenderRanges(const std::vector<MeshletIndexRange>& Ranges) const;
+
+		eVertexLayout GetVertexLayout() const { return m_VertexLayout; }
+		uint32_t GetVertexCount() const { return m_pVertexBuffer->GetNumVerticies(); }
+		uint32_t GetVertexBufferSize() const { return m_pVertexBuffer->GetBufferSize(); }
+		uint32_t GetIndexCount() const { return m_pIndexBuffer->GetNumIndices(); }
+		uint32_t GetIndexBufferSize() const { return m_pIndexBuffer->GetBufferSize(); }
+
+		// Full precision copies of the mesh data. Empty unless the geometry was created with 'RetainCPUGeometry'.
+		inline bool HasCPUGeometry() const { return m_HasCPUGeometry; }
+		inline const Verticies& GetVerticies() const { return m_Verticies; }
+		inline const Indices& GetIndices() const { return m_Indices; }
+		inline const std::vector<Meshlet>& GetMeshlets() const { return m_Meshlets; }
+
+	private:
+		ieVertexBuffer* m_pVertexBuffer = nullptr;
+		ieIndexBuffer* m_pIndexBuffer = nullptr;
+		eVertexLayout m_VertexLayout = eVertexLayout::Packed;
+
+		// Size of the vertex and index buffers, recorded against the Geometry memory category.
+		uint64_t m_VideoMemoryBytes = 0U;
+
+		std::vector<Meshlet> m_Meshlets;
+		Verticies m_Verticies;
+		Indices m_Indices;
+		bool m_HasCPUGeometry = false;
+	};
+
+	// Identifies a model asset in the cache. The same file imported with different
+	// post processing produces different geometry, so the flags are part of the key.
+	// Assets with and without retained CPU data are cached separately so models that
+	// never read it do not pay for it.
+	struct ModelAssetKey
+	{
+		ModelAssetKey(const AssetPath& Path, uint32_t ImportFlags, uint32_t AssetFlags)
+			: Path(Path), ImportFlags(ImportFlags), AssetFlags(AssetFlags) {}
+
+		inline bool operator == (const ModelAssetKey& Other) const { return Path == Other.Path && ImportFlags == Other.ImportFlags && AssetFlags == Other.AssetFlags; }
+
+		AssetPath Path;
+		// Assimp post processing flags.
+		uint32_t ImportFlags;
+		// IE_MODEL_ASSET_* flags.
+		uint32_t AssetFlags;
+	};
+
+	class INSIGHT_API ModelAsset : public TRefCounted<ThreadSafeRefCountPolicy>
+	{
+	public:
+		// Create the GPU buffers for an import. The import's mesh data is moved into the
+		// buffers, it must not be used to create anything else afterwards.
+		ModelAsset(const ModelAssetKey& Key, ImportedModel& Import);
+		~ModelAsset();
+
+		inline const ModelAssetKey& GetKey() const { return m_Key; }
+		inline const ImportedNode& GetRootNode() const { return *m_pRoot; }
+		inline size_t GetNumMeshes() const { return m_Meshes.size(); }
+		inline const MeshGeometry& GetMesh(size_t Index) const { return *m_Meshes[Index]; }
+
+	private:
+		ModelAssetKey m_Key;
+		std::vector<unique_ptr<MeshGeometry>> m_Meshes;
+		unique_ptr<ImportedNode> m_pRoot;
+	};
+
+}
+
+namespace std {
+
+	template <>
+	struct hash<Insight::ModelAssetKey>
+	{
+		size_t operator()(const Insight::ModelAssetKey& Key) const
+		{
+			return hash<Insight::AssetPath>()(Key.Path) ^ (static_cast<size_t>(Key.ImportFlags) * 0x9E3779B9U) ^ static_cast<size_t>(Key.AssetFlags);
+		}
+	};
+
+}
@@ -1,5 +1,8 @@
 #pragma once
-#include "Insight/Math/ie_Vectors.h"
+
+#include <Insight/Core.h>
+
+#include "Insight/Math/ie_Float_Vectors.h"
 
 namespace Insight {
 
@@ -15,6 +18,38 @@ namespace Insight {
 		ieFloat3 BiTangent	 = {};
 	};
 
+	// GPU layout of mesh vertices, 24 bytes against Vertex3D's 56. Packed from Vertex3D
+	// when the vertex buffer is created, see VertexPacking.
+	//	Position	R32G32B32_FLOAT
+	//	TexCoords	R16G16_FLOAT
+	//	Normal		R10G10B10A2_UNORM, xyz * 0.5 + 0.5
+	//	Tangent		R10G10B10A2_UNORM, xyz * 0.5 + 0.5, w is 1 if BiTangent is cross(Normal, Tangent), 0 if it is flipped
+	struct PackedVertex3D
+	{
+		ieFloat3 Position	 = {};
+		uint16_t TexCoords[2] = {};
+		uint32_t Normal		 = 0U;
+		uint32_t Tangent	 = 0U;
+	};
+
+	// PackedVertex3D with R32G32_FLOAT texture coordinates, 28 bytes. For meshes whose texture
+	// coordinates lose too much in half floats, e.g. large tiling or atlas UVs, see VertexPacking.
+	struct PackedVertex3DFullPrecisionUV
+	{
+		ieFloat3 Position	 = {};
+		ieFloat2 TexCoords	 = {};
+		uint32_t Normal		 = 0U;
+		uint32_t Tangent	 = 0U;
+	};
+
+	// Vertex formats a mesh's GPU buffer can be packed to. The passes that draw meshes
+	// keep an input layout per format and switch with Renderer::SetVertexLayout.
+	enum class eVertexLayout : uint8_t
+	{
+		Packed = 0,				// PackedVertex3D
+		PackedFullPrecisionUV,	// PackedVertex3DFullPrecisionUV
+	};
+
 	struct ScreenSpaceVertex
 	{
 		ieFloat3 Position	 = {};
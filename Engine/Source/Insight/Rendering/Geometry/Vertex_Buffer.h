@@ -4,6 +4,8 @@
 
 #include "Insight/Rendering/Geometry/Vertex.h"
 
+#include <vector>
+
 namespace Insight {
 
 	using Verticies = std::vector<Vertex3D>;
@@ -11,8 +13,10 @@ namespace Insight {
 	class INSIGHT_API ieVertexBuffer
 	{
 	public:
-		ieVertexBuffer(Verticies Verticies)
-			: m_Verticies(std::move(Verticies)) {}
+		// 'Data' holds vertices of 'Stride' bytes each, already in the layout the pipelines
+		// expect. See VertexPacking for mesh vertices.
+		ieVertexBuffer(std::vector<uint8_t> Data, uint32_t Stride)
+			: m_Data(std::move(Data)), m_Stride(Stride), m_NumVerticies(Stride ? static_cast<uint32_t>(m_Data.size() / Stride) : 0U), m_BufferSize(static_cast<uint32_t>(m_Data.size())) {}
 		ieVertexBuffer() = default;
 		virtual ~ieVertexBuffer() = default;
 
@@ -20,11 +24,16 @@ namespace Insight {
 
 		uint32_t GetNumVerticies() { return m_NumVerticies; }
 		uint32_t GetBufferSize() { return m_BufferSize; }
+		uint32_t GetStride() const { return m_Stride; }
 	protected:
 		virtual bool CreateResources() { return true; }
+		// Free the vertex data once it has been copied to GPU or upload memory.
+		void ReleaseCPUData() { std::vector<uint8_t>().swap(m_Data); }
 
 	protected:
-		Verticies	m_Verticies;
+		// Only valid until the buffer's resources are created.
+		std::vector<uint8_t> m_Data;
+		uint32_t	m_Stride = 0U;
 		uint32_t	m_NumVerticies = 0U;
 		uint32_t	m_BufferSize = 0U;
 	};
@@ -0,0 +1,208 @@
+// No precompiled header, this file is also built by Engine_Tests. See 'PortableEngineFiles' in premake5.lua.
+#include "Vertex_Packing.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <type_traits>
+
+namespace Insight {
+
+	static_assert(sizeof(PackedVertex3D) == 24, "PackedVertex3D must match the input layouts of the geometry and shadow passes.");
+	static_assert(sizeof(PackedVertex3DFullPrecisionUV) == 28, "PackedVertex3DFullPrecisionUV must match the full precision UV input layouts of the geometry and shadow passes.");
+	static_assert(std::is_trivially_copyable_v<PackedVertex3D>, "Packed vertices are uploaded as raw bytes.");
+	static_assert(std::is_trivially_copyable_v<PackedVertex3DFullPrecisionUV>, "Packed vertices are uploaded as raw bytes.");
+
+	static inline uint32_t PackUnorm10(float Value)
+	{
+		const float Clamped = std::min(std::max(Value, -1.0f), 1.0f);
+		return static_cast<uint32_t>((Clamped * 0.5f + 0.5f) * 1023.0f + 0.5f);
+	}
+
+	static inline float UnpackUnorm10(uint32_t Value)
+	{
+		return (Value & 0x3FFU) * (2.0f / 1023.0f) - 1.0f;
+	}
+
+	static inline uint32_t PackUnitVector(const ieFloat3& Vector, uint32_t W)
+	{
+		return PackUnorm10(Vector.x) | (PackUnorm10(Vector.y) << 10) | (PackUnorm10(Vector.z) << 20) | (W << 30);
+	}
+
+	static inline ieFloat3 UnpackUnitVector(uint32_t Packed)
+	{
+		return ieFloat3(UnpackUnorm10(Packed), UnpackUnorm10(Packed >> 10), UnpackUnorm10(Packed >> 20));
+	}
+
+	static inline ieFloat3 Cross(const ieFloat3& A, const ieFloat3& B)
+	{
+		return ieFloat3(A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x);
+	}
+
+	static inline float Dot(const ieFloat3& A, const ieFloat3& B)
+	{
+		return A.x * B.x + A.y * B.y + A.z * B.z;
+	}
+
+	PackedVertex3D VertexPacking::PackVertex(const Vertex3D& Vertex)
+	{
+		PackedVertex3D Packed;
+		Packed.Position = Vertex.Position;
+		Packed.TexCoords[0] = FloatToHalf(Vertex.TexCoords.x);
+		Packed.TexCoords[1] = FloatToHalf(Vertex.TexCoords.y);
+		Packed.Normal = PackUnitVector(Vertex.Normal, 0U);
+		const bool IsBiTangentFlipped = Dot(Cross(Vertex.Normal, Vertex.Tangent), Vertex.BiTangent) < 0.0f;
+		Packed.Tangent = PackUnitVector(Vertex.Tangent, IsBiTangentFlipped ? 0U : 3U);
+		return Packed;
+	}
+
+	Vertex3D VertexPacking::UnpackVertex(const PackedVertex3D& Packed)
+	{
+		Vertex3D Vertex;
+		Vertex.Position = Packed.Position;
+		Vertex.TexCoords = ieFloat2(HalfToFloat(Packed.TexCoords[0]), HalfToFloat(Packed.TexCoords[1]));
+		Vertex.Normal = UnpackUnitVector(Packed.Normal);
+		Vertex.Tangent = UnpackUnitVector(Packed.Tangent);
+		// Same reconstruction as the vertex shaders.
+		const float Sign = ((Packed.Tangent >> 30) > 1U) ? 1.0f : -1.0f;
+		const ieFloat3 BiTangent = Cross(Vertex.Normal, Vertex.Tangent);
+		Vertex.BiTangent = ieFloat3(BiTangent.x * Sign, BiTangent.y * Sign, BiTangent.z * Sign);
+		return Vertex;
+	}
+
+	PackedVertex3DFullPrecisionUV VertexPacking::PackVertexFullPrecisionUV(const Vertex3D& Vertex)
+	{
+		const PackedVertex3D Packed = PackVertex(Vertex);
+		PackedVertex3DFullPrecisionUV FullPrecision;
+		FullPrecision.Position = Vertex.Position;
+		FullPrecision.TexCoords = Vertex.TexCoords;
+		FullPrecision.Normal = Packed.Normal;
+		FullPrecision.Tangent = Packed.Tangent;
+		return FullPrecision;
+	}
+
+	eVertexLayout VertexPacking::ChooseLayout(const Verticies& MeshVerticies, bool RequireFullPrecisionTexCoords)
+	{
+		if (RequireFullPrecisionTexCoords) {
+			return eVertexLayout::PackedFullPrecisionUV;
+		}
+		for (const Vertex3D& Vertex : MeshVerticies) {
+			const float ErrorU = fabsf(Vertex.TexCoords.x - HalfToFloat(FloatToHalf(Vertex.TexCoords.x)));
+			const float ErrorV = fabsf(Vertex.TexCoords.y - HalfToFloat(FloatToHalf(Vertex.TexCoords.y)));
+			// Written so NaN errors, from coordinates past the half range, also pick full precision.
+			if (!(ErrorU <= IE_VERTEX_PACKING_MAX_TEXCOORD_ERROR && ErrorV <= IE_VERTEX_PACKING_MAX_TEXCOORD_ERROR)) {
+				return eVertexLayout::PackedFullPrecisionUV;
+			}
+		}
+		return eVertexLayout::Packed;
+	}
+
+	uint32_t VertexPacking::GetVertexStride(eVertexLayout Layout)
+	{
+		return (Layout == eVertexLayout::PackedFullPrecisionUV) ? sizeof(PackedVertex3DFullPrecisionUV) : sizeof(PackedVertex3D);
+	}
+
+	void VertexPacking::PackVertices(const Verticies& MeshVerticies, eVertexLayout Layout, std::vector<uint8_t>& OutData)
+	{
+		OutData.resize(MeshVerticies.size() * GetVertexStride(Layout));
+		if (Layout == eVertexLayout::PackedFullPrecisionUV) {
+			PackedVertex3DFullPrecisionUV* pPacked = reinterpret_cast<PackedVertex3DFullPrecisionUV*>(OutData.data());
+			for (size_t i = 0; i < MeshVerticies.size(); ++i) {
+				pPacked[i] = PackVertexFullPrecisionUV(MeshVerticies[i]);
+			}
+		}
+		else {
+			PackedVertex3D* pPacked = reinterpret_cast<PackedVertex3D*>(OutData.data());
+			for (size_t i = 0; i < MeshVerticies.size(); ++i) {
+				pPacked[i] = PackVertex(MeshVerticies[i]);
+			}
+		}
+	}
+
+	void VertexPacking::PackIndices(const Indices& MeshIndices, bool Use16Bit, std::vector<uint8_t>& OutData)
+	{
+		if (Use16Bit) {
+			OutData.resize(MeshIndices.size() * sizeof(uint16_t));
+			uint16_t* pIndices = reinterpret_cast<uint16_t*>(OutData.data());
+			for (size_t i = 0; i < MeshIndices.size(); ++i) {
+				pIndices[i] = static_cast<uint16_t>(MeshIndices[i]);
+			}
+		}
+		else {
+			OutData.resize(MeshIndices.size() * sizeof(uint32_t));
+			uint32_t* pIndices = reinterpret_cast<uint32_t*>(OutData.data());
+			for (size_t i = 0; i < MeshIndices.size(); ++i) {
+				pIndices[i] = static_cast<uint32_t>(MeshIndices[i]);
+			}
+		}
+	}
+
+	uint16_t VertexPacking::FloatToHalf(float Value)
+	{
+		uint32_t Bits;
+		memcpy(&Bits, &Value, sizeof(Bits));
+		const uint32_t Sign = (Bits >> 16) & 0x8000U;
+		const uint32_t Abs = Bits & 0x7FFFFFFFU;
+
+		// Infinity and NaN.
+		if (Abs >= 0x7F800000U) {
+			return static_cast<uint16_t>(Sign | 0x7C00U | ((Abs > 0x7F800000U) ? 0x200U : 0U));
+		}
+		// Rounds to more than 65504, the largest half.
+		if (Abs >= 0x477FF000U) {
+			return static_cast<uint16_t>(Sign | 0x7C00U);
+		}
+		// Below the smallest normal half, 2^-14.
+		if (Abs < 0x38800000U) {
+			// Less than half the smallest subnormal rounds to zero.
+			if (Abs < 0x33000000U) {
+				return static_cast<uint16_t>(Sign);
+			}
+			const uint32_t Exponent = Abs >> 23;
+			const uint32_t Mantissa = (Abs & 0x7FFFFFU) | 0x800000U;
+			const uint32_t Shift = 126U - Exponent;
+			uint32_t Half = Mantissa >> Shift;
+			const uint32_t Remainder = Mantissa & ((1U << Shift) - 1U);
+			const uint32_t HalfWay = 1U << (Shift - 1U);
+			if (Remainder > HalfWay || (Remainder == HalfWay && (Half & 1U))) {
+				++Half;
+			}
+			return static_cast<uint16_t>(Sign | Half);
+		}
+
+		// Rebias the exponent from 127 to 15 and round the mantissa to nearest even. A carry
+		// out of the mantissa correctly moves on to the next exponent.
+		uint32_t Half = (Abs - 0x38000000U) >> 13;
+		const uint32_t Remainder = Abs & 0x1FFFU;
+		if (Remainder > 0x1000U || (Remainder == 0x1000U && (Half & 1U))) {
+			++Half;
+		}
+		return static_cast<uint16_t>(Sign | Half);
+	}
+
+	float VertexPacking::HalfToFloat(uint16_t Value)
+	{
+		const uint32_t Sign = (Value & 0x8000U) << 16;
+		const uint32_t Exponent = (Value >> 10) & 0x1FU;
+		const uint32_t Mantissa = Value & 0x3FFU;
+
+		uint32_t Bits;
+		if (Exponent == 0U) {
+			// Zero and subnormals, exactly representable as a float.
+			const float Magnitude = Mantissa * (1.0f / 16777216.0f);
+			memcpy(&Bits, &Magnitude, sizeof(Bits));
+			Bits |= Sign;
+		}
+		else if (Exponent == 31U) {
+			Bits = Sign | 0x7F800000U | (Mantissa << 13);
+		}
+		else {
+			Bits = Sign | ((Exponent + 112U) << 23) | (Mantissa << 13);
+		}
+
+		float Result;
+		memcpy(&Result, &Bits, sizeof(Result));
+		return Result;
+	}
+
+}
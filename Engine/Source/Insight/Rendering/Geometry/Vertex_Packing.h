@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
+#include "Insight/Rendering/Geometry/Index_Buffer.h"
+
+/*
+	Conversion of full precision mesh data to the formats uploaded to the GPU.
+
+	Vertices are packed to PackedVertex3D: half float texture coordinates, 10-10-10-2
+	normals and tangents and a bitangent sign in place of the bitangent, which the vertex
+	shader rebuilds as cross(Normal, Tangent) * Sign. Positions stay full floats, quantizing
+	them would need a per-mesh dequantization transform in front of every pass that reads them.
+	Index buffers with fewer than 65535 vertices are stored as 16-bit.
+
+	Meshes whose texture coordinates move more than IE_VERTEX_PACKING_MAX_TEXCOORD_ERROR in
+	half floats, or that ask for it with IE_MODEL_ASSET_FULL_PRECISION_TEXCOORDS, are packed
+	to PackedVertex3DFullPrecisionUV instead, see ChooseLayout.
+
+	Imports, the optimizer and the cooked format keep working on full precision Vertex3D,
+	packing only happens once when the GPU buffers are created.
+
+	Example usage:
+		std::vector<uint8_t> VertexData;
+		const eVertexLayout Layout = VertexPacking::ChooseLayout(MeshVerticies, false);
+		VertexPacking::PackVertices(MeshVerticies, Layout, VertexData);
+*/
+
+// Largest texture coordinate error allowed in half floats, one texel of a 2048 texture.
+// Coordinates within [-2, 2] stay under it.
+#define IE_VERTEX_PACKING_MAX_TEXCOORD_ERROR (1.0f / 2048.0f)
+
+namespace Insight {
+
+	class INSIGHT_API VertexPacking
+	{
+	public:
+		static PackedVertex3D PackVertex(const Vertex3D& Vertex);
+		static Vertex3D UnpackVertex(const PackedVertex3D& Packed);
+		static PackedVertex3DFullPrecisionUV PackVertexFullPrecisionUV(const Vertex3D& Vertex);
+
+		// PackedFullPrecisionUV if 'RequireFullPrecisionTexCoords' is set or any texture coordinate
+		// is off by more than IE_VERTEX_PACKING_MAX_TEXCOORD_ERROR in half floats, Packed otherwise.
+		static eVertexLayout ChooseLayout(const Verticies& MeshVerticies, bool RequireFullPrecisionTexCoords);
+		static uint32_t GetVertexStride(eVertexLayout Layout);
+		static void PackVertices(const Verticies& MeshVerticies, eVertexLayout Layout, std::vector<uint8_t>& OutData);
+
+		// True if the indices fit in 16 bits. 0xFFFF is left out, it is the strip cut value.
+		static bool CanUse16BitIndices(size_t NumVertices) { return NumVertices < 0xFFFFU; }
+		// Writes 16-bit indices if 'Use16Bit' is set, 32-bit otherwise.
+		static void PackIndices(const Indices& MeshIndices, bool Use16Bit, std::vector<uint8_t>& OutData);
+
+		static uint16_t FloatToHalf(float Value);
+		static float HalfToFloat(uint16_t Value);
+	};
+
+}
@@ -10,6 +10,9 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(ADirectionalLight, "DirectionalLight");
+
+	static_assert(sizeof(DirectionalLightProperties) == 16, "Directional light payload layout changed, bump IE_COOKED_SCENE_VERSION.");
 
 
 	ADirectionalLight::ADirectionalLight(ActorId id, ActorType type)
@@ -19,9 +22,9 @@ namespace Insight {
 
 		AActor::GetTransformRef().SetPosition(0.0f, -1.0f, -6.0f);
 
-		m_ShaderCB.diffuse = ieVector3(1.0f, 1.0f, 1.0f);
+		m_ShaderCB.diffuse = m_Properties.Diffuse;
 		m_ShaderCB.direction = SceneNode::GetTransformRef().GetPosition();
-		m_ShaderCB.strength = 8.0f;
+		m_ShaderCB.strength = m_Properties.Strength;
 
 		m_NearPlane = 1.0f;
 		m_FarPlane = 210.0f;
@@ -35,17 +38,65 @@ namespace Insight {
 	{
 		AActor::LoadFromJson(jsonDirectionalLight);
 
-		float diffuseR, diffuseG, diffuseB, strength;
 		const rapidjson::Value& emission = jsonDirectionalLight["Emission"];
-		json::get_float(emission[0], "diffuseR", diffuseR);
-		json::get_float(emission[0], "diffuseG", diffuseG);
-		json::get_float(emission[0], "diffuseB", diffuseB);
-		json::get_float(emission[0], "strength", strength);
+		Reflection::ReadJson(emission[0], m_Properties);
+
+		m_ShaderCB.diffuse = m_Properties.Diffuse;
+		m_ShaderCB.direction = AActor::GetTransformRef().GetRotationRef();
+		m_ShaderCB.strength = m_Properties.Strength;
+
+		InitLightSpaceMatrices();
+
+		return true;
+	}
+
+	bool ADirectionalLight::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		AActor::LoadFromCooked(Scene, Actor);
 
-		m_ShaderCB.diffuse = XMFLOAT3(diffuseR, diffuseG, diffuseB);
+		const DirectionalLightProperties* pCooked = Scene.GetPayload<DirectionalLightProperties>(Actor);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked directional light \"{0}\" has an invalid payload.", SceneNode::GetDisplayName());
+			return false;
+		}
+
+		m_Properties = *pCooked;
+
+		m_ShaderCB.diffuse = m_Properties.Diffuse;
 		m_ShaderCB.direction = AActor::GetTransformRef().GetRotationRef();
-		m_ShaderCB.strength = strength;
+		m_ShaderCB.strength = m_Properties.Strength;
+
+		InitLightSpaceMatrices();
+
+		return true;
+	}
+
+	bool ADirectionalLight::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		AActor::BeginCookedActor(Builder, HashTypeName("DirectionalLight"));
+		Builder.SetActorPayload(m_Properties);
+		Builder.EndActor();
+		return true;
+	}
+
+	void ADirectionalLight::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		AActor::WriteToSnapshot(Snapshot);
+		Reflection::WriteBinary(m_Properties, Snapshot);
+	}
+
+	bool ADirectionalLight::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		if (!AActor::ReadFromSnapshot(pData, pEnd) || !Reflection::ReadBinary(m_Properties, pData, pEnd)) {
+			return false;
+		}
+		m_ShaderCB.diffuse = m_Properties.Diffuse;
+		m_ShaderCB.strength = m_Properties.Strength;
+		return true;
+	}
 
+	void ADirectionalLight::InitLightSpaceMatrices()
+	{
 		m_NearPlane = 1.0f;
 		m_FarPlane = 210.0f;
 		
@@ -76,11 +127,9 @@ namespace Insight {
 
 		m_ShaderCB.lightSpaceView = LightViewFloat;
 		m_ShaderCB.lightSpaceProj = LightProjFloat;
-
-		return true;
 	}
 
-	bool ADirectionalLight::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool ADirectionalLight::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.StartObject(); // Start Write Actor
 		{
@@ -91,55 +140,12 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			AActor::WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			// Directional Light Attributes
 			Writer.Key("Emission");
 			Writer.StartArray();
-			{
-				Writer.StartObject();
-				Writer.Key("diffuseR");
-				Writer.Double(m_ShaderCB.diffuse.x);
-				Writer.Key("diffuseG");
-				Writer.Double(m_ShaderCB.diffuse.y);
-				Writer.Key("diffuseB");
-				Writer.Double(m_ShaderCB.diffuse.z);
-				Writer.Key("strength");
-				Writer.Double(m_ShaderCB.strength);
-				Writer.EndObject();
-			}
+			Reflection::WriteJson(Writer, m_Properties);
 			Writer.EndArray();
 
 			Writer.Key("Subobjects");
@@ -238,11 +244,11 @@ namespace Insight {
 
 		if (ImGui::CollapsingHeader("Emission", ImGuiTreeNodeFlags_DefaultOpen))
 		{
-			ImGuiColorEditFlags colorWheelFlags = ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_Uint8 | ImGuiColorEditFlags_PickerHueWheel;
-			// Imgui will edit the color values in a normalized 0 to 1 space. 
-			// In the shaders we transform the color values back into 0 to 255 space.
-			ImGui::ColorEdit3("Diffuse", &m_ShaderCB.diffuse.x, colorWheelFlags);
-			ImGui::DragFloat("Strength", &m_ShaderCB.strength, 0.01f, 0.0f, 10.0f);
+			if (Reflection::DrawInspector(m_Properties)) {
+				AActor::MarkSaveDirty();
+				m_ShaderCB.diffuse = m_Properties.Diffuse;
+				m_ShaderCB.strength = m_Properties.Strength;
+			}
 		}
 
 	}
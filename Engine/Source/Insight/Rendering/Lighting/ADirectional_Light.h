@@ -3,10 +3,23 @@
 #include <Insight/Core.h>
 
 #include <Insight/Runtime/AActor.h>
+#include "Insight/Runtime/Reflection.h"
 #include "Platform/Windows/DirectX_Shared/Constant_Buffer_Types.h"
 
 namespace Insight {
 
+	// Saved as the "Emission" record and used as the cooked payload.
+	// The light's direction comes from the actor's transform.
+	struct DirectionalLightProperties
+	{
+		ieVector3 Diffuse = ieVector3(1.0f, 1.0f, 1.0f);
+		float Strength = 8.0f;
+	};
+	IE_REFLECT_TYPE(DirectionalLightProperties,
+		IE_REFLECT_FIELD(Diffuse, "diffuse", "Diffuse", FieldEditor::Color()),
+		IE_REFLECT_FIELD(Strength, "strength", "Strength", FieldEditor::Drag(0.01f, 0.0f, 10.0f))
+	);
+
 	class INSIGHT_API ADirectionalLight : public AActor
 	{
 	public:
@@ -14,7 +27,11 @@ namespace Insight {
 		virtual ~ADirectionalLight();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonDirectionalLight) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot) override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		virtual bool OnInit();
 		virtual bool OnPostInit();
@@ -36,6 +53,10 @@ namespace Insight {
 		XMFLOAT4X4 LightViewFloat;
 		XMFLOAT4X4 LightProjFloat;
 	private:
+		void InitLightSpaceMatrices();
+
+	private:
+		DirectionalLightProperties m_Properties;
 		CB_PS_DirectionalLight m_ShaderCB;
 		XMVECTOR LightCamPositionVec;
 		XMFLOAT3 LightCamPositionOffset;
@@ -8,6 +8,9 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(APointLight, "PointLight");
+
+	static_assert(sizeof(PointLightProperties) == 16, "Point light payload layout changed, bump IE_COOKED_SCENE_VERSION.");
 
 
 	APointLight::APointLight(ActorId id, ActorType type)
@@ -15,8 +18,7 @@ namespace Insight {
 	{
 		Renderer::RegisterPointLight(this);
 
-		m_ShaderCB.diffuse = ieVector3(1.0f, 1.0f, 1.0f);
-		m_ShaderCB.strength = 1.0f;
+		UpdateShaderCB();
 	}
 
 	APointLight::~APointLight()
@@ -27,20 +29,53 @@ namespace Insight {
 	{
 		AActor::LoadFromJson(jsonPointLight);
 
-		float diffuseR, diffuseG, diffuseB, strength;
 		const rapidjson::Value& emission = jsonPointLight["Emission"];
-		json::get_float(emission[0], "diffuseR", diffuseR);
-		json::get_float(emission[0], "diffuseG", diffuseG);
-		json::get_float(emission[0], "diffuseB", diffuseB);
-		json::get_float(emission[0], "strength", strength);
+		Reflection::ReadJson(emission[0], m_Properties);
+
+		UpdateShaderCB();
+		return true;
+	}
+
+	bool APointLight::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		AActor::LoadFromCooked(Scene, Actor);
+
+		const PointLightProperties* pCooked = Scene.GetPayload<PointLightProperties>(Actor);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked point light \"{0}\" has an invalid payload.", SceneNode::GetDisplayName());
+			return false;
+		}
 
-		m_ShaderCB.diffuse = XMFLOAT3(diffuseR, diffuseG, diffuseB);
-		m_ShaderCB.strength = strength;
+		m_Properties = *pCooked;
 
+		UpdateShaderCB();
 		return true;
 	}
 
-	bool APointLight::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool APointLight::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		AActor::BeginCookedActor(Builder, HashTypeName("PointLight"));
+		Builder.SetActorPayload(m_Properties);
+		Builder.EndActor();
+		return true;
+	}
+
+	void APointLight::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		AActor::WriteToSnapshot(Snapshot);
+		Reflection::WriteBinary(m_Properties, Snapshot);
+	}
+
+	bool APointLight::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		if (!AActor::ReadFromSnapshot(pData, pEnd) || !Reflection::ReadBinary(m_Properties, pData, pEnd)) {
+			return false;
+		}
+		UpdateShaderCB();
+		return true;
+	}
+
+	bool APointLight::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.StartObject(); // Start Write Actor
 		{
@@ -51,55 +86,12 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			AActor::WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			// Point Light Attributes
 			Writer.Key("Emission");
 			Writer.StartArray();
-			{
-				Writer.StartObject();
-				Writer.Key("diffuseR");
-				Writer.Double(m_ShaderCB.diffuse.x);
-				Writer.Key("diffuseG");
-				Writer.Double(m_ShaderCB.diffuse.y);
-				Writer.Key("diffuseB");
-				Writer.Double(m_ShaderCB.diffuse.z);
-				Writer.Key("strength");
-				Writer.Double(m_ShaderCB.strength);
-				Writer.EndObject();
-			}
+			Reflection::WriteJson(Writer, m_Properties);
 			Writer.EndArray();
 
 			Writer.Key("Subobjects");
@@ -169,13 +161,19 @@ namespace Insight {
 
 		if (ImGui::CollapsingHeader("Emission", ImGuiTreeNodeFlags_DefaultOpen))
 		{
-			ImGuiColorEditFlags colorWheelFlags = ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_Uint8 | ImGuiColorEditFlags_PickerHueWheel;
-			// Imgui will edit the color values in a normalized 0 to 1 space. 
-			// In the shaders we transform the color values back into 0 to 255 space.
-			ImGui::ColorEdit3("Diffuse", &m_ShaderCB.diffuse.x, colorWheelFlags);
-			ImGui::DragFloat("Strength", &m_ShaderCB.strength, 0.1f, 0.0f, 100.0f);
+			if (Reflection::DrawInspector(m_Properties)) {
+				AActor::MarkSaveDirty();
+				UpdateShaderCB();
+			}
 		}
 
 	}
 
+	void APointLight::UpdateShaderCB()
+	{
+		m_ShaderCB.position = SceneNode::GetTransformRef().GetPosition();
+		m_ShaderCB.diffuse = m_Properties.Diffuse;
+		m_ShaderCB.strength = m_Properties.Strength;
+	}
+
 }
\ No newline at end of file
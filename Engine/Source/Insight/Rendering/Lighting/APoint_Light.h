@@ -3,10 +3,22 @@
 #include <Insight/Core.h>
 
 #include <Insight/Runtime/AActor.h>
+#include "Insight/Runtime/Reflection.h"
 #include "Platform/Windows/DirectX_Shared/Constant_Buffer_Types.h"
 
 namespace Insight {
 
+	// Saved as the "Emission" record and used as the cooked payload.
+	struct PointLightProperties
+	{
+		ieVector3 Diffuse = ieVector3(1.0f, 1.0f, 1.0f);
+		float Strength = 1.0f;
+	};
+	IE_REFLECT_TYPE(PointLightProperties,
+		IE_REFLECT_FIELD(Diffuse, "diffuse", "Diffuse", FieldEditor::Color()),
+		IE_REFLECT_FIELD(Strength, "strength", "Strength", FieldEditor::Drag(0.1f, 0.0f, 100.0f))
+	);
+
 	class INSIGHT_API APointLight : public AActor
 	{
 	public:
@@ -14,7 +26,11 @@ namespace Insight {
 		virtual ~APointLight();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonPointLight) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot) override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		virtual bool OnInit();
 		virtual bool OnPostInit();
@@ -34,6 +50,10 @@ namespace Insight {
 		 CB_PS_PointLight GetConstantBuffer() { return m_ShaderCB; }
 
 	private:
+		void UpdateShaderCB();
+
+	private:
+		PointLightProperties m_Properties;
 		CB_PS_PointLight m_ShaderCB;
 	};
 
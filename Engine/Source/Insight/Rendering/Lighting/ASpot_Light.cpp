@@ -9,6 +9,9 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(ASpotLight, "SpotLight");
+
+	static_assert(sizeof(SpotLightProperties) == 36, "Spot light payload layout changed, bump IE_COOKED_SCENE_VERSION.");
 
 
 
@@ -17,11 +20,7 @@ namespace Insight {
 	{
 		Renderer::RegisterSpotLight(this);
 
-		m_ShaderCB.diffuse = ieVector3(1.0f, 1.0f, 1.0f);
-		m_ShaderCB.direction = Vector3::Down;
-		m_ShaderCB.strength = 1.0f;
-		m_ShaderCB.innerCutoff = cos(XMConvertToRadians(m_TempInnerCutoff));
-		m_ShaderCB.outerCutoff = cos(XMConvertToRadians(m_TempOuterCutoff));
+		UpdateShaderCB();
 	}
 
 	ASpotLight::~ASpotLight()
@@ -33,24 +32,52 @@ namespace Insight {
 		AActor::LoadFromJson(jsonSpotLight);
 
 		const rapidjson::Value& emission = jsonSpotLight["Emission"];
-		json::get_float(emission[0], "diffuseR", m_ShaderCB.diffuse.x);
-		json::get_float(emission[0], "diffuseG", m_ShaderCB.diffuse.y);
-		json::get_float(emission[0], "diffuseB", m_ShaderCB.diffuse.z);
-		json::get_float(emission[0], "directionX", m_ShaderCB.direction.x);
-		json::get_float(emission[0], "directionY", m_ShaderCB.direction.y);
-		json::get_float(emission[0], "directionZ", m_ShaderCB.direction.z);
-		json::get_float(emission[0], "strength", m_ShaderCB.strength);
-		json::get_float(emission[0], "innerCutoff", m_TempInnerCutoff);
-		json::get_float(emission[0], "outerCutoff", m_TempOuterCutoff);
+		Reflection::ReadJson(emission[0], m_Properties);
 
-		m_ShaderCB.position = SceneNode::GetTransformRef().GetPosition();
-		m_ShaderCB.innerCutoff = cos(XMConvertToRadians(m_TempInnerCutoff));
-		m_ShaderCB.outerCutoff = cos(XMConvertToRadians(m_TempOuterCutoff));
-		
+		UpdateShaderCB();
+		return true;
+	}
+
+	bool ASpotLight::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		AActor::LoadFromCooked(Scene, Actor);
+
+		const SpotLightProperties* pCooked = Scene.GetPayload<SpotLightProperties>(Actor);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked spot light \"{0}\" has an invalid payload.", SceneNode::GetDisplayName());
+			return false;
+		}
+
+		m_Properties = *pCooked;
+
+		UpdateShaderCB();
+		return true;
+	}
+
+	bool ASpotLight::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		AActor::BeginCookedActor(Builder, HashTypeName("SpotLight"));
+		Builder.SetActorPayload(m_Properties);
+		Builder.EndActor();
 		return true;
 	}
 
-	bool ASpotLight::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	void ASpotLight::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		AActor::WriteToSnapshot(Snapshot);
+		Reflection::WriteBinary(m_Properties, Snapshot);
+	}
+
+	bool ASpotLight::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		if (!AActor::ReadFromSnapshot(pData, pEnd) || !Reflection::ReadBinary(m_Properties, pData, pEnd)) {
+			return false;
+		}
+		UpdateShaderCB();
+		return true;
+	}
+
+	bool ASpotLight::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.StartObject(); // Start Write Actor
 		{
@@ -61,65 +88,12 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			AActor::WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			// Spot Light Attributes
 			Writer.Key("Emission");
 			Writer.StartArray();
-			{
-				Writer.StartObject();
-				Writer.Key("diffuseR");
-				Writer.Double(m_ShaderCB.diffuse.x);
-				Writer.Key("diffuseG");
-				Writer.Double(m_ShaderCB.diffuse.y);
-				Writer.Key("diffuseB");
-				Writer.Double(m_ShaderCB.diffuse.z);
-				Writer.Key("directionX");
-				Writer.Double(m_ShaderCB.direction.x);
-				Writer.Key("directionY");
-				Writer.Double(m_ShaderCB.direction.y);
-				Writer.Key("directionZ");
-				Writer.Double(m_ShaderCB.direction.z);
-				Writer.Key("strength");
-				Writer.Double(m_ShaderCB.strength);
-				Writer.Key("innerCuttoff");
-				Writer.Double(m_ShaderCB.innerCutoff);
-				Writer.Key("outerCuttoff");
-				Writer.Double(m_ShaderCB.outerCutoff);
-				Writer.EndObject();
-			}
+			Reflection::WriteJson(Writer, m_Properties);
 			Writer.EndArray();
 
 			Writer.Key("Subobjects");
@@ -189,20 +163,24 @@ namespace Insight {
 
 		if (ImGui::CollapsingHeader("Emission", ImGuiTreeNodeFlags_DefaultOpen))
 		{
-			ImGuiColorEditFlags colorWheelFlags = ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_Uint8 | ImGuiColorEditFlags_PickerHueWheel;
-			// Imgui will edit the color values in a normalized 0 to 1 space. 
-			// In the shaders we transform the color values back into 0 to 255 space.
-			ImGui::ColorEdit3("Diffuse", &m_ShaderCB.diffuse.x, colorWheelFlags);
-			ImGui::DragFloat3("Direction", &m_ShaderCB.direction.x, 0.05f, -1.0f, 1.0f);
-			ImGui::DragFloat("Inner Cut-off", &m_TempInnerCutoff, 0.1f, 0.0f, 50.0f);
-			ImGui::DragFloat("Outer Cut-off", &m_TempOuterCutoff, 0.1f, 0.0f, 50.0f);
-			ImGui::DragFloat("Strength", &m_ShaderCB.strength, 0.15f, 0.0f, 10.0f);
-			if (m_TempInnerCutoff > m_TempOuterCutoff) {
-				m_TempInnerCutoff = m_TempOuterCutoff;
+			if (Reflection::DrawInspector(m_Properties)) {
+				if (m_Properties.InnerCutoff > m_Properties.OuterCutoff) {
+					m_Properties.InnerCutoff = m_Properties.OuterCutoff;
+				}
+				AActor::MarkSaveDirty();
+				UpdateShaderCB();
 			}
-			m_ShaderCB.innerCutoff = cos(XMConvertToRadians(m_TempInnerCutoff));
-			m_ShaderCB.outerCutoff = cos(XMConvertToRadians(m_TempOuterCutoff));
 		}
 	}
 
+	void ASpotLight::UpdateShaderCB()
+	{
+		m_ShaderCB.position = SceneNode::GetTransformRef().GetPosition();
+		m_ShaderCB.diffuse = m_Properties.Diffuse;
+		m_ShaderCB.direction = m_Properties.Direction;
+		m_ShaderCB.strength = m_Properties.Strength;
+		m_ShaderCB.innerCutoff = cos(XMConvertToRadians(m_Properties.InnerCutoff));
+		m_ShaderCB.outerCutoff = cos(XMConvertToRadians(m_Properties.OuterCutoff));
+	}
+
 }
\ No newline at end of file
@@ -3,10 +3,29 @@
 #include <Insight/Core.h>
 
 #include "Insight/Runtime/AActor.h"
+#include "Insight/Runtime/Reflection.h"
 #include "Platform/Windows/DirectX_Shared/Constant_Buffer_Types.h"
 
 namespace Insight {
 
+	// Saved as the "Emission" record and used as the cooked payload.
+	struct SpotLightProperties
+	{
+		ieVector3 Diffuse = ieVector3(1.0f, 1.0f, 1.0f);
+		ieVector3 Direction = Vector3::Down;
+		float Strength = 1.0f;
+		// In degrees, the shader gets their cosine.
+		float InnerCutoff = 12.5f;
+		float OuterCutoff = 15.0f;
+	};
+	IE_REFLECT_TYPE(SpotLightProperties,
+		IE_REFLECT_FIELD(Diffuse, "diffuse", "Diffuse", FieldEditor::Color()),
+		IE_REFLECT_FIELD(Direction, "direction", "Direction", FieldEditor::Drag(0.05f, -1.0f, 1.0f)),
+		IE_REFLECT_FIELD(Strength, "strength", "Strength", FieldEditor::Drag(0.15f, 0.0f, 10.0f)),
+		IE_REFLECT_FIELD(InnerCutoff, "innerCutoff", "Inner Cut-off", FieldEditor::Drag(0.1f, 0.0f, 50.0f)),
+		IE_REFLECT_FIELD(OuterCutoff, "outerCutoff", "Outer Cut-off", FieldEditor::Drag(0.1f, 0.0f, 50.0f))
+	);
+
 	class INSIGHT_API ASpotLight : public AActor
 	{
 	public:
@@ -14,7 +33,11 @@ namespace Insight {
 		virtual ~ASpotLight();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonSpotLight) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot) override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		virtual bool OnInit();
 		virtual bool OnPostInit();
@@ -34,9 +57,11 @@ namespace Insight {
 		CB_PS_SpotLight GetConstantBuffer() { return m_ShaderCB; }
 
 	private:
+		void UpdateShaderCB();
+
+	private:
+		SpotLightProperties m_Properties;
 		CB_PS_SpotLight m_ShaderCB;
-		float m_TempInnerCutoff = 12.5f;
-		float m_TempOuterCutoff = 15.0f;
 	};
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Insight/Utilities/String_Helper.h"
 #include "Insight/Systems/File_System.h"
 #include "Insight/Systems/Managers/Resource_Manager.h"
+#include "Insight/Systems/Cooked_Scene.h"
 
 #include "imgui.h"
 
@@ -97,17 +98,64 @@ namespace Insight {
 		json::get_float(jsonMaterial, "Metallic_Override", m_ShaderCB.metallicAdditive);
 		json::get_float(jsonMaterial, "Roughness_Override", m_ShaderCB.roughnessAdditive);
 
+		AcquireTextureMaps();
+
+		return true;
+	}
+
+	bool Material::LoadFromCooked(const CookedMaterial& Cooked)
+	{
+		m_AlbedoTextureManagerID = Cooked.AlbedoMapID;
+		m_NormalTextureManagerID = Cooked.NormalMapID;
+		m_MetallicTextureManagerID = Cooked.MetallicMapID;
+		m_RoughnessTextureManagerID = Cooked.RoughnessMapID;
+		m_AoTextureManagerID = Cooked.AOMapID;
+
+		m_ShaderCB.uvOffset.x = Cooked.UVOffset[0];
+		m_ShaderCB.uvOffset.y = Cooked.UVOffset[1];
+		m_ShaderCB.tiling.x = Cooked.Tiling[0];
+		m_ShaderCB.tiling.y = Cooked.Tiling[1];
+		m_ShaderCB.diffuseAdditive.x = Cooked.ColorOverride[0];
+		m_ShaderCB.diffuseAdditive.y = Cooked.ColorOverride[1];
+		m_ShaderCB.diffuseAdditive.z = Cooked.ColorOverride[2];
+		m_ShaderCB.metallicAdditive = Cooked.MetallicOverride;
+		m_ShaderCB.roughnessAdditive = Cooked.RoughnessOverride;
+
+		AcquireTextureMaps();
+
+		return true;
+	}
+
+	void Material::WriteToCooked(CookedMaterial& OutCooked) const
+	{
+		OutCooked.AlbedoMapID = m_AlbedoTextureManagerID;
+		OutCooked.NormalMapID = m_NormalTextureManagerID;
+		OutCooked.MetallicMapID = m_MetallicTextureManagerID;
+		OutCooked.RoughnessMapID = m_RoughnessTextureManagerID;
+		OutCooked.AOMapID = m_AoTextureManagerID;
+
+		OutCooked.UVOffset[0] = m_ShaderCB.uvOffset.x;
+		OutCooked.UVOffset[1] = m_ShaderCB.uvOffset.y;
+		OutCooked.Tiling[0] = m_ShaderCB.tiling.x;
+		OutCooked.Tiling[1] = m_ShaderCB.tiling.y;
+		OutCooked.ColorOverride[0] = m_ShaderCB.diffuseAdditive.x;
+		OutCooked.ColorOverride[1] = m_ShaderCB.diffuseAdditive.y;
+		OutCooked.ColorOverride[2] = m_ShaderCB.diffuseAdditive.z;
+		OutCooked.MetallicOverride = m_ShaderCB.metallicAdditive;
+		OutCooked.RoughnessOverride = m_ShaderCB.roughnessAdditive;
+	}
+
+	void Material::AcquireTextureMaps()
+	{
 		TextureManager& textureManager = ResourceManager::Get().GetTextureManager();
 		m_AlbedoMap		= textureManager.GetTextureByID(m_AlbedoTextureManagerID, Texture::eTextureType::ALBEDO);
 		m_NormalMap		= textureManager.GetTextureByID(m_NormalTextureManagerID, Texture::eTextureType::NORMAL);
 		m_MetallicMap	= textureManager.GetTextureByID(m_MetallicTextureManagerID, Texture::eTextureType::METALLIC);
 		m_RoughnessMap	= textureManager.GetTextureByID(m_RoughnessTextureManagerID, Texture::eTextureType::ROUGHNESS);
 		m_AOMap			= textureManager.GetTextureByID(m_AoTextureManagerID, Texture::eTextureType::AO);
-
-		return true;
 	}
 
-	bool Material::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool Material::WriteToJson(JsonRecordWriter& Writer)
 	{
 		// Textures
 		{
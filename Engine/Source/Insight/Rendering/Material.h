@@ -3,10 +3,13 @@
 #include <Insight/Core.h>
 
 #include "Insight/Rendering/Texture.h"
+#include "Insight/Systems/Json_Record_Writer.h"
 #include "Platform/Windows/DirectX_Shared/Constant_Buffer_Types.h"
 
 namespace Insight {
 
+	struct CookedMaterial;
+
 	class INSIGHT_API Material
 	{
 	public:
@@ -18,7 +21,9 @@ namespace Insight {
 
 		static Material* CreateDefaultTexturedMaterial();
 		bool LoadFromJson(const rapidjson::Value& jsonMaterial);
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer);
+		bool WriteToJson(JsonRecordWriter& Writer);
+		bool LoadFromCooked(const CookedMaterial& Cooked);
+		void WriteToCooked(CookedMaterial& OutCooked) const;
 
 		CB_PS_VS_PerObjectAdditives GetMaterialOverrideConstantBuffer() { return m_ShaderCB; }
 
@@ -26,6 +31,10 @@ namespace Insight {
 		
 		void BindResources();
 
+	private:
+		// Fetch the texture maps for the current texture manager IDs.
+		void AcquireTextureMaps();
+
 	private:
 
 		StrongTexturePtr m_AlbedoMap;
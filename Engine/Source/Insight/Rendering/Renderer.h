@@ -89,6 +89,8 @@ namespace Insight {
 
 		static void SetRenderPass(eRenderPass RenderPass) { s_Instance->m_RenderPass = RenderPass; }
 
+		// Switch the active mesh pass to the input layout of 'Layout'. Each pass starts with eVertexLayout::Packed.
+		static void SetVertexLayout(eVertexLayout Layout) { s_Instance->SetVertexLayoutImpl(Layout); }
 		static void SetVertexBuffers(uint32_t StartSlot, uint32_t NumBuffers, ieVertexBuffer* pBuffers) { s_Instance->SetVertexBuffersImpl(StartSlot, NumBuffers, pBuffers); }
 		static void SetIndexBuffer(ieIndexBuffer* pBuffer) { s_Instance->SetIndexBufferImpl(pBuffer); }
 		static void DrawIndexedInstanced(uint32_t IndexCountPerInstance, uint32_t NumInstances, uint32_t StartIndexLocation, uint32_t BaseVertexLoaction, uint32_t StartInstanceLocation) { s_Instance->DrawIndexedInstancedImpl(IndexCountPerInstance, NumInstances, StartIndexLocation, BaseVertexLoaction, StartInstanceLocation); }
@@ -145,6 +147,7 @@ namespace Insight {
 		virtual void OnWindowResizeImpl() = 0;
 		virtual void OnWindowFullScreenImpl() = 0;
 
+		virtual void SetVertexLayoutImpl(eVertexLayout Layout) = 0;
 		virtual void SetVertexBuffersImpl(uint32_t StartSlot, uint32_t NumBuffers, ieVertexBuffer* pBuffers) = 0;
 		virtual void SetIndexBufferImpl(ieIndexBuffer* pBuffer) = 0;
 		virtual void DrawIndexedInstancedImpl(uint32_t IndexCountPerInstance, uint32_t NumInstances, uint32_t StartIndexLocation, uint32_t BaseVertexLoaction, uint32_t StartInstanceLocation) = 0;
@@ -2,11 +2,15 @@
 
 #include <Insight/Core.h>
 
+#include "Insight/Core/Ref_Counted.h"
+#include "Insight/Utilities/String_Interner.h"
+#include "Insight/Systems/Asset_Path.h"
+
 namespace Insight {
 
 	using Microsoft::WRL::ComPtr;
 
-	class Texture
+	class Texture : public TRefCounted<ThreadSafeRefCountPolicy>
 	{
 	public:
 		typedef uint32_t ID;
@@ -32,9 +36,8 @@ namespace Insight {
 			eTextureType Type = eTextureType::INVALID;
 			bool GenerateMipMaps = true;
 			bool IsCubeMap = false;
-			std::wstring Filepath;
-			std::string AssetDirectoryRelPath;
-			std::string DisplayName;
+			AssetPath Filepath;
+			ieSymbol DisplayName;
 			ID Id;
 		};
 
@@ -52,11 +55,11 @@ namespace Insight {
 		// Get the general information about this texture.
 		inline const IE_TEXTURE_INFO& GetTextureInfo() const { return m_TextureInfo; }
 		// Get the filename for this texture.
-		inline const std::string& GetDisplayName() const { return m_TextureInfo.DisplayName; }
-		// Get the full file path to this texture on disk.
-		inline const std::wstring& GetFilepath() const { return m_TextureInfo.Filepath; }
+		inline ieSymbol GetDisplayName() const { return m_TextureInfo.DisplayName; }
+		// Get the path to this texture on disk.
+		inline const AssetPath& GetFilepath() const { return m_TextureInfo.Filepath; }
 		// Get the Asset directory relative path for the texture for this project.
-		inline const std::string& GetAssetDirectoryRelPath() const { return m_TextureInfo.AssetDirectoryRelPath; }
+		inline const AssetPath& GetAssetDirectoryRelPath() const { return m_TextureInfo.Filepath; }
 
 	protected:
 		IE_TEXTURE_INFO				m_TextureInfo = {};
@@ -6,6 +6,7 @@
 #include "Insight/Runtime/Components/Actor_Component.h"
 #include "Insight/Runtime/Components/Static_Mesh_Component.h"
 #include "Insight/Runtime/Components/CSharp_Scirpt_Component.h"
+#include "Insight/Systems/Managers/Resource_Manager.h"
 
 //TEMP
 #include "Insight/Rendering/Material.h"
@@ -15,6 +16,7 @@
 
 namespace Insight {
 
+	IE_REGISTER_ACTOR_TYPE(AActor, "Actor");
 
 	AActor::AActor(ActorId Id, ActorName ActorName)
 		: m_Id(Id)
@@ -27,54 +29,171 @@ namespace Insight {
 	{
 	}
 
+	static CookedTransform MakeTransformRecord(const ieTransform& Transform)
+	{
+		const ieVector3& Pos = Transform.GetPosition();
+		const ieVector3& Rot = Transform.GetRotation();
+		const ieVector3& Sca = Transform.GetScale();
+
+		return CookedTransform{
+			{ Pos.x, Pos.y, Pos.z },
+			{ Rot.x, Rot.y, Rot.z },
+			{ Sca.x, Sca.y, Sca.z },
+		};
+	}
+
+	static void ApplyTransformRecord(ieTransform& Transform, const CookedTransform& Record)
+	{
+		Transform.SetPositionRotationScale(
+			ieVector3(Record.Position[0], Record.Position[1], Record.Position[2]),
+			ieVector3(Record.Rotation[0], Record.Rotation[1], Record.Rotation[2]),
+			ieVector3(Record.Scale[0], Record.Scale[1], Record.Scale[2])
+		);
+	}
+
 	bool AActor::LoadFromJson(const rapidjson::Value& jsonActor)
 	{
 		if (!m_CanBeFileParsed)
 			return true;
 
-		// Load Transform
-		float posX, posY, posZ;
-		float rotX, rotY, rotZ;
-		float scaX, scaY, scaZ;
-		const rapidjson::Value& transform = jsonActor["Transform"];
-		// Position
-		json::get_float(transform[0], "posX", posX);
-		json::get_float(transform[0], "posY", posY);
-		json::get_float(transform[0], "posZ", posZ);
-		SceneNode::GetTransformRef().SetPosition(ieVector3(posX, posY, posZ));
-		// Rotation
-		json::get_float(transform[0], "rotX", rotX);
-		json::get_float(transform[0], "rotY", rotY);
-		json::get_float(transform[0], "rotZ", rotZ);
-		SceneNode::GetTransformRef().SetRotation(ieVector3(rotX, rotY, rotZ));
-		// Scale
-		json::get_float(transform[0], "scaX", scaX);
-		json::get_float(transform[0], "scaY", scaY);
-		json::get_float(transform[0], "scaZ", scaZ);
-		SceneNode::GetTransformRef().SetScale(ieVector3(scaX, scaY, scaZ));
-
-		SceneNode::GetTransformRef().EditorInit();
+		// Load Transform. Prefab templates have none, their instances apply it beforehand.
+		if (jsonActor.HasMember("Transform")) {
+			LoadTransformFromJson(jsonActor["Transform"]);
+		}
 
 		// Load Subobjects
 		const rapidjson::Value& jsonSubobjects = jsonActor["Subobjects"];
 
 		for (UINT i = 0; i < jsonSubobjects.Size(); ++i) {
 
-			if (jsonSubobjects[i].HasMember("StaticMesh")) {
-				StrongActorComponentPtr ptr = AActor::CreateDefaultSubobject<StaticMeshComponent>();
-				ptr->LoadFromJson(jsonSubobjects[i]["StaticMesh"]);
-				continue;
+			// Each subobject is keyed by its component type name, e.g. { "StaticMesh": [...] }
+			for (const auto& jsonComponent : jsonSubobjects[i].GetObject()) {
+				const std::string_view componentType(jsonComponent.name.GetString(), jsonComponent.name.GetStringLength());
+				StrongActorComponentPtr ptr = TypeRegistry::CreateComponent(HashTypeName(componentType), this);
+				if (!ptr) {
+					IE_CORE_WARN("Unknown component type \"{0}\" on actor \"{1}\"", jsonComponent.name.GetString(), SceneNode::GetDisplayName());
+					continue;
+				}
+				ptr->LoadFromJson(jsonComponent.value);
 			}
-			else if (jsonSubobjects[i].HasMember("CSharpScript")) {
-				StrongActorComponentPtr ptr = AActor::CreateDefaultSubobject<CSharpScriptComponent>();
-				ptr->LoadFromJson(jsonSubobjects[i]["CSharpScript"]);
+		}
+		return true;
+	}
+
+	void AActor::LoadTransformFromJson(const rapidjson::Value& jsonTransform)
+	{
+		// Components missing from the record keep the actor's current values.
+		CookedTransform Record = MakeTransformRecord(SceneNode::GetTransformRef());
+		Reflection::ReadJson(jsonTransform[0], Record);
+		ApplyTransformRecord(SceneNode::GetTransformRef(), Record);
+	}
+
+	CookedTransform AActor::GetTransformRecord()
+	{
+		return MakeTransformRecord(SceneNode::GetTransformRef());
+	}
+
+	void AActor::WriteTransformToJson(const ieTransform& Transform, JsonRecordWriter& Writer)
+	{
+		Writer.StartArray(); // Start Write Transform
+		Reflection::WriteJson(Writer, MakeTransformRecord(Transform));
+		Writer.EndArray(); // End Write Transform
+	}
+
+	void AActor::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		SceneNode::WriteToSnapshot(Snapshot);
+
+		Reflection::WriteBinary(m_IsSaveDirty, Snapshot);
+		Reflection::WriteBinary(m_NumComponents, Snapshot);
+		for (size_t i = 0; i < m_NumComponents; ++i) {
+			// Each component record is prefixed with its size so records of components
+			// removed during play can be skipped.
+			const size_t SizeOffset = Snapshot.size();
+			Reflection::WriteBinary(uint32_t(0U), Snapshot);
+			m_Components[i]->WriteToSnapshot(Snapshot);
+			const uint32_t RecordSize = static_cast<uint32_t>(Snapshot.size() - SizeOffset - sizeof(uint32_t));
+			memcpy(Snapshot.data() + SizeOffset, &RecordSize, sizeof(RecordSize));
+		}
+	}
+
+	bool AActor::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		uint32_t NumComponents = 0U;
+		if (!SceneNode::ReadFromSnapshot(pData, pEnd)
+			|| !Reflection::ReadBinary(m_IsSaveDirty, pData, pEnd)
+			|| !Reflection::ReadBinary(NumComponents, pData, pEnd)) {
+			return false;
+		}
+		if (NumComponents != m_NumComponents) {
+			IE_CORE_WARN("Actor \"{0}\" gained or lost components during play, they are not restored.", SceneNode::GetDisplayName());
+		}
+		for (uint32_t i = 0; i < NumComponents; ++i) {
+			uint32_t RecordSize = 0U;
+			if (!Reflection::ReadBinary(RecordSize, pData, pEnd) || static_cast<size_t>(pEnd - pData) < RecordSize) {
+				return false;
+			}
+			const uint8_t* pRecordEnd = pData + RecordSize;
+			if (i < m_NumComponents) {
+				const uint8_t* pRecord = pData;
+				if (!m_Components[i]->ReadFromSnapshot(pRecord, pRecordEnd)) {
+					IE_CORE_WARN("Component \"{0}\" on actor \"{1}\" could not be restored from the play snapshot.", m_Components[i]->GetName(), SceneNode::GetDisplayName());
+				}
+			}
+			pData = pRecordEnd;
+		}
+		return true;
+	}
+
+	bool AActor::LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor)
+	{
+		if (!m_CanBeFileParsed)
+			return true;
+
+		// Load Transform
+		ApplyTransformRecord(SceneNode::GetTransformRef(), Scene.GetTransform(Actor.Transform));
+
+		// Cooked instances hold their full state, the prefab is only needed to keep the link for saving.
+		if (Actor.Prefab != 0U) {
+			m_pPrefab = ResourceManager::Get().GetPrefabManager().LoadPrefab(AssetPath(Scene.GetString(Actor.Prefab)));
+		}
+
+		// Load Subobjects
+		for (uint32_t i = 0; i < Actor.NumComponents; ++i) {
+			const CookedComponent& Component = Scene.GetComponent(Actor.FirstComponent + i);
+
+			StrongActorComponentPtr ptr = TypeRegistry::CreateComponent(Component.Type, this);
+			if (!ptr) {
+				IE_CORE_WARN("Unknown cooked component type ({0}) on actor \"{1}\"", Component.Type, SceneNode::GetDisplayName());
 				continue;
 			}
+			ptr->LoadFromCooked(Scene, Component);
 		}
 		return true;
 	}
 
-	bool AActor::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool AActor::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		if (!m_CanBeFileParsed)
+			return true;
+
+		BeginCookedActor(Builder, HashTypeName("Actor"));
+		Builder.EndActor();
+		return true;
+	}
+
+	void AActor::BeginCookedActor(CookedSceneBuilder& Builder, TypeId Type)
+	{
+		const CookedTransform Cooked = MakeTransformRecord(SceneNode::GetTransformRef());
+		const std::string_view PrefabPath = m_pPrefab ? m_pPrefab->GetPath().GetView() : std::string_view();
+		Builder.BeginActor(Type, std::string_view(m_DisplayName.c_str(), m_DisplayName.Length()), Cooked, PrefabPath);
+
+		for (size_t i = 0; i < m_NumComponents; ++i) {
+			m_Components[i]->WriteToCooked(Builder);
+		}
+	}
+
+	bool AActor::WriteToJson(JsonRecordWriter& Writer)
 	{
 		if (!m_CanBeFileParsed)
 			return true;
@@ -88,39 +207,7 @@ namespace Insight {
 			Writer.String(SceneNode::GetDisplayName());
 
 			Writer.Key("Transform");
-			Writer.StartArray(); // Start Write Transform
-			{
-				ieTransform& Transform = SceneNode::GetTransformRef();
-				ieVector3 Pos = Transform.GetPosition();
-				ieVector3 Rot = Transform.GetRotation();
-				ieVector3 Sca = Transform.GetScale();
-
-				Writer.StartObject();
-				// Position
-				Writer.Key("posX");
-				Writer.Double(Pos.x);
-				Writer.Key("posY");
-				Writer.Double(Pos.y);
-				Writer.Key("posZ");
-				Writer.Double(Pos.z);
-				// Rotation
-				Writer.Key("rotX");
-				Writer.Double(Rot.x);
-				Writer.Key("rotY");
-				Writer.Double(Rot.y);
-				Writer.Key("rotZ");
-				Writer.Double(Rot.z);
-				// Scale
-				Writer.Key("scaX");
-				Writer.Double(Sca.x);
-				Writer.Key("scaY");
-				Writer.Double(Sca.y);
-				Writer.Key("scaZ");
-				Writer.Double(Sca.z);
-
-				Writer.EndObject();
-			}
-			Writer.EndArray(); // End Write Transform
+			WriteTransformToJson(SceneNode::GetTransformRef(), Writer);
 
 			Writer.Key("Subobjects");
 			Writer.StartArray(); // Start Write SubObjects
@@ -164,29 +251,54 @@ namespace Insight {
 	static int currentIndex = 0;
 	void AActor::OnImGuiRender()
 	{
-		if (ImGui::InputText("##ActorNameField", &m_DisplayName, ImGuiInputTextFlags_EnterReturnsTrue)) {
-			if (m_DisplayName == "") {
-				m_DisplayName = "MyActor";
-			}
+		// Names are interned, edit a copy and re-intern it once the user commits the change.
+		char NameBuffer[128];
+		strncpy_s(NameBuffer, m_DisplayName.c_str(), _TRUNCATE);
+		if (ImGui::InputText("##ActorNameField", NameBuffer, sizeof(NameBuffer), ImGuiInputTextFlags_EnterReturnsTrue)) {
+			m_DisplayName = (NameBuffer[0] == '\0') ? ieSymbol("MyActor") : ieSymbol(NameBuffer);
 		}
 
 		ImGuiTreeNodeFlags TreeFlags = ImGuiTreeNodeFlags_Leaf;
 		if (ImGui::TreeNodeEx("Actions", ImGuiTreeNodeFlags_OpenOnArrow)) {
 
-			ImGui::TreeNodeEx("Delete Actor", TreeFlags);
-			if (ImGui::IsItemClicked()) {
+			// A deleted actor cannot be brought back when the play snapshot is restored.
+			if (!Application::Get().IsPlaySessionUnderWay()) {
+				ImGui::TreeNodeEx("Delete Actor", TreeFlags);
+				if (ImGui::IsItemClicked()) {
+
+					// Set the Details panel to be blank
+					Application::Get().GetEditorLayer().SetSelectedActor(nullptr);
+					// remove the actor fom the world
+					m_Parent->RemoveChild(this);
+					// Pop the rest of the tree nodes for ImGui.
+					// Thers no reason to leave this scope the actor has been deleted.
+					ImGui::TreePop();
+					ImGui::TreePop();
+					return;
+				}
+				ImGui::TreePop();
+			}
 
-				// Set the Details panel to be blank
-				Application::Get().GetEditorLayer().SetSelectedActor(nullptr);
-				// remove the actor fom the world
-				m_Parent->RemoveChild(this);
-				// Pop the rest of the tree nodes for ImGui.
-				// Thers no reason to leave this scope the actor has been deleted.
+			if (m_pPrefab) {
+				// Once unlinked the actor is saved as a full record again.
+				ImGui::TreeNodeEx("Unlink From Prefab", TreeFlags);
+				if (ImGui::IsItemClicked()) {
+					m_pPrefab.Reset();
+					MarkSaveDirty();
+				}
 				ImGui::TreePop();
+			}
+			else {
+				ImGui::TreeNodeEx("Create Prefab", TreeFlags);
+				if (ImGui::IsItemClicked()) {
+					AssetPath PrefabPath(std::string("Prefabs/") + m_DisplayName.c_str() + ".ieprefab");
+					if (Prefab::CreateFromActor(*this, PrefabPath)) {
+						m_pPrefab = ResourceManager::Get().GetPrefabManager().LoadPrefab(PrefabPath);
+						MarkSaveDirty();
+					}
+				}
 				ImGui::TreePop();
-				return;
 			}
-			ImGui::TreePop();
 			/*ImGui::TreeNodeEx("Remove All Components", TreeFlags);
 			if (ImGui::IsItemClicked()) {
 				RemoveAllSubobjects();
@@ -208,14 +320,15 @@ namespace Insight {
 			ImGui::NewLine();
 			static constexpr char* availableComponents[] = { "", "Static Mesh Component", "C-Sharp Script Component" };
 			if (ImGui::Combo("Add Component", &currentIndex, availableComponents, IM_ARRAYSIZE(availableComponents))) {
+				MarkSaveDirty();
 				switch (currentIndex) {
 				case 0: break;
 				case 1:
 				{
 					IE_CORE_INFO("Adding Static Mesh component to \"{0}\"", AActor::GetDisplayName());
 					StrongActorComponentPtr ptr = AActor::CreateDefaultSubobject<StaticMeshComponent>();
-					static_cast<StaticMeshComponent*>(ptr.get())->SetMaterial(std::move(Material::CreateDefaultTexturedMaterial()));
-					static_cast<StaticMeshComponent*>(ptr.get())->AttachMesh("Models/Quad.obj");
+					static_cast<StaticMeshComponent*>(ptr.Get())->SetMaterial(std::move(Material::CreateDefaultTexturedMaterial()));
+					static_cast<StaticMeshComponent*>(ptr.Get())->AttachMesh("Models/Quad.obj");
 
 					break;
 				}
@@ -327,7 +440,7 @@ namespace Insight {
 
 		for (uint32_t i = 0; i < m_NumComponents; i++) {
 			m_Components[i]->OnDestroy();
-			m_Components[i].reset();
+			m_Components[i].Reset();
 		}
 		m_Components.clear();
 	}
@@ -338,6 +451,15 @@ namespace Insight {
 
 	}
 
+	void AActor::AttachSubobject(const StrongActorComponentPtr& component)
+	{
+		IE_CORE_ASSERT(component, "Trying to add null component to actor");
+
+		component->OnAttach();
+		m_Components.push_back(component);
+		m_NumComponents++;
+	}
+
 	void AActor::RemoveSubobject(StrongActorComponentPtr component)
 	{
 		IE_CORE_ASSERT(std::find(m_Components.begin(), m_Components.end(), component) != m_Components.end(), "Could not find Component in Actor list while attempting to delete");
@@ -345,7 +467,7 @@ namespace Insight {
 		auto iter = std::find(m_Components.begin(), m_Components.end(), component);
 		(*iter)->OnDetach();
 		(*iter)->OnDestroy();
-		(*iter).reset();
+		(*iter).Reset();
 		m_Components.erase(iter);
 		m_NumComponents--;
 	}
@@ -354,7 +476,7 @@ namespace Insight {
 	{
 		for (uint32_t i = 0; i < m_NumComponents; ++i) {
 			m_Components[i]->OnDestroy();
-			m_Components[i].reset();
+			m_Components[i].Reset();
 		}
 		m_Components.clear();
 		m_NumComponents = 0;
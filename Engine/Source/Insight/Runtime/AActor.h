@@ -5,8 +5,15 @@
 #include "Insight/Math/Transform.h"
 #include "Insight/Core/Scene/Scene_Node.h"
 #include "Insight/Runtime/Components/Scene_Component.h"
+#include "Insight/Runtime/Components/Actor_Component.h"
+#include "Insight/Systems/Cooked_Scene.h"
+#include "Insight/Runtime/Type_Registry.h"
+#include "Insight/Runtime/Prefab.h"
 
 
+// Save chunk of an actor that has not been saved yet.
+#define IE_INVALID_SAVE_CHUNK 0xFFFFFFFFU
+
 namespace Insight {
 
 	typedef std::string ActorType;
@@ -22,7 +29,17 @@ namespace Insight {
 		virtual ~AActor();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonActor) override;
-		bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		// Load the "Transform" array of an actor record.
+		void LoadTransformFromJson(const rapidjson::Value& jsonTransform);
+		// The actor's transform as it is cooked.
+		CookedTransform GetTransformRecord();
+		// Write a transform as the "Transform" array of an actor record. Components use it for their local transforms.
+		static void WriteTransformToJson(const ieTransform& Transform, JsonRecordWriter& Writer);
+		bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedActor& Actor) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot) override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		// Editor
 		virtual void RenderSceneHeirarchy();
@@ -42,37 +59,53 @@ namespace Insight {
 		virtual void Exit();
 
 		ActorId GetId() { return m_Id; }
+		// The prefab this actor was created from, empty if it is not a prefab instance.
+		const StrongPrefabPtr& GetPrefab() const { return m_pPrefab; }
+		void SetPrefab(const StrongPrefabPtr& pPrefab) { m_pPrefab = pPrefab; }
+
+		// Actor chunk file this actor was last loaded from or saved to. See 'FileSystem::SaveSceneAsync'.
+		uint32_t GetSaveChunk() const { return m_SaveChunk; }
+		void SetSaveChunk(uint32_t Chunk) { m_SaveChunk = Chunk; }
+		// Flag the actor as edited so its chunk is rewritten on the next save.
+		void MarkSaveDirty() { m_IsSaveDirty = true; }
+		void ClearSaveDirty() { m_IsSaveDirty = false; }
+		bool IsSaveDirty() const { return m_IsSaveDirty; }
 	public:
 		template<typename T>
 		StrongActorComponentPtr CreateDefaultSubobject()
 		{
-			StrongActorComponentPtr component = std::make_shared<T>(this);
-			IE_CORE_ASSERT(component, "Trying to add null component to actor");
-
-			component->OnAttach();
-			m_Components.push_back(component);
-			m_NumComponents++;
+			StrongActorComponentPtr component = MakeRef<T>(this);
+			AttachSubobject(component);
 			return component;
 		}
+		// Attach a component that was created with this actor as its owner.
+		void AttachSubobject(const StrongActorComponentPtr& component);
 		template<typename T>
-		WeakActorComponentPtr GetSubobject()
+		T* GetSubobject()
 		{
-			WeakActorComponentPtr component = nullptr;
-			for (UniqueActorComponentPtr _component : m_components)
+			for (StrongActorComponentPtr& _component : m_Components)
 			{
-				component = dynamic_cast<T>(_component);
-				if (component != nullptr) break;
+				T* component = dynamic_cast<T*>(_component.Get());
+				if (component != nullptr) return component;
 			}
-			return component;
+			return nullptr;
 		}
 		void RemoveSubobject(StrongActorComponentPtr component);
 		void RemoveAllSubobjects();
-		std::vector<StrongActorComponentPtr> GetAllSubobjects() const { return m_Components; }
+		const ActorComponents& GetAllSubobjects() const { return m_Components; }
 		
+	protected:
+		// Begin a cooked record for this actor and write its transform and components.
+		// Derived actors set their payload and end the record.
+		void BeginCookedActor(CookedSceneBuilder& Builder, TypeId Type);
+
 	protected:
 		ActorComponents m_Components;
 		uint32_t m_NumComponents = 0;
 		ActorId m_Id;
+		StrongPrefabPtr m_pPrefab;
+		uint32_t m_SaveChunk = IE_INVALID_SAVE_CHUNK;
+		bool m_IsSaveDirty = false;
 	private:
 
 	};
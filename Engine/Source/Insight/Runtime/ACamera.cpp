@@ -71,9 +71,15 @@ namespace Insight {
 		}
 	}
 
-	void ACamera::EditorEndPlay()
+	bool ACamera::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
 	{
-
+		if (!AActor::ReadFromSnapshot(pData, pEnd)) {
+			return false;
+		}
+		// Put the editor view back where it was before play began.
+		UpdateViewMatrix();
+		GetTransformRef().UpdateLocalDirectionVectors();
+		return true;
 	}
 
 	void ACamera::ProcessMouseScroll(float yOffset)
@@ -55,7 +55,7 @@ namespace Insight {
 
 		virtual void BeginPlay() override;
 		virtual void OnUpdate(const float& DeltaMs) override;
-		virtual void EditorEndPlay() override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		void ProcessMouseScroll(float yOffset);
 		void ProcessMouseMovement(float xOffset, float yOffset);
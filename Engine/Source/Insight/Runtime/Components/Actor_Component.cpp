@@ -1,3 +1,18 @@
 #include "ie_pch.h"
 #include "Actor_Component.h"
 
+#include "Insight/Runtime/Reflection.h"
+
+namespace Insight {
+
+	void ActorComponent::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		Reflection::WriteBinary(m_Enabled, Snapshot);
+	}
+
+	bool ActorComponent::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		return Reflection::ReadBinary(m_Enabled, pData, pEnd);
+	}
+
+}
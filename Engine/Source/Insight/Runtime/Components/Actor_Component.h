@@ -1,18 +1,31 @@
 #pragma once
 #include <Insight/Core.h>
 
+#include "Insight/Core/Ref_Counted.h"
+#include "Insight/Systems/Json_Record_Writer.h"
+
 namespace Insight {
 
+	class CookedSceneView;
+	class CookedSceneBuilder;
+	struct CookedComponent;
 
 #define RETURN_IF_COMPONENT_DISABLED if(!m_Enabled){return;}
 
-	class ActorComponent
+	// Components are only ever touched by their owning actor on the main thread.
+	class ActorComponent : public TRefCounted<SingleThreadRefCountPolicy>
 	{
 	public:
 		virtual ~ActorComponent(void) { m_pOwner = nullptr; }
 
 		virtual bool LoadFromJson(const rapidjson::Value& JsonComponent) = 0;
-		virtual bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) = 0;
+		virtual bool WriteToJson(JsonRecordWriter& Writer) = 0;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedComponent& Component) = 0;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) = 0;
+		// Play-in-editor snapshot, see SceneSnapshot. The base record is the enabled flag,
+		// components with editable properties append them after it.
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot);
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd);
 
 		virtual void OnInit() = 0;
 		virtual void OnPostInit() {}
@@ -5,12 +5,15 @@
 #include "Insight/Systems/Managers/Resource_Manager.h"
 #include "Insight/Runtime/AActor.h"
 #include "Insight/Core/Application.h"
+#include "Insight/Systems/Cooked_Scene.h"
 
 #include "imgui.h"
 #include <misc/cpp/imgui_stdlib.h>
 
 namespace Insight {
 
+	IE_REGISTER_COMPONENT_TYPE(CSharpScriptComponent, "CSharpScript");
+
 	uint32_t CSharpScriptComponent::s_NumActiveCSScriptComponents = 0U;
 
 	CSharpScriptComponent::CSharpScriptComponent(AActor* pOwner)
@@ -47,6 +50,8 @@ namespace Insight {
 
 	void CSharpScriptComponent::RegisterScript()
 	{
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::Scripting);
+
 		// Register the class with mono runtime
 		if (!m_pMonoScriptManager->CreateClass(m_pClass, m_pObject, m_ModuleName.c_str())) {
 			IE_CORE_ERROR("Failed to create C# class for \"{0}\"", m_ModuleName);
@@ -82,7 +87,31 @@ namespace Insight {
 		return true;
 	}
 
-	bool CSharpScriptComponent::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool CSharpScriptComponent::LoadFromCooked(const CookedSceneView& Scene, const CookedComponent& Component)
+	{
+		const CookedCSharpScript* pCooked = Scene.GetPayload<CookedCSharpScript>(Component);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked C# script component has an invalid payload.");
+			return false;
+		}
+
+		m_ModuleName = Scene.GetString(pCooked->ModuleName);
+		ActorComponent::m_Enabled = Component.Enabled != 0U;
+
+		RegisterScript();
+		return true;
+	}
+
+	bool CSharpScriptComponent::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		CookedCSharpScript Cooked = {};
+		Cooked.ModuleName = Builder.AddString(m_ModuleName);
+
+		Builder.AddComponent(HashTypeName("CSharpScript"), ActorComponent::m_Enabled, Cooked);
+		return true;
+	}
+
+	bool CSharpScriptComponent::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.Key("CSharpScript");
 		Writer.StartArray(); // Start CSScript Write
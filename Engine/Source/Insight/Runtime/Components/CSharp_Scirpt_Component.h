@@ -18,7 +18,9 @@ namespace Insight {
 		virtual ~CSharpScriptComponent();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonCSScriptComponent) override;
-		virtual bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		virtual bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedComponent& Component) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
 
 		virtual void OnInit() override;
 		virtual void OnPostInit() override;
@@ -7,6 +7,8 @@
 #include "Insight/Systems/Managers/Resource_Manager.h"
 #include "Insight/Rendering/Renderer.h"
 #include "Insight/Rendering/Material.h"
+#include "Insight/Systems/Cooked_Scene.h"
+#include "Insight/Runtime/Reflection.h"
 
 
 #include <imgui.h>
@@ -14,6 +16,8 @@
 
 namespace Insight {
 
+	IE_REGISTER_COMPONENT_TYPE(StaticMeshComponent, "StaticMesh");
+
 	uint32_t StaticMeshComponent::s_NumActiveSMComponents = 0U;
 
 	StaticMeshComponent::StaticMeshComponent(AActor* pOwner)
@@ -62,7 +66,66 @@ namespace Insight {
 		return true;
 	}
 
-	bool StaticMeshComponent::WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer)
+	bool StaticMeshComponent::LoadFromCooked(const CookedSceneView& Scene, const CookedComponent& Component)
+	{
+		const CookedStaticMesh* pCooked = Scene.GetPayload<CookedStaticMesh>(Component);
+		if (!pCooked) {
+			IE_CORE_ERROR("Cooked static mesh component has an invalid payload.");
+			return false;
+		}
+
+		AttachMesh(Scene.GetString(pCooked->Mesh));
+		ActorComponent::m_Enabled = Component.Enabled != 0U;
+		m_pMaterial->LoadFromCooked(pCooked->Material);
+
+		return true;
+	}
+
+	bool StaticMeshComponent::WriteToCooked(CookedSceneBuilder& Builder)
+	{
+		CookedStaticMesh Cooked = {};
+		Cooked.Mesh = Builder.AddString(m_pModel->GetAssetDirectoryRelativePath());
+		m_pMaterial->WriteToCooked(Cooked.Material);
+
+		Builder.AddComponent(HashTypeName("StaticMesh"), ActorComponent::m_Enabled, Cooked);
+		return true;
+	}
+
+	struct StaticMeshSnapshot
+	{
+		ieVector3 Position;
+		ieVector3 Rotation;
+		ieVector3 Scale;
+		CookedMaterial Material;
+	};
+
+	void StaticMeshComponent::WriteToSnapshot(std::vector<uint8_t>& Snapshot)
+	{
+		ActorComponent::WriteToSnapshot(Snapshot);
+
+		const ieTransform& MeshTransform = m_pModel->GetMeshRootTransformRef();
+		StaticMeshSnapshot Record = {
+			MeshTransform.GetPosition(),
+			MeshTransform.GetRotation(),
+			MeshTransform.GetScale(),
+		};
+		m_pMaterial->WriteToCooked(Record.Material);
+		Reflection::WriteBinary(Record, Snapshot);
+	}
+
+	bool StaticMeshComponent::ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd)
+	{
+		StaticMeshSnapshot Record;
+		if (!ActorComponent::ReadFromSnapshot(pData, pEnd) || !Reflection::ReadBinary(Record, pData, pEnd)) {
+			return false;
+		}
+		// The mesh itself is not swapped back, only what the details panel and scripts can edit.
+		m_pModel->GetMeshRootTransformRef().SetPositionRotationScale(Record.Position, Record.Rotation, Record.Scale);
+		m_pMaterial->LoadFromCooked(Record.Material);
+		return true;
+	}
+
+	bool StaticMeshComponent::WriteToJson(JsonRecordWriter& Writer)
 	{
 		Writer.Key("StaticMesh");
 		Writer.StartArray(); // Start SM Write
@@ -75,37 +138,7 @@ namespace Insight {
 				Writer.Key("Enabled");
 				Writer.Bool(ActorComponent::m_Enabled);
 				Writer.Key("LocalTransform");
-				Writer.StartArray();
-				{
-					ieTransform& MeshTransform = m_pModel->GetMeshRootTransformRef();
-					ieVector3 Pos = MeshTransform.GetPosition();
-					ieVector3 Rot = MeshTransform.GetRotation();
-					ieVector3 Sca = MeshTransform.GetScale();
-					Writer.StartObject();
-					// Position
-					Writer.Key("posX");
-					Writer.Double(Pos.x);
-					Writer.Key("posY");
-					Writer.Double(Pos.y);
-					Writer.Key("posZ");
-					Writer.Double(Pos.z);
-					// Rotation
-					Writer.Key("rotX");
-					Writer.Double(Rot.x);
-					Writer.Key("rotY");
-					Writer.Double(Rot.y);
-					Writer.Key("rotZ");
-					Writer.Double(Rot.z);
-					// Scale
-					Writer.Key("scaX");
-					Writer.Double(Sca.x);
-					Writer.Key("scaY");
-					Writer.Double(Sca.y);
-					Writer.Key("scaZ");
-					Writer.Double(Sca.z);
-					Writer.EndObject();
-				}
-				Writer.EndArray();
+				AActor::WriteTransformToJson(m_pModel->GetMeshRootTransformRef(), Writer);
 			}
 			Writer.EndObject(); // End Mesh Directory
 
@@ -136,9 +169,7 @@ namespace Insight {
 
 	void StaticMeshComponent::CalculateParent(const XMMATRIX& parentMatrix)
 	{
-		//if (m_ModelLoadFuture.get()) {
-			m_pModel->CalculateParent(parentMatrix);
-		//}
+		m_pModel->CalculateParent(parentMatrix);
 	}
 
 	void StaticMeshComponent::OnRender()
@@ -175,32 +206,25 @@ namespace Insight {
 	{
 	}
 
-	static std::mutex s_MeshMutex;
-	static bool LoadModelAsync(StrongModelPtr Model, const std::string& Path, Material* Material)
-	{
-		Model->Create(Path, Material);
-
-		std::lock_guard<std::mutex> ResourceLock(s_MeshMutex);
-
-		GeometryManager::RegisterModel(Model);
-		return true;
-	}
-
 	void StaticMeshComponent::AttachMesh(const std::string& AssestDirectoryRelPath)
 	{
-		Profiling::ScopedTimer timer(("StaticMeshComponent::AttachMesh \"" + AssestDirectoryRelPath + "\"").c_str());
+		Profiling::ScopedTimer timer("StaticMeshComponent::AttachMesh", AssestDirectoryRelPath.c_str());
 
 		if (m_pModel) {
 			GeometryManager::UnRegisterModel(m_pModel);
 			m_pModel->Destroy();
-			m_pModel.reset();
+			m_pModel.Reset();
+		}
+		m_pModel = MakeRef<Model>();
+
+		// During scene loads the import runs on the thread pool and the model
+		// is registered once the load's import batch is finished.
+		if (GeometryManager::IsImportBatchOpen()) {
+			GeometryManager::QueueModelImport(m_pModel, AssestDirectoryRelPath, m_pMaterial);
+			return;
 		}
-		m_pModel = make_shared<Model>();
 		m_pModel->Create(AssestDirectoryRelPath, m_pMaterial);
 		GeometryManager::RegisterModel(m_pModel);
-
-		// Experamental: Multi-threaded model laoding
-		//m_ModelLoadFuture = std::async(std::launch::async, LoadModelAsync, m_pModel, AssestDirectoryRelPath, m_pMaterial);
 	}
 
 	void StaticMeshComponent::SetMaterial(Material* pMaterial)
@@ -14,7 +14,11 @@ namespace Insight {
 		virtual ~StaticMeshComponent();
 
 		virtual bool LoadFromJson(const rapidjson::Value& jsonStaticMeshComponent) override;
-		virtual bool WriteToJson(rapidjson::PrettyWriter<rapidjson::StringBuffer>& Writer) override;
+		virtual bool WriteToJson(JsonRecordWriter& Writer) override;
+		virtual bool LoadFromCooked(const CookedSceneView& Scene, const CookedComponent& Component) override;
+		virtual bool WriteToCooked(CookedSceneBuilder& Builder) override;
+		virtual void WriteToSnapshot(std::vector<uint8_t>& Snapshot) override;
+		virtual bool ReadFromSnapshot(const uint8_t*& pData, const uint8_t* pEnd) override;
 
 		virtual void OnInit() override;
 		virtual void OnPostInit() {}
@@ -39,7 +43,6 @@ namespace Insight {
 		std::string m_DynamicAssetDir;
 		StrongModelPtr m_pModel;
 		Material* m_pMaterial;
-		std::future<bool> m_ModelLoadFuture;
 
 		uint32_t m_SMWorldIndex = 0U;
 
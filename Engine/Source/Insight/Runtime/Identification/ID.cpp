@@ -3,16 +3,17 @@
 
 namespace Insight {
 
-	size_t ID::ms_uniqueID = 0;
+	// Zero is reserved for 'INVALID_UNIQUE_ID'.
+	std::atomic<ID::UniqueID> ID::ms_uniqueID(1U);
 
 	ID::ID()
+		: m_Id(GetUniqueID())
 	{
-		m_Id = GetUniqueID();
 	}
 
-	std::string ID::GetUniqueID()
+	ID::UniqueID ID::GetUniqueID()
 	{
-		return ("uid_" + std::to_string(ms_uniqueID++));
+		return ms_uniqueID.fetch_add(1, std::memory_order_relaxed);
 	}
 
 }
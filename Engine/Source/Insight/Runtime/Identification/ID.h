@@ -1,6 +1,8 @@
 #pragma once
 
-#include <string>
+#include <atomic>
+
+#include "Insight/Utilities/String_Interner.h"
 
 namespace Insight {
 
@@ -8,6 +10,9 @@ namespace Insight {
 	class ID
 	{
 	public:
+		typedef uint64_t UniqueID;
+		static const UniqueID INVALID_UNIQUE_ID = 0U;
+
 		enum eLayer
 		{
 			DEFAULT
@@ -15,41 +20,46 @@ namespace Insight {
 
 	public:
 		ID();
+		// The string only becomes the name and tag, every ID gets a new unique id. Two IDs
+		// built from equal strings compare unequal, compare GetName() to match by name.
 		ID(const std::string& id)
-			: m_Name(id), m_Id(id), m_Tag(id) {}
+			: m_Name(id), m_Tag(id), m_Id(GetUniqueID()) {}
 		ID(const char* id)
-			: m_Name(id), m_Id(id), m_Tag(id) {}
+			: m_Name(id), m_Tag(id), m_Id(GetUniqueID()) {}
 
 		bool operator == (const ID& id) const { return m_Id == id.m_Id; }
 		bool operator != (const ID& id) const { return m_Id != id.m_Id; }
 
 		bool IsValid() const
 		{
-			return (m_Id != "");
+			return (m_Id != INVALID_UNIQUE_ID);
 		}
 
-		static size_t ms_uniqueID;
-		static std::string GetUniqueID();
-		void SetUniqueID(std::string id) { m_Id = id; }
+		// Returns a new process-wide unique id. Safe to call from any thread.
+		static UniqueID GetUniqueID();
+		UniqueID GetID() const { return m_Id; }
+		void SetUniqueID(UniqueID id) { m_Id = id; }
 
-		std::string& GetName() { return m_Name; }
-		void SetName(std::string name) { m_Name = name; }
+		ieSymbol GetName() const { return m_Name; }
+		void SetName(ieSymbol name) { m_Name = name; }
 
-		std::string& GetType() { return m_Type; }
-		void SetType(std::string type) { m_Type = type; }
+		ieSymbol GetType() const { return m_Type; }
+		void SetType(ieSymbol type) { m_Type = type; }
 
-		std::string& GetTag() { return m_Tag; }
-		void SetTag(std::string tag) { m_Tag = tag; }
+		ieSymbol GetTag() const { return m_Tag; }
+		void SetTag(ieSymbol tag) { m_Tag = tag; }
 
 		void SetLayer(const int& layer) { m_Layer = layer; }
 		int GetLayer() const { return m_Layer; }
 
 	protected:
-		std::string m_Type;
-		std::string m_Name;
-		std::string m_Id;
-		std::string m_Tag;
-		int m_Layer;
+		static std::atomic<UniqueID> ms_uniqueID;
+
+		ieSymbol m_Type;
+		ieSymbol m_Name;
+		ieSymbol m_Tag;
+		UniqueID m_Id;
+		int m_Layer = DEFAULT;
 	};
 
 }
@@ -0,0 +1,258 @@
+#include <ie_pch.h>
+
+#include "Prefab.h"
+
+#include "Insight/Runtime/AActor.h"
+#include "Insight/Systems/File_System.h"
+
+#include <rapidjson/pointer.h>
+
+namespace Insight {
+
+	// Members of an actor record that belong to the instance rather than the template.
+	static bool IsInstanceMember(const rapidjson::Value& Name)
+	{
+		return Name == "Type" || Name == "DisplayName" || Name == "Transform" || Name == "Prefab" || Name == "Overrides";
+	}
+
+	// Append a reference token to a JSON pointer, escaping '~' and '/' as RFC 6901 requires.
+	static void AppendPointerToken(std::string& Pointer, const char* Token, size_t Length)
+	{
+		Pointer += '/';
+		for (size_t i = 0; i < Length; ++i) {
+			if (Token[i] == '~') {
+				Pointer += "~0";
+			}
+			else if (Token[i] == '/') {
+				Pointer += "~1";
+			}
+			else {
+				Pointer += Token[i];
+			}
+		}
+	}
+
+	// Add every value in 'Instance' that differs from 'Base' to 'Overrides', keyed by its JSON pointer.
+	// Scalars that changed, values that changed type and arrays that changed size are written whole.
+	// Members missing from the instance are not recorded, actors always write their full record.
+	static void DiffValues_r(const rapidjson::Value& Base, const rapidjson::Value& Instance, std::string& Pointer, rapidjson::Value& Overrides, rapidjson::Document::AllocatorType& Allocator)
+	{
+		if (Base.GetType() == Instance.GetType()) {
+			if (Instance.IsObject()) {
+				for (const auto& Member : Instance.GetObject()) {
+					if (Pointer.empty() && IsInstanceMember(Member.name)) {
+						continue;
+					}
+
+					const size_t ParentLength = Pointer.size();
+					AppendPointerToken(Pointer, Member.name.GetString(), Member.name.GetStringLength());
+
+					auto BaseMember = Base.FindMember(Member.name);
+					if (BaseMember != Base.MemberEnd()) {
+						DiffValues_r(BaseMember->value, Member.value, Pointer, Overrides, Allocator);
+					}
+					else {
+						Overrides.AddMember(rapidjson::Value(Pointer.c_str(), static_cast<rapidjson::SizeType>(Pointer.size()), Allocator), rapidjson::Value(Member.value, Allocator), Allocator);
+					}
+					Pointer.resize(ParentLength);
+				}
+				return;
+			}
+			if (Instance.IsArray() && Base.Size() == Instance.Size()) {
+				for (rapidjson::SizeType i = 0; i < Instance.Size(); ++i) {
+					const size_t ParentLength = Pointer.size();
+					const std::string Index = std::to_string(i);
+					AppendPointerToken(Pointer, Index.c_str(), Index.size());
+					DiffValues_r(Base[i], Instance[i], Pointer, Overrides, Allocator);
+					Pointer.resize(ParentLength);
+				}
+				return;
+			}
+			if (!Instance.IsArray() && Base == Instance) {
+				return;
+			}
+		}
+		Overrides.AddMember(rapidjson::Value(Pointer.c_str(), static_cast<rapidjson::SizeType>(Pointer.size()), Allocator), rapidjson::Value(Instance, Allocator), Allocator);
+	}
+
+	// Serialize an actor to a document in the same format it is saved to Actors.json.
+	// The records are replayed straight into the DOM, there is no text to format and parse.
+	static bool WriteActorToDocument(AActor& Actor, rapidjson::Document& jsonActor)
+	{
+		JsonRecordWriter Records;
+		if (!Actor.WriteToJson(Records) || Records.IsEmpty()) {
+			return false;
+		}
+		auto ReplayRecords = [&Records](rapidjson::Document& Handler) { return Records.Replay(Handler); };
+		jsonActor.Populate(ReplayRecords);
+		return !jsonActor.HasParseError() && jsonActor.IsObject();
+	}
+
+	Prefab::Prefab(const AssetPath& Path)
+		: m_Path(Path)
+	{
+	}
+
+	Prefab::~Prefab()
+	{
+		MemoryTracker::RecordFree(eMemoryCategory::Json, m_Template.GetAllocator().Capacity());
+		MemoryTracker::RecordFree(eMemoryCategory::SceneGraph, m_CookedTemplate.capacity());
+	}
+
+	bool Prefab::Load()
+	{
+		const std::string Filepath = m_Path.ToAbsolute();
+		if (!json::load(Filepath.c_str(), m_Template)) {
+			IE_CORE_ERROR("Failed to load prefab: \"{0}\"", m_Path.c_str());
+			return false;
+		}
+		MemoryTracker::RecordAllocation(eMemoryCategory::Json, m_Template.GetAllocator().Capacity());
+
+		if (!m_Template.IsObject() || !m_Template.HasMember("Type") || !m_Template["Type"].IsString()
+			|| !m_Template.HasMember("Subobjects") || !m_Template["Subobjects"].IsArray()) {
+			IE_CORE_ERROR("Prefab \"{0}\" is not a valid actor record.", m_Path.c_str());
+			return false;
+		}
+
+		const rapidjson::Value& jsonType = m_Template["Type"];
+		m_ActorType = HashTypeName(std::string_view(jsonType.GetString(), jsonType.GetStringLength()));
+		if (!TypeRegistry::IsActorTypeRegistered(m_ActorType)) {
+			IE_CORE_ERROR("Prefab \"{0}\" uses unknown actor type \"{1}\"", m_Path.c_str(), jsonType.GetString());
+			return false;
+		}
+
+		// Hand written prefabs may carry these, they always come from the instance.
+		m_Template.RemoveMember("DisplayName");
+		m_Template.RemoveMember("Transform");
+		return true;
+	}
+
+	AActor* Prefab::Instantiate(ActorId Id, const std::string& DisplayName, const rapidjson::Value& jsonInstance)
+	{
+		AActor* pActor = TypeRegistry::CreateActor(m_ActorType, Id, DisplayName);
+		if (pActor == nullptr) {
+			return nullptr;
+		}
+
+		// The template has no transform, apply the instance's first since
+		// some actors derive state from it while they load.
+		auto jsonTransform = jsonInstance.FindMember("Transform");
+		if (jsonTransform != jsonInstance.MemberEnd()) {
+			pActor->LoadTransformFromJson(jsonTransform->value);
+		}
+
+		pActor->SetPrefab(StrongPrefabPtr(this));
+
+		auto jsonOverrides = jsonInstance.FindMember("Overrides");
+		if (jsonOverrides == jsonInstance.MemberEnd() || !jsonOverrides->value.IsObject() || jsonOverrides->value.ObjectEmpty()) {
+			if (!m_CookedTemplate.empty()) {
+				// The cooked actor carries the transform of the instance it was cooked from, swap in this one's.
+				const CookedTransform Transform = pActor->GetTransformRecord();
+				const CookedActor& Actor = m_CookedTemplateView.GetActor(0U);
+				memcpy(m_CookedTemplate.data() + m_CookedTemplateView.GetHeader().Transforms.Offset + Actor.Transform * sizeof(CookedTransform), &Transform, sizeof(Transform));
+				pActor->LoadFromCooked(m_CookedTemplateView, Actor);
+			}
+			else {
+				pActor->LoadFromJson(m_Template);
+				if (m_CanCookTemplate) {
+					m_CanCookTemplate = CookTemplate(*pActor);
+				}
+			}
+		}
+		else {
+			// Only instances that change something pay for a copy of the template.
+			rapidjson::Document Patched;
+			Patched.CopyFrom(m_Template, Patched.GetAllocator());
+			for (const auto& Override : jsonOverrides->value.GetObject()) {
+				rapidjson::Pointer Target(Override.name.GetString(), Override.name.GetStringLength());
+				if (!Target.IsValid()) {
+					IE_CORE_WARN("Ignoring invalid prefab override \"{0}\" on actor \"{1}\"", Override.name.GetString(), DisplayName);
+					continue;
+				}
+				Target.Set(Patched, Override.value, Patched.GetAllocator());
+			}
+
+			ScopedExternalAllocation JsonMemory(eMemoryCategory::Json, Patched.GetAllocator().Capacity());
+			pActor->LoadFromJson(Patched);
+		}
+		return pActor;
+	}
+
+	bool Prefab::CookTemplate(AActor& Actor)
+	{
+		CookedSceneBuilder Builder;
+		if (!Actor.WriteToCooked(Builder)) {
+			return false;
+		}
+		Builder.Finalize(m_CookedTemplate);
+
+		if (!m_CookedTemplateView.OpenFromMemory(m_CookedTemplate.data(), m_CookedTemplate.size()) || m_CookedTemplateView.GetNumActors() != 1U) {
+			IE_CORE_WARN("Prefab \"{0}\" could not be cooked, every instance is loaded from json.", m_Path.c_str());
+			std::vector<uint8_t>().swap(m_CookedTemplate);
+			return false;
+		}
+		MemoryTracker::RecordAllocation(eMemoryCategory::SceneGraph, m_CookedTemplate.capacity());
+		return true;
+	}
+
+	bool Prefab::WriteInstanceToJson(AActor& Actor, JsonRecordWriter& Writer) const
+	{
+		rapidjson::Document jsonActor;
+		if (!WriteActorToDocument(Actor, jsonActor)) {
+			IE_CORE_ERROR("Failed to write actor \"{0}\" as an instance of prefab \"{1}\".", Actor.GetDisplayName(), m_Path.c_str());
+			return false;
+		}
+
+		rapidjson::Document Overrides(rapidjson::kObjectType);
+		std::string Pointer;
+		DiffValues_r(m_Template, jsonActor, Pointer, Overrides, Overrides.GetAllocator());
+
+		Writer.StartObject(); // Start Write Instance
+		{
+			Writer.Key("Prefab");
+			Writer.String(m_Path.c_str());
+
+			Writer.Key("DisplayName");
+			Writer.String(Actor.GetDisplayName());
+
+			Writer.Key("Transform");
+			jsonActor["Transform"].Accept(Writer);
+
+			if (!Overrides.ObjectEmpty()) {
+				Writer.Key("Overrides");
+				Overrides.Accept(Writer);
+			}
+		}
+		Writer.EndObject(); // End Write Instance
+		return true;
+	}
+
+	bool Prefab::CreateFromActor(AActor& Actor, const AssetPath& Path)
+	{
+		rapidjson::Document jsonActor;
+		if (!WriteActorToDocument(Actor, jsonActor)) {
+			IE_CORE_ERROR("Actor \"{0}\" cannot be saved as a prefab.", Actor.GetDisplayName());
+			return false;
+		}
+		jsonActor.RemoveMember("DisplayName");
+		jsonActor.RemoveMember("Transform");
+
+		rapidjson::StringBuffer StrBuffer;
+		rapidjson::PrettyWriter<rapidjson::StringBuffer> Writer(StrBuffer);
+		jsonActor.Accept(Writer);
+
+		// Final Export
+		const std::string Filepath = Path.ToAbsolute();
+		const size_t DirectoryEnd = Filepath.find_last_of("/\\");
+		if (DirectoryEnd != std::string::npos) {
+			SHCreateDirectoryExA(NULL, Filepath.substr(0, DirectoryEnd).c_str(), NULL);
+		}
+		if (!FileSystem::WriteFileAtomic(Filepath, StrBuffer.GetString(), StrBuffer.GetSize())) {
+			IE_CORE_ERROR("Failed to save prefab: {0}", Path.c_str());
+			return false;
+		}
+		IE_CORE_INFO("Saved actor \"{0}\" as prefab \"{1}\"", Actor.GetDisplayName(), Path.c_str());
+		return true;
+	}
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Core/Ref_Counted.h"
+#include "Insight/Systems/Asset_Path.h"
+#include "Insight/Runtime/Type_Registry.h"
+#include "Insight/Systems/Cooked_Scene.h"
+#include "Insight/Systems/Json_Record_Writer.h"
+
+/*
+	Reusable actor template saved as a .ieprefab file.
+
+	A prefab file holds a single actor record in the same format as an entry in
+	Actors.json, minus its DisplayName and Transform. The record is parsed once and
+	shared by every instance. Scenes only store what is unique to each instance:
+		{
+			"Prefab": "Prefabs/Rock.ieprefab",
+			"DisplayName": "Rock_12",
+			"Transform": [ { "posX": 1.0, ... } ],
+			"Overrides": { "/Subobjects/0/StaticMesh/0/Mesh": "Models/Rock_Broken.obj" }
+		}
+	Override keys are JSON pointers into the template. The first instance without overrides
+	is loaded from the JSON template and cooked into a single actor CookedSceneView, later
+	ones load from that in place of walking the JSON again. Their models come from the
+	GeometryManager's model cache, so the geometry is shared as well. An instance with
+	overrides patches a private copy of the JSON template that is thrown away once the
+	actor has been created.
+
+	Example usage:
+		StrongPrefabPtr pPrefab = ResourceManager::Get().GetPrefabManager().LoadPrefab("Prefabs/Rock.ieprefab");
+		AActor* pRock = pPrefab->Instantiate(Id, "Rock_12", jsonInstance);
+*/
+
+namespace Insight {
+
+	class AActor;
+
+	class INSIGHT_API Prefab : public TRefCounted<SingleThreadRefCountPolicy>
+	{
+	public:
+		Prefab(const AssetPath& Path);
+		~Prefab();
+
+		// Parse the template from disk. Returns false if the file is missing or
+		// does not hold an actor record of a registered type.
+		bool Load();
+
+		// Create an actor from the template and link it to this prefab. 'jsonInstance' is the
+		// instance record from Actors.json, its Transform and Overrides are applied.
+		AActor* Instantiate(ActorId Id, const std::string& DisplayName, const rapidjson::Value& jsonInstance);
+		// Write an instance record for an actor created from this prefab. Only properties
+		// that differ from the template are written to "Overrides". Returns false without
+		// writing anything if the actor's record could not be built to diff against the template.
+		bool WriteInstanceToJson(AActor& Actor, JsonRecordWriter& Writer) const;
+
+		// Save the actor's current state as a new prefab file. Does not link the actor to it.
+		static bool CreateFromActor(AActor& Actor, const AssetPath& Path);
+
+		inline const AssetPath& GetPath() const { return m_Path; }
+		inline TypeId GetActorType() const { return m_ActorType; }
+
+	private:
+		// Cook an actor loaded from the unmodified template. Returns false if the actor cannot be cooked.
+		bool CookTemplate(AActor& Actor);
+
+	private:
+		AssetPath m_Path;
+		TypeId m_ActorType = 0U;
+		rapidjson::Document m_Template;
+		// Owned by the prefab, each instance's transform is written into it before the instance loads.
+		std::vector<uint8_t> m_CookedTemplate;
+		CookedSceneView m_CookedTemplateView;
+		bool m_CanCookTemplate = true;
+	};
+
+	typedef TRef<Prefab> StrongPrefabPtr;
+
+}
@@ -0,0 +1,157 @@
+#include <ie_pch.h>
+
+#include "Reflection.h"
+
+#include "imgui.h"
+
+namespace Insight {
+
+	namespace Reflection {
+
+		// Build "<Key><Suffix>", e.g. "diffuseR". Keys are short identifiers, longer ones are truncated.
+		static const char* MakeElementKey(char (&Buffer)[64], const char* Key, char Suffix)
+		{
+			sprintf_s(Buffer, "%s%c", Key, Suffix);
+			return Buffer;
+		}
+
+		void ReadValue(const rapidjson::Value& jsonObject, const char* Key, float& Value)
+		{
+			auto Member = jsonObject.FindMember(Key);
+			if (Member != jsonObject.MemberEnd() && Member->value.IsNumber()) {
+				Value = static_cast<float>(Member->value.GetDouble());
+			}
+		}
+
+		void ReadValue(const rapidjson::Value& jsonObject, const char* Key, int32_t& Value)
+		{
+			auto Member = jsonObject.FindMember(Key);
+			if (Member != jsonObject.MemberEnd() && Member->value.IsInt()) {
+				Value = Member->value.GetInt();
+			}
+		}
+
+		void ReadValue(const rapidjson::Value& jsonObject, const char* Key, uint32_t& Value)
+		{
+			auto Member = jsonObject.FindMember(Key);
+			if (Member != jsonObject.MemberEnd() && Member->value.IsUint()) {
+				Value = Member->value.GetUint();
+			}
+		}
+
+		void ReadValue(const rapidjson::Value& jsonObject, const char* Key, bool& Value)
+		{
+			auto Member = jsonObject.FindMember(Key);
+			if (Member != jsonObject.MemberEnd() && Member->value.IsBool()) {
+				Value = Member->value.GetBool();
+			}
+		}
+
+		void ReadValues(const rapidjson::Value& jsonObject, const char* Key, const char* Suffixes, float* pValues, uint32_t Count)
+		{
+			char Buffer[64];
+			for (uint32_t i = 0; i < Count; ++i) {
+				ReadValue(jsonObject, MakeElementKey(Buffer, Key, Suffixes[i]), pValues[i]);
+			}
+		}
+
+		void ReadFlag(const rapidjson::Value& jsonObject, const char* Key, uint32_t& Value)
+		{
+			bool Enabled = Value != 0U;
+			ReadValue(jsonObject, Key, Enabled);
+			Value = Enabled ? 1U : 0U;
+		}
+
+		void WriteValue(JsonRecordWriter& Writer, const char* Key, float Value)
+		{
+			Writer.Key(Key);
+			Writer.Double(Value);
+		}
+
+		void WriteValue(JsonRecordWriter& Writer, const char* Key, int32_t Value)
+		{
+			Writer.Key(Key);
+			Writer.Int(Value);
+		}
+
+		void WriteValue(JsonRecordWriter& Writer, const char* Key, uint32_t Value)
+		{
+			Writer.Key(Key);
+			Writer.Uint(Value);
+		}
+
+		void WriteValue(JsonRecordWriter& Writer, const char* Key, bool Value)
+		{
+			Writer.Key(Key);
+			Writer.Bool(Value);
+		}
+
+		void WriteValues(JsonRecordWriter& Writer, const char* Key, const char* Suffixes, const float* pValues, uint32_t Count)
+		{
+			char Buffer[64];
+			for (uint32_t i = 0; i < Count; ++i) {
+				WriteValue(Writer, MakeElementKey(Buffer, Key, Suffixes[i]), pValues[i]);
+			}
+		}
+
+		void WriteFlag(JsonRecordWriter& Writer, const char* Key, uint32_t Value)
+		{
+			WriteValue(Writer, Key, Value != 0U);
+		}
+
+		bool DrawValue(const char* Label, const FieldEditor& Editor, float& Value)
+		{
+			return ImGui::DragFloat(Label, &Value, Editor.Speed, Editor.Min, Editor.Max);
+		}
+
+		bool DrawValue(const char* Label, const FieldEditor& Editor, int32_t& Value)
+		{
+			return ImGui::DragInt(Label, &Value, Editor.Speed, static_cast<int>(Editor.Min), static_cast<int>(Editor.Max));
+		}
+
+		bool DrawValue(const char* Label, const FieldEditor& Editor, uint32_t& Value)
+		{
+			if (Editor.Widget == FieldEditor::Widget_Flag) {
+				bool Enabled = Value != 0U;
+				if (ImGui::Checkbox(Label, &Enabled)) {
+					Value = Enabled ? 1U : 0U;
+					return true;
+				}
+				return false;
+			}
+			const uint32_t Min = static_cast<uint32_t>(Editor.Min);
+			const uint32_t Max = static_cast<uint32_t>(Editor.Max);
+			// Equal bounds leave the value unclamped, as they do for the other drag widgets.
+			const bool IsClamped = Min != Max;
+			return ImGui::DragScalar(Label, ImGuiDataType_U32, &Value, Editor.Speed, IsClamped ? &Min : nullptr, IsClamped ? &Max : nullptr);
+		}
+
+		bool DrawValue(const char* Label, const FieldEditor& Editor, bool& Value)
+		{
+			return ImGui::Checkbox(Label, &Value);
+		}
+
+		bool DrawValues(const char* Label, const FieldEditor& Editor, float* pValues, uint32_t Count)
+		{
+			if (Editor.Widget == FieldEditor::Widget_Color) {
+				// Imgui will edit the color values in a normalized 0 to 1 space.
+				// In the shaders we transform the color values back into 0 to 255 space.
+				const ImGuiColorEditFlags ColorWheelFlags = ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_Uint8 | ImGuiColorEditFlags_PickerHueWheel;
+				if (Count == 3U) {
+					return ImGui::ColorEdit3(Label, pValues, ColorWheelFlags);
+				}
+				if (Count == 4U) {
+					return ImGui::ColorEdit4(Label, pValues, ColorWheelFlags & ~ImGuiColorEditFlags_NoAlpha);
+				}
+			}
+			switch (Count) {
+			case 2U: return ImGui::DragFloat2(Label, pValues, Editor.Speed, Editor.Min, Editor.Max);
+			case 3U: return ImGui::DragFloat3(Label, pValues, Editor.Speed, Editor.Min, Editor.Max);
+			case 4U: return ImGui::DragFloat4(Label, pValues, Editor.Speed, Editor.Min, Editor.Max);
+			default: return ImGui::DragFloat(Label, pValues, Editor.Speed, Editor.Min, Editor.Max);
+			}
+		}
+
+	}
+
+}
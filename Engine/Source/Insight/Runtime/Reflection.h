@@ -0,0 +1,276 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Math/ie_Vectors.h"
+#include "Insight/Systems/Json_Record_Writer.h"
+
+#include <tuple>
+#include <type_traits>
+
+/*
+	Compile-time field descriptions for plain property structs. A type lists its fields
+	once and that list drives JSON, binary serialization and the editor inspector, so
+	adding a property is a one line change instead of four hand written ones.
+
+	Reflect a type from its header, inside namespace Insight:
+		struct PointLightProperties
+		{
+			ieVector3 Diffuse = ieVector3(1.0f, 1.0f, 1.0f);
+			float Strength = 1.0f;
+		};
+		IE_REFLECT_TYPE(PointLightProperties,
+			IE_REFLECT_FIELD(Diffuse, "diffuse", "Diffuse", FieldEditor::Color()),
+			IE_REFLECT_FIELD(Strength, "strength", "Strength", FieldEditor::Drag(0.1f, 0.0f, 100.0f))
+		);
+
+	The field list is a constexpr tuple of member pointers. Visiting it is unrolled by the
+	compiler and each field is dispatched on its C++ type, there is no runtime type switch.
+	Supported field types are float, int32_t, uint32_t, bool, ieVector3 and float arrays.
+	Vectors and arrays are saved as one JSON key per element with an X/Y/Z/W suffix,
+	or R/G/B/A for color fields, which matches the layout of existing scene files.
+	A uint32_t is a number unless its field is declared with FieldEditor::Flag(), which
+	saves it as a JSON bool and edits it with a checkbox, for flags in cooked data.
+
+	Example usage:
+		Reflection::ReadJson(jsonEmission[0], m_Properties);
+		Reflection::WriteJson(Writer, m_Properties); // Writes a { ... } object.
+		if (Reflection::DrawInspector(m_Properties)) { ... }
+		Reflection::WriteBinary(m_Properties, Bytes); // A single memcpy for trivially copyable types.
+*/
+
+namespace Insight {
+
+	// How a field is shown in the details panel.
+	struct FieldEditor
+	{
+		enum eWidget : uint8_t
+		{
+			Widget_Drag,
+			Widget_Color,
+			// A uint32_t holding 0 or 1, saved as a bool.
+			Widget_Flag,
+			// Serialized but not shown in the inspector.
+			Widget_Hidden,
+		};
+
+		eWidget Widget;
+		float Speed;
+		float Min;
+		float Max;
+
+		// A Min equal to Max leaves the value unclamped.
+		static constexpr FieldEditor Drag(float Speed = 0.1f, float Min = 0.0f, float Max = 0.0f) { return FieldEditor{ Widget_Drag, Speed, Min, Max }; }
+		static constexpr FieldEditor Color() { return FieldEditor{ Widget_Color, 0.0f, 0.0f, 1.0f }; }
+		static constexpr FieldEditor Flag() { return FieldEditor{ Widget_Flag, 0.0f, 0.0f, 1.0f }; }
+		static constexpr FieldEditor Hidden() { return FieldEditor{ Widget_Hidden, 0.0f, 0.0f, 0.0f }; }
+	};
+
+	template <typename ClassType, typename FieldType>
+	struct TReflectedField
+	{
+		typedef FieldType Type;
+
+		// Name the field is saved under in JSON.
+		const char* Key;
+		// Name the field is shown with in the inspector.
+		const char* Label;
+		FieldType ClassType::* Member;
+		FieldEditor Editor;
+	};
+
+	template <typename ClassType, typename FieldType>
+	constexpr TReflectedField<ClassType, FieldType> MakeReflectedField(FieldType ClassType::* Member, const char* Key, const char* Label, FieldEditor Editor)
+	{
+		return TReflectedField<ClassType, FieldType>{ Key, Label, Member, Editor };
+	}
+
+	// Specialized for each reflected type by IE_REFLECT_TYPE.
+	template <typename ClassType>
+	struct TypeReflection;
+
+	namespace Reflection {
+
+		// Per value serializers the field visitors dispatch to. 'Suffixes' holds one character per element.
+		INSIGHT_API void ReadValue(const rapidjson::Value& jsonObject, const char* Key, float& Value);
+		INSIGHT_API void ReadValue(const rapidjson::Value& jsonObject, const char* Key, int32_t& Value);
+		INSIGHT_API void ReadValue(const rapidjson::Value& jsonObject, const char* Key, uint32_t& Value);
+		INSIGHT_API void ReadValue(const rapidjson::Value& jsonObject, const char* Key, bool& Value);
+		INSIGHT_API void ReadValues(const rapidjson::Value& jsonObject, const char* Key, const char* Suffixes, float* pValues, uint32_t Count);
+		INSIGHT_API void ReadFlag(const rapidjson::Value& jsonObject, const char* Key, uint32_t& Value);
+
+		INSIGHT_API void WriteValue(JsonRecordWriter& Writer, const char* Key, float Value);
+		INSIGHT_API void WriteValue(JsonRecordWriter& Writer, const char* Key, int32_t Value);
+		INSIGHT_API void WriteValue(JsonRecordWriter& Writer, const char* Key, uint32_t Value);
+		INSIGHT_API void WriteValue(JsonRecordWriter& Writer, const char* Key, bool Value);
+		INSIGHT_API void WriteValues(JsonRecordWriter& Writer, const char* Key, const char* Suffixes, const float* pValues, uint32_t Count);
+		INSIGHT_API void WriteFlag(JsonRecordWriter& Writer, const char* Key, uint32_t Value);
+
+		// Return true if the user changed the value this frame. A uint32_t with a Flag editor is drawn as a checkbox.
+		INSIGHT_API bool DrawValue(const char* Label, const FieldEditor& Editor, float& Value);
+		INSIGHT_API bool DrawValue(const char* Label, const FieldEditor& Editor, int32_t& Value);
+		INSIGHT_API bool DrawValue(const char* Label, const FieldEditor& Editor, uint32_t& Value);
+		INSIGHT_API bool DrawValue(const char* Label, const FieldEditor& Editor, bool& Value);
+		INSIGHT_API bool DrawValues(const char* Label, const FieldEditor& Editor, float* pValues, uint32_t Count);
+
+		constexpr const char* GetSuffixes(const FieldEditor& Editor)
+		{
+			return (Editor.Widget == FieldEditor::Widget_Color) ? "RGBA" : "XYZW";
+		}
+
+		// Call 'Visitor(Field)' for every reflected field of ClassType, in declaration order.
+		template <typename ClassType, typename VisitorType>
+		inline void ForEachField(VisitorType&& Visitor)
+		{
+			static constexpr auto s_Fields = TypeReflection<ClassType>::GetFields();
+			std::apply([&Visitor](const auto&... Field) { (Visitor(Field), ...); }, s_Fields);
+		}
+
+		// Fields missing from 'jsonObject' keep their current value.
+		template <typename ClassType>
+		void ReadJson(const rapidjson::Value& jsonObject, ClassType& Object)
+		{
+			ForEachField<ClassType>([&](const auto& Field) {
+				auto& Value = Object.*(Field.Member);
+				typedef std::remove_reference_t<decltype(Value)> FieldType;
+				if constexpr (std::is_same_v<FieldType, ieVector3>) {
+					ReadValues(jsonObject, Field.Key, GetSuffixes(Field.Editor), &Value.x, 3U);
+				}
+				else if constexpr (std::is_array_v<FieldType>) {
+					static_assert(std::is_same_v<std::remove_extent_t<FieldType>, float> && std::extent_v<FieldType> <= 4, "Only arrays of up to four floats can be reflected.");
+					ReadValues(jsonObject, Field.Key, GetSuffixes(Field.Editor), Value, static_cast<uint32_t>(std::extent_v<FieldType>));
+				}
+				else if constexpr (std::is_same_v<FieldType, uint32_t>) {
+					if (Field.Editor.Widget == FieldEditor::Widget_Flag) {
+						ReadFlag(jsonObject, Field.Key, Value);
+					}
+					else {
+						ReadValue(jsonObject, Field.Key, Value);
+					}
+				}
+				else {
+					ReadValue(jsonObject, Field.Key, Value);
+				}
+			});
+		}
+
+		// Writes the fields as a single JSON object.
+		template <typename ClassType>
+		void WriteJson(JsonRecordWriter& Writer, const ClassType& Object)
+		{
+			Writer.StartObject();
+			ForEachField<ClassType>([&](const auto& Field) {
+				const auto& Value = Object.*(Field.Member);
+				typedef std::remove_const_t<std::remove_reference_t<decltype(Value)>> FieldType;
+				if constexpr (std::is_same_v<FieldType, ieVector3>) {
+					WriteValues(Writer, Field.Key, GetSuffixes(Field.Editor), &Value.x, 3U);
+				}
+				else if constexpr (std::is_array_v<FieldType>) {
+					WriteValues(Writer, Field.Key, GetSuffixes(Field.Editor), Value, static_cast<uint32_t>(std::extent_v<FieldType>));
+				}
+				else if constexpr (std::is_same_v<FieldType, uint32_t>) {
+					if (Field.Editor.Widget == FieldEditor::Widget_Flag) {
+						WriteFlag(Writer, Field.Key, Value);
+					}
+					else {
+						WriteValue(Writer, Field.Key, Value);
+					}
+				}
+				else {
+					WriteValue(Writer, Field.Key, Value);
+				}
+			});
+			Writer.EndObject();
+		}
+
+		// Draw an editor widget for every field that is not hidden. Returns true if any field changed.
+		template <typename ClassType>
+		bool DrawInspector(ClassType& Object)
+		{
+			bool Changed = false;
+			ForEachField<ClassType>([&](const auto& Field) {
+				if (Field.Editor.Widget == FieldEditor::Widget_Hidden) {
+					return;
+				}
+				auto& Value = Object.*(Field.Member);
+				typedef std::remove_reference_t<decltype(Value)> FieldType;
+				if constexpr (std::is_same_v<FieldType, ieVector3>) {
+					Changed |= DrawValues(Field.Label, Field.Editor, &Value.x, 3U);
+				}
+				else if constexpr (std::is_array_v<FieldType>) {
+					Changed |= DrawValues(Field.Label, Field.Editor, Value, static_cast<uint32_t>(std::extent_v<FieldType>));
+				}
+				else {
+					Changed |= DrawValue(Field.Label, Field.Editor, Value);
+				}
+			});
+			return Changed;
+		}
+
+		// Number of bytes WriteBinary appends for ClassType.
+		template <typename ClassType>
+		constexpr size_t GetBinarySize()
+		{
+			if constexpr (std::is_trivially_copyable_v<ClassType>) {
+				return sizeof(ClassType);
+			}
+			else {
+				return std::apply([](const auto&... Field) { return (sizeof(typename std::decay_t<decltype(Field)>::Type) + ... + size_t(0)); }, TypeReflection<ClassType>::GetFields());
+			}
+		}
+
+		// Trivially copyable types are copied whole. Others are packed field by field, in which
+		// case every reflected field must itself be trivially copyable.
+		template <typename ClassType>
+		void WriteBinary(const ClassType& Object, std::vector<uint8_t>& Out)
+		{
+			const size_t Offset = Out.size();
+			Out.resize(Offset + GetBinarySize<ClassType>());
+			uint8_t* pDest = Out.data() + Offset;
+
+			if constexpr (std::is_trivially_copyable_v<ClassType>) {
+				memcpy(pDest, &Object, sizeof(ClassType));
+			}
+			else {
+				ForEachField<ClassType>([&](const auto& Field) {
+					typedef typename std::decay_t<decltype(Field)>::Type FieldType;
+					static_assert(std::is_trivially_copyable_v<FieldType>, "Reflected fields must be trivially copyable to be written as binary.");
+					memcpy(pDest, &(Object.*(Field.Member)), sizeof(FieldType));
+					pDest += sizeof(FieldType);
+				});
+			}
+		}
+
+		// Reads what WriteBinary wrote and advances 'pData'. Returns false without touching
+		// the object if fewer than GetBinarySize bytes remain.
+		template <typename ClassType>
+		bool ReadBinary(ClassType& Object, const uint8_t*& pData, const uint8_t* pEnd)
+		{
+			if (static_cast<size_t>(pEnd - pData) < GetBinarySize<ClassType>()) {
+				return false;
+			}
+
+			if constexpr (std::is_trivially_copyable_v<ClassType>) {
+				memcpy(&Object, pData, sizeof(ClassType));
+				pData += sizeof(ClassType);
+			}
+			else {
+				ForEachField<ClassType>([&](const auto& Field) {
+					typedef typename std::decay_t<decltype(Field)>::Type FieldType;
+					memcpy(&(Object.*(Field.Member)), pData, sizeof(FieldType));
+					pData += sizeof(FieldType);
+				});
+			}
+			return true;
+		}
+
+	}
+
+}
+
+#define IE_REFLECT_TYPE(Class, ...) template <> struct TypeReflection<Class>\
+	{\
+		typedef Class ReflectedType;\
+		static constexpr auto GetFields() { return std::make_tuple(__VA_ARGS__); }\
+	}
+#define IE_REFLECT_FIELD(Member, Key, Label, Editor) ::Insight::MakeReflectedField(&ReflectedType::Member, Key, Label, Editor)
@@ -0,0 +1,104 @@
+#include <ie_pch.h>
+
+#include "Type_Registry.h"
+
+#include "Insight/Runtime/AActor.h"
+
+namespace Insight {
+
+	struct ActorTypeEntry
+	{
+		const char* Name;
+		TypeRegistry::ActorFactory Factory;
+	};
+
+	struct ComponentTypeEntry
+	{
+		const char* Name;
+		TypeRegistry::ComponentFactory Factory;
+	};
+
+	// Types register from static initializers in any translation unit, so the tables
+	// are created on first use rather than relying on initialization order.
+	static std::unordered_map<TypeId, ActorTypeEntry>& GetActorTypes()
+	{
+		static std::unordered_map<TypeId, ActorTypeEntry> s_ActorTypes;
+		return s_ActorTypes;
+	}
+
+	static std::unordered_map<TypeId, ComponentTypeEntry>& GetComponentTypes()
+	{
+		static std::unordered_map<TypeId, ComponentTypeEntry> s_ComponentTypes;
+		return s_ComponentTypes;
+	}
+
+	template <typename EntryType, typename FactoryType>
+	static bool RegisterType(std::unordered_map<TypeId, EntryType>& Types, const char* TypeName, FactoryType Factory)
+	{
+		const TypeId Id = HashTypeName(TypeName);
+		auto Result = Types.emplace(Id, EntryType{ TypeName, Factory });
+		if (!Result.second) {
+			// Types register from static initializers before logging is up, so a duplicate
+			// name or hash collision can only be caught in the debugger.
+#if defined IE_DEBUG
+			__debugbreak();
+#endif
+			return false;
+		}
+		return true;
+	}
+
+	bool TypeRegistry::RegisterActorType(const char* TypeName, ActorFactory Factory)
+	{
+		return RegisterType(GetActorTypes(), TypeName, Factory);
+	}
+
+	bool TypeRegistry::RegisterComponentType(const char* TypeName, ComponentFactory Factory)
+	{
+		return RegisterType(GetComponentTypes(), TypeName, Factory);
+	}
+
+	AActor* TypeRegistry::CreateActor(TypeId Type, ActorId Id, const std::string& DisplayName)
+	{
+		auto Iter = GetActorTypes().find(Type);
+		if (Iter == GetActorTypes().end()) {
+			return nullptr;
+		}
+		return Iter->second.Factory(Id, DisplayName);
+	}
+
+	StrongActorComponentPtr TypeRegistry::CreateComponent(TypeId Type, AActor* pOwner)
+	{
+		auto Iter = GetComponentTypes().find(Type);
+		if (Iter == GetComponentTypes().end()) {
+			return StrongActorComponentPtr();
+		}
+		StrongActorComponentPtr Component = Iter->second.Factory(pOwner);
+		pOwner->AttachSubobject(Component);
+		return Component;
+	}
+
+	bool TypeRegistry::IsActorTypeRegistered(TypeId Type)
+	{
+		return GetActorTypes().find(Type) != GetActorTypes().end();
+	}
+
+	bool TypeRegistry::IsComponentTypeRegistered(TypeId Type)
+	{
+		return GetComponentTypes().find(Type) != GetComponentTypes().end();
+	}
+
+	const char* TypeRegistry::GetTypeName(TypeId Type)
+	{
+		auto ActorIter = GetActorTypes().find(Type);
+		if (ActorIter != GetActorTypes().end()) {
+			return ActorIter->second.Name;
+		}
+		auto ComponentIter = GetComponentTypes().find(Type);
+		if (ComponentIter != GetComponentTypes().end()) {
+			return ComponentIter->second.Name;
+		}
+		return "";
+	}
+
+}
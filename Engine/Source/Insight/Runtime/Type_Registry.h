@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <string_view>
+
+/*
+	Registry of the actor and component types that can be created by name, e.g. when
+	loading a scene or spawning from the editor. Types are keyed by the hash of the
+	name they are saved under ("PointLight", "StaticMesh", ...), so a lookup is a
+	single hash table probe no matter how many types are registered.
+
+	Register a type from its .cpp file, inside namespace Insight:
+		IE_REGISTER_ACTOR_TYPE(APointLight, "PointLight");
+		IE_REGISTER_COMPONENT_TYPE(StaticMeshComponent, "StaticMesh");
+
+	Create one by name or by id:
+		AActor* pActor = TypeRegistry::CreateActor(HashTypeName(TypeName), SceneIndex, DisplayName);
+*/
+
+namespace Insight {
+
+	class AActor;
+
+	// 32-bit FNV-1a hash of a type name. Stored in cooked scenes, so it must never change.
+	typedef uint32_t TypeId;
+	constexpr TypeId HashTypeName(std::string_view TypeName)
+	{
+		TypeId Hash = 2166136261U;
+		for (char c : TypeName) {
+			Hash ^= static_cast<uint8_t>(c);
+			Hash *= 16777619U;
+		}
+		return Hash;
+	}
+
+	class INSIGHT_API TypeRegistry
+	{
+	public:
+		typedef AActor* (*ActorFactory)(ActorId Id, const std::string& DisplayName);
+		// Only constructs the component, 'CreateComponent' attaches it to the owner.
+		typedef StrongActorComponentPtr (*ComponentFactory)(AActor* pOwner);
+
+		// Returns false if the name, or a different name with the same hash, is already registered.
+		static bool RegisterActorType(const char* TypeName, ActorFactory Factory);
+		static bool RegisterComponentType(const char* TypeName, ComponentFactory Factory);
+
+		// Return nullptr if no type is registered under the id.
+		static AActor* CreateActor(TypeId Type, ActorId Id, const std::string& DisplayName);
+		// The component is attached to pOwner before it is returned.
+		static StrongActorComponentPtr CreateComponent(TypeId Type, AActor* pOwner);
+
+		static bool IsActorTypeRegistered(TypeId Type);
+		static bool IsComponentTypeRegistered(TypeId Type);
+		// Returns the name a type was registered with, or "" if it is unknown.
+		static const char* GetTypeName(TypeId Type);
+	};
+
+	template <typename ActorType>
+	struct ActorTypeRegistrar
+	{
+		ActorTypeRegistrar(const char* TypeName)
+		{
+			TypeRegistry::RegisterActorType(TypeName, [](ActorId Id, const std::string& DisplayName) -> AActor* { return new ActorType(Id, DisplayName); });
+		}
+	};
+
+	template <typename ComponentType>
+	struct ComponentTypeRegistrar
+	{
+		ComponentTypeRegistrar(const char* TypeName)
+		{
+			TypeRegistry::RegisterComponentType(TypeName, [](AActor* pOwner) -> StrongActorComponentPtr { return MakeRef<ComponentType>(pOwner); });
+		}
+	};
+
+}
+
+#define IE_REGISTER_ACTOR_TYPE(Class, TypeName) static ::Insight::ActorTypeRegistrar<Class> s_##Class##TypeRegistrar(TypeName)
+#define IE_REGISTER_COMPONENT_TYPE(Class, TypeName) static ::Insight::ComponentTypeRegistrar<Class> s_##Class##TypeRegistrar(TypeName)
@@ -0,0 +1,87 @@
+#include <ie_pch.h>
+
+#include "Asset_Path.h"
+
+#include "Insight/Systems/File_System.h"
+#include "Insight/Utilities/Utf_Conversion.h"
+
+namespace Insight {
+
+	AssetPath::AssetPath(std::string_view RelativePath, eRoot Root)
+		: m_Path(Normalize(RelativePath))
+		, m_Root(Root)
+	{
+	}
+
+	std::string_view AssetPath::GetFilename() const
+	{
+		std::string_view Path = GetView();
+		const size_t LastSlash = Path.find_last_of('/');
+		return (LastSlash == std::string_view::npos) ? Path : Path.substr(LastSlash + 1);
+	}
+
+	std::string_view AssetPath::GetExtension() const
+	{
+		std::string_view Filename = GetFilename();
+		const size_t LastDot = Filename.find_last_of('.');
+		return (LastDot == std::string_view::npos) ? std::string_view() : Filename.substr(LastDot + 1);
+	}
+
+	std::string AssetPath::ToAbsolute() const
+	{
+		switch (m_Root)
+		{
+		case ROOT_PROJECT:
+			return FileSystem::GetProjectRelativeAssetDirectory(m_Path.ToString());
+		case ROOT_ENGINE:
+			return m_Path.ToString();
+		default:
+			IE_CORE_ERROR("Unknown root for asset path: {0}", m_Path.c_str());
+			return m_Path.ToString();
+		}
+	}
+
+	std::wstring AssetPath::ToAbsoluteWide() const
+	{
+		return UtfConversion::Utf8ToUtf16(ToAbsolute());
+	}
+
+	std::string AssetPath::Normalize(std::string_view Path)
+	{
+		std::string Result;
+		Result.reserve(Path.size());
+
+		size_t Index = 0;
+		while (Index < Path.size()) {
+			// Skip any run of separators.
+			while (Index < Path.size() && (Path[Index] == '/' || Path[Index] == '\\')) {
+				Index++;
+			}
+			const size_t SegmentBegin = Index;
+			while (Index < Path.size() && Path[Index] != '/' && Path[Index] != '\\') {
+				Index++;
+			}
+			std::string_view Segment = Path.substr(SegmentBegin, Index - SegmentBegin);
+
+			if (Segment.empty() || Segment == ".") {
+				continue;
+			}
+			if (Segment == "..") {
+				// Pop the previous segment unless there is nothing left to pop.
+				const size_t LastSlash = Result.find_last_of('/');
+				const size_t LastStart = (LastSlash == std::string::npos) ? 0 : LastSlash + 1;
+				if (!Result.empty() && std::string_view(Result).substr(LastStart) != "..") {
+					Result.resize(LastSlash == std::string::npos ? 0 : LastSlash);
+					continue;
+				}
+			}
+
+			if (!Result.empty()) {
+				Result.push_back('/');
+			}
+			Result.append(Segment.data(), Segment.size());
+		}
+		return Result;
+	}
+
+}
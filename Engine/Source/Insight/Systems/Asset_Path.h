@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Utilities/String_Interner.h"
+
+/*
+	Canonical reference to a file on disk.
+
+	The path is normalized once on construction ('/' separators, no duplicate
+	separators, "." and ".." resolved) and interned, so copying, comparing and hashing
+	an AssetPath costs the same as an integer. Paths are stored relative to a root and
+	are only expanded to an absolute, wide path at the OS call boundary.
+
+	Example usage:
+		AssetPath Path("Textures\\Brick//Albedo.png");	// Stored as "Textures/Brick/Albedo.png"
+		DirectX::CreateWICTextureFromFile(..., Path.ToAbsoluteWide().c_str(), ...);
+*/
+
+namespace Insight {
+
+	class INSIGHT_API AssetPath
+	{
+	public:
+		enum eRoot : uint32_t
+		{
+			// Relative to the "Assets" folder of the open project.
+			ROOT_PROJECT = 0,
+			// Relative to the engine's working directory. Used for engine content such as default textures.
+			ROOT_ENGINE = 1,
+		};
+
+	public:
+		AssetPath() : m_Root(ROOT_PROJECT) {}
+		AssetPath(std::string_view RelativePath, eRoot Root = ROOT_PROJECT);
+		AssetPath(const char* RelativePath, eRoot Root = ROOT_PROJECT) : AssetPath(std::string_view(RelativePath ? RelativePath : ""), Root) {}
+		AssetPath(const std::string& RelativePath, eRoot Root = ROOT_PROJECT) : AssetPath(std::string_view(RelativePath), Root) {}
+
+		inline bool operator == (const AssetPath& Other) const { return m_Path == Other.m_Path && m_Root == Other.m_Root; }
+		inline bool operator != (const AssetPath& Other) const { return !(*this == Other); }
+
+		inline bool IsEmpty() const { return m_Path.IsEmpty(); }
+		inline eRoot GetRoot() const { return m_Root; }
+		inline ieSymbol GetSymbol() const { return m_Path; }
+		// Get the normalized path relative to its root.
+		inline const char* c_str() const { return m_Path.c_str(); }
+		inline std::string_view GetView() const { return std::string_view(m_Path.c_str(), m_Path.Length()); }
+
+		// Get the filename including its extension. "Textures/Albedo.png" -> "Albedo.png"
+		std::string_view GetFilename() const;
+		// Get the extension without the leading '.'. "Textures/Albedo.png" -> "png"
+		std::string_view GetExtension() const;
+
+		// Expand to a full path on disk. Only call this when handing the path to the OS.
+		std::string ToAbsolute() const;
+		std::wstring ToAbsoluteWide() const;
+
+		// Normalize a path without interning it. Backslashes become '/', duplicate
+		// separators are collapsed and "." and ".." segments are resolved.
+		static std::string Normalize(std::string_view Path);
+
+	private:
+		ieSymbol m_Path;
+		eRoot m_Root;
+	};
+
+}
+
+namespace std {
+
+	template <>
+	struct hash<Insight::AssetPath>
+	{
+		size_t operator()(const Insight::AssetPath& Path) const
+		{
+			return (static_cast<size_t>(Path.GetSymbol().GetId()) << 1) | static_cast<size_t>(Path.GetRoot());
+		}
+	};
+
+}
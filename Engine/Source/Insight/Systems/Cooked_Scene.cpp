@@ -0,0 +1,230 @@
+#include <ie_pch.h>
+
+#include "Cooked_Scene.h"
+
+#include "Insight/Systems/File_System.h"
+
+namespace Insight {
+
+	static_assert(sizeof(CookedSceneHeader) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(CookedTexture) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(CookedActor) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(CookedTransform) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+	static_assert(sizeof(CookedComponent) % 4 == 0, "Cooked records must be a multiple of 4 bytes.");
+
+	// Round a payload up so the next record stays 4-byte aligned.
+	static inline uint32_t AlignUp4(uint32_t Value) { return (Value + 3U) & ~3U; }
+
+
+	// ----------------------
+	// Cooked Scene Builder
+	// ----------------------
+
+	CookedSceneBuilder::CookedSceneBuilder()
+	{
+		// Offset zero is reserved for the empty string.
+		m_Strings.push_back('\0');
+		m_StringLookup.emplace(std::string(), 0U);
+	}
+
+	CookedString CookedSceneBuilder::AddString(std::string_view String)
+	{
+		auto Iter = m_StringLookup.find(std::string(String));
+		if (Iter != m_StringLookup.end()) {
+			return Iter->second;
+		}
+		const CookedString Offset = static_cast<CookedString>(m_Strings.size());
+		m_Strings.append(String.data(), String.size());
+		m_Strings.push_back('\0');
+		m_StringLookup.emplace(std::string(String), Offset);
+		return Offset;
+	}
+
+	void CookedSceneBuilder::SetSceneName(std::string_view Name)
+	{
+		m_SceneName = AddString(Name);
+	}
+
+	void CookedSceneBuilder::AddTexture(const CookedTexture& Texture)
+	{
+		m_Textures.push_back(Texture);
+	}
+
+	void CookedSceneBuilder::BeginActor(TypeId Type, std::string_view DisplayName, const CookedTransform& Transform, std::string_view Prefab)
+	{
+		IE_CORE_ASSERT(!m_IsActorOpen, "Cooked actor was not ended before beginning another.");
+		m_IsActorOpen = true;
+
+		CookedActor Actor = {};
+		Actor.Type = Type;
+		Actor.DisplayName = AddString(DisplayName);
+		Actor.Prefab = AddString(Prefab);
+		Actor.Transform = static_cast<uint32_t>(m_Transforms.size());
+		Actor.FirstComponent = static_cast<uint32_t>(m_Components.size());
+		m_Actors.push_back(Actor);
+		m_Transforms.push_back(Transform);
+	}
+
+	void CookedSceneBuilder::SetActorPayloadRaw(const void* pData, uint32_t Size)
+	{
+		IE_CORE_ASSERT(m_IsActorOpen, "Trying to set a payload with no open cooked actor.");
+		CookedActor& Actor = m_Actors.back();
+		Actor.PayloadOffset = AppendPayload(pData, Size);
+		Actor.PayloadSize = Size;
+	}
+
+	void CookedSceneBuilder::AddComponentRaw(TypeId Type, bool Enabled, const void* pData, uint32_t Size)
+	{
+		IE_CORE_ASSERT(m_IsActorOpen, "Trying to add a component with no open cooked actor.");
+		CookedComponent Component = {};
+		Component.Type = Type;
+		Component.Enabled = Enabled ? 1U : 0U;
+		Component.PayloadOffset = AppendPayload(pData, Size);
+		Component.PayloadSize = Size;
+		m_Components.push_back(Component);
+	}
+
+	void CookedSceneBuilder::EndActor()
+	{
+		IE_CORE_ASSERT(m_IsActorOpen, "Trying to end a cooked actor that was never begun.");
+		CookedActor& Actor = m_Actors.back();
+		Actor.NumComponents = static_cast<uint32_t>(m_Components.size()) - Actor.FirstComponent;
+		m_IsActorOpen = false;
+	}
+
+	uint32_t CookedSceneBuilder::AppendPayload(const void* pData, uint32_t Size)
+	{
+		const uint32_t Offset = static_cast<uint32_t>(m_Payload.size());
+		m_Payload.resize(AlignUp4(Offset + Size), 0U);
+		memcpy(m_Payload.data() + Offset, pData, Size);
+		return Offset;
+	}
+
+	void CookedSceneBuilder::Finalize(std::vector<uint8_t>& OutBytes) const
+	{
+		IE_CORE_ASSERT(!m_IsActorOpen, "Finalizing a cooked scene with an actor still open.");
+
+		CookedSceneHeader Header = {};
+		Header.Magic = IE_COOKED_SCENE_MAGIC;
+		Header.Version = IE_COOKED_SCENE_VERSION;
+		Header.SceneName = m_SceneName;
+
+		uint32_t Offset = sizeof(CookedSceneHeader);
+		auto PlaceTable = [&Offset](CookedTable& Table, uint32_t Count, uint32_t Stride) {
+			Table.Offset = Offset;
+			Table.Count = Count;
+			Offset += AlignUp4(Count * Stride);
+		};
+		PlaceTable(Header.Textures, (uint32_t)m_Textures.size(), sizeof(CookedTexture));
+		PlaceTable(Header.ActorChunks, (uint32_t)m_ActorChunkSizes.size(), sizeof(uint32_t));
+		PlaceTable(Header.Actors, (uint32_t)m_Actors.size(), sizeof(CookedActor));
+		PlaceTable(Header.Transforms, (uint32_t)m_Transforms.size(), sizeof(CookedTransform));
+		PlaceTable(Header.Components, (uint32_t)m_Components.size(), sizeof(CookedComponent));
+		PlaceTable(Header.Payload, (uint32_t)m_Payload.size(), 1U);
+		PlaceTable(Header.Strings, (uint32_t)m_Strings.size(), 1U);
+		Header.FileSize = Offset;
+
+		OutBytes.assign(Header.FileSize, 0U);
+		auto CopyTable = [&OutBytes](const CookedTable& Table, const void* pData, size_t Size) {
+			if (Size > 0U) {
+				memcpy(OutBytes.data() + Table.Offset, pData, Size);
+			}
+		};
+		memcpy(OutBytes.data(), &Header, sizeof(CookedSceneHeader));
+		CopyTable(Header.Textures, m_Textures.data(), m_Textures.size() * sizeof(CookedTexture));
+		CopyTable(Header.ActorChunks, m_ActorChunkSizes.data(), m_ActorChunkSizes.size() * sizeof(uint32_t));
+		CopyTable(Header.Actors, m_Actors.data(), m_Actors.size() * sizeof(CookedActor));
+		CopyTable(Header.Transforms, m_Transforms.data(), m_Transforms.size() * sizeof(CookedTransform));
+		CopyTable(Header.Components, m_Components.data(), m_Components.size() * sizeof(CookedComponent));
+		CopyTable(Header.Payload, m_Payload.data(), m_Payload.size());
+		CopyTable(Header.Strings, m_Strings.data(), m_Strings.size());
+	}
+
+	bool CookedSceneBuilder::WriteToFile(const std::string& Filepath) const
+	{
+		std::vector<uint8_t> Bytes;
+		Finalize(Bytes);
+
+		return FileSystem::WriteFileAtomic(Filepath, Bytes.data(), Bytes.size());
+	}
+
+
+	// -------------------
+	// Cooked Scene View
+	// -------------------
+
+	bool CookedSceneView::Open(const std::string& Filepath)
+	{
+		if (!m_File.Open(Filepath)) {
+			return false;
+		}
+		if (!OpenFromMemory(m_File.GetData(), m_File.GetSize())) {
+			IE_CORE_ERROR("Cooked scene is corrupt or out of date: {0}", Filepath);
+			m_File.Close();
+			return false;
+		}
+		return true;
+	}
+
+	bool CookedSceneView::OpenFromMemory(const uint8_t* pData, size_t Size)
+	{
+		m_pData = pData;
+		m_Size = Size;
+		if (!Validate()) {
+			m_pData = nullptr;
+			m_Size = 0U;
+			return false;
+		}
+		return true;
+	}
+
+	const char* CookedSceneView::GetString(CookedString Offset) const
+	{
+		const CookedTable& Strings = GetHeader().Strings;
+		if (Offset >= Strings.Count) {
+			IE_CORE_WARN("Cooked string offset {0} is out of range.", Offset);
+			return "";
+		}
+		return reinterpret_cast<const char*>(m_pData + Strings.Offset + Offset);
+	}
+
+	bool CookedSceneView::Validate() const
+	{
+		if (!m_pData || m_Size < sizeof(CookedSceneHeader)) {
+			return false;
+		}
+		const CookedSceneHeader& Header = GetHeader();
+		if (Header.Magic != IE_COOKED_SCENE_MAGIC || Header.Version != IE_COOKED_SCENE_VERSION || Header.FileSize != m_Size) {
+			return false;
+		}
+
+		auto IsTableInBounds = [this](const CookedTable& Table, uint32_t Stride) {
+			return (Table.Offset % 4U) == 0U && (uint64_t)Table.Offset + (uint64_t)Table.Count * Stride <= m_Size;
+		};
+		if (!IsTableInBounds(Header.Textures, sizeof(CookedTexture))
+			|| !IsTableInBounds(Header.ActorChunks, sizeof(uint32_t))
+			|| !IsTableInBounds(Header.Actors, sizeof(CookedActor))
+			|| !IsTableInBounds(Header.Transforms, sizeof(CookedTransform))
+			|| !IsTableInBounds(Header.Components, sizeof(CookedComponent))
+			|| !IsTableInBounds(Header.Payload, 1U)
+			|| !IsTableInBounds(Header.Strings, 1U)) {
+			return false;
+		}
+
+		// Strings are read in place, the table must end in a terminator.
+		if (Header.Strings.Count == 0U || m_pData[Header.Strings.Offset + Header.Strings.Count - 1] != '\0') {
+			return false;
+		}
+
+		// Actor records index other tables, check them once here rather than on every access.
+		for (uint32_t i = 0; i < Header.Actors.Count; ++i) {
+			const CookedActor& Actor = GetActor(i);
+			if (Actor.Transform >= Header.Transforms.Count
+				|| (uint64_t)Actor.FirstComponent + Actor.NumComponents > Header.Components.Count) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Systems/Mapped_File.h"
+#include "Insight/Runtime/Type_Registry.h"
+#include "Insight/Runtime/Reflection.h"
+
+#include <string_view>
+
+/*
+	Cooked binary scene format.
+
+	A cooked scene is a single file of fixed-layout tables addressed by byte offsets
+	from the start of the file. It is memory-mapped and read in place, nothing is
+	parsed or copied before actors are created. The .json files in the .iescene folder
+	stay the authoring source, the cooked file is regenerated from them whenever it is
+	missing or older than any of them.
+
+	File layout:
+		CookedSceneHeader
+		CookedTexture[]		Resource references
+		uint32_t[]		Number of actors in each saved actor chunk, see FileSystem::SaveSceneAsync
+		CookedActor[]		One per actor, in scene order
+		CookedTransform[]	Indexed by CookedActor::Transform
+		CookedComponent[]	Each actor owns a contiguous range
+		Payload			Type specific structs (CookedStaticMesh, PointLightProperties, ...)
+		String table		Null terminated UTF-8, referenced by CookedString offsets
+
+	All records are made of 4-byte fields so every table stays naturally aligned.
+	Types whose properties are reflected (see Reflection.h) use their property struct
+	as the payload directly, so it is written and read with a single memcpy.
+*/
+
+#define IE_COOKED_SCENE_FILENAME "Scene.iecooked"
+#define IE_COOKED_SCENE_MAGIC 0x43534549U // "IESC"
+#define IE_COOKED_SCENE_VERSION 4U
+
+namespace Insight {
+
+	// Byte offset into the string table. Zero is always the empty string.
+	typedef uint32_t CookedString;
+
+	struct CookedTable
+	{
+		uint32_t Offset;
+		uint32_t Count;
+	};
+
+	struct CookedSceneHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t FileSize;
+		CookedString SceneName;
+		CookedTable Textures;
+		CookedTable ActorChunks;
+		CookedTable Actors;
+		CookedTable Transforms;
+		CookedTable Components;
+		// Count is in bytes for the payload and string tables.
+		CookedTable Payload;
+		CookedTable Strings;
+	};
+
+	struct CookedTexture
+	{
+		int32_t Id;
+		uint32_t Type;
+		CookedString Name;
+		CookedString Filepath;
+		uint32_t GenerateMipMaps;
+	};
+
+	struct CookedTransform
+	{
+		float Position[3];
+		float Rotation[3];
+		float Scale[3];
+	};
+	// Also the layout of the "Transform" record in Actors.json.
+	IE_REFLECT_TYPE(CookedTransform,
+		IE_REFLECT_FIELD(Position, "pos", "Position", FieldEditor::Drag(0.1f)),
+		IE_REFLECT_FIELD(Rotation, "rot", "Rotation", FieldEditor::Drag(0.1f)),
+		IE_REFLECT_FIELD(Scale, "sca", "Scale", FieldEditor::Drag(0.01f))
+	);
+
+	struct CookedActor
+	{
+		// Registered type, see TypeRegistry.
+		TypeId Type;
+		CookedString DisplayName;
+		// Path of the prefab the actor was created from. Zero if it is not a prefab instance.
+		CookedString Prefab;
+		uint32_t Transform;
+		uint32_t FirstComponent;
+		uint32_t NumComponents;
+		uint32_t PayloadOffset;
+		uint32_t PayloadSize;
+	};
+
+	struct CookedComponent
+	{
+		TypeId Type;
+		uint32_t Enabled;
+		uint32_t PayloadOffset;
+		uint32_t PayloadSize;
+	};
+
+	// ----------
+	// Payloads
+	// ----------
+
+	struct CookedMaterial
+	{
+		int32_t AlbedoMapID;
+		int32_t NormalMapID;
+		int32_t MetallicMapID;
+		int32_t RoughnessMapID;
+		int32_t AOMapID;
+		float UVOffset[2];
+		float Tiling[2];
+		float ColorOverride[3];
+		float MetallicOverride;
+		float RoughnessOverride;
+	};
+
+	struct CookedStaticMesh
+	{
+		CookedString Mesh;
+		CookedMaterial Material;
+	};
+
+	struct CookedCSharpScript
+	{
+		CookedString ModuleName;
+	};
+
+	struct CookedSkySphere
+	{
+		CookedString Diffuse;
+	};
+
+	struct CookedSkyLight
+	{
+		CookedString BrdfLUT;
+		CookedString Irradiance;
+		CookedString Environment;
+	};
+
+	struct CookedPostFx
+	{
+		float VignetteInnerRadius;
+		float VignetteOuterRadius;
+		float VignetteOpacity;
+		uint32_t VignetteEnabled;
+		float FilmGrainStrength;
+		uint32_t FilmGrainEnabled;
+		float ChromaticAberrationIntensity;
+		uint32_t ChromaticAberrationEnabled;
+	};
+	// Keys of the "PostFx" groups in Actors.json. Each group holds a subset of them.
+	IE_REFLECT_TYPE(CookedPostFx,
+		IE_REFLECT_FIELD(VignetteInnerRadius, "vnInnerRadius", "Inner Radius", FieldEditor::Drag(0.1f, 0.0f, 50.0f)),
+		IE_REFLECT_FIELD(VignetteOuterRadius, "vnOuterRadius", "Outer Radius", FieldEditor::Drag(0.1f, 0.0f, 50.0f)),
+		IE_REFLECT_FIELD(VignetteOpacity, "vnOpacity", "Opacity", FieldEditor::Drag(0.15f, 0.0f, 10.0f)),
+		IE_REFLECT_FIELD(VignetteEnabled, "vnEnabled", "vnEnabled", FieldEditor::Flag()),
+		IE_REFLECT_FIELD(FilmGrainStrength, "fgStrength", "Strength", FieldEditor::Drag(0.1f, 0.0f, 80.0f)),
+		IE_REFLECT_FIELD(FilmGrainEnabled, "fgEnabled", "fgEnabled", FieldEditor::Flag()),
+		IE_REFLECT_FIELD(ChromaticAberrationIntensity, "caIntensity", "Intensity", FieldEditor::Drag(0.1f, 0.0f, 80.0f)),
+		IE_REFLECT_FIELD(ChromaticAberrationEnabled, "caEnabled", "caEnabled", FieldEditor::Flag())
+	);
+
+
+	// Builds a cooked scene in memory. Actors must be written between BeginActor and
+	// EndActor, and their components must be added before the next actor begins.
+	class INSIGHT_API CookedSceneBuilder
+	{
+	public:
+		CookedSceneBuilder();
+		~CookedSceneBuilder() = default;
+
+		// Add a string to the string table. Identical strings are stored once.
+		CookedString AddString(std::string_view String);
+
+		void SetSceneName(std::string_view Name);
+		void AddTexture(const CookedTexture& Texture);
+		void SetActorChunkSizes(const std::vector<uint32_t>& ChunkSizes) { m_ActorChunkSizes = ChunkSizes; }
+
+		void BeginActor(TypeId Type, std::string_view DisplayName, const CookedTransform& Transform, std::string_view Prefab = std::string_view());
+		template <typename PayloadType>
+		inline void SetActorPayload(const PayloadType& Payload)
+		{
+			static_assert(std::is_trivially_copyable_v<PayloadType>, "Cooked payloads are copied as raw bytes.");
+			SetActorPayloadRaw(&Payload, sizeof(PayloadType));
+		}
+		template <typename PayloadType>
+		inline void AddComponent(TypeId Type, bool Enabled, const PayloadType& Payload)
+		{
+			static_assert(std::is_trivially_copyable_v<PayloadType>, "Cooked payloads are copied as raw bytes.");
+			AddComponentRaw(Type, Enabled, &Payload, sizeof(PayloadType));
+		}
+		void EndActor();
+
+		// Lay out the tables and produce the final file contents.
+		void Finalize(std::vector<uint8_t>& OutBytes) const;
+		// Finalize and write to disk. The file is written next to the target and renamed
+		// over it, a half written cooked scene is never left behind.
+		bool WriteToFile(const std::string& Filepath) const;
+
+	private:
+		void SetActorPayloadRaw(const void* pData, uint32_t Size);
+		void AddComponentRaw(TypeId Type, bool Enabled, const void* pData, uint32_t Size);
+		uint32_t AppendPayload(const void* pData, uint32_t Size);
+
+	private:
+		CookedString m_SceneName = 0U;
+		std::vector<CookedTexture> m_Textures;
+		std::vector<uint32_t> m_ActorChunkSizes;
+		std::vector<CookedActor> m_Actors;
+		std::vector<CookedTransform> m_Transforms;
+		std::vector<CookedComponent> m_Components;
+		std::vector<uint8_t> m_Payload;
+		std::string m_Strings;
+		std::unordered_map<std::string, CookedString> m_StringLookup;
+		bool m_IsActorOpen = false;
+	};
+
+
+	// Read-only view over a cooked scene, either memory-mapped from disk or over a
+	// caller owned buffer. All table bounds are validated once when the view is opened.
+	class INSIGHT_API CookedSceneView
+	{
+	public:
+		CookedSceneView() = default;
+		~CookedSceneView() = default;
+
+		bool Open(const std::string& Filepath);
+		bool OpenFromMemory(const uint8_t* pData, size_t Size);
+
+		inline const uint8_t* GetData() const { return m_pData; }
+		inline size_t GetSize() const { return m_Size; }
+		inline const CookedSceneHeader& GetHeader() const { return *reinterpret_cast<const CookedSceneHeader*>(m_pData); }
+
+		const char* GetString(CookedString Offset) const;
+
+		inline uint32_t GetNumTextures() const { return GetHeader().Textures.Count; }
+		inline const CookedTexture& GetTexture(uint32_t Index) const { return GetTable<CookedTexture>(GetHeader().Textures)[Index]; }
+		inline uint32_t GetNumActorChunks() const { return GetHeader().ActorChunks.Count; }
+		inline uint32_t GetActorChunkSize(uint32_t Index) const { return GetTable<uint32_t>(GetHeader().ActorChunks)[Index]; }
+		inline uint32_t GetNumActors() const { return GetHeader().Actors.Count; }
+		inline const CookedActor& GetActor(uint32_t Index) const { return GetTable<CookedActor>(GetHeader().Actors)[Index]; }
+		inline const CookedTransform& GetTransform(uint32_t Index) const { return GetTable<CookedTransform>(GetHeader().Transforms)[Index]; }
+		inline const CookedComponent& GetComponent(uint32_t Index) const { return GetTable<CookedComponent>(GetHeader().Components)[Index]; }
+
+		// Returns nullptr if the record's payload is not a PayloadType.
+		template <typename PayloadType>
+		inline const PayloadType* GetPayload(uint32_t Offset, uint32_t Size) const
+		{
+			if (Size != sizeof(PayloadType) || (uint64_t)Offset + Size > GetHeader().Payload.Count) {
+				return nullptr;
+			}
+			return reinterpret_cast<const PayloadType*>(m_pData + GetHeader().Payload.Offset + Offset);
+		}
+		template <typename PayloadType>
+		inline const PayloadType* GetPayload(const CookedActor& Actor) const { return GetPayload<PayloadType>(Actor.PayloadOffset, Actor.PayloadSize); }
+		template <typename PayloadType>
+		inline const PayloadType* GetPayload(const CookedComponent& Component) const { return GetPayload<PayloadType>(Component.PayloadOffset, Component.PayloadSize); }
+
+	private:
+		bool Validate() const;
+
+		template <typename RecordType>
+		inline const RecordType* GetTable(const CookedTable& Table) const
+		{
+			return reinterpret_cast<const RecordType*>(m_pData + Table.Offset);
+		}
+
+	private:
+		MappedFile m_File;
+		const uint8_t* m_pData = nullptr;
+		size_t m_Size = 0U;
+	};
+
+}
@@ -6,17 +6,253 @@
 #include "Insight/Core/Scene/scene.h"
 #include "Insight/Core/ieException.h"
 #include "Insight/Utilities/String_Helper.h"
+#include "Insight/Systems/Cooked_Scene.h"
+#include "Insight/Systems/Json_Stream_Reader.h"
+#include "Insight/Systems/Json_Record_Writer.h"
+#include "Insight/Systems/Thread_Pool.h"
 
-#include "Insight/Rendering/APost_Fx.h"
-#include "Insight/Rendering/ASky_Light.h"
-#include "Insight/Rendering/ASky_Sphere.h"
-#include "Insight/Rendering/Lighting/ASpot_Light.h"
-#include "Insight/Rendering/Lighting/APoint_Light.h"
-#include "Insight/Rendering/Lighting/ADirectional_Light.h"
+#include "Insight/Runtime/AActor.h"
+#include "Insight/Runtime/Type_Registry.h"
+
+#include <Psapi.h>
+
+// Files are written in slices of this size so save progress moves while large files are written.
+#define IE_SAVE_WRITE_SLICE_SIZE (1024U * 1024U)
+// Actors are saved in chunk files of up to this many actors, see 'FileSystem::SaveSceneAsync'.
+#define IE_SCENE_ACTORS_PER_CHUNK 512U
 
 namespace Insight {
 
 	std::string FileSystem::ProjectDirectory = "";
+	bool FileSystem::s_LoadSceneJsonAsDom = false;
+
+	// Everything a save writes, captured on the main thread as plain records so the scene can
+	// keep changing while the thread pool formats and writes the files.
+	struct ActorChunkSnapshot
+	{
+		// Relative to the scene folder.
+		std::string File;
+		JsonRecordWriter Records;
+		// Formatted on the thread pool.
+		rapidjson::StringBuffer Text;
+	};
+
+	struct SceneSaveSnapshot
+	{
+		std::string SceneDirectory;
+		std::string SceneName;
+		uint32_t SaveGeneration = 0U;
+		std::vector<uint32_t> ChunkSizes;
+		std::vector<std::string> ChunkFiles;
+		// Only the chunks that changed since the last save.
+		std::vector<unique_ptr<ActorChunkSnapshot>> Chunks;
+		uint32_t NumChunks = 0U;
+		// Compacting saves rewrite every chunk, remove chunk files that are no longer used and re-cook the scene.
+		bool IsCompaction = false;
+		// The records WriteToCooked copies out of each actor, laid out into a file on the thread pool.
+		CookedSceneBuilder Cooked;
+	};
+
+	static std::future<bool> s_PendingSave;
+	static std::atomic<bool> s_IsSaving(false);
+	static std::atomic<bool> s_LastSaveSucceeded(true);
+	static std::atomic<size_t> s_SaveBytesWritten(0U);
+	static std::atomic<size_t> s_SaveBytesTotal(0U);
+
+	static bool WriteFileAtomic_Internal(const std::string& Filepath, const void* pData, size_t Size, std::atomic<size_t>* pBytesWritten)
+	{
+		const std::string TempFilepath = Filepath + ".tmp";
+		HANDLE hFile = CreateFileA(TempFilepath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (hFile == INVALID_HANDLE_VALUE) {
+			IE_CORE_ERROR("Failed to create file: {0}", TempFilepath);
+			return false;
+		}
+
+		const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+		size_t Offset = 0U;
+		bool Succeeded = true;
+		while (Offset < Size && Succeeded) {
+			const size_t Remaining = Size - Offset;
+			const DWORD SliceSize = static_cast<DWORD>((Remaining < IE_SAVE_WRITE_SLICE_SIZE) ? Remaining : IE_SAVE_WRITE_SLICE_SIZE);
+			DWORD BytesWritten = 0;
+			Succeeded = WriteFile(hFile, pBytes + Offset, SliceSize, &BytesWritten, NULL) && BytesWritten == SliceSize;
+			Offset += BytesWritten;
+			if (pBytesWritten) {
+				*pBytesWritten += BytesWritten;
+			}
+		}
+		// The data must be on disk before the rename makes it visible.
+		Succeeded = Succeeded && FlushFileBuffers(hFile);
+		CloseHandle(hFile);
+
+		if (!Succeeded) {
+			IE_CORE_ERROR("Failed to write file: {0}", TempFilepath);
+			DeleteFileA(TempFilepath.c_str());
+			return false;
+		}
+		if (!MoveFileExA(TempFilepath.c_str(), Filepath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+			IE_CORE_ERROR("Failed to replace file: {0}", Filepath);
+			DeleteFileA(TempFilepath.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	// Chunk files are never overwritten in place. Each save writes the chunks it changes under
+	// its own generation and Meta.json, replaced last, is what switches the scene over to them.
+	// Generation zero is the untagged name scenes used before chunks were generation tagged.
+	static std::string GetActorChunkFilename(uint32_t Chunk, uint32_t Generation)
+	{
+		char Filename[48];
+		if (Generation == 0U) {
+			sprintf_s(Filename, "Actors/Chunk_%04u.json", Chunk);
+		}
+		else {
+			sprintf_s(Filename, "Actors/Chunk_%04u_%08u.json", Chunk, Generation);
+		}
+		return Filename;
+	}
+
+	struct SceneMeta
+	{
+		std::string SceneName;
+		uint32_t SaveGeneration = 0U;
+		// False for scenes that keep every actor in Actors.json.
+		bool HasActorChunks = false;
+		// Relative to the scene folder.
+		std::vector<std::string> ChunkFiles;
+	};
+
+	static bool LoadSceneMeta(const std::string& FileName, SceneMeta& OutMeta)
+	{
+		rapidjson::Document rawMetaFile;
+		const std::string metaDir = FileName + "/Meta.json";
+		if (!json::load(metaDir.c_str(), rawMetaFile) || !rawMetaFile.IsObject()) {
+			return false;
+		}
+		json::get_string(rawMetaFile, "SceneName", OutMeta.SceneName);
+		if (rawMetaFile.HasMember("SaveGeneration") && rawMetaFile["SaveGeneration"].IsUint()) {
+			OutMeta.SaveGeneration = rawMetaFile["SaveGeneration"].GetUint();
+		}
+
+		if (!rawMetaFile.HasMember("ActorChunks") || !rawMetaFile["ActorChunks"].IsArray()) {
+			return true;
+		}
+		OutMeta.HasActorChunks = true;
+		const rapidjson::Value& jsonChunks = rawMetaFile["ActorChunks"];
+		for (rapidjson::SizeType i = 0; i < jsonChunks.Size(); ++i) {
+			// Chunks saved before generation tagging are listed by size only.
+			if (jsonChunks[i].IsObject() && jsonChunks[i].HasMember("File") && jsonChunks[i]["File"].IsString()) {
+				OutMeta.ChunkFiles.push_back(jsonChunks[i]["File"].GetString());
+			}
+			else {
+				OutMeta.ChunkFiles.push_back(GetActorChunkFilename(i, 0U));
+			}
+		}
+		return true;
+	}
+
+	// Delete the chunk files in the scene's Actors folder that Meta.json no longer lists,
+	// those replaced by this save and any left behind by a save that failed.
+	static void DeleteUnlistedActorChunks(const std::string& SceneDirectory, const std::vector<std::string>& ChunkFiles)
+	{
+		const std::unordered_set<std::string> Listed(ChunkFiles.begin(), ChunkFiles.end());
+
+		WIN32_FIND_DATAA FindData;
+		HANDLE hFind = FindFirstFileA((SceneDirectory + "/Actors/Chunk_*.json").c_str(), &FindData);
+		if (hFind == INVALID_HANDLE_VALUE) {
+			return;
+		}
+		do {
+			const std::string File = std::string("Actors/") + FindData.cFileName;
+			if (Listed.find(File) == Listed.end()) {
+				DeleteFileA((SceneDirectory + "/" + File).c_str());
+			}
+		} while (FindNextFileA(hFind, &FindData));
+		FindClose(hFind);
+	}
+
+	// Create every actor in the "Set" array of an actor file.
+	static bool LoadActorFile(const std::string& Filepath, const JsonStreamReader::ElementCallback& LoadActor)
+	{
+		if (!FileSystem::GetLoadSceneJsonAsDom()) {
+			return JsonStreamReader::ForEachArrayElement(Filepath, "Set", LoadActor);
+		}
+
+		rapidjson::Document rawActorsFile;
+		if (!json::load(Filepath.c_str(), rawActorsFile)) {
+			return false;
+		}
+		ScopedExternalAllocation JsonMemory(eMemoryCategory::Json, rawActorsFile.GetAllocator().Capacity());
+
+		const rapidjson::Value& sceneObjects = rawActorsFile["Set"];
+		for (rapidjson::SizeType a = 0; a < sceneObjects.Size(); a++) {
+			LoadActor(sceneObjects[a]);
+		}
+		return true;
+	}
+
+	// Group the scene's actors by the chunk file they are saved to and flag the chunks that must be
+	// rewritten. Actors stay in the chunk they were loaded from and new actors are appended to the
+	// last chunks, so the chunks read back in the same order as the scene. Returns true if the
+	// chunks were laid out again from scratch.
+	static bool BuildActorChunks(Scene* pScene, bool ForceCompaction, std::vector<std::vector<AActor*>>& OutChunks, std::vector<bool>& OutIsDirty)
+	{
+		const std::vector<uint32_t>& SavedChunkSizes = pScene->GetSavedChunkSizes();
+		const uint32_t NumSavedChunks = static_cast<uint32_t>(SavedChunkSizes.size());
+
+		std::vector<AActor*> AllActors;
+		std::vector<AActor*> NewActors;
+		OutChunks.assign(NumSavedChunks, std::vector<AActor*>());
+		OutIsDirty.assign(NumSavedChunks, false);
+		for (SceneNode* pNode : pScene->GetRootNode()->m_Children) {
+			AActor* pActor = dynamic_cast<AActor*>(pNode);
+			if (!pActor || !pActor->GetCanBeFileParsed()) {
+				continue;
+			}
+			AllActors.push_back(pActor);
+
+			const uint32_t Chunk = pActor->GetSaveChunk();
+			if (Chunk < NumSavedChunks) {
+				OutChunks[Chunk].push_back(pActor);
+				OutIsDirty[Chunk] = OutIsDirty[Chunk] || pActor->IsSaveDirty();
+			}
+			else {
+				NewActors.push_back(pActor);
+			}
+		}
+
+		// A chunk holding fewer actors than were saved to it had some deleted.
+		for (uint32_t i = 0; i < NumSavedChunks; ++i) {
+			if (OutChunks[i].size() != SavedChunkSizes[i]) {
+				OutIsDirty[i] = true;
+			}
+		}
+
+		for (AActor* pActor : NewActors) {
+			if (OutChunks.empty() || OutChunks.back().size() >= IE_SCENE_ACTORS_PER_CHUNK) {
+				OutChunks.emplace_back();
+				OutIsDirty.push_back(true);
+			}
+			OutChunks.back().push_back(pActor);
+			OutIsDirty.back() = true;
+		}
+
+		// Deleting actors leaves chunks partly empty. Compact once there are more than twice
+		// as many chunks as the actors need, which keeps it rare while bounding the waste.
+		const size_t NumNeededChunks = (AllActors.size() + IE_SCENE_ACTORS_PER_CHUNK - 1U) / IE_SCENE_ACTORS_PER_CHUNK;
+		const bool IsFragmented = OutChunks.size() > 2U * ((NumNeededChunks > 0U) ? NumNeededChunks : 1U);
+		if (!ForceCompaction && NumSavedChunks > 0U && !IsFragmented) {
+			return false;
+		}
+
+		OutChunks.assign(NumNeededChunks, std::vector<AActor*>());
+		OutIsDirty.assign(NumNeededChunks, true);
+		for (size_t i = 0; i < AllActors.size(); ++i) {
+			OutChunks[i / IE_SCENE_ACTORS_PER_CHUNK].push_back(AllActors[i]);
+		}
+		return true;
+	}
 
 	FileSystem::FileSystem()
 	{
@@ -141,22 +377,164 @@ namespace Insight {
 		return UserGraphicsSettings;
 	}
 
+	bool FileSystem::LoadScene(const std::string& FileName, Scene* pScene)
+	{
+		// The cooked scene never parses json, comparing the json loaders means loading from json.
+		if (!s_LoadSceneJsonAsDom && IsCookedSceneUpToDate(FileName)) {
+			if (LoadSceneFromCooked(FileName, pScene)) {
+				return true;
+			}
+			IE_CORE_WARN("Falling back to json for scene: \"{0}\"", FileName);
+		}
+
+		if (!LoadSceneFromJson(FileName, pScene)) {
+			return false;
+		}
+		CookScene(pScene, FileName);
+		return true;
+	}
+
+	bool FileSystem::IsCookedSceneUpToDate(const std::string& FileName)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA CookedAttributes;
+		const std::string CookedDir = FileName + "/" IE_COOKED_SCENE_FILENAME;
+		if (!GetFileAttributesExA(CookedDir.c_str(), GetFileExInfoStandard, &CookedAttributes)) {
+			return false;
+		}
+
+		// Meta.json is the commit point of a save, the cooked scene is only current if it is
+		// newer than Meta.json and every file Meta.json lists.
+		SceneMeta Meta;
+		if (!LoadSceneMeta(FileName, Meta)) {
+			return false;
+		}
+		auto IsNewerThanCooked = [&FileName, &CookedAttributes](const std::string& SourceFile, bool MustExist) {
+			WIN32_FILE_ATTRIBUTE_DATA SourceAttributes;
+			const std::string SourceDir = FileName + "/" + SourceFile;
+			if (!GetFileAttributesExA(SourceDir.c_str(), GetFileExInfoStandard, &SourceAttributes)) {
+				return MustExist;
+			}
+			return CompareFileTime(&SourceAttributes.ftLastWriteTime, &CookedAttributes.ftLastWriteTime) > 0;
+		};
+
+		if (IsNewerThanCooked("Meta.json", true) || IsNewerThanCooked("Resources.json", false)
+			|| (!Meta.HasActorChunks && IsNewerThanCooked("Actors.json", false))) {
+			return false;
+		}
+		// A listed chunk that is missing means the files on disk are not the save Meta.json describes.
+		for (const std::string& ChunkFile : Meta.ChunkFiles) {
+			if (IsNewerThanCooked(ChunkFile, true)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FileSystem::LoadSceneFromCooked(const std::string& FileName, Scene* pScene)
+	{
+		Profiling::ScopedTimer timer("LoadSceneFromCooked");
+
+		CookedSceneView CookedScene;
+		const std::string CookedDir = FileName + "/" IE_COOKED_SCENE_FILENAME;
+		if (!CookedScene.Open(CookedDir)) {
+			IE_CORE_ERROR("Failed to open cooked scene: \"{0}\"", CookedDir);
+			return false;
+		}
+
+		// The chunk files are named in Meta.json, not the cooked scene. The next save needs them.
+		SceneMeta Meta;
+		if (!LoadSceneMeta(FileName, Meta) || Meta.ChunkFiles.size() != CookedScene.GetNumActorChunks()) {
+			IE_CORE_INFO("Cooked scene does not match the chunks listed in Meta.json.");
+			return false;
+		}
+
+		// Prefab instances are cooked with their template baked in,
+		// editing a prefab makes every scene that uses it stale.
+		{
+			WIN32_FILE_ATTRIBUTE_DATA CookedAttributes;
+			GetFileAttributesExA(CookedDir.c_str(), GetFileExInfoStandard, &CookedAttributes);
+
+			std::unordered_set<CookedString> CheckedPrefabs;
+			for (uint32_t a = 0; a < CookedScene.GetNumActors(); a++) {
+				const CookedString Prefab = CookedScene.GetActor(a).Prefab;
+				if (Prefab == 0U || !CheckedPrefabs.insert(Prefab).second) {
+					continue;
+				}
+
+				WIN32_FILE_ATTRIBUTE_DATA PrefabAttributes;
+				const std::string PrefabDir = AssetPath(CookedScene.GetString(Prefab)).ToAbsolute();
+				if (GetFileAttributesExA(PrefabDir.c_str(), GetFileExInfoStandard, &PrefabAttributes)
+					&& CompareFileTime(&PrefabAttributes.ftLastWriteTime, &CookedAttributes.ftLastWriteTime) > 0) {
+					IE_CORE_INFO("Prefab \"{0}\" changed since the scene was cooked.", CookedScene.GetString(Prefab));
+					return false;
+				}
+			}
+		}
+
+		const char* SceneName = CookedScene.GetString(CookedScene.GetHeader().SceneName);
+		pScene->SetDisplayName(SceneName);
+		Application::Get().GetWindow().SetWindowTitle(SceneName);
+
+		ResourceManager::Get().LoadResourcesFromCooked(CookedScene);
+
+		{
+			ScopedMemoryCategory MemoryScope(eMemoryCategory::SceneGraph);
+			GeometryManager::BeginImportBatch();
+
+			// Actors are cooked in the order of the chunk files they were saved to. Give
+			// each its chunk back so the next save only rewrites the chunks that change.
+			std::vector<uint32_t>& chunkSizes = pScene->GetSavedChunkSizes();
+			chunkSizes.assign(CookedScene.GetNumActorChunks(), 0U);
+			pScene->GetSavedChunkFiles() = Meta.ChunkFiles;
+			pScene->SetSaveGeneration(Meta.SaveGeneration);
+			uint32_t actorChunk = 0U;
+
+			UINT actorSceneIndex = 0;
+			for (uint32_t a = 0; a < CookedScene.GetNumActors(); a++)
+			{
+				const CookedActor& Cooked = CookedScene.GetActor(a);
+				const std::string actorDisplayName = CookedScene.GetString(Cooked.DisplayName);
+
+				AActor* newActor = TypeRegistry::CreateActor(Cooked.Type, actorSceneIndex, actorDisplayName);
+				if (newActor == nullptr) {
+					IE_CORE_ERROR("Failed to parse cooked actor \"{0}\" into scene", (actorDisplayName == "") ? "INVALID NAME" : actorDisplayName);
+					continue;
+				}
+
+				newActor->LoadFromCooked(CookedScene, Cooked);
+				while (actorChunk < chunkSizes.size() && chunkSizes[actorChunk] == CookedScene.GetActorChunkSize(actorChunk)) {
+					actorChunk++;
+				}
+				if (actorChunk < chunkSizes.size()) {
+					newActor->SetSaveChunk(actorChunk);
+					chunkSizes[actorChunk]++;
+				}
+				pScene->GetRootNode()->AddChild(newActor);
+				actorSceneIndex++;
+			}
+
+			GeometryManager::EndImportBatch();
+		}
+
+		IE_CORE_TRACE("Cooked scene loaded.");
+		return true;
+	}
+
 	bool FileSystem::LoadSceneFromJson(const std::string& FileName, Scene* pScene)
 	{
+		SceneMeta meta;
+
 		// Load in Meta.json
 		{
 			Profiling::ScopedTimer timer("LoadSceneFromJson::LoadMetaData");
 
-			rapidjson::Document rawMetaFile;
-			const std::string metaDir = FileName + "/Meta.json";
-			if (!json::load(metaDir.c_str(), rawMetaFile)) {
+			if (!LoadSceneMeta(FileName, meta)) {
 				IE_CORE_ERROR("Failed to load meta file from scene: \"{0}\" from file.", FileName);
 				return false;
 			}
-			std::string sceneName;
-			json::get_string(rawMetaFile, "SceneName", sceneName); // Find something that says 'SceneName' and load sceneName variable
-			pScene->SetDisplayName(sceneName);
-			Application::Get().GetWindow().SetWindowTitle(sceneName);
+			pScene->SetDisplayName(meta.SceneName);
+			Application::Get().GetWindow().SetWindowTitle(meta.SceneName);
+			pScene->SetSaveGeneration(meta.SaveGeneration);
 
 			IE_CORE_TRACE("Scene meta data loaded.");
 		}
@@ -165,127 +543,311 @@ namespace Insight {
 		{
 			Profiling::ScopedTimer timer("LoadSceneFromJson::LoadResources");
 
-			rapidjson::Document rawResourceFile;
 			const std::string resorurceDir = FileName + "/Resources.json";
-			if (!json::load(resorurceDir.c_str(), rawResourceFile)) {
-				IE_CORE_ERROR("Failed to load resource file from scene: \"{0}\" from file.", FileName);
-				return false;
-			}
+			if (s_LoadSceneJsonAsDom) {
+				rapidjson::Document rawResourceFile;
+				if (!json::load(resorurceDir.c_str(), rawResourceFile)) {
+					IE_CORE_ERROR("Failed to load resource file from scene: \"{0}\" from file.", FileName);
+					return false;
+				}
+				ScopedExternalAllocation JsonMemory(eMemoryCategory::Json, rawResourceFile.GetAllocator().Capacity());
 
-			ResourceManager::Get().LoadResourcesFromJson(rawResourceFile);
+				ResourceManager::Get().LoadResourcesFromJson(rawResourceFile);
+			}
+			else {
+				TextureManager& textureManager = ResourceManager::Get().GetTextureManager();
+				bool loaded = JsonStreamReader::ForEachArrayElement(resorurceDir, "Textures", [&textureManager](const rapidjson::Value& jsonTexture) {
+					textureManager.LoadTextureFromJson(jsonTexture);
+				});
+				if (!loaded) {
+					IE_CORE_ERROR("Failed to load resource file from scene: \"{0}\" from file.", FileName);
+					return false;
+				}
+			}
 
 			IE_CORE_TRACE("Scene resouces loaded.");
 		}
 
-		// Load in Actors.json last once resources have been intialized
+		// Load in the actors last once resources have been intialized
 		{
 			Profiling::ScopedTimer timer("LoadSceneFromJson::LoadActors");
 
-			rapidjson::Document rawActorsFile;
-			const std::string actorsDir = FileName + "/Actors.json";
-			if (!json::load(actorsDir.c_str(), rawActorsFile)) {
-				IE_CORE_ERROR("Failed to load actor file from scene: \"{0}\" from file.", FileName);
-				return false;
-			}
+			// Actors are created in file order while the meshes they reference import on the
+			// thread pool. Ending the batch finishes the imports in that same order.
+			GeometryManager::BeginImportBatch();
 
-			AActor* newActor = nullptr;
 			UINT actorSceneIndex = 0;
-
-			const rapidjson::Value& sceneObjects = rawActorsFile["Set"];
-			for (rapidjson::SizeType a = 0; a < sceneObjects.Size(); a++)
-			{
-				const rapidjson::Value& jsonActor = sceneObjects[a];
-
-				std::string actorDisplayName;
-				std::string actorType;
-				json::get_string(jsonActor, "DisplayName", actorDisplayName);
-				json::get_string(jsonActor, "Type", actorType);
-
-				if (actorType == "Actor") {
-					newActor = new AActor(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-				else if (actorType == "PointLight") {
-					newActor = new APointLight(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-				else if (actorType == "SpotLight") {
-					newActor = new ASpotLight(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-				else if (actorType == "DirectionalLight") {
-					newActor = new ADirectionalLight(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-				else if (actorType == "SkySphere") {
-					newActor = new ASkySphere(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-				else if (actorType == "SkyLight") {
-					newActor = new ASkyLight(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-				else if (actorType == "PostFxVolume") {
-					newActor = new APostFx(actorSceneIndex, actorDisplayName);
-					newActor->LoadFromJson(jsonActor);
-				}
-
+			uint32_t actorChunk = IE_INVALID_SAVE_CHUNK;
+			std::vector<uint32_t>& chunkSizes = pScene->GetSavedChunkSizes();
+			auto LoadActor = [pScene, &actorSceneIndex, &actorChunk, &chunkSizes](const rapidjson::Value& jsonActor) {
+				AActor* newActor = CreateActorFromJson(jsonActor, actorSceneIndex);
 				if (newActor == nullptr) {
-					IE_CORE_ERROR("Failed to parse actor \"{0}\" into scene", (actorDisplayName == "") ? "INVALID NAME" : actorDisplayName);
-					continue;
+					return;
+				}
+				if (actorChunk != IE_INVALID_SAVE_CHUNK) {
+					newActor->SetSaveChunk(actorChunk);
+					chunkSizes[actorChunk]++;
 				}
-
 				pScene->GetRootNode()->AddChild(newActor);
 				actorSceneIndex++;
+			};
+
+			bool loaded = true;
+			if (meta.HasActorChunks) {
+				// Chunk sizes are counted as they load rather than taken from Meta.json,
+				// so whatever is actually on disk is what the next save compares against.
+				const uint32_t numActorChunks = static_cast<uint32_t>(meta.ChunkFiles.size());
+				chunkSizes.assign(numActorChunks, 0U);
+				pScene->GetSavedChunkFiles() = meta.ChunkFiles;
+				for (actorChunk = 0; actorChunk < numActorChunks && loaded; ++actorChunk) {
+					loaded = LoadActorFile(FileName + "/" + meta.ChunkFiles[actorChunk], LoadActor);
+				}
+			}
+			else {
+				// Scenes saved before actor chunks keep every actor in Actors.json. They are split into chunks on their next save.
+				loaded = LoadActorFile(FileName + "/Actors.json", LoadActor);
+			}
+
+			GeometryManager::EndImportBatch();
+			if (!loaded) {
+				IE_CORE_ERROR("Failed to load actor file from scene: \"{0}\" from file.", FileName);
+				return false;
 			}
 
 			IE_CORE_TRACE("Scene actors loaded.");
 		}
 
+		LogSceneLoadMemoryStats();
+
 		return true;
 	}
 
+	AActor* FileSystem::CreateActorFromJson(const rapidjson::Value& jsonActor, UINT actorSceneIndex)
+	{
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::SceneGraph);
+
+		std::string actorDisplayName;
+		std::string actorType;
+		json::get_string(jsonActor, "DisplayName", actorDisplayName);
+
+		// Prefab instances only store their transform and overrides, the rest comes from the shared template.
+		if (jsonActor.HasMember("Prefab")) {
+			std::string prefabPath;
+			json::get_string(jsonActor, "Prefab", prefabPath);
+			StrongPrefabPtr pPrefab = ResourceManager::Get().GetPrefabManager().LoadPrefab(AssetPath(prefabPath));
+			if (!pPrefab) {
+				IE_CORE_ERROR("Failed to load prefab \"{0}\" for actor \"{1}\"", prefabPath, actorDisplayName);
+				return nullptr;
+			}
+			return pPrefab->Instantiate(actorSceneIndex, actorDisplayName, jsonActor);
+		}
+
+		json::get_string(jsonActor, "Type", actorType);
+
+		AActor* newActor = TypeRegistry::CreateActor(HashTypeName(actorType), actorSceneIndex, actorDisplayName);
+		if (newActor == nullptr) {
+			IE_CORE_ERROR("Failed to parse actor \"{0}\" into scene", (actorDisplayName == "") ? "INVALID NAME" : actorDisplayName);
+			return nullptr;
+		}
+
+		newActor->LoadFromJson(jsonActor);
+		return newActor;
+	}
+
+	void FileSystem::LogSceneLoadMemoryStats()
+	{
+		// Compare against a load with SetLoadSceneJsonAsDom(true), "-domload" in the benchmark, to measure the streaming loader.
+		PROCESS_MEMORY_COUNTERS MemoryCounters = {};
+		GetProcessMemoryInfo(GetCurrentProcess(), &MemoryCounters, sizeof(MemoryCounters));
+		const MemoryTracker::CategoryStats JsonStats = MemoryTracker::GetStats(eMemoryCategory::Json);
+
+		const char* LoaderName = s_LoadSceneJsonAsDom ? "DOM" : "Streaming";
+		IE_CORE_INFO("{0} scene load: peak json memory {1} KB, peak working set {2} KB.", LoaderName, JsonStats.PeakBytes / 1024, MemoryCounters.PeakWorkingSetSize / 1024);
+	}
+
 	bool FileSystem::WriteSceneToJson(Scene* pScene)
 	{
-		// Save Out Meta.json
-		{
-			rapidjson::StringBuffer StrBuffer;
-			rapidjson::PrettyWriter<rapidjson::StringBuffer> Writer(StrBuffer);
+		return SaveSceneAsync(pScene) && WaitForPendingSave();
+	}
 
-			Writer.StartObject();
-			Writer.Key("SceneName");
-			Writer.String(pScene->GetDisplayName().c_str());
-			Writer.EndObject();
+	bool FileSystem::SaveSceneAsync(Scene* pScene, bool ForceCompaction)
+	{
+		// Saves must land on disk in the order they were made.
+		WaitForPendingSave();
+		// A failed save may have left any chunk behind, write them all again.
+		ForceCompaction = ForceCompaction || !s_LastSaveSucceeded;
 
-			// Final Export
-			std::string sceneName = FileSystem::ProjectDirectory + "/Assets/Scenes/" + pScene->GetDisplayName() + ".iescene/Meta.json";
-			std::ofstream offstream(sceneName.c_str());
-			offstream << StrBuffer.GetString();
+		auto pSnapshot = std::make_shared<SceneSaveSnapshot>();
+		{
+			Profiling::ScopedTimer timer("SaveScene::Snapshot");
+
+			pSnapshot->SceneDirectory = FileSystem::ProjectDirectory + "/Assets/Scenes/" + pScene->GetDisplayName() + ".iescene";
+			pSnapshot->SceneName = pScene->GetDisplayName();
+
+			// Actor chunks. Only the chunks holding edited, added or deleted actors are written.
+			std::vector<std::vector<AActor*>> Chunks;
+			std::vector<bool> IsChunkDirty;
+			std::vector<uint32_t>& ChunkSizes = pScene->GetSavedChunkSizes();
+			std::vector<std::string>& ChunkFiles = pScene->GetSavedChunkFiles();
+			pSnapshot->IsCompaction = BuildActorChunks(pScene, ForceCompaction, Chunks, IsChunkDirty);
+			pSnapshot->NumChunks = static_cast<uint32_t>(Chunks.size());
+			pSnapshot->SaveGeneration = pScene->GetSaveGeneration() + 1U;
+			pScene->SetSaveGeneration(pSnapshot->SaveGeneration);
+
+			ChunkSizes.resize(Chunks.size());
+			ChunkFiles.resize(Chunks.size());
+			for (uint32_t i = 0; i < pSnapshot->NumChunks; ++i) {
+				ChunkSizes[i] = static_cast<uint32_t>(Chunks[i].size());
+				if (!IsChunkDirty[i]) {
+					continue;
+				}
+				ChunkFiles[i] = GetActorChunkFilename(i, pSnapshot->SaveGeneration);
+
+				auto pChunk = std::make_unique<ActorChunkSnapshot>();
+				pChunk->File = ChunkFiles[i];
+				if (!Scene::WriteActorsToJson(Chunks[i], pChunk->Records)) {
+					// Nothing has been written yet, the files on disk still hold the last good save.
+					// The chunk bookkeeping above is partly updated, the next save rewrites every chunk.
+					IE_CORE_ERROR("Failed to save scene \"{0}\", an actor in chunk {1} could not be written.", pSnapshot->SceneName, i);
+					s_LastSaveSucceeded = false;
+					return false;
+				}
+				pSnapshot->Chunks.push_back(std::move(pChunk));
 
-			if (!offstream.good()) {
-				IE_CORE_ERROR("Failed to save meta data for scene: {0}", pScene->GetDisplayName());
-				return false;
+				for (AActor* pActor : Chunks[i]) {
+					pActor->SetSaveChunk(i);
+					pActor->ClearSaveDirty();
+				}
 			}
+
+			pSnapshot->ChunkSizes = ChunkSizes;
+			pSnapshot->ChunkFiles = ChunkFiles;
+
+			// Re-cooking needs every actor, so it is left to compacting saves. After an
+			// incremental save the cooked scene is stale and rebuilt on the next load.
+			// Only the records are captured here, Finalize lays the file out on the thread pool.
+			if (pSnapshot->IsCompaction) {
+				pSnapshot->Cooked.SetSceneName(pScene->GetDisplayName());
+				pSnapshot->Cooked.SetActorChunkSizes(ChunkSizes);
+				ResourceManager::Get().WriteToCooked(pSnapshot->Cooked);
+				pScene->GetRootNode()->WriteToCooked(pSnapshot->Cooked);
+			}
+
+			IE_CORE_INFO("Saving {0} of {1} actor chunks{2}.", pSnapshot->Chunks.size(), pSnapshot->NumChunks, pSnapshot->IsCompaction ? " (compacting)" : "");
 		}
 
-		// Save Out Actors.json
-		{
-			rapidjson::StringBuffer StrBuffer;
-			rapidjson::PrettyWriter<rapidjson::StringBuffer> Writer(StrBuffer);
+		s_SaveBytesWritten = 0U;
+		s_SaveBytesTotal = 0U;
+		s_IsSaving = true;
+		s_PendingSave = ThreadPool::Submit([pSnapshot]() {
+			Profiling::ScopedTimer timer("SaveScene::Write");
 
-			pScene->WriteToJson(Writer);
+			bool Succeeded = true;
+			for (const unique_ptr<ActorChunkSnapshot>& pChunk : pSnapshot->Chunks) {
+				rapidjson::PrettyWriter<rapidjson::StringBuffer> ChunkWriter(pChunk->Text);
+				Succeeded = Succeeded && pChunk->Records.Replay(ChunkWriter);
+			}
 
-			// Final Export
-			std::string sceneName = FileSystem::ProjectDirectory + "/Assets/Scenes/" + pScene->GetDisplayName() + ".iescene/Actors.json";
-			std::ofstream offstream(sceneName.c_str());
-			offstream << StrBuffer.GetString();
+			rapidjson::StringBuffer Meta;
+			rapidjson::PrettyWriter<rapidjson::StringBuffer> MetaWriter(Meta);
+			MetaWriter.StartObject();
+			MetaWriter.Key("SceneName");
+			MetaWriter.String(pSnapshot->SceneName.c_str());
+			MetaWriter.Key("SaveGeneration");
+			MetaWriter.Uint(pSnapshot->SaveGeneration);
+			MetaWriter.Key("ActorChunks");
+			MetaWriter.StartArray();
+			for (uint32_t i = 0; i < pSnapshot->NumChunks; ++i) {
+				MetaWriter.StartObject();
+				MetaWriter.Key("File");
+				MetaWriter.String(pSnapshot->ChunkFiles[i].c_str());
+				MetaWriter.Key("Actors");
+				MetaWriter.Uint(pSnapshot->ChunkSizes[i]);
+				MetaWriter.EndObject();
+			}
+			MetaWriter.EndArray();
+			MetaWriter.EndObject();
 
-			if (!offstream.good()) {
-				IE_CORE_ERROR("Failed to save actors for scene: {0}", pScene->GetDisplayName());
-				return false;
+			std::vector<uint8_t> CookedBytes;
+			if (pSnapshot->IsCompaction) {
+				pSnapshot->Cooked.Finalize(CookedBytes);
+			}
+			size_t TotalBytes = Meta.GetSize() + CookedBytes.size();
+			for (const unique_ptr<ActorChunkSnapshot>& pChunk : pSnapshot->Chunks) {
+				TotalBytes += pChunk->Text.GetSize();
+			}
+			s_SaveBytesTotal = TotalBytes;
+
+			// Changed chunks are written under this save's generation, next to the files the current
+			// Meta.json lists. Replacing Meta.json commits the save, if the save stops before then the
+			// previous Meta.json and every file it lists are untouched and it loads as it was. Chunk
+			// files it no longer lists are only deleted once it is replaced. The cooked scene goes
+			// last so it is never newer than json it was not built from.
+			CreateDirectoryA((pSnapshot->SceneDirectory + "/Actors").c_str(), NULL);
+			for (const unique_ptr<ActorChunkSnapshot>& pChunk : pSnapshot->Chunks) {
+				Succeeded = Succeeded && WriteFileAtomic_Internal(pSnapshot->SceneDirectory + "/" + pChunk->File, pChunk->Text.GetString(), pChunk->Text.GetSize(), &s_SaveBytesWritten);
+			}
+			Succeeded = Succeeded && WriteFileAtomic_Internal(pSnapshot->SceneDirectory + "/Meta.json", Meta.GetString(), Meta.GetSize(), &s_SaveBytesWritten);
+
+			if (Succeeded) {
+				DeleteUnlistedActorChunks(pSnapshot->SceneDirectory, pSnapshot->ChunkFiles);
 			}
+			if (Succeeded && pSnapshot->IsCompaction) {
+				Succeeded = WriteFileAtomic_Internal(pSnapshot->SceneDirectory + "/" IE_COOKED_SCENE_FILENAME, CookedBytes.data(), CookedBytes.size(), &s_SaveBytesWritten);
+			}
+
+			if (Succeeded) {
+				IE_CORE_INFO("Scene saved to \"{0}\"", pSnapshot->SceneDirectory);
+			}
+			else {
+				IE_CORE_ERROR("Failed to save scene to \"{0}\". Files that were not replaced are unchanged.", pSnapshot->SceneDirectory);
+			}
+			s_LastSaveSucceeded = Succeeded;
+			s_IsSaving = false;
+			return Succeeded;
+		});
+		return true;
+	}
+
+	bool FileSystem::WaitForPendingSave()
+	{
+		if (!s_PendingSave.valid()) {
+			return true;
 		}
+		return s_PendingSave.get();
+	}
 
+	bool FileSystem::IsSaveInProgress()
+	{
+		return s_IsSaving;
+	}
+
+	float FileSystem::GetSaveProgress()
+	{
+		const size_t Total = s_SaveBytesTotal;
+		return (Total > 0U) ? static_cast<float>(s_SaveBytesWritten) / static_cast<float>(Total) : 0.0f;
+	}
+
+	bool FileSystem::WriteFileAtomic(const std::string& Filepath, const void* pData, size_t Size)
+	{
+		return WriteFileAtomic_Internal(Filepath, pData, Size, nullptr);
+	}
+
+	bool FileSystem::CookScene(Scene* pScene, const std::string& FileName)
+	{
+		Profiling::ScopedTimer timer("CookScene");
+
+		CookedSceneBuilder Builder;
+		Builder.SetSceneName(pScene->GetDisplayName());
+		Builder.SetActorChunkSizes(pScene->GetSavedChunkSizes());
+		ResourceManager::Get().WriteToCooked(Builder);
+		pScene->GetRootNode()->WriteToCooked(Builder);
+
+		const std::string CookedDir = FileName + "/" IE_COOKED_SCENE_FILENAME;
+		if (!Builder.WriteToFile(CookedDir)) {
+			IE_CORE_ERROR("Failed to cook scene: {0}", pScene->GetDisplayName());
+			return false;
+		}
 		return true;
 	}
 
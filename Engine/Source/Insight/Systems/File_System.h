@@ -6,6 +6,7 @@
 namespace Insight {
 
 	class Scene;
+	class AActor;
 
 	class INSIGHT_API FileSystem
 	{
@@ -20,13 +21,45 @@ namespace Insight {
 		static std::string GetUserDocumentsFolderPath();
 		static std::string GetProjectRelativeAssetDirectory(std::string Path);
 		static Renderer::GraphicsSettings LoadGraphicsSettingsFromJson();
+		// Load a scene from its .iescene folder. Uses the cooked scene when it is up to date
+		// with the .json files, otherwise loads the .json files and re-cooks.
+		static bool LoadScene(const std::string& FileName, Scene* pScene);
 		static bool LoadSceneFromJson(const std::string& FileName, Scene* pScene);
+		static bool LoadSceneFromCooked(const std::string& FileName, Scene* pScene);
+		// Save the scene to its .iescene folder. Blocks until the files are written.
 		static bool WriteSceneToJson(Scene* pScene);
+		// Capture the scene as plain records on the calling thread, then format and write
+		// the files on the thread pool.
+		// Saves run one at a time, starting a save waits for the previous one to finish.
+		// Actors are saved in chunk files (Actors/Chunk_NNNN_<generation>.json) listed in
+		// Meta.json, and only chunks with edited, added or removed actors are rewritten. Compaction lays all chunks out
+		// again and re-cooks the scene. It runs on its own once chunks become too sparse.
+		// Returns false, with nothing written, if an actor could not be captured.
+		static bool SaveSceneAsync(Scene* pScene, bool ForceCompaction = false);
+		// Block until the save in flight, if any, is written. Returns whether it succeeded.
+		static bool WaitForPendingSave();
+		static bool IsSaveInProgress();
+		// Fraction of the save in flight that has been written, from 0 to 1.
+		static float GetSaveProgress();
+		static bool CookScene(Scene* pScene, const std::string& FileName);
 		static bool FileExists(const std::string& Path);
+		// Replace a file without ever leaving it partially written. The data is written to
+		// "<Filepath>.tmp", flushed to disk and then renamed over the original.
+		static bool WriteFileAtomic(const std::string& Filepath, const void* pData, size_t Size);
+		// Load json scenes by building the full DOM of each file instead of streaming it, and skip
+		// the cooked scene. Only for comparing the two loaders, see the benchmark's "-domload".
+		static void SetLoadSceneJsonAsDom(bool LoadAsDom) { s_LoadSceneJsonAsDom = LoadAsDom; }
+		static bool GetLoadSceneJsonAsDom() { return s_LoadSceneJsonAsDom; }
 
 	public:
 		static std::string ProjectDirectory;
 	private:
+		static bool s_LoadSceneJsonAsDom;
+
+		static bool IsCookedSceneUpToDate(const std::string& FileName);
+		// Create and load an actor from its entry in Actors.json. Returns nullptr if the actor type is unknown.
+		static AActor* CreateActorFromJson(const rapidjson::Value& jsonActor, UINT actorSceneIndex);
+		static void LogSceneLoadMemoryStats();
 
 	};
 
@@ -0,0 +1,158 @@
+#include <ie_pch.h>
+
+#include "Json_Record_Writer.h"
+
+namespace Insight {
+
+	bool JsonRecordWriter::Null()
+	{
+		BeginValue();
+		AppendEvent(eEvent::Null, nullptr, 0U);
+		return true;
+	}
+
+	bool JsonRecordWriter::Bool(bool b)
+	{
+		const uint8_t Value = b ? 1U : 0U;
+		BeginValue();
+		AppendEvent(eEvent::Bool, &Value, sizeof(Value));
+		return true;
+	}
+
+	bool JsonRecordWriter::Int(int i)
+	{
+		BeginValue();
+		AppendEvent(eEvent::Int, &i, sizeof(i));
+		return true;
+	}
+
+	bool JsonRecordWriter::Uint(unsigned u)
+	{
+		BeginValue();
+		AppendEvent(eEvent::Uint, &u, sizeof(u));
+		return true;
+	}
+
+	bool JsonRecordWriter::Int64(int64_t i)
+	{
+		BeginValue();
+		AppendEvent(eEvent::Int64, &i, sizeof(i));
+		return true;
+	}
+
+	bool JsonRecordWriter::Uint64(uint64_t u)
+	{
+		BeginValue();
+		AppendEvent(eEvent::Uint64, &u, sizeof(u));
+		return true;
+	}
+
+	bool JsonRecordWriter::Double(double d)
+	{
+		BeginValue();
+		AppendEvent(eEvent::Double, &d, sizeof(d));
+		return true;
+	}
+
+	bool JsonRecordWriter::String(const char* pString)
+	{
+		return String(pString, static_cast<rapidjson::SizeType>(strlen(pString)));
+	}
+
+	bool JsonRecordWriter::String(const char* pString, rapidjson::SizeType Length, bool Copy)
+	{
+		BeginValue();
+		return AppendString(eEvent::String, pString, Length);
+	}
+
+	bool JsonRecordWriter::Key(const char* pKey)
+	{
+		return Key(pKey, static_cast<rapidjson::SizeType>(strlen(pKey)));
+	}
+
+	bool JsonRecordWriter::Key(const char* pKey, rapidjson::SizeType Length, bool Copy)
+	{
+		if (m_OpenContainers.empty() || m_OpenContainers.back().IsArray) {
+			IE_CORE_ERROR("Json key \"{0}\" written outside of an object.", pKey);
+			return false;
+		}
+		m_OpenContainers.back().Count++;
+		return AppendString(eEvent::Key, pKey, Length);
+	}
+
+	bool JsonRecordWriter::StartObject()
+	{
+		BeginValue();
+		AppendEvent(eEvent::StartObject, nullptr, 0U);
+		m_OpenContainers.push_back({ false, 0U });
+		return true;
+	}
+
+	bool JsonRecordWriter::EndObject(rapidjson::SizeType MemberCount)
+	{
+		return EndContainer(eEvent::EndObject);
+	}
+
+	bool JsonRecordWriter::StartArray()
+	{
+		BeginValue();
+		AppendEvent(eEvent::StartArray, nullptr, 0U);
+		m_OpenContainers.push_back({ true, 0U });
+		return true;
+	}
+
+	bool JsonRecordWriter::EndArray(rapidjson::SizeType ElementCount)
+	{
+		return EndContainer(eEvent::EndArray);
+	}
+
+	void JsonRecordWriter::Clear()
+	{
+		m_Events.clear();
+		m_OpenContainers.clear();
+	}
+
+	void JsonRecordWriter::BeginValue()
+	{
+		if (!m_OpenContainers.empty() && m_OpenContainers.back().IsArray) {
+			m_OpenContainers.back().Count++;
+		}
+	}
+
+	void JsonRecordWriter::AppendEvent(eEvent Event, const void* pData, size_t Size)
+	{
+		const size_t Offset = m_Events.size();
+		m_Events.resize(Offset + 1U + Size);
+		m_Events[Offset] = static_cast<uint8_t>(Event);
+		if (Size > 0U) {
+			memcpy(m_Events.data() + Offset + 1U, pData, Size);
+		}
+	}
+
+	bool JsonRecordWriter::AppendString(eEvent Event, const char* pString, rapidjson::SizeType Length)
+	{
+		const size_t Offset = m_Events.size();
+		m_Events.resize(Offset + 1U + sizeof(Length) + Length + 1U);
+		uint8_t* pDest = m_Events.data() + Offset;
+		*pDest++ = static_cast<uint8_t>(Event);
+		memcpy(pDest, &Length, sizeof(Length));
+		pDest += sizeof(Length);
+		memcpy(pDest, pString, Length);
+		pDest[Length] = '\0';
+		return true;
+	}
+
+	bool JsonRecordWriter::EndContainer(eEvent Event)
+	{
+		const bool IsArray = (Event == eEvent::EndArray);
+		if (m_OpenContainers.empty() || m_OpenContainers.back().IsArray != IsArray) {
+			IE_CORE_ERROR("Mismatched json {0} end.", IsArray ? "array" : "object");
+			return false;
+		}
+		const rapidjson::SizeType Count = m_OpenContainers.back().Count;
+		m_OpenContainers.pop_back();
+		AppendEvent(Event, &Count, sizeof(Count));
+		return true;
+	}
+
+}
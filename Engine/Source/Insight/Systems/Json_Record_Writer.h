@@ -0,0 +1,130 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+namespace Insight {
+
+	/*
+		Records the SAX events of a json document as plain bytes instead of formatting them,
+		so a scene's state can be captured on the main thread and turned into text on the
+		thread pool. It has the part of rapidjson::Writer's interface the engine writes with
+		and replays into any rapidjson SAX handler: a PrettyWriter to produce a file, or a
+		Document to build the DOM without formatting and parsing the text.
+
+		Usage:
+			JsonRecordWriter Records;
+			pActor->WriteToJson(Records);	// Main thread
+
+			rapidjson::PrettyWriter<rapidjson::StringBuffer> Writer(Buffer);
+			Records.Replay(Writer);	// Any thread
+	*/
+	class INSIGHT_API JsonRecordWriter
+	{
+	public:
+		JsonRecordWriter() = default;
+		~JsonRecordWriter() = default;
+
+		bool Null();
+		bool Bool(bool b);
+		bool Int(int i);
+		bool Uint(unsigned u);
+		bool Int64(int64_t i);
+		bool Uint64(uint64_t u);
+		bool Double(double d);
+		bool String(const char* pString);
+		bool String(const char* pString, rapidjson::SizeType Length, bool Copy = false);
+		bool Key(const char* pKey);
+		bool Key(const char* pKey, rapidjson::SizeType Length, bool Copy = false);
+		bool StartObject();
+		// The count is ignored, the recorder counts members itself so Document handlers get the right one.
+		bool EndObject(rapidjson::SizeType MemberCount = 0U);
+		bool StartArray();
+		bool EndArray(rapidjson::SizeType ElementCount = 0U);
+
+		// Send every recorded event to 'Handler' in order. Returns false if the handler stopped early.
+		template <typename HandlerType>
+		bool Replay(HandlerType& Handler) const
+		{
+			const uint8_t* pData = m_Events.data();
+			const uint8_t* pEnd = pData + m_Events.size();
+			bool Succeeded = true;
+			while (pData < pEnd && Succeeded) {
+				const eEvent Event = static_cast<eEvent>(*pData++);
+				switch (Event) {
+				case eEvent::Null:			Succeeded = Handler.Null(); break;
+				case eEvent::Bool:			Succeeded = Handler.Bool(Read<uint8_t>(pData) != 0U); break;
+				case eEvent::Int:			Succeeded = Handler.Int(Read<int>(pData)); break;
+				case eEvent::Uint:			Succeeded = Handler.Uint(Read<unsigned>(pData)); break;
+				case eEvent::Int64:			Succeeded = Handler.Int64(Read<int64_t>(pData)); break;
+				case eEvent::Uint64:		Succeeded = Handler.Uint64(Read<uint64_t>(pData)); break;
+				case eEvent::Double:		Succeeded = Handler.Double(Read<double>(pData)); break;
+				case eEvent::StartObject:	Succeeded = Handler.StartObject(); break;
+				case eEvent::EndObject:		Succeeded = Handler.EndObject(Read<rapidjson::SizeType>(pData)); break;
+				case eEvent::StartArray:	Succeeded = Handler.StartArray(); break;
+				case eEvent::EndArray:		Succeeded = Handler.EndArray(Read<rapidjson::SizeType>(pData)); break;
+				case eEvent::String:
+				case eEvent::Key:
+				{
+					// Strings are stored null terminated, the handler copies them out of the record.
+					const rapidjson::SizeType Length = Read<rapidjson::SizeType>(pData);
+					const char* pString = reinterpret_cast<const char*>(pData);
+					pData += Length + 1U;
+					Succeeded = (Event == eEvent::Key) ? Handler.Key(pString, Length, true) : Handler.String(pString, Length, true);
+					break;
+				}
+				default:
+					return false;
+				}
+			}
+			return Succeeded;
+		}
+
+		inline bool IsEmpty() const { return m_Events.empty(); }
+		inline size_t GetSizeInBytes() const { return m_Events.size(); }
+		void Clear();
+
+	private:
+		enum class eEvent : uint8_t
+		{
+			Null,
+			Bool,
+			Int,
+			Uint,
+			Int64,
+			Uint64,
+			Double,
+			String,
+			Key,
+			StartObject,
+			EndObject,
+			StartArray,
+			EndArray,
+		};
+
+		template <typename ValueType>
+		static ValueType Read(const uint8_t*& pData)
+		{
+			ValueType Value;
+			memcpy(&Value, pData, sizeof(ValueType));
+			pData += sizeof(ValueType);
+			return Value;
+		}
+
+		// Count a value against the enclosing array, object members are counted by their key.
+		void BeginValue();
+		void AppendEvent(eEvent Event, const void* pData, size_t Size);
+		bool AppendString(eEvent Event, const char* pString, rapidjson::SizeType Length);
+		bool EndContainer(eEvent Event);
+
+	private:
+		struct OpenContainer
+		{
+			bool IsArray;
+			rapidjson::SizeType Count;
+		};
+
+		std::vector<uint8_t> m_Events;
+		std::vector<OpenContainer> m_OpenContainers;
+	};
+
+}
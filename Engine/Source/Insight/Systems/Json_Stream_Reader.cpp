@@ -0,0 +1,181 @@
+#include <ie_pch.h>
+
+#include "Json_Stream_Reader.h"
+
+#include <rapidjson/reader.h>
+#include <rapidjson/filereadstream.h>
+
+// Size of the read buffer the file is streamed through.
+#define IE_JSON_STREAM_BUFFER_SIZE 65536U
+
+namespace Insight {
+
+	// SAX handler that rebuilds each element of the target array as a small
+	// rapidjson::Value. Everything outside the target array is skipped.
+	class ElementCaptureHandler
+	{
+	public:
+		ElementCaptureHandler(const char* ArrayKey, const JsonStreamReader::ElementCallback& OnElement)
+			: m_ArrayKey(ArrayKey), m_OnElement(OnElement)
+		{
+			m_Stack.reserve(32);
+		}
+
+		bool Null() { return Scalar(rapidjson::Value()); }
+		bool Bool(bool b) { return Scalar(rapidjson::Value(b)); }
+		bool Int(int i) { return Scalar(rapidjson::Value(i)); }
+		bool Uint(unsigned u) { return Scalar(rapidjson::Value(u)); }
+		bool Int64(int64_t i) { return Scalar(rapidjson::Value(i)); }
+		bool Uint64(uint64_t u) { return Scalar(rapidjson::Value(u)); }
+		bool Double(double d) { return Scalar(rapidjson::Value(d)); }
+		bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) { return String(str, length, copy); }
+		bool String(const char* str, rapidjson::SizeType length, bool copy)
+		{
+			if (!m_IsInTargetArray) {
+				return true;
+			}
+			return AddValue(rapidjson::Value(str, length, m_Allocator));
+		}
+
+		bool Key(const char* str, rapidjson::SizeType length, bool copy)
+		{
+			if (m_IsInTargetArray) {
+				// Keys wait on the stack above their object until the value completes.
+				m_Stack.emplace_back(str, length, m_Allocator);
+			}
+			else if (m_Depth == 1) {
+				m_IsTargetKey = (strncmp(str, m_ArrayKey, length) == 0 && m_ArrayKey[length] == '\0');
+			}
+			return true;
+		}
+
+		bool StartObject()
+		{
+			if (m_IsInTargetArray) {
+				m_Stack.emplace_back(rapidjson::kObjectType);
+			}
+			m_Depth++;
+			return true;
+		}
+
+		bool EndObject(rapidjson::SizeType memberCount)
+		{
+			m_Depth--;
+			return m_IsInTargetArray ? CloseContainer() : true;
+		}
+
+		bool StartArray()
+		{
+			if (m_IsInTargetArray) {
+				m_Stack.emplace_back(rapidjson::kArrayType);
+			}
+			else if (m_Depth == 1 && m_IsTargetKey) {
+				m_IsInTargetArray = true;
+			}
+			m_Depth++;
+			return true;
+		}
+
+		bool EndArray(rapidjson::SizeType elementCount)
+		{
+			m_Depth--;
+			if (m_IsInTargetArray && m_Depth == 1) {
+				m_IsInTargetArray = false;
+				m_IsTargetKey = false;
+				return true;
+			}
+			return m_IsInTargetArray ? CloseContainer() : true;
+		}
+
+		inline uint32_t GetNumElements() const { return m_NumElements; }
+		inline size_t GetPeakElementBytes() const { return m_PeakElementBytes; }
+
+	private:
+		bool Scalar(rapidjson::Value&& Value)
+		{
+			return m_IsInTargetArray ? AddValue(std::move(Value)) : true;
+		}
+
+		bool CloseContainer()
+		{
+			rapidjson::Value Container(std::move(m_Stack.back()));
+			m_Stack.pop_back();
+			return AddValue(std::move(Container));
+		}
+
+		bool AddValue(rapidjson::Value&& Value)
+		{
+			if (m_Stack.empty()) {
+				EmitElement(Value);
+				return true;
+			}
+
+			rapidjson::Value& Top = m_Stack.back();
+			if (Top.IsArray()) {
+				Top.PushBack(Value, m_Allocator);
+			}
+			else {
+				// A string on top of the stack is the key of a member of the object below it.
+				rapidjson::Value MemberName(std::move(Top));
+				m_Stack.pop_back();
+				m_Stack.back().AddMember(MemberName, Value, m_Allocator);
+			}
+			return true;
+		}
+
+		void EmitElement(const rapidjson::Value& Element)
+		{
+			const size_t ElementBytes = m_Allocator.Capacity();
+			m_PeakElementBytes = (ElementBytes > m_PeakElementBytes) ? ElementBytes : m_PeakElementBytes;
+			{
+				ScopedExternalAllocation JsonMemory(eMemoryCategory::Json, ElementBytes);
+				m_OnElement(Element);
+			}
+			m_NumElements++;
+
+			// Element values never free individually, drop the whole pool once the element is consumed.
+			m_Allocator.Clear();
+		}
+
+	private:
+		const char* m_ArrayKey;
+		const JsonStreamReader::ElementCallback& m_OnElement;
+
+		rapidjson::MemoryPoolAllocator<> m_Allocator;
+		std::vector<rapidjson::Value> m_Stack;
+		uint32_t m_Depth = 0U;
+		bool m_IsTargetKey = false;
+		bool m_IsInTargetArray = false;
+
+		uint32_t m_NumElements = 0U;
+		size_t m_PeakElementBytes = 0U;
+	};
+
+	bool JsonStreamReader::ForEachArrayElement(const std::string& Filepath, const char* ArrayKey, const ElementCallback& OnElement)
+	{
+		FILE* pFile = nullptr;
+		if (fopen_s(&pFile, Filepath.c_str(), "rb") != 0 || !pFile) {
+			IE_CORE_ERROR("Failed to open json file for streaming: {0}", Filepath);
+			return false;
+		}
+
+		char* ReadBuffer = new char[IE_JSON_STREAM_BUFFER_SIZE];
+		rapidjson::FileReadStream InStream(pFile, ReadBuffer, IE_JSON_STREAM_BUFFER_SIZE);
+
+		ElementCaptureHandler Handler(ArrayKey, OnElement);
+		rapidjson::Reader Reader;
+		rapidjson::ParseResult Result = Reader.Parse(InStream, Handler);
+
+		delete[] ReadBuffer;
+		fclose(pFile);
+
+		if (Result.IsError()) {
+			IE_CORE_ERROR("Failed to parse json file \"{0}\": error {1} at offset {2}", Filepath, (int)Result.Code(), Result.Offset());
+			return false;
+		}
+
+		IE_CORE_TRACE("Streamed {0} elements from \"{1}\", largest element used {2} bytes.", Handler.GetNumElements(), Filepath, Handler.GetPeakElementBytes());
+		return true;
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+namespace Insight {
+
+	/*
+		Streams a json file through rapidjson's SAX reader and hands back the elements
+		of one top-level array as they finish parsing, e.g. each actor in the "Set"
+		array of Actors.json. Only the element currently being parsed is held in memory,
+		so peak usage is bounded by the largest element rather than the whole document.
+
+		Usage:
+			JsonStreamReader::ForEachArrayElement(ActorsDir, "Set", [](const rapidjson::Value& jsonActor) {
+				...
+			});
+	*/
+	class INSIGHT_API JsonStreamReader
+	{
+	public:
+		typedef std::function<void(const rapidjson::Value& Element)> ElementCallback;
+
+		// Returns false if the file could not be opened or is malformed. Elements
+		// parsed before an error is hit have already been passed to OnElement.
+		static bool ForEachArrayElement(const std::string& Filepath, const char* ArrayKey, const ElementCallback& OnElement);
+	};
+
+}
@@ -3,7 +3,9 @@
 #include "Geometry_Manager.h"
 
 #include "Insight/Rendering/Renderer.h"
+#include "Insight/Systems/Thread_Pool.h"
 #include "Insight/Runtime/APlayer_Character.h"
+#include "Insight/Runtime/ACamera.h"
 
 #include "Platform/Windows/DirectX_12/Direct3D12_Context.h"
 #include "Platform/Windows/DirectX_11/Geometry/D3D11_Geometry_Manager.h"
@@ -57,10 +59,66 @@ namespace Insight {
 
 	void GeometryManager::FlushModelCache()
 	{
+		// Assets still referenced outside the manager stay alive and cached, the rest
+		// remove themselves from the cache as they are destroyed.
 		s_Instance->m_Models.clear();
 	}
 
-	void GeometryManager::UnRegisterModel(StrongModelPtr Model)
+	void GeometryManager::CullMeshlets(const ACamera& Camera)
+	{
+		XMFLOAT4X4 ViewProjection;
+		XMStoreFloat4x4(&ViewProjection, XMMatrixMultiply(Camera.GetViewMatrix(), Camera.GetProjectionMatrix()));
+		// The camera may be parented to another actor, take the eye from the view matrix instead of its local transform.
+		XMFLOAT3 Eye;
+		XMStoreFloat3(&Eye, XMMatrixInverse(nullptr, Camera.GetViewMatrix()).r[3]);
+		const MeshletCuller::View View = MeshletCuller::MakeView(ViewProjection, ieFloat3(Eye.x, Eye.y, Eye.z));
+
+		for (const StrongModelPtr& Model : s_Instance->m_Models) {
+			if (!Model->GetCanBeRendered()) {
+				continue;
+			}
+			for (size_t i = 0; i < Model->GetNumChildMeshes(); ++i) {
+				Model->GetMeshAtIndex(static_cast<int>(i))->CullMeshlets(View);
+			}
+		}
+	}
+
+	StrongModelAssetPtr GeometryManager::FindModelAsset(const ModelAssetKey& Key)
+	{
+		auto Iter = s_Instance->m_ModelAssets.find(Key);
+		if (Iter == s_Instance->m_ModelAssets.end()) {
+			return nullptr;
+		}
+		// Released but not destroyed yet, a ScopedBulkRelease is holding on to it.
+		if (Iter->second->GetRefCount() == 0U) {
+			return nullptr;
+		}
+		return StrongModelAssetPtr(Iter->second);
+	}
+
+	StrongModelAssetPtr GeometryManager::AddModelAsset(const ModelAssetKey& Key, const shared_ptr<ImportedModel>& pImport)
+	{
+		if (!pImport) {
+			return nullptr;
+		}
+		StrongModelAssetPtr pAsset = MakeRef<const ModelAsset>(Key, *pImport);
+		s_Instance->m_ModelAssets[Key] = pAsset.Get();
+		return pAsset;
+	}
+
+	void GeometryManager::OnModelAssetDestroyed(WeakModelAssetPtr pAsset)
+	{
+		if (!s_Instance) {
+			return;
+		}
+		// A newer asset may have replaced this one under the same key while it was waiting to be destroyed.
+		auto Iter = s_Instance->m_ModelAssets.find(pAsset->GetKey());
+		if (Iter != s_Instance->m_ModelAssets.end() && Iter->second == pAsset) {
+			s_Instance->m_ModelAssets.erase(Iter);
+		}
+	}
+
+	void GeometryManager::UnRegisterModel(const StrongModelPtr& Model)
 	{
 		auto iter = std::find(s_Instance->m_Models.begin(), s_Instance->m_Models.end(), Model);
 
@@ -69,5 +127,56 @@ namespace Insight {
 		}
 	}
 
+	void GeometryManager::BeginImportBatch()
+	{
+		IE_CORE_ASSERT(!s_Instance->m_IsImportBatchOpen, "A model import batch is already open.");
+		s_Instance->m_IsImportBatchOpen = true;
+	}
+
+	void GeometryManager::EndImportBatch()
+	{
+		IE_CORE_ASSERT(s_Instance->m_IsImportBatchOpen, "Trying to end a model import batch that was never begun.");
+		Profiling::ScopedTimer timer("GeometryManager::EndImportBatch");
+
+		IE_CORE_TRACE("Finishing {0} model imports from {1} unique files.", s_Instance->m_PendingImports.size(), s_Instance->m_BatchImports.size());
+		s_Instance->m_BatchImports.clear();
+
+		for (PendingImport& Import : s_Instance->m_PendingImports) {
+			// The first model to finish an import uploads it, every later model with the same key finds it in the cache.
+			StrongModelAssetPtr pAsset = FindModelAsset(Import.Key);
+			if (!pAsset && Import.Result.valid()) {
+				pAsset = AddModelAsset(Import.Key, Import.Result.get());
+			}
+			Import.Result = std::shared_future<shared_ptr<ImportedModel>>();
+
+			if (!Import.Model->CreateFromAsset(Import.Path, pAsset, Import.pMaterial)) {
+				IE_CORE_ERROR("Failed to import model: {0}", Import.Path);
+			}
+			RegisterModel(Import.Model);
+		}
+		s_Instance->m_PendingImports.clear();
+		s_Instance->m_IsImportBatchOpen = false;
+	}
+
+	void GeometryManager::QueueModelImport(const StrongModelPtr& Model, const std::string& Path, Material* pMaterial, uint32_t AssetFlags)
+	{
+		IE_CORE_ASSERT(s_Instance->m_IsImportBatchOpen, "Model imports can only be queued while an import batch is open.");
+
+		PendingImport Import{ Model, Path, pMaterial, ModelAssetKey(AssetPath(Path), IE_MODEL_DEFAULT_IMPORT_FLAGS, AssetFlags) };
+
+		if (!FindModelAsset(Import.Key)) {
+			auto Iter = s_Instance->m_BatchImports.find(Import.Key);
+			if (Iter != s_Instance->m_BatchImports.end()) {
+				Import.Result = Iter->second;
+			}
+			else {
+				const uint32_t ImportFlags = Import.Key.ImportFlags;
+				Import.Result = ThreadPool::Submit([Path, ImportFlags, AssetFlags]() { return Model::Import(Path, ImportFlags, AssetFlags); }).share();
+				s_Instance->m_BatchImports.emplace(Import.Key, Import.Result);
+			}
+		}
+		s_Instance->m_PendingImports.push_back(std::move(Import));
+	}
+
 }
 
@@ -3,9 +3,12 @@
 #include <Insight/Core.h>
 
 #include "Insight/Rendering/Geometry/Model.h"
+#include "Insight/Systems/Asset_Path.h"
 
 namespace Insight {
 
+	class ACamera;
+
 	using namespace Microsoft::WRL;
 
 	class GeometryManager
@@ -31,17 +34,41 @@ namespace Insight {
 		// Gather all geometry in the scene and uplaod their constant buffers to the GPU.
 		// Should only be called once, before 'Render()'. Does not draw models.
 		static void GatherGeometry() { s_Instance->GatherGeometryImpl(); }
+		// Cull the meshlets of every renderable model against the camera. Call after the scene's
+		// world matrices are updated and before 'Render()'. Only the scene pass draws the culled ranges.
+		static void CullMeshlets(const ACamera& Camera);
 		// Reset incrementor for model geometry gather phase.
 		// See 'GatherGeometry()' for more information.
 		static void PostRender() { s_Instance->PostRenderImpl(); }
 		// UnRegister all model in the model cache. Usually used 
 		// when switching scenes.
 		static void FlushModelCache();
+
+		// Shared geometry of every model file currently in use, keyed by path, import and asset flags.
+		// Entries are weak, an asset is released along with the last model using it.
+		// Returns nullptr if no live model was loaded with this key. Main thread only.
+		static StrongModelAssetPtr FindModelAsset(const ModelAssetKey& Key);
+		// Upload an import and add it to the cache. The import's mesh data is moved into the
+		// asset and freed after upload unless the key retains it. Returns nullptr if 'pImport' is null.
+		static StrongModelAssetPtr AddModelAsset(const ModelAssetKey& Key, const shared_ptr<ImportedModel>& pImport);
+		// Drop a destroyed asset's cache entry, called from ModelAsset's destructor.
+		static void OnModelAssetDestroyed(WeakModelAssetPtr pAsset);
 		
 		// Register a model to be drawn in the geometry pass
-		static void RegisterModel(StrongModelPtr Model) { s_Instance->m_Models.push_back(Model); }
+		static void RegisterModel(const StrongModelPtr& Model) { s_Instance->m_Models.push_back(Model); }
 		// Unregister a model to not be drawn in the geometry pass
-		static void UnRegisterModel(StrongModelPtr Model);
+		static void UnRegisterModel(const StrongModelPtr& Model);
+
+		// While an import batch is open, 'QueueModelImport' reads model files on the thread
+		// pool instead of blocking. 'EndImportBatch' waits on them in the order they were
+		// queued, creates their GPU buffers and registers them, so the result does not
+		// depend on how many workers there are or which import finishes first. Every
+		// model in a batch that loads the same file shares a single import of it, and
+		// files already in the model cache are not imported at all.
+		static void BeginImportBatch();
+		static void EndImportBatch();
+		static bool IsImportBatchOpen() { return s_Instance->m_IsImportBatchOpen; }
+		static void QueueModelImport(const StrongModelPtr& Model, const std::string& Path, Material* pMaterial, uint32_t AssetFlags = IE_MODEL_DEFAULT_ASSET_FLAGS);
 
 	protected:
 		virtual bool InitImpl() = 0;
@@ -52,6 +79,21 @@ namespace Insight {
 	protected:
 		SceneModels m_Models;  
 
+	private:
+		struct PendingImport
+		{
+			StrongModelPtr Model;
+			std::string Path;
+			Material* pMaterial;
+			ModelAssetKey Key;
+			// Not valid if the asset was already cached when the import was queued.
+			std::shared_future<shared_ptr<ImportedModel>> Result;
+		};
+		std::vector<PendingImport> m_PendingImports;
+		std::unordered_map<ModelAssetKey, std::shared_future<shared_ptr<ImportedModel>>> m_BatchImports;
+		std::unordered_map<ModelAssetKey, WeakModelAssetPtr> m_ModelAssets;
+		bool m_IsImportBatchOpen = false;
+
 	private:
 		static GeometryManager* s_Instance;
 	};
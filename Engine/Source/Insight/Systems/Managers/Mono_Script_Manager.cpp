@@ -84,6 +84,8 @@ namespace Insight {
 
 	bool MonoScriptManager::Init()
 	{
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::Scripting);
+
 		const char* BuildConfig = MACRO_TO_STRING(IE_BUILD_CONFIG);
 		m_AssemblyDir = FileSystem::ProjectDirectory;
 		m_AssemblyDir += "/Bin/";
@@ -0,0 +1,36 @@
+#include <ie_pch.h>
+
+#include "Prefab_Manager.h"
+
+namespace Insight {
+
+	PrefabManager::PrefabManager()
+	{
+	}
+
+	PrefabManager::~PrefabManager()
+	{
+		FlushPrefabCache();
+	}
+
+	StrongPrefabPtr PrefabManager::LoadPrefab(const AssetPath& Path)
+	{
+		auto Iter = m_Prefabs.find(Path);
+		if (Iter != m_Prefabs.end()) {
+			return Iter->second;
+		}
+
+		StrongPrefabPtr pPrefab = MakeRef<Prefab>(Path);
+		if (!pPrefab->Load()) {
+			return StrongPrefabPtr();
+		}
+		m_Prefabs.emplace(Path, pPrefab);
+		return pPrefab;
+	}
+
+	void PrefabManager::FlushPrefabCache()
+	{
+		m_Prefabs.clear();
+	}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include "Insight/Runtime/Prefab.h"
+
+namespace Insight {
+
+	class INSIGHT_API PrefabManager
+	{
+	public:
+		PrefabManager();
+		~PrefabManager();
+
+		// Get a prefab, loading it the first time it is requested. Every instance in the
+		// scene shares the one template. Returns an empty handle if the prefab failed to load.
+		StrongPrefabPtr LoadPrefab(const AssetPath& Path);
+		// Release the cached templates. Instances still alive keep their prefab loaded.
+		void FlushPrefabCache();
+
+	private:
+		std::unordered_map<AssetPath, StrongPrefabPtr> m_Prefabs;
+	};
+
+}
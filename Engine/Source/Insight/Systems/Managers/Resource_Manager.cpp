@@ -16,6 +16,7 @@ namespace Insight {
 		//m_pGeometryManager = new GeometryManager();
 		m_pTextureManager = new TextureManager();
 		m_pMonoScriptManager = new MonoScriptManager();
+		m_pPrefabManager = new PrefabManager();
 	}
 
 	ResourceManager::~ResourceManager()
@@ -23,6 +24,7 @@ namespace Insight {
 		GeometryManager::Shutdown();
 		delete m_pTextureManager;
 		delete m_pMonoScriptManager;
+		delete m_pPrefabManager;
 	}
 
 	bool ResourceManager::Init()
@@ -43,13 +45,26 @@ namespace Insight {
 		return true;
 	}
 
+	bool ResourceManager::LoadResourcesFromCooked(const CookedSceneView& Scene)
+	{
+		return m_pTextureManager->LoadResourcesFromCooked(Scene);
+	}
+
+	void ResourceManager::WriteToCooked(CookedSceneBuilder& Builder) const
+	{
+		m_pTextureManager->WriteToCooked(Builder);
+	}
+
 	// Clears all resource caches for the currenly active scene.
 	// If used, make sure you are loading a new scene or immediatly 
 	// adding new resources AFTER this call
 	void ResourceManager::FlushAllResources()
 	{
+		ScopedBulkRelease BulkRelease;
+
 		GeometryManager::FlushModelCache();
 		m_pTextureManager->FlushTextureCache();
+		m_pPrefabManager->FlushPrefabCache();
 		//m_pMonoScriptManager->Cleanup();
 	}
 
@@ -4,6 +4,7 @@
 #include "Insight/Systems/Managers/Geometry_Manager.h"
 #include "Insight/Systems/Managers/Texture_Manager.h"
 #include "Insight/Systems/Managers/Mono_Script_Manager.h"
+#include "Insight/Systems/Managers/Prefab_Manager.h"
 
 namespace Insight {
 
@@ -15,16 +16,20 @@ namespace Insight {
 
 		bool Init();
 		virtual bool LoadResourcesFromJson(const rapidjson::Value& jsonResources);
+		bool LoadResourcesFromCooked(const CookedSceneView& Scene);
+		void WriteToCooked(CookedSceneBuilder& Builder) const;
 
 		inline static ResourceManager& Get() { return *s_Instance; }
 		void FlushAllResources();
 
 		TextureManager& GetTextureManager() { return *m_pTextureManager; }
 		MonoScriptManager& GetMonoScriptManager() { return *m_pMonoScriptManager; }
+		PrefabManager& GetPrefabManager() { return *m_pPrefabManager; }
 
 	private:
 		TextureManager* m_pTextureManager = nullptr;
 		MonoScriptManager* m_pMonoScriptManager = nullptr;
+		PrefabManager* m_pPrefabManager = nullptr;
 	private:
 		static ResourceManager* s_Instance;
 	};
@@ -4,6 +4,7 @@
 #include "Insight/Systems/File_System.h"
 #include "Insight/Utilities/String_Helper.h"
 #include "Insight/Rendering/Renderer.h"
+#include "Insight/Systems/Cooked_Scene.h"
 
 #include "Platform/Windows/DirectX_12/Direct3D12_Context.h"
 #include "Platform/Windows/DirectX_12/ie_D3D12_Texture.h"
@@ -27,19 +28,19 @@ namespace Insight {
 	void TextureManager::FlushTextureCache()
 	{
 		for (StrongTexturePtr& tex : m_AlbedoTextures) {
-			tex.reset();
+			tex.Reset();
 		}
 		for (StrongTexturePtr& tex : m_NormalTextures) {
-			tex.reset();
+			tex.Reset();
 		}
 		for (StrongTexturePtr& tex : m_MetallicTextures) {
-			tex.reset();
+			tex.Reset();
 		}
 		for (StrongTexturePtr& tex : m_RoughnessTextures) {
-			tex.reset();
+			tex.Reset();
 		}
 		for (StrongTexturePtr& tex : m_AOTextures) {
-			tex.reset();
+			tex.Reset();
 		}
 	}
 
@@ -52,38 +53,87 @@ namespace Insight {
 	bool TextureManager::LoadResourcesFromJson(const rapidjson::Value& JsonTextures)
 	{
 		for (rapidjson::SizeType i = 0; i < JsonTextures.Size(); i++) {
-			std::string Name, Filepath;
-			int Type, ID;
-			bool GenMipMaps;
-			json::get_int(JsonTextures[i], "ID", ID);
-			json::get_int(JsonTextures[i], "Type", Type);
-			json::get_string(JsonTextures[i], "Name", Name);
-			json::get_string(JsonTextures[i], "Filepath", Filepath);
-			json::get_bool(JsonTextures[i], "GenerateMipMaps", GenMipMaps);
+			LoadTextureFromJson(JsonTextures[i]);
+		}
+
+		return true;
+	}
+
+	void TextureManager::LoadTextureFromJson(const rapidjson::Value& JsonTexture)
+	{
+		std::string Name, Filepath;
+		int Type, ID;
+		bool GenMipMaps;
+		json::get_int(JsonTexture, "ID", ID);
+		json::get_int(JsonTexture, "Type", Type);
+		json::get_string(JsonTexture, "Name", Name);
+		json::get_string(JsonTexture, "Filepath", Filepath);
+		json::get_bool(JsonTexture, "GenerateMipMaps", GenMipMaps);
+
+		Texture::IE_TEXTURE_INFO TexInfo = {};
+		TexInfo.DisplayName = Name;
+		TexInfo.Id = ID;
+		TexInfo.Filepath = Filepath;
+		TexInfo.GenerateMipMaps = GenMipMaps;
+		TexInfo.Type = (Texture::eTextureType)Type;
+
+		RegisterTextureByType(TexInfo);
+
+		m_HighestTextureId = ((int)m_HighestTextureId < ID) ? ID : m_HighestTextureId;
+	}
+
+	bool TextureManager::LoadResourcesFromCooked(const CookedSceneView& Scene)
+	{
+		for (uint32_t i = 0; i < Scene.GetNumTextures(); i++) {
+			const CookedTexture& Cooked = Scene.GetTexture(i);
 
 			Texture::IE_TEXTURE_INFO TexInfo = {};
-			TexInfo.DisplayName = Name;
-			TexInfo.Id = ID;
-			TexInfo.Filepath = StringHelper::StringToWide(FileSystem::GetProjectRelativeAssetDirectory(Filepath));
-			TexInfo.GenerateMipMaps = GenMipMaps;
-			TexInfo.Type = (Texture::eTextureType)Type;
-			
+			TexInfo.DisplayName = Scene.GetString(Cooked.Name);
+			TexInfo.Id = Cooked.Id;
+			TexInfo.Filepath = Scene.GetString(Cooked.Filepath);
+			TexInfo.GenerateMipMaps = Cooked.GenerateMipMaps != 0U;
+			TexInfo.Type = (Texture::eTextureType)Cooked.Type;
+
 			RegisterTextureByType(TexInfo);
 
-			m_HighestTextureId = ((int)m_HighestTextureId < ID) ? ID : m_HighestTextureId;
+			m_HighestTextureId = ((int)m_HighestTextureId < Cooked.Id) ? Cooked.Id : m_HighestTextureId;
 		}
 
 		return true;
 	}
 
-	StrongTexturePtr TextureManager::GetTextureByID(Texture::ID textureID, Texture::eTextureType textreType)
+	void TextureManager::WriteToCooked(CookedSceneBuilder& Builder) const
+	{
+		auto WriteTextures = [&Builder](const std::vector<StrongTexturePtr>& Textures) {
+			for (const StrongTexturePtr& tex : Textures) {
+				if (!tex) {
+					continue;
+				}
+				const Texture::IE_TEXTURE_INFO& TexInfo = tex->GetTextureInfo();
+				CookedTexture Cooked = {};
+				Cooked.Id = TexInfo.Id;
+				Cooked.Type = (uint32_t)TexInfo.Type;
+				Cooked.Name = Builder.AddString(TexInfo.DisplayName.c_str());
+				Cooked.Filepath = Builder.AddString(TexInfo.Filepath.GetView());
+				Cooked.GenerateMipMaps = TexInfo.GenerateMipMaps ? 1U : 0U;
+				Builder.AddTexture(Cooked);
+			}
+		};
+		WriteTextures(m_AlbedoTextures);
+		WriteTextures(m_NormalTextures);
+		WriteTextures(m_RoughnessTextures);
+		WriteTextures(m_MetallicTextures);
+		WriteTextures(m_AOTextures);
+	}
+
+	Texture* TextureManager::GetTextureByID(Texture::ID textureID, Texture::eTextureType textreType)
 	{
 		switch (textreType) {
 		case Texture::eTextureType::ALBEDO:
 		{
 			for (UINT i = 0; i < m_AlbedoTextures.size(); i++) {
 				if (textureID == m_AlbedoTextures[i]->GetTextureInfo().Id) {
-					return m_AlbedoTextures[i];
+					return m_AlbedoTextures[i].Get();
 				}
 			}
 			break;
@@ -93,7 +143,7 @@ namespace Insight {
 			for (UINT i = 0; i < m_NormalTextures.size(); i++) {
 
 				if (textureID == m_NormalTextures[i]->GetTextureInfo().Id) {
-					return m_NormalTextures[i];
+					return m_NormalTextures[i].Get();
 				}
 			}
 			break;
@@ -103,7 +153,7 @@ namespace Insight {
 			for (UINT i = 0; i < m_RoughnessTextures.size(); i++) {
 
 				if (textureID == m_RoughnessTextures[i]->GetTextureInfo().Id) {
-					return m_RoughnessTextures[i];
+					return m_RoughnessTextures[i].Get();
 				}
 			}
 			break;
@@ -113,7 +163,7 @@ namespace Insight {
 			for (UINT i = 0; i < m_MetallicTextures.size(); i++) {
 
 				if (textureID == m_MetallicTextures[i]->GetTextureInfo().Id) {
-					return m_MetallicTextures[i];
+					return m_MetallicTextures[i].Get();
 				}
 			}
 			break;
@@ -123,7 +173,7 @@ namespace Insight {
 			for (UINT i = 0; i < m_AOTextures.size(); i++) {
 
 				if (textureID == m_AOTextures[i]->GetTextureInfo().Id) {
-					return m_AOTextures[i];
+					return m_AOTextures[i].Get();
 				}
 			}
 			break;
@@ -140,6 +190,8 @@ namespace Insight {
 	
 	bool TextureManager::LoadDefaultTextures()
 	{
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::Textures);
+
 		Texture::IE_TEXTURE_INFO TexInfo = {};
 		TexInfo.Id = -1;
 		TexInfo.GenerateMipMaps = true;
@@ -147,33 +199,33 @@ namespace Insight {
 		// Albedo
 		TexInfo.DisplayName = "Default_Albedo";
 		TexInfo.Type = Texture::eTextureType::ALBEDO;
-		TexInfo.Filepath = StringHelper::StringToWide("Assets/Textures/Default_Object/Default_Albedo.png");
+		TexInfo.Filepath = AssetPath("Assets/Textures/Default_Object/Default_Albedo.png", AssetPath::ROOT_ENGINE);
 		// Normal
 		TexInfo.DisplayName = "Default_Normal";
 		TexInfo.Type = Texture::eTextureType::NORMAL;
-		TexInfo.Filepath = StringHelper::StringToWide("Assets/Textures/Default_Object/Default_Normal.png");
+		TexInfo.Filepath = AssetPath("Assets/Textures/Default_Object/Default_Normal.png", AssetPath::ROOT_ENGINE);
 		// Metallic
 		TexInfo.DisplayName = "Default_Metallic";
 		TexInfo.Type = Texture::eTextureType::METALLIC;
-		TexInfo.Filepath = StringHelper::StringToWide("Assets/Textures/Default_Object/Default_Metallic.png");
+		TexInfo.Filepath = AssetPath("Assets/Textures/Default_Object/Default_Metallic.png", AssetPath::ROOT_ENGINE);
 		// Roughness
 		TexInfo.DisplayName = "Default_Roughness";
 		TexInfo.Type = Texture::eTextureType::ROUGHNESS;
-		TexInfo.Filepath = StringHelper::StringToWide("Assets/Textures/Default_Object/Default_RoughAO.png");
+		TexInfo.Filepath = AssetPath("Assets/Textures/Default_Object/Default_RoughAO.png", AssetPath::ROOT_ENGINE);
 		// AO
 		TexInfo.DisplayName = "Default_AO";
 		TexInfo.Type = Texture::eTextureType::AO;
-		TexInfo.Filepath = StringHelper::StringToWide("Assets/Textures/Default_Object/Default_RoughAO.png");
+		TexInfo.Filepath = AssetPath("Assets/Textures/Default_Object/Default_RoughAO.png", AssetPath::ROOT_ENGINE);
 
 		switch (Renderer::GetAPI())
 		{
 		case Renderer::eTargetRenderAPI::D3D_11:
 		{
-			m_DefaultAlbedoTexture = make_shared<ieD3D11Texture>(TexInfo);
-			m_DefaultNormalTexture = make_shared<ieD3D11Texture>(TexInfo);
-			m_DefaultMetallicTexture = make_shared<ieD3D11Texture>(TexInfo);
-			m_DefaultRoughnessTexture = make_shared<ieD3D11Texture>(TexInfo);
-			m_DefaultAOTexture = make_shared<ieD3D11Texture>(TexInfo);
+			m_DefaultAlbedoTexture = MakeRef<ieD3D11Texture>(TexInfo);
+			m_DefaultNormalTexture = MakeRef<ieD3D11Texture>(TexInfo);
+			m_DefaultMetallicTexture = MakeRef<ieD3D11Texture>(TexInfo);
+			m_DefaultRoughnessTexture = MakeRef<ieD3D11Texture>(TexInfo);
+			m_DefaultAOTexture = MakeRef<ieD3D11Texture>(TexInfo);
 			break;
 		}
 		case Renderer::eTargetRenderAPI::D3D_12:
@@ -181,11 +233,11 @@ namespace Insight {
 			Direct3D12Context* graphicsContext = reinterpret_cast<Direct3D12Context*>(&Renderer::Get());
 			CDescriptorHeapWrapper& cbvSrvHeapStart = graphicsContext->GetCBVSRVDescriptorHeap();
 
-			m_DefaultAlbedoTexture = make_shared<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
-			m_DefaultNormalTexture = make_shared<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
-			m_DefaultMetallicTexture = make_shared<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
-			m_DefaultRoughnessTexture = make_shared<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
-			m_DefaultAOTexture = make_shared<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
+			m_DefaultAlbedoTexture = MakeRef<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
+			m_DefaultNormalTexture = MakeRef<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
+			m_DefaultMetallicTexture = MakeRef<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
+			m_DefaultRoughnessTexture = MakeRef<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
+			m_DefaultAOTexture = MakeRef<ieD3D12Texture>(TexInfo, cbvSrvHeapStart);
 			break;
 		}
 		default:
@@ -199,6 +251,7 @@ namespace Insight {
 
 	void TextureManager::RegisterTextureByType(const Texture::IE_TEXTURE_INFO& texInfo)
 	{
+		ScopedMemoryCategory MemoryScope(eMemoryCategory::Textures);
 
 		switch (Renderer::GetAPI())
 		{
@@ -207,32 +260,32 @@ namespace Insight {
 			switch (texInfo.Type) {
 			case Texture::eTextureType::ALBEDO:
 			{
-				m_AlbedoTextures.push_back(make_shared<ieD3D11Texture>(texInfo));
+				m_AlbedoTextures.push_back(MakeRef<ieD3D11Texture>(texInfo));
 				break;
 			}
 			case Texture::eTextureType::NORMAL:
 			{
-				m_NormalTextures.push_back(make_shared<ieD3D11Texture>(texInfo));
+				m_NormalTextures.push_back(MakeRef<ieD3D11Texture>(texInfo));
 				break;
 			}
 			case Texture::eTextureType::ROUGHNESS:
 			{
-				m_RoughnessTextures.push_back(make_shared<ieD3D11Texture>(texInfo));
+				m_RoughnessTextures.push_back(MakeRef<ieD3D11Texture>(texInfo));
 				break;
 			}
 			case Texture::eTextureType::METALLIC:
 			{
-				m_MetallicTextures.push_back(make_shared<ieD3D11Texture>(texInfo));
+				m_MetallicTextures.push_back(MakeRef<ieD3D11Texture>(texInfo));
 				break;
 			}
 			case Texture::eTextureType::AO:
 			{
-				m_AOTextures.push_back(make_shared<ieD3D11Texture>(texInfo));
+				m_AOTextures.push_back(MakeRef<ieD3D11Texture>(texInfo));
 				break;
 			}
 			default:
 			{
-				IE_CORE_WARN("Failed to identify texture to create with name of {0} - ID({1})", texInfo.DisplayName, texInfo.Id);
+				IE_CORE_WARN("Failed to identify texture to create with name of {0} - ID({1})", texInfo.DisplayName.c_str(), texInfo.Id);
 				break;
 			}
 			}
@@ -246,32 +299,32 @@ namespace Insight {
 			switch (texInfo.Type) {
 			case Texture::eTextureType::ALBEDO:
 			{
-				m_AlbedoTextures.push_back(make_shared<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
+				m_AlbedoTextures.push_back(MakeRef<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
 				break;
 			}
 			case Texture::eTextureType::NORMAL:
 			{
-				m_NormalTextures.push_back(make_shared<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
+				m_NormalTextures.push_back(MakeRef<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
 				break;
 			}
 			case Texture::eTextureType::ROUGHNESS:
 			{
-				m_RoughnessTextures.push_back(make_shared<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
+				m_RoughnessTextures.push_back(MakeRef<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
 				break;
 			}
 			case Texture::eTextureType::METALLIC:
 			{
-				m_MetallicTextures.push_back(make_shared<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
+				m_MetallicTextures.push_back(MakeRef<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
 				break;
 			}
 			case Texture::eTextureType::AO:
 			{
-				m_AOTextures.push_back(make_shared<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
+				m_AOTextures.push_back(MakeRef<ieD3D12Texture>(texInfo, cbvSrvHeapStart));
 				break;
 			}
 			default:
 			{
-				IE_CORE_WARN("Failed to identify texture to create with name of {0} - ID({1})", texInfo.DisplayName, texInfo.Id);
+				IE_CORE_WARN("Failed to identify texture to create with name of {0} - ID({1})", texInfo.DisplayName.c_str(), texInfo.Id);
 				break;
 			}
 			}
@@ -7,6 +7,9 @@
 
 namespace Insight {
 
+	class CookedSceneView;
+	class CookedSceneBuilder;
+
 	class INSIGHT_API TextureManager
 	{
 	public:
@@ -18,13 +21,18 @@ namespace Insight {
 
 		void FlushTextureCache();
 		bool LoadResourcesFromJson(const rapidjson::Value& jsonTextures);
-		StrongTexturePtr GetTextureByID(Texture::ID textureID, Texture::eTextureType textreType);
+		// Register a single texture entry from the "Textures" array in Resources.json.
+		void LoadTextureFromJson(const rapidjson::Value& jsonTexture);
+		bool LoadResourcesFromCooked(const CookedSceneView& Scene);
+		void WriteToCooked(CookedSceneBuilder& Builder) const;
+		// Returns a non-owning pointer to the texture. Wrap it in a 'StrongTexturePtr' to hold on to it.
+		Texture* GetTextureByID(Texture::ID textureID, Texture::eTextureType textreType);
 		
-		StrongTexturePtr GetDefaultAlbedoTexture() { return m_AlbedoTextures[0];/*return m_DefaultAlbedoTexture;*/ }
-		StrongTexturePtr GetDefaultNormalTexture() { return m_NormalTextures[0];/*return m_DefaultNormalTexture;*/ }
-		StrongTexturePtr GetDefaultMetallicTexture() { return m_MetallicTextures[0];/*return m_DefaultMetallicTexture;*/ }
-		StrongTexturePtr GetDefaultRoughnessTexture() { return m_RoughnessTextures[0];/*return m_DefaultRoughnessTexture;*/ }
-		StrongTexturePtr GetDefaultAOTexture() { return m_AOTextures[0];/*return m_DefaultAOTexture;*/ }
+		const StrongTexturePtr& GetDefaultAlbedoTexture() { return m_AlbedoTextures[0];/*return m_DefaultAlbedoTexture;*/ }
+		const StrongTexturePtr& GetDefaultNormalTexture() { return m_NormalTextures[0];/*return m_DefaultNormalTexture;*/ }
+		const StrongTexturePtr& GetDefaultMetallicTexture() { return m_MetallicTextures[0];/*return m_DefaultMetallicTexture;*/ }
+		const StrongTexturePtr& GetDefaultRoughnessTexture() { return m_RoughnessTextures[0];/*return m_DefaultRoughnessTexture;*/ }
+		const StrongTexturePtr& GetDefaultAOTexture() { return m_AOTextures[0];/*return m_DefaultAOTexture;*/ }
 
 	private:
 		bool LoadDefaultTextures();
@@ -0,0 +1,64 @@
+#include <ie_pch.h>
+
+#include "Mapped_File.h"
+
+#include "Insight/Utilities/String_Helper.h"
+
+namespace Insight {
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	bool MappedFile::Open(const std::string& Filepath)
+	{
+		Close();
+
+		m_hFile = CreateFileW(StringHelper::StringToWide(Filepath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_hFile == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER FileSize;
+		if (!GetFileSizeEx(m_hFile, &FileSize) || FileSize.QuadPart == 0) {
+			IE_CORE_ERROR("Failed to map empty or unreadable file: {0}", Filepath);
+			Close();
+			return false;
+		}
+
+		m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m_hMapping) {
+			IE_CORE_ERROR("Failed to create file mapping for: {0}", Filepath);
+			Close();
+			return false;
+		}
+
+		m_pData = static_cast<const uint8_t*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+		if (!m_pData) {
+			IE_CORE_ERROR("Failed to map view of file: {0}", Filepath);
+			Close();
+			return false;
+		}
+		m_Size = static_cast<size_t>(FileSize.QuadPart);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_pData) {
+			UnmapViewOfFile(m_pData);
+			m_pData = nullptr;
+		}
+		if (m_hMapping) {
+			CloseHandle(m_hMapping);
+			m_hMapping = nullptr;
+		}
+		if (m_hFile != INVALID_HANDLE_VALUE) {
+			CloseHandle(m_hFile);
+			m_hFile = INVALID_HANDLE_VALUE;
+		}
+		m_Size = 0U;
+	}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+namespace Insight {
+
+	// Read-only memory mapping of a file. The view stays valid until Close is called
+	// or the object is destroyed.
+	class INSIGHT_API MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator = (const MappedFile&) = delete;
+
+		bool Open(const std::string& Filepath);
+		void Close();
+
+		inline bool IsOpen() const { return m_pData != nullptr; }
+		inline const uint8_t* GetData() const { return m_pData; }
+		inline size_t GetSize() const { return m_Size; }
+
+	private:
+		HANDLE m_hFile = INVALID_HANDLE_VALUE;
+		HANDLE m_hMapping = nullptr;
+		const uint8_t* m_pData = nullptr;
+		size_t m_Size = 0U;
+	};
+
+}
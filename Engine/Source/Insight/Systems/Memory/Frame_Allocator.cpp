@@ -0,0 +1,157 @@
+#include <ie_pch.h>
+
+#include "Frame_Allocator.h"
+#include "Memory_Tracker.h"
+
+#include <new>
+
+// Frames the application is given to settle (scene load, first use of
+// every arena) before heap allocations are counted against it.
+#define IE_HEAP_TRACKING_WARM_UP_FRAMES 120U
+
+namespace Insight {
+
+	std::atomic<uint64_t> FrameAllocator::s_FrameIndex(0U);
+	uint64_t FrameAllocator::s_LastFrameHeapAllocations = 0U;
+	uint64_t FrameAllocator::s_FrameStartHeapAllocations = 0U;
+	uint64_t FrameAllocator::s_NumSteadyStateFramesWithHeapAllocations = 0U;
+
+	struct ThreadFrameArenas
+	{
+		FrameArena Arenas[IE_FRAME_ARENA_BUFFER_COUNT];
+		uint64_t ArenaFrame[IE_FRAME_ARENA_BUFFER_COUNT] = {};
+	};
+	static thread_local ThreadFrameArenas s_ThreadArenas;
+
+
+	// -------------
+	// Frame Arena
+	// -------------
+
+	FrameArena::~FrameArena()
+	{
+		FreeBlocks();
+	}
+
+	void* FrameArena::Allocate(size_t Size, size_t Alignment)
+	{
+		IE_CORE_ASSERT((Alignment & (Alignment - 1)) == 0, "Frame arena alignment must be a power of two.");
+
+		if (m_pCurrent) {
+			uintptr_t Base = reinterpret_cast<uintptr_t>(m_pCurrent->GetData());
+			uintptr_t Aligned = (Base + m_pCurrent->Offset + (Alignment - 1)) & ~(uintptr_t)(Alignment - 1);
+			size_t NewOffset = (Aligned - Base) + Size;
+			if (NewOffset <= m_pCurrent->Size) {
+				m_BytesUsed += NewOffset - m_pCurrent->Offset;
+				m_pCurrent->Offset = NewOffset;
+				return reinterpret_cast<void*>(Aligned);
+			}
+		}
+
+		// Out of room, chain a new block big enough for this request.
+		Block* pBlock = AllocateBlock(Size + Alignment);
+		if (m_pCurrent) {
+			m_pCurrent->pNext = pBlock;
+		}
+		else {
+			m_pHead = pBlock;
+		}
+		m_pCurrent = pBlock;
+		return Allocate(Size, Alignment);
+	}
+
+	void FrameArena::Reset()
+	{
+		m_BytesUsed = 0U;
+
+		// The last frame spilled into more than one block. Replace the chain
+		// with a single block so the next frame stays off the heap.
+		if (m_pHead && m_pHead->pNext) {
+			size_t Required = m_Capacity;
+			FreeBlocks();
+			m_pHead = m_pCurrent = AllocateBlock(Required);
+			return;
+		}
+
+		if (m_pHead) {
+			m_pHead->Offset = 0U;
+		}
+		m_pCurrent = m_pHead;
+	}
+
+	FrameArena::Block* FrameArena::AllocateBlock(size_t MinSize)
+	{
+		size_t BlockSize = (MinSize > IE_FRAME_ARENA_DEFAULT_BLOCK_SIZE) ? MinSize : IE_FRAME_ARENA_DEFAULT_BLOCK_SIZE;
+		Block* pBlock = static_cast<Block*>(std::malloc(sizeof(Block) + BlockSize));
+		if (!pBlock) {
+			throw std::bad_alloc();
+		}
+		pBlock->pNext = nullptr;
+		pBlock->Size = BlockSize;
+		pBlock->Offset = 0U;
+		m_Capacity += BlockSize;
+		MemoryTracker::RecordAllocation(eMemoryCategory::FrameArena, BlockSize);
+		return pBlock;
+	}
+
+	void FrameArena::FreeBlocks()
+	{
+		Block* pBlock = m_pHead;
+		while (pBlock) {
+			Block* pNext = pBlock->pNext;
+			MemoryTracker::RecordFree(eMemoryCategory::FrameArena, pBlock->Size);
+			std::free(pBlock);
+			pBlock = pNext;
+		}
+		m_pHead = m_pCurrent = nullptr;
+		m_Capacity = 0U;
+	}
+
+
+	// -----------------
+	// Frame Allocator
+	// -----------------
+
+	void* FrameAllocator::Allocate(size_t Size, size_t Alignment)
+	{
+		const uint64_t Frame = s_FrameIndex.load(std::memory_order_acquire);
+		const uint32_t Slot = static_cast<uint32_t>(Frame % IE_FRAME_ARENA_BUFFER_COUNT);
+
+		// First allocation from this slot since it was last used, rewind it.
+		if (s_ThreadArenas.ArenaFrame[Slot] != Frame) {
+			s_ThreadArenas.Arenas[Slot].Reset();
+			s_ThreadArenas.ArenaFrame[Slot] = Frame;
+		}
+		return s_ThreadArenas.Arenas[Slot].Allocate(Size, Alignment);
+	}
+
+	void FrameAllocator::EndFrame()
+	{
+		const uint64_t Frame = s_FrameIndex.fetch_add(1, std::memory_order_acq_rel);
+
+		const uint64_t HeapAllocations = GetTotalHeapAllocationCount();
+		s_LastFrameHeapAllocations = HeapAllocations - s_FrameStartHeapAllocations;
+		s_FrameStartHeapAllocations = HeapAllocations;
+
+		if (Frame > IE_HEAP_TRACKING_WARM_UP_FRAMES && s_LastFrameHeapAllocations > 0U) {
+			s_NumSteadyStateFramesWithHeapAllocations++;
+#if defined IE_TRACK_HEAP_ALLOCATIONS
+			// The counter is only live here. Report the first offending frame and then every
+			// power of two after it so a leak every frame is still visible without flooding the log.
+			const uint64_t NumFrames = s_NumSteadyStateFramesWithHeapAllocations;
+			if ((NumFrames & (NumFrames - 1U)) == 0U) {
+				IE_CORE_ERROR("Frame Allocator: Frame {0} made {1} heap allocations past the warm-up period ({2} steady-state frames have allocated so far). Use the frame arena for per-frame temporaries.",
+					Frame, s_LastFrameHeapAllocations, NumFrames);
+				// Don't count the log's own allocations against the next frame.
+				s_FrameStartHeapAllocations = GetTotalHeapAllocationCount();
+			}
+#endif
+		}
+	}
+
+	uint64_t FrameAllocator::GetTotalHeapAllocationCount()
+	{
+		return MemoryTracker::GetTotalHeapAllocationCount();
+	}
+
+}
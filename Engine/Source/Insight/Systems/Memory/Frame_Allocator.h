@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <atomic>
+
+/*
+	Per-frame linear allocator for transient data.
+
+	Every thread owns IE_FRAME_ARENA_BUFFER_COUNT arenas. An allocation is bumped out of
+	the arena belonging to the current frame and is never freed individually, the whole
+	arena is rewound the next time that frame slot comes around. Memory handed out during
+	frame N therefore stays valid until frame N + IE_FRAME_ARENA_BUFFER_COUNT - 1, which
+	is long enough for the GPU or a worker thread to consume it.
+
+	Example usage:
+		FrameVector<ieFloat3> Corners;					// STL container backed by the frame arena.
+		BYTE* pData = FrameAllocator::AllocateArray<BYTE>(Size);	// Raw transient buffer.
+*/
+
+#define IE_FRAME_ARENA_BUFFER_COUNT 3U
+#define IE_FRAME_ARENA_DEFAULT_BLOCK_SIZE (1024U * 1024U)
+
+namespace Insight {
+
+	// Bump allocator over a chain of memory blocks. When the active block runs out a new
+	// block is chained on. On reset the chain is coalesced into a single block large enough
+	// for the previous frame, so a steady-state frame never has to touch the heap.
+	class INSIGHT_API FrameArena
+	{
+	public:
+		FrameArena() = default;
+		~FrameArena();
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator = (const FrameArena&) = delete;
+
+		void* Allocate(size_t Size, size_t Alignment);
+		void Reset();
+
+		inline size_t GetBytesUsed() const { return m_BytesUsed; }
+		inline size_t GetCapacity() const { return m_Capacity; }
+
+	private:
+		struct Block
+		{
+			Block* pNext;
+			size_t Size;
+			size_t Offset;
+			// Allocations follow the header.
+			inline uint8_t* GetData() { return reinterpret_cast<uint8_t*>(this + 1); }
+		};
+
+		Block* AllocateBlock(size_t MinSize);
+		void FreeBlocks();
+
+	private:
+		Block* m_pHead = nullptr;
+		Block* m_pCurrent = nullptr;
+		size_t m_BytesUsed = 0U;
+		size_t m_Capacity = 0U;
+	};
+
+	class INSIGHT_API FrameAllocator
+	{
+	public:
+		// Allocate transient memory from the calling thread's arena for the current frame.
+		static void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+		template <typename T>
+		static inline T* AllocateArray(size_t Count)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+		}
+
+		// Advance to the next frame. Arenas are rewound lazily the first time a thread
+		// allocates from them in the new frame. Should be called once at the end of every frame.
+		static void EndFrame();
+
+		inline static uint64_t GetFrameIndex() { return s_FrameIndex.load(std::memory_order_acquire); }
+
+		// Number of general-heap allocations made by any thread during the last full frame.
+		inline static uint64_t GetLastFrameHeapAllocationCount() { return s_LastFrameHeapAllocations; }
+		// Number of frames past the warm-up period that still allocated from the general heap.
+		inline static uint64_t GetNumSteadyStateFramesWithHeapAllocations() { return s_NumSteadyStateFramesWithHeapAllocations; }
+		// Total number of general-heap allocations since the application started.
+		static uint64_t GetTotalHeapAllocationCount();
+
+	private:
+		static std::atomic<uint64_t> s_FrameIndex;
+		static uint64_t s_LastFrameHeapAllocations;
+		static uint64_t s_FrameStartHeapAllocations;
+		static uint64_t s_NumSteadyStateFramesWithHeapAllocations;
+	};
+
+	// STL allocator adaptor for the frame arena. Deallocation is a no-op, memory is
+	// reclaimed when the arena is rewound. Containers using it must not outlive the
+	// frame buffering window.
+	template <typename T>
+	class TFrameAllocator
+	{
+	public:
+		typedef T value_type;
+
+		TFrameAllocator() noexcept = default;
+		template <typename U>
+		TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+		inline T* allocate(size_t Count) { return FrameAllocator::AllocateArray<T>(Count); }
+		inline void deallocate(T*, size_t) noexcept {}
+
+		template <typename U> inline bool operator == (const TFrameAllocator<U>&) const noexcept { return true; }
+		template <typename U> inline bool operator != (const TFrameAllocator<U>&) const noexcept { return false; }
+	};
+
+	template <typename T>
+	using FrameVector = std::vector<T, TFrameAllocator<T>>;
+	using FrameString = std::basic_string<char, std::char_traits<char>, TFrameAllocator<char>>;
+
+}
@@ -0,0 +1,272 @@
+#include <ie_pch.h>
+
+#include "Memory_Tracker.h"
+
+#include "Insight/Systems/File_System.h"
+#include "imgui.h"
+
+#include <atomic>
+#include <new>
+
+namespace Insight {
+
+	struct CategoryCounters
+	{
+		std::atomic<int64_t> LiveBytes{ 0 };
+		std::atomic<int64_t> PeakBytes{ 0 };
+		std::atomic<int64_t> LiveCount{ 0 };
+		std::atomic<int64_t> FrameAllocations{ 0 };
+		std::atomic<int64_t> FrameBytes{ 0 };
+		std::atomic<int64_t> BudgetBytes{ 0 };
+
+		// Latched at the end of each frame, only touched by the main thread.
+		int64_t LastFrameAllocations = 0;
+		int64_t LastFrameBytes = 0;
+		bool OverBudget = false;
+	};
+
+	// Constant initialized so allocations made during static initialization can be counted.
+	static CategoryCounters s_Counters[(size_t)eMemoryCategory::Count];
+	static std::atomic<uint64_t> s_HeapAllocationCount(0U);
+	static thread_local eMemoryCategory s_CurrentCategory = eMemoryCategory::General;
+
+	static const char* s_CategoryNames[] =
+	{
+		"General",
+		"Scene Graph",
+		"Geometry",
+		"Textures",
+		"Textures (GPU)",
+		"Scripting",
+		"Json",
+		"Frame Arena",
+	};
+	static_assert(_countof(s_CategoryNames) == (size_t)eMemoryCategory::Count, "Every memory category needs a name.");
+
+	void MemoryTracker::RecordAllocation(eMemoryCategory Category, size_t Bytes)
+	{
+		CategoryCounters& Counters = s_Counters[(size_t)Category];
+		const int64_t Live = Counters.LiveBytes.fetch_add((int64_t)Bytes, std::memory_order_relaxed) + (int64_t)Bytes;
+		Counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+		Counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+		Counters.FrameBytes.fetch_add((int64_t)Bytes, std::memory_order_relaxed);
+
+		int64_t Peak = Counters.PeakBytes.load(std::memory_order_relaxed);
+		while (Live > Peak && !Counters.PeakBytes.compare_exchange_weak(Peak, Live, std::memory_order_relaxed)) {}
+	}
+
+	void MemoryTracker::RecordFree(eMemoryCategory Category, size_t Bytes)
+	{
+		CategoryCounters& Counters = s_Counters[(size_t)Category];
+		Counters.LiveBytes.fetch_sub((int64_t)Bytes, std::memory_order_relaxed);
+		Counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	eMemoryCategory MemoryTracker::GetCurrentCategory()
+	{
+		return s_CurrentCategory;
+	}
+
+	eMemoryCategory MemoryTracker::SetCurrentCategory(eMemoryCategory Category)
+	{
+		eMemoryCategory Previous = s_CurrentCategory;
+		s_CurrentCategory = Category;
+		return Previous;
+	}
+
+	void MemoryTracker::SetBudget(eMemoryCategory Category, size_t Bytes)
+	{
+		s_Counters[(size_t)Category].BudgetBytes.store((int64_t)Bytes, std::memory_order_relaxed);
+	}
+
+	void MemoryTracker::EndFrame()
+	{
+		for (size_t i = 0; i < (size_t)eMemoryCategory::Count; ++i) {
+			CategoryCounters& Counters = s_Counters[i];
+			Counters.LastFrameAllocations = Counters.FrameAllocations.exchange(0, std::memory_order_relaxed);
+			Counters.LastFrameBytes = Counters.FrameBytes.exchange(0, std::memory_order_relaxed);
+
+			// Only warn when a category crosses its budget, not every frame it stays over.
+			const int64_t Budget = Counters.BudgetBytes.load(std::memory_order_relaxed);
+			const int64_t Live = Counters.LiveBytes.load(std::memory_order_relaxed);
+			const bool OverBudget = Budget > 0 && Live > Budget;
+			if (OverBudget && !Counters.OverBudget) {
+				IE_CORE_WARN("Memory category \"{0}\" is over budget: {1} KB used of {2} KB.", s_CategoryNames[i], Live / 1024, Budget / 1024);
+			}
+			Counters.OverBudget = OverBudget;
+		}
+	}
+
+	MemoryTracker::CategoryStats MemoryTracker::GetStats(eMemoryCategory Category)
+	{
+		const CategoryCounters& Counters = s_Counters[(size_t)Category];
+		CategoryStats Stats;
+		Stats.LiveBytes = Counters.LiveBytes.load(std::memory_order_relaxed);
+		Stats.PeakBytes = Counters.PeakBytes.load(std::memory_order_relaxed);
+		Stats.LiveCount = Counters.LiveCount.load(std::memory_order_relaxed);
+		Stats.FrameAllocations = Counters.LastFrameAllocations;
+		Stats.FrameBytes = Counters.LastFrameBytes;
+		Stats.BudgetBytes = Counters.BudgetBytes.load(std::memory_order_relaxed);
+		return Stats;
+	}
+
+	const char* MemoryTracker::GetCategoryName(eMemoryCategory Category)
+	{
+		return s_CategoryNames[(size_t)Category];
+	}
+
+	uint64_t MemoryTracker::GetTotalHeapAllocationCount()
+	{
+		return s_HeapAllocationCount.load(std::memory_order_relaxed);
+	}
+
+	bool MemoryTracker::DumpToJson(const std::string& Filepath)
+	{
+		rapidjson::StringBuffer StrBuffer;
+		rapidjson::PrettyWriter<rapidjson::StringBuffer> Writer(StrBuffer);
+
+		Writer.StartObject();
+		Writer.Key("Frame");
+		Writer.Uint64(FrameAllocator::GetFrameIndex());
+		// Heap figures come from the operator new hooks, which only exist in Debug. Without them
+		// TotalHeapAllocations is zero and the categories hold only explicitly recorded GPU and external memory.
+		Writer.Key("HeapTracking");
+#if defined IE_TRACK_HEAP_ALLOCATIONS
+		Writer.Bool(true);
+#else
+		Writer.Bool(false);
+#endif
+		Writer.Key("TotalHeapAllocations");
+		Writer.Uint64(GetTotalHeapAllocationCount());
+		Writer.Key("Categories");
+		Writer.StartArray();
+		for (size_t i = 0; i < (size_t)eMemoryCategory::Count; ++i) {
+			const CategoryStats Stats = GetStats((eMemoryCategory)i);
+			Writer.StartObject();
+			Writer.Key("Name");
+			Writer.String(s_CategoryNames[i]);
+			Writer.Key("LiveBytes");
+			Writer.Int64(Stats.LiveBytes);
+			Writer.Key("PeakBytes");
+			Writer.Int64(Stats.PeakBytes);
+			Writer.Key("LiveCount");
+			Writer.Int64(Stats.LiveCount);
+			Writer.Key("FrameAllocations");
+			Writer.Int64(Stats.FrameAllocations);
+			Writer.Key("FrameBytes");
+			Writer.Int64(Stats.FrameBytes);
+			Writer.Key("BudgetBytes");
+			Writer.Int64(Stats.BudgetBytes);
+			Writer.EndObject();
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+
+		std::ofstream OutStream(Filepath.c_str());
+		OutStream << StrBuffer.GetString();
+		if (!OutStream.good()) {
+			IE_CORE_ERROR("Failed to write memory stats to file: {0}", Filepath);
+			return false;
+		}
+		IE_CORE_INFO("Memory stats written to: {0}", Filepath);
+		return true;
+	}
+
+	void MemoryTracker::OnImGuiRender()
+	{
+		ImGui::Begin("Memory");
+		{
+			ImGui::TextDisabled("Heap figures are tracked in Debug builds only. GPU memory is recorded in every build.");
+#if !defined IE_TRACK_HEAP_ALLOCATIONS
+			ImGui::TextDisabled("Heap tracking is disabled in this configuration, only GPU and external allocations are shown.");
+#endif
+			ImGui::Text("Heap allocations last frame (Debug only): %llu", FrameAllocator::GetLastFrameHeapAllocationCount());
+			ImGui::Text("Total heap allocations (Debug only): %llu", GetTotalHeapAllocationCount());
+			if (ImGui::Button("Dump to File")) {
+				DumpToJson(FileSystem::ProjectDirectory + "/Memory_Stats.json");
+			}
+			ImGui::Separator();
+
+			ImGui::Columns(6, "MemoryCategories");
+			ImGui::Text("Category"); ImGui::NextColumn();
+			ImGui::Text("Live (KB)"); ImGui::NextColumn();
+			ImGui::Text("Peak (KB)"); ImGui::NextColumn();
+			ImGui::Text("Count"); ImGui::NextColumn();
+			ImGui::Text("Allocs/Frame"); ImGui::NextColumn();
+			ImGui::Text("Budget"); ImGui::NextColumn();
+			ImGui::Separator();
+
+			for (size_t i = 0; i < (size_t)eMemoryCategory::Count; ++i) {
+				const CategoryStats Stats = GetStats((eMemoryCategory)i);
+				ImGui::Text("%s", s_CategoryNames[i]); ImGui::NextColumn();
+				ImGui::Text("%lld", Stats.LiveBytes / 1024); ImGui::NextColumn();
+				ImGui::Text("%lld", Stats.PeakBytes / 1024); ImGui::NextColumn();
+				ImGui::Text("%lld", Stats.LiveCount); ImGui::NextColumn();
+				ImGui::Text("%lld (%lld B)", Stats.FrameAllocations, Stats.FrameBytes); ImGui::NextColumn();
+				if (Stats.BudgetBytes > 0) {
+					ImGui::ProgressBar((float)Stats.LiveBytes / (float)Stats.BudgetBytes, ImVec2(-1.0f, 0.0f));
+				}
+				else {
+					ImGui::TextDisabled("None");
+				}
+				ImGui::NextColumn();
+			}
+			ImGui::Columns(1);
+		}
+		ImGui::End();
+	}
+
+}
+
+#if defined IE_TRACK_HEAP_ALLOCATIONS
+
+// Prepended to every heap allocation so the free can be attributed to the
+// category that was active when the memory was allocated. Sized to keep
+// the user pointer 16-byte aligned.
+struct HeapAllocationHeader
+{
+	size_t Size;
+	Insight::eMemoryCategory Category;
+};
+static_assert(sizeof(HeapAllocationHeader) <= 16, "Heap allocation header must fit in 16 bytes.");
+#define IE_HEAP_HEADER_SIZE 16U
+
+// Replace the global allocation functions so every trip to the general
+// heap, ours or third-party, is counted.
+void* operator new(size_t Size)
+{
+	Insight::s_HeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	uint8_t* pMemory = static_cast<uint8_t*>(std::malloc(IE_HEAP_HEADER_SIZE + Size));
+	if (!pMemory) {
+		throw std::bad_alloc();
+	}
+	HeapAllocationHeader* pHeader = reinterpret_cast<HeapAllocationHeader*>(pMemory);
+	pHeader->Size = Size;
+	pHeader->Category = Insight::s_CurrentCategory;
+	Insight::MemoryTracker::RecordAllocation(pHeader->Category, Size);
+	return pMemory + IE_HEAP_HEADER_SIZE;
+}
+
+void* operator new[](size_t Size)
+{
+	return operator new(Size);
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	if (!pMemory) {
+		return;
+	}
+	uint8_t* pBase = static_cast<uint8_t*>(pMemory) - IE_HEAP_HEADER_SIZE;
+	const HeapAllocationHeader* pHeader = reinterpret_cast<const HeapAllocationHeader*>(pBase);
+	Insight::MemoryTracker::RecordFree(pHeader->Category, pHeader->Size);
+	std::free(pBase);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+	operator delete(pMemory);
+}
+
+#endif // IE_TRACK_HEAP_ALLOCATIONS
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+/*
+	Tagged memory tracking and soft budgets.
+
+	Every heap allocation made through global operator new is attributed to the
+	category active on the calling thread when IE_TRACK_HEAP_ALLOCATIONS is defined (Debug).
+	Memory that never touches operator new (GPU resources, third-party allocators,
+	JSON DOMs) can be attributed explicitly with ScopedExternalAllocation or
+	RecordAllocation/RecordFree. Explicit records are kept in every build, so in Release
+	the categories hold only those, texture video memory and mesh vertex and index buffers
+	among them.
+
+	Example usage:
+		{
+			ScopedMemoryCategory MemoryScope(eMemoryCategory::Geometry);
+			pModel->Create(Path); // Anything allocated here counts against Geometry until it is freed.
+		}
+		MemoryTracker::SetBudget(eMemoryCategory::Textures, 512U * 1024U * 1024U);
+*/
+
+namespace Insight {
+
+	enum class eMemoryCategory : uint8_t
+	{
+		General = 0,
+		SceneGraph,
+		// Heap memory of imported meshes, plus the size of their vertex and index buffers.
+		Geometry,
+		Textures,
+		// Estimated video memory, recorded explicitly by the renderer.
+		TextureVideoMemory,
+		Scripting,
+		Json,
+		FrameArena,
+
+		Count,
+	};
+
+	class INSIGHT_API MemoryTracker
+	{
+	public:
+		struct CategoryStats
+		{
+			int64_t LiveBytes = 0;
+			int64_t PeakBytes = 0;
+			int64_t LiveCount = 0;
+			// Allocations and bytes allocated during the last full frame.
+			int64_t FrameAllocations = 0;
+			int64_t FrameBytes = 0;
+			// Zero when the category has no budget.
+			int64_t BudgetBytes = 0;
+		};
+
+	public:
+		static void RecordAllocation(eMemoryCategory Category, size_t Bytes);
+		static void RecordFree(eMemoryCategory Category, size_t Bytes);
+
+		static eMemoryCategory GetCurrentCategory();
+		// Set the category allocations on this thread are attributed to. Returns the previous category.
+		static eMemoryCategory SetCurrentCategory(eMemoryCategory Category);
+
+		// Set a soft budget for a category. Exceeding it logs a warning, it never fails an allocation.
+		// Pass zero to remove the budget.
+		static void SetBudget(eMemoryCategory Category, size_t Bytes);
+
+		// Latch per-frame allocation rates and check budgets. Should be called once at the end of every frame.
+		static void EndFrame();
+
+		static CategoryStats GetStats(eMemoryCategory Category);
+		static const char* GetCategoryName(eMemoryCategory Category);
+		// Total number of general-heap allocations since the application started.
+		static uint64_t GetTotalHeapAllocationCount();
+
+		// Write the current stats for every category to a json file.
+		static bool DumpToJson(const std::string& Filepath);
+		// Draw the memory stats window.
+		static void OnImGuiRender();
+	};
+
+	// Attribute allocations made on this thread to a category until the end of the scope.
+	class ScopedMemoryCategory
+	{
+	public:
+		ScopedMemoryCategory(eMemoryCategory Category) : m_PreviousCategory(MemoryTracker::SetCurrentCategory(Category)) {}
+		~ScopedMemoryCategory() { MemoryTracker::SetCurrentCategory(m_PreviousCategory); }
+
+		ScopedMemoryCategory(const ScopedMemoryCategory&) = delete;
+		ScopedMemoryCategory& operator = (const ScopedMemoryCategory&) = delete;
+
+	private:
+		eMemoryCategory m_PreviousCategory;
+	};
+
+	// Attribute memory the tracker cannot see to a category for the lifetime of this object.
+	class ScopedExternalAllocation
+	{
+	public:
+		ScopedExternalAllocation(eMemoryCategory Category, size_t Bytes)
+			: m_Category(Category), m_Bytes(Bytes)
+		{
+			MemoryTracker::RecordAllocation(m_Category, m_Bytes);
+		}
+		~ScopedExternalAllocation() { MemoryTracker::RecordFree(m_Category, m_Bytes); }
+
+		ScopedExternalAllocation(const ScopedExternalAllocation&) = delete;
+		ScopedExternalAllocation& operator = (const ScopedExternalAllocation&) = delete;
+
+	private:
+		eMemoryCategory m_Category;
+		size_t m_Bytes;
+	};
+
+}
@@ -0,0 +1,133 @@
+#include <ie_pch.h>
+
+#include "Thread_Pool.h"
+
+#include <atomic>
+#include <condition_variable>
+
+namespace Insight {
+
+	static std::vector<std::thread> s_Workers;
+	static std::queue<std::function<void()>> s_Jobs;
+	static std::mutex s_JobMutex;
+	static std::condition_variable s_JobAvailable;
+	static bool s_IsShuttingDown = false;
+
+	void ThreadPool::Init(uint32_t NumWorkers)
+	{
+		IE_CORE_ASSERT(s_Workers.empty(), "Thread pool has already been initialized.");
+
+		if (NumWorkers == 0U) {
+			const uint32_t HardwareThreads = std::thread::hardware_concurrency();
+			NumWorkers = (HardwareThreads > 1U) ? HardwareThreads - 1U : 1U;
+		}
+
+		s_IsShuttingDown = false;
+		s_Workers.reserve(NumWorkers);
+		for (uint32_t i = 0; i < NumWorkers; ++i) {
+			s_Workers.emplace_back(&ThreadPool::WorkerMain);
+		}
+		IE_CORE_INFO("Thread pool started with {0} workers.", NumWorkers);
+	}
+
+	void ThreadPool::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(s_JobMutex);
+			s_IsShuttingDown = true;
+		}
+		s_JobAvailable.notify_all();
+
+		for (std::thread& Worker : s_Workers) {
+			Worker.join();
+		}
+		s_Workers.clear();
+	}
+
+	void ThreadPool::ParallelFor(uint32_t Count, const std::function<void(uint32_t)>& Body)
+	{
+		if (Count == 0U) {
+			return;
+		}
+		if (Count == 1U || s_Workers.empty()) {
+			for (uint32_t i = 0; i < Count; ++i) {
+				Body(i);
+			}
+			return;
+		}
+
+		// Helpers that start after every index is taken return without touching 'Body',
+		// so the state only has to outlive them, not the call.
+		struct ParallelForState
+		{
+			std::atomic<uint32_t> NextIndex{ 0U };
+			uint32_t NumDone = 0U;
+			std::mutex DoneMutex;
+			std::condition_variable AllDone;
+		};
+		auto pState = std::make_shared<ParallelForState>();
+		const std::function<void(uint32_t)>* pBody = &Body;
+		auto Work = [pState, pBody, Count]() {
+			uint32_t NumRun = 0U;
+			for (uint32_t i = pState->NextIndex++; i < Count; i = pState->NextIndex++) {
+				(*pBody)(i);
+				++NumRun;
+			}
+			if (NumRun > 0U) {
+				std::lock_guard<std::mutex> Lock(pState->DoneMutex);
+				pState->NumDone += NumRun;
+				if (pState->NumDone == Count) {
+					pState->AllDone.notify_all();
+				}
+			}
+		};
+
+		const uint32_t NumHelpers = std::min(Count, static_cast<uint32_t>(s_Workers.size())) - 1U;
+		for (uint32_t i = 0; i < NumHelpers; ++i) {
+			Enqueue(Work);
+		}
+		Work();
+
+		std::unique_lock<std::mutex> Lock(pState->DoneMutex);
+		pState->AllDone.wait(Lock, [&pState, Count]() { return pState->NumDone == Count; });
+	}
+
+	uint32_t ThreadPool::GetNumWorkers()
+	{
+		return static_cast<uint32_t>(s_Workers.size());
+	}
+
+	void ThreadPool::Enqueue(std::function<void()>&& Job)
+	{
+		if (s_Workers.empty()) {
+			Job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(s_JobMutex);
+			s_Jobs.push(std::move(Job));
+		}
+		s_JobAvailable.notify_one();
+	}
+
+	void ThreadPool::WorkerMain()
+	{
+		while (true) {
+			std::function<void()> Job;
+			{
+				std::unique_lock<std::mutex> Lock(s_JobMutex);
+				s_JobAvailable.wait(Lock, []() { return s_IsShuttingDown || !s_Jobs.empty(); });
+
+				// Drain the queue before exiting so no future is left without a result.
+				if (s_Jobs.empty()) {
+					return;
+				}
+				Job = std::move(s_Jobs.front());
+				s_Jobs.pop();
+			}
+			Job();
+		}
+	}
+
+}
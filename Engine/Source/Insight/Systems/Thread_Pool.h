@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+/*
+	Fixed pool of worker threads for engine background work such as asset imports.
+	Jobs are started in the order they are submitted. Anything that touches the
+	renderer or the scene graph must stay on the main thread, hand results back
+	through the returned future instead.
+
+	Example usage:
+		std::future<shared_ptr<ImportedModel>> Result = ThreadPool::Submit([Path]() { return Model::Import(Path); });
+		...
+		GeometryManager::AddModelAsset(Key, Result.get());
+*/
+
+namespace Insight {
+
+	class INSIGHT_API ThreadPool
+	{
+	public:
+		// Start the workers. Zero picks one less than the number of hardware threads.
+		static void Init(uint32_t NumWorkers = 0U);
+		// Finish all queued jobs and join the workers.
+		static void Shutdown();
+
+		// Queue a job. If the pool has no workers the job runs immediately on the calling thread.
+		template <typename JobType>
+		static auto Submit(JobType&& Job) -> std::future<decltype(Job())>
+		{
+			typedef decltype(Job()) ResultType;
+			auto pTask = std::make_shared<std::packaged_task<ResultType()>>(std::forward<JobType>(Job));
+			std::future<ResultType> Result = pTask->get_future();
+			Enqueue([pTask]() { (*pTask)(); });
+			return Result;
+		}
+
+		// Run 'Body' once for every index in [0, Count) across the workers and the calling
+		// thread, returning once every index is done. Safe to call from inside a job, the
+		// caller keeps taking indices itself so it never waits on a job stuck behind it in the queue.
+		static void ParallelFor(uint32_t Count, const std::function<void(uint32_t)>& Body);
+
+		static uint32_t GetNumWorkers();
+
+	private:
+		static void Enqueue(std::function<void()>&& Job);
+		static void WorkerMain();
+	};
+
+}
@@ -1,6 +1,9 @@
 #pragma once
 #include <Insight/Core.h>
 
+#include "Insight/Systems/Memory/Frame_Allocator.h"
+#include "Insight/Systems/Memory/Memory_Tracker.h"
+
 #include <chrono>
 
 namespace Insight {
@@ -16,8 +19,17 @@ namespace Insight {
 			};
 
 			ScopedTimer(const char* pScopeName, eOutputType outputType = eOutputType::MILISECONDS)
-				: m_ScopeName(pScopeName), m_OutputType(outputType)
+				: m_OutputType(outputType)
+			{
+				strncpy_s(m_ScopeName, pScopeName, _TRUNCATE);
+				start = std::chrono::high_resolution_clock::now();
+			}
+
+			// Logged as 'ScopeName "Detail"', e.g. the asset a load is timing.
+			ScopedTimer(const char* pScopeName, const char* pDetail, eOutputType outputType = eOutputType::MILISECONDS)
+				: m_OutputType(outputType)
 			{
+				_snprintf_s(m_ScopeName, _TRUNCATE, "%s \"%s\"", pScopeName, pDetail);
 				start = std::chrono::high_resolution_clock::now();
 			}
 
@@ -55,7 +67,8 @@ namespace Insight {
 			std::chrono::time_point<std::chrono::steady_clock> start, end;
 			std::chrono::duration<float> duration;
 
-			std::string m_ScopeName;
+			// Owned by the timer, timers on pool threads can outlive frame arena strings.
+			char m_ScopeName[128];
 			eOutputType m_OutputType;
 		};
 
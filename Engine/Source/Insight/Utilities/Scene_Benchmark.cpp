@@ -0,0 +1,451 @@
+#include <ie_pch.h>
+
+#include "Scene_Benchmark.h"
+
+#include "Insight/Core/Scene/Scene.h"
+#include "Insight/Runtime/AActor.h"
+#include "Insight/Runtime/Type_Registry.h"
+#include "Insight/Systems/File_System.h"
+#include "Insight/Systems/Cooked_Scene.h"
+#include "Insight/Systems/Managers/Geometry_Manager.h"
+#include "Insight/Systems/Managers/Resource_Manager.h"
+#include "Insight/Rendering/Geometry/Model.h"
+#include "Insight/Rendering/Geometry/Gltf_Loader.h"
+#include "Insight/Rendering/Geometry/Imported_Model.h"
+#include "Insight/Utilities/String_Helper.h"
+
+#include <Psapi.h>
+
+// Frames played when "-frames" is not given.
+#define IE_BENCHMARK_DEFAULT_FRAMES 300U
+
+namespace Insight {
+
+	bool SceneBenchmark::s_IsEnabled = false;
+	bool SceneBenchmark::s_ShouldSave = true;
+	bool SceneBenchmark::s_ShouldVerifyCook = false;
+	std::string SceneBenchmark::s_SceneName = "";
+	uint32_t SceneBenchmark::s_NumFrames = IE_BENCHMARK_DEFAULT_FRAMES;
+	SceneBenchmark::Clock::time_point SceneBenchmark::s_LastTime;
+	double SceneBenchmark::s_LoadMs = 0.0;
+	uint64_t SceneBenchmark::s_LoadPeakJsonKB = 0U;
+	uint64_t SceneBenchmark::s_LoadPeakWorkingSetKB = 0U;
+	std::vector<float> SceneBenchmark::s_FrameMs;
+	std::vector<std::string> SceneBenchmark::s_GltfFiles;
+
+	static double GetElapsedMs(std::chrono::high_resolution_clock::time_point Start, std::chrono::high_resolution_clock::time_point End)
+	{
+		return std::chrono::duration<double, std::milli>(End - Start).count();
+	}
+
+	static void CookSceneToMemory(Scene* pScene, std::vector<uint8_t>& OutBytes)
+	{
+		CookedSceneBuilder Builder;
+		Builder.SetSceneName(pScene->GetDisplayName());
+		Builder.SetActorChunkSizes(pScene->GetSavedChunkSizes());
+		ResourceManager::Get().WriteToCooked(Builder);
+		pScene->GetRootNode()->WriteToCooked(Builder);
+		Builder.Finalize(OutBytes);
+	}
+
+	// Read the actors of a cooked scene back into new actors and cook those again. The result must
+	// match 'Cooked' byte for byte, anything else means a type's LoadFromCooked and WriteToCooked
+	// have drifted apart. Resources are written from the resource manager both times.
+	static bool VerifyCookedRoundTrip(const std::vector<uint8_t>& Cooked, ActorId FirstActorId)
+	{
+		CookedSceneView View;
+		if (!View.OpenFromMemory(Cooked.data(), Cooked.size())) {
+			IE_CORE_ERROR("Cooked scene round trip: the cooked scene is rejected by its own validation.");
+			return false;
+		}
+
+		std::vector<uint32_t> ChunkSizes(View.GetNumActorChunks());
+		for (uint32_t i = 0; i < View.GetNumActorChunks(); ++i) {
+			ChunkSizes[i] = View.GetActorChunkSize(i);
+		}
+		CookedSceneBuilder Builder;
+		Builder.SetSceneName(View.GetString(View.GetHeader().SceneName));
+		Builder.SetActorChunkSizes(ChunkSizes);
+		ResourceManager::Get().WriteToCooked(Builder);
+		{
+			// Deletes the actors read back when it goes out of scope.
+			SceneNode Root("Cooked Round Trip");
+			GeometryManager::BeginImportBatch();
+			for (uint32_t a = 0; a < View.GetNumActors(); ++a) {
+				const CookedActor& Actor = View.GetActor(a);
+				AActor* pActor = TypeRegistry::CreateActor(Actor.Type, FirstActorId + a, View.GetString(Actor.DisplayName));
+				if (pActor == nullptr) {
+					IE_CORE_ERROR("Cooked scene round trip: actor \"{0}\" has an unknown type.", View.GetString(Actor.DisplayName));
+					continue;
+				}
+				pActor->LoadFromCooked(View, Actor);
+				Root.AddChild(pActor);
+			}
+			GeometryManager::EndImportBatch();
+			Root.WriteToCooked(Builder);
+		}
+
+		std::vector<uint8_t> Recooked;
+		Builder.Finalize(Recooked);
+		const size_t NumCompared = std::min(Cooked.size(), Recooked.size());
+		const size_t FirstMismatch = std::mismatch(Cooked.begin(), Cooked.begin() + NumCompared, Recooked.begin()).first - Cooked.begin();
+		if (FirstMismatch < NumCompared || Cooked.size() != Recooked.size()) {
+			IE_CORE_ERROR("Cooked scene round trip: {0} bytes cooked, {1} bytes re-cooked, first difference at byte {2}.", Cooked.size(), Recooked.size(), FirstMismatch);
+			return false;
+		}
+		return true;
+	}
+
+	static size_t CountTriangles(const ImportedModel* pImport)
+	{
+		size_t NumTriangles = 0U;
+		if (pImport) {
+			for (const ImportedMesh& Mesh : pImport->Meshes) {
+				NumTriangles += Mesh.MeshIndices.size() / 3U;
+			}
+		}
+		return NumTriangles;
+	}
+
+	struct GltfComparison
+	{
+		std::string File;
+		double GltfMs = 0.0;
+		size_t GltfTriangles = 0U;
+		double AssimpMs = 0.0;
+		size_t AssimpTriangles = 0U;
+	};
+
+	// Read a glTF file with the native loader and with Assimp. Neither goes through the cooked mesh cache.
+	static bool CompareGltfLoaders(const std::string& File, GltfComparison& OutResult)
+	{
+		typedef std::chrono::high_resolution_clock Clock;
+
+		OutResult.File = File;
+		const std::string SourcePath = FileSystem::GetProjectRelativeAssetDirectory(File);
+		if (!GltfLoader::CanLoad(SourcePath, IE_MODEL_DEFAULT_IMPORT_FLAGS)) {
+			IE_CORE_ERROR("Benchmark: \"{0}\" is not a glTF file the native loader can read.", File);
+			return false;
+		}
+
+		Clock::time_point Start = Clock::now();
+		const shared_ptr<ImportedModel> pGltfImport = GltfLoader::Load(SourcePath, IE_MODEL_DEFAULT_IMPORT_FLAGS);
+		OutResult.GltfMs = GetElapsedMs(Start, Clock::now());
+		OutResult.GltfTriangles = CountTriangles(pGltfImport.get());
+
+		Start = Clock::now();
+		const shared_ptr<ImportedModel> pAssimpImport = Model::ImportWithAssimp(SourcePath, IE_MODEL_DEFAULT_IMPORT_FLAGS);
+		OutResult.AssimpMs = GetElapsedMs(Start, Clock::now());
+		OutResult.AssimpTriangles = CountTriangles(pAssimpImport.get());
+
+		IE_CORE_INFO("Benchmark \"{0}\": glTF loader {1}ms, {2} triangles. Assimp {3}ms, {4} triangles.",
+			File, OutResult.GltfMs, OutResult.GltfTriangles, OutResult.AssimpMs, OutResult.AssimpTriangles);
+		if (!pGltfImport || !pAssimpImport) {
+			IE_CORE_ERROR("Benchmark: \"{0}\" failed to load with the {1}.", File, pGltfImport ? "Assimp importer" : "glTF loader");
+			return false;
+		}
+		if (OutResult.GltfTriangles != OutResult.AssimpTriangles) {
+			IE_CORE_WARN("Benchmark: the glTF loader and Assimp disagree on the triangle count of \"{0}\".", File);
+		}
+		return true;
+	}
+
+	// Open damaged copies of a valid cooked scene. Returns how many of them were rejected, out of 'OutNumCases'.
+	static uint32_t VerifyCookedValidation(const std::vector<uint8_t>& Cooked, uint32_t& OutNumCases)
+	{
+		struct DamageCase
+		{
+			const char* Name;
+			std::function<bool(std::vector<uint8_t>&)> Damage;
+		};
+		auto GetHeader = [](std::vector<uint8_t>& Bytes) { return reinterpret_cast<CookedSceneHeader*>(Bytes.data()); };
+		auto GetFirstActor = [&GetHeader](std::vector<uint8_t>& Bytes) { return reinterpret_cast<CookedActor*>(Bytes.data() + GetHeader(Bytes)->Actors.Offset); };
+		const DamageCase Cases[] = {
+			{ "Truncated header", [](std::vector<uint8_t>& Bytes) { Bytes.resize(sizeof(CookedSceneHeader) - 1U); return true; } },
+			{ "Truncated by one byte", [](std::vector<uint8_t>& Bytes) { Bytes.pop_back(); return true; } },
+			{ "Truncated with a matching file size", [&GetHeader](std::vector<uint8_t>& Bytes) {
+				Bytes.resize(sizeof(CookedSceneHeader) + (Bytes.size() - sizeof(CookedSceneHeader)) / 8U * 4U);
+				GetHeader(Bytes)->FileSize = static_cast<uint32_t>(Bytes.size());
+				return true;
+			} },
+			{ "Wrong magic", [&GetHeader](std::vector<uint8_t>& Bytes) { GetHeader(Bytes)->Magic ^= 1U; return true; } },
+			{ "Wrong version", [&GetHeader](std::vector<uint8_t>& Bytes) { GetHeader(Bytes)->Version += 1U; return true; } },
+			{ "Misaligned table", [&GetHeader](std::vector<uint8_t>& Bytes) { GetHeader(Bytes)->Transforms.Offset += 2U; return true; } },
+			{ "Table past the end", [&GetHeader](std::vector<uint8_t>& Bytes) { GetHeader(Bytes)->Components.Count += static_cast<uint32_t>(Bytes.size()); return true; } },
+			{ "Unterminated strings", [&GetHeader](std::vector<uint8_t>& Bytes) {
+				const CookedTable& Strings = GetHeader(Bytes)->Strings;
+				Bytes[Strings.Offset + Strings.Count - 1U] = 'x';
+				return true;
+			} },
+			{ "Transform index out of range", [&GetHeader, &GetFirstActor](std::vector<uint8_t>& Bytes) {
+				if (GetHeader(Bytes)->Actors.Count == 0U) {
+					return false;
+				}
+				GetFirstActor(Bytes)->Transform = GetHeader(Bytes)->Transforms.Count;
+				return true;
+			} },
+			{ "Components out of range", [&GetHeader, &GetFirstActor](std::vector<uint8_t>& Bytes) {
+				if (GetHeader(Bytes)->Actors.Count == 0U) {
+					return false;
+				}
+				GetFirstActor(Bytes)->NumComponents = GetHeader(Bytes)->Components.Count + 1U;
+				return true;
+			} },
+		};
+
+		OutNumCases = 0U;
+		uint32_t NumRejected = 0U;
+		for (const DamageCase& Case : Cases) {
+			std::vector<uint8_t> Damaged = Cooked;
+			if (!Case.Damage(Damaged)) {
+				continue;
+			}
+			++OutNumCases;
+			CookedSceneView View;
+			if (View.OpenFromMemory(Damaged.data(), Damaged.size())) {
+				IE_CORE_ERROR("Cooked scene validation: accepted a damaged scene, \"{0}\".", Case.Name);
+			}
+			else {
+				++NumRejected;
+			}
+		}
+		return NumRejected;
+	}
+
+	bool SceneBenchmark::ParseCommandLine(const wchar_t* CommandLine)
+	{
+		if (CommandLine == nullptr || CommandLine[0] == L'\0') {
+			return false;
+		}
+
+		int NumArgs = 0;
+		LPWSTR* ppArgs = CommandLineToArgvW(CommandLine, &NumArgs);
+		if (ppArgs == nullptr) {
+			return false;
+		}
+		for (int i = 0; i < NumArgs; ++i) {
+			const bool HasValue = (i + 1 < NumArgs);
+			if (wcscmp(ppArgs[i], L"-benchmark") == 0 && HasValue) {
+				s_SceneName = StringHelper::WideToString(ppArgs[++i]);
+				s_IsEnabled = true;
+			}
+			else if (wcscmp(ppArgs[i], L"-frames") == 0 && HasValue) {
+				const int NumFrames = _wtoi(ppArgs[++i]);
+				s_NumFrames = (NumFrames > 0) ? static_cast<uint32_t>(NumFrames) : IE_BENCHMARK_DEFAULT_FRAMES;
+			}
+			else if (wcscmp(ppArgs[i], L"-nosave") == 0) {
+				s_ShouldSave = false;
+			}
+			else if (wcscmp(ppArgs[i], L"-domload") == 0) {
+				FileSystem::SetLoadSceneJsonAsDom(true);
+			}
+			else if (wcscmp(ppArgs[i], L"-verifycook") == 0) {
+				s_ShouldVerifyCook = true;
+			}
+			else if (wcscmp(ppArgs[i], L"-gltf") == 0 && HasValue) {
+				s_GltfFiles.push_back(StringHelper::WideToString(ppArgs[++i]));
+			}
+		}
+		LocalFree(ppArgs);
+
+		if (s_IsEnabled) {
+			s_FrameMs.reserve(s_NumFrames);
+			IE_CORE_INFO("Benchmarking scene \"{0}\" for {1} frames.", s_SceneName, s_NumFrames);
+		}
+		return s_IsEnabled;
+	}
+
+	void SceneBenchmark::BeginLoad()
+	{
+		s_LastTime = Clock::now();
+	}
+
+	void SceneBenchmark::EndLoad()
+	{
+		const Clock::time_point Now = Clock::now();
+		s_LoadMs = GetElapsedMs(s_LastTime, Now);
+
+		// Taken before the first frame, so they are the load's alone.
+		PROCESS_MEMORY_COUNTERS MemoryCounters = {};
+		GetProcessMemoryInfo(GetCurrentProcess(), &MemoryCounters, sizeof(MemoryCounters));
+		s_LoadPeakWorkingSetKB = MemoryCounters.PeakWorkingSetSize / 1024;
+		s_LoadPeakJsonKB = static_cast<uint64_t>(MemoryTracker::GetStats(eMemoryCategory::Json).PeakBytes / 1024);
+		s_LastTime = Now;
+	}
+
+	bool SceneBenchmark::EndFrame()
+	{
+		const Clock::time_point Now = Clock::now();
+		s_FrameMs.push_back(static_cast<float>(GetElapsedMs(s_LastTime, Now)));
+		s_LastTime = Now;
+		return s_FrameMs.size() < s_NumFrames;
+	}
+
+	void SceneBenchmark::Finish(Scene* pScene)
+	{
+		// Checked on the scene as it was played, before the saves lay its actor chunks out again.
+		bool CookRoundTripMatches = false;
+		uint32_t NumCookCases = 0U, NumCookCasesRejected = 0U;
+		if (s_ShouldVerifyCook) {
+			std::vector<uint8_t> Cooked;
+			CookSceneToMemory(pScene, Cooked);
+			CookRoundTripMatches = VerifyCookedRoundTrip(Cooked, static_cast<ActorId>(pScene->GetRootNode()->m_Children.size()));
+			NumCookCasesRejected = VerifyCookedValidation(Cooked, NumCookCases);
+			IE_CORE_INFO("Benchmark \"{0}\": cooked round trip {1}, {2} of {3} damaged cooked scenes rejected.",
+				s_SceneName, CookRoundTripMatches ? "matches" : "DIFFERS", NumCookCasesRejected, NumCookCases);
+		}
+
+		std::vector<GltfComparison> GltfComparisons(s_GltfFiles.size());
+		for (size_t i = 0; i < s_GltfFiles.size(); ++i) {
+			CompareGltfLoaders(s_GltfFiles[i], GltfComparisons[i]);
+		}
+
+		// An incremental save with one actor edited, then a compacting save. The incremental save
+		// goes first, it does not re-cook the scene and would leave the cooked file out of date.
+		double IncrementalSaveMs = -1.0;
+		double CompactingSaveMs = 0.0;
+		bool Saved = false;
+		if (s_ShouldSave) {
+			AActor* pEditedActor = nullptr;
+			for (SceneNode* pNode : pScene->GetRootNode()->m_Children) {
+				pEditedActor = dynamic_cast<AActor*>(pNode);
+				if (pEditedActor && pEditedActor->GetCanBeFileParsed()) {
+					break;
+				}
+				pEditedActor = nullptr;
+			}
+			// Scenes without actor chunks, saved by older builds, have every chunk to write the first time.
+			bool SavedIncremental = true;
+			if (pEditedActor && !pScene->GetSavedChunkSizes().empty()) {
+				pEditedActor->MarkSaveDirty();
+				const Clock::time_point SaveStart = Clock::now();
+				SavedIncremental = FileSystem::SaveSceneAsync(pScene, false) && FileSystem::WaitForPendingSave();
+				IncrementalSaveMs = GetElapsedMs(SaveStart, Clock::now());
+			}
+			else {
+				IE_CORE_WARN("Benchmark \"{0}\" has no actor chunks to edit, skipping the incremental save.", s_SceneName);
+			}
+
+			// Compact so every chunk and the cooked scene are written, not just the ones that changed.
+			const Clock::time_point SaveStart = Clock::now();
+			const bool SavedCompacted = FileSystem::SaveSceneAsync(pScene, true) && FileSystem::WaitForPendingSave();
+			CompactingSaveMs = GetElapsedMs(SaveStart, Clock::now());
+			Saved = SavedIncremental && SavedCompacted;
+		}
+
+		// The first frame pays for pipeline and upload work left over from the load, report it on its own.
+		const float FirstFrameMs = s_FrameMs.empty() ? 0.0f : s_FrameMs.front();
+		std::vector<float> SortedMs(s_FrameMs.size() > 1U ? s_FrameMs.begin() + 1 : s_FrameMs.end(), s_FrameMs.end());
+		std::sort(SortedMs.begin(), SortedMs.end());
+		double TotalMs = 0.0;
+		for (float Ms : SortedMs) {
+			TotalMs += Ms;
+		}
+		auto Percentile = [&SortedMs](float Fraction) {
+			return SortedMs.empty() ? 0.0f : SortedMs[static_cast<size_t>(Fraction * (SortedMs.size() - 1U))];
+		};
+		const double AverageMs = SortedMs.empty() ? 0.0 : TotalMs / SortedMs.size();
+
+		const size_t NumActors = pScene->GetRootNode()->m_Children.size();
+		const char* BuildConfig = MACRO_TO_STRING(IE_BUILD_CONFIG);
+		PROCESS_MEMORY_COUNTERS MemoryCounters = {};
+		GetProcessMemoryInfo(GetCurrentProcess(), &MemoryCounters, sizeof(MemoryCounters));
+
+		IE_CORE_INFO("Benchmark \"{0}\": {1} actors, load {2}ms, incremental save {3}ms, compacting save {4}ms{5}.",
+			s_SceneName, NumActors, s_LoadMs, IncrementalSaveMs, CompactingSaveMs, s_ShouldSave ? (Saved ? "" : " (failed)") : " (skipped)");
+		IE_CORE_INFO("Benchmark \"{0}\": {1} frames, first {2}ms, average {3}ms, median {4}ms, 95th {5}ms, 99th {6}ms, worst {7}ms.",
+			s_SceneName, s_FrameMs.size(), FirstFrameMs, AverageMs, Percentile(0.5f), Percentile(0.95f), Percentile(0.99f), Percentile(1.0f));
+		IE_CORE_INFO("Benchmark \"{0}\": peak working set {1} KB.", s_SceneName, MemoryCounters.PeakWorkingSetSize / 1024);
+
+		rapidjson::StringBuffer StrBuffer;
+		rapidjson::PrettyWriter<rapidjson::StringBuffer> Writer(StrBuffer);
+		Writer.StartObject();
+		{
+			Writer.Key("Scene");
+			Writer.String(s_SceneName.c_str());
+			Writer.Key("Build");
+			Writer.String(BuildConfig);
+			Writer.Key("Actors");
+			Writer.Uint64(NumActors);
+
+			Writer.Key("LoadMs");
+			Writer.Double(s_LoadMs);
+			Writer.Key("JsonLoader");
+			Writer.String(FileSystem::GetLoadSceneJsonAsDom() ? "DOM" : "Streaming");
+			Writer.Key("LoadPeakJsonKB");
+			Writer.Uint64(s_LoadPeakJsonKB);
+			Writer.Key("LoadPeakWorkingSetKB");
+			Writer.Uint64(s_LoadPeakWorkingSetKB);
+			// -1 if the scene had no actor chunks for an incremental save to edit.
+			Writer.Key("IncrementalSaveMs");
+			Writer.Double(IncrementalSaveMs);
+			Writer.Key("CompactingSaveMs");
+			Writer.Double(CompactingSaveMs);
+			Writer.Key("Saved");
+			Writer.Bool(Saved);
+
+			if (s_ShouldVerifyCook) {
+				Writer.Key("CookRoundTripMatches");
+				Writer.Bool(CookRoundTripMatches);
+				Writer.Key("CookDamagedCases");
+				Writer.Uint(NumCookCases);
+				Writer.Key("CookDamagedCasesRejected");
+				Writer.Uint(NumCookCasesRejected);
+			}
+
+			if (!GltfComparisons.empty()) {
+				Writer.Key("GltfLoaders");
+				Writer.StartArray();
+				for (const GltfComparison& Comparison : GltfComparisons) {
+					Writer.StartObject();
+					Writer.Key("File");
+					Writer.String(Comparison.File.c_str());
+					Writer.Key("GltfMs");
+					Writer.Double(Comparison.GltfMs);
+					Writer.Key("GltfTriangles");
+					Writer.Uint64(Comparison.GltfTriangles);
+					Writer.Key("AssimpMs");
+					Writer.Double(Comparison.AssimpMs);
+					Writer.Key("AssimpTriangles");
+					Writer.Uint64(Comparison.AssimpTriangles);
+					Writer.EndObject();
+				}
+				Writer.EndArray();
+			}
+
+			Writer.Key("Frames");
+			Writer.Uint64(s_FrameMs.size());
+			Writer.Key("FirstFrameMs");
+			Writer.Double(FirstFrameMs);
+			Writer.Key("AverageFrameMs");
+			Writer.Double(AverageMs);
+			Writer.Key("MedianFrameMs");
+			Writer.Double(Percentile(0.5f));
+			Writer.Key("P95FrameMs");
+			Writer.Double(Percentile(0.95f));
+			Writer.Key("P99FrameMs");
+			Writer.Double(Percentile(0.99f));
+			Writer.Key("WorstFrameMs");
+			Writer.Double(Percentile(1.0f));
+
+			Writer.Key("PeakWorkingSetKB");
+			Writer.Uint64(MemoryCounters.PeakWorkingSetSize / 1024);
+			Writer.Key("PeakMemoryKB");
+			Writer.StartObject();
+			for (size_t i = 0; i < (size_t)eMemoryCategory::Count; ++i) {
+				Writer.Key(MemoryTracker::GetCategoryName((eMemoryCategory)i));
+				Writer.Int64(MemoryTracker::GetStats((eMemoryCategory)i).PeakBytes / 1024);
+			}
+			Writer.EndObject();
+		}
+		Writer.EndObject();
+
+		const std::string ReportDirectory = FileSystem::ProjectDirectory + "/Benchmarks";
+		CreateDirectoryA(ReportDirectory.c_str(), NULL);
+		const std::string ReportPath = ReportDirectory + "/" + s_SceneName.substr(0, s_SceneName.find_last_of('.')) + ".json";
+		if (FileSystem::WriteFileAtomic(ReportPath, StrBuffer.GetString(), StrBuffer.GetSize())) {
+			IE_CORE_INFO("Benchmark results written to: {0}", ReportPath);
+		}
+	}
+
+}
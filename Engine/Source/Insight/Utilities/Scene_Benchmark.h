@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <chrono>
+
+/*
+	Headless load, tick and save benchmark for a scene, usually one written by the
+	Stress_Scene_Gen tool. Started from the command line instead of the editor:
+		Engine.exe -benchmark Stress_50k.iescene -frames 600
+
+	The window is kept hidden, the scene is loaded, played for the requested number
+	of frames, then saved twice: incrementally with one actor marked as edited, which
+	rewrites one actor chunk and Meta.json, then compacted. Timings go to the log and to
+	"<Project>/Benchmarks/<Scene>.json" so results can be compared between builds.
+	The compacting save also cooks the scene, so the next run of the same scene loads
+	the cooked file.
+
+	Options:
+		-frames <N>		Frames to play, 300 by default.
+		-nosave			Skip the saves, the next run keeps measuring the json loader.
+		-domload		Load the json files as whole DOMs instead of streaming them. The
+						report's LoadPeakJsonKB and LoadPeakWorkingSetKB compare the two.
+		-verifycook		Cook the loaded scene, create its actors again from the cooked bytes
+						and check cooking them gives the same bytes, and that damaged or
+						truncated copies fail validation. Starts from json with "-domload".
+		-gltf <Path>	Read an asset with the native glTF loader and with Assimp and report
+						both times. Both skip the cooked ".iemesh" cache. Can be repeated.
+
+	Example usage:
+		SceneBenchmark::ParseCommandLine(lpCmdLine);	// wWinMain
+		if (SceneBenchmark::IsEnabled() && !SceneBenchmark::EndFrame()) {
+			m_Running = false;
+		}
+*/
+
+namespace Insight {
+
+	class Scene;
+
+	class INSIGHT_API SceneBenchmark
+	{
+	public:
+		// Returns true if the command line asked for a benchmark run.
+		static bool ParseCommandLine(const wchar_t* CommandLine);
+
+		inline static bool IsEnabled() { return s_IsEnabled; }
+		// Scene file name relative to the project's scene folder, e.g. "Stress_10k.iescene".
+		inline static const std::string& GetSceneName() { return s_SceneName; }
+
+		static void BeginLoad();
+		static void EndLoad();
+		// Record the frame that just finished. Returns false once every requested frame has run.
+		static bool EndFrame();
+		// Save the scene if requested and write the report.
+		static void Finish(Scene* pScene);
+
+	private:
+		typedef std::chrono::high_resolution_clock Clock;
+
+		static bool s_IsEnabled;
+		static bool s_ShouldSave;
+		static bool s_ShouldVerifyCook;
+		static std::string s_SceneName;
+		static uint32_t s_NumFrames;
+		static Clock::time_point s_LastTime;
+		static double s_LoadMs;
+		static uint64_t s_LoadPeakJsonKB;
+		static uint64_t s_LoadPeakWorkingSetKB;
+		static std::vector<float> s_FrameMs;
+		static std::vector<std::string> s_GltfFiles;
+	};
+
+}
@@ -1,33 +1,18 @@
 ﻿#include <ie_pch.h>
 
 #include "String_Helper.h"
-#include <locale>
-#include <clocale>
+#include "Utf_Conversion.h"
+
 namespace Insight {
 
 	std::wstring StringHelper::StringToWide(const std::string& str)
 	{
-		std::wstring widestr(str.begin(), str.end());
-		return widestr;
+		return UtfConversion::Utf8ToUtf16(str);
 	}
 
 	std::string StringHelper::WideToString(const std::wstring& wStr)
 	{
-		std::setlocale(LC_ALL, "");
-		const std::locale locale("");
-		typedef std::codecvt<wchar_t, char, std::mbstate_t> converter_type;
-		const converter_type& converter = std::use_facet<converter_type>(locale);
-		std::vector<char> to(wStr.length() * converter.max_length());
-		std::mbstate_t state;
-		const wchar_t* from_next;
-		char* to_next;
-		const converter_type::result result = converter.out(state, wStr.data(), wStr.data() + wStr.length(), from_next, &to[0], &to[0] + to.size(), to_next);
-		if (result == converter_type::ok || result == converter_type::noconv) {
-			const std::string s(&to[0], to_next);
-			return s;
-		}
-
-		return "";
+		return UtfConversion::Utf16ToUtf8(wStr);
 	}
 
 	std::string StringHelper::GetDirectoryFromPath(const std::string & filepath)
@@ -0,0 +1,133 @@
+#include <ie_pch.h>
+
+#include "String_Interner.h"
+
+#include <atomic>
+#include <shared_mutex>
+
+#define IE_INTERNER_ENTRIES_PER_PAGE 4096U
+#define IE_INTERNER_MAX_PAGES 1024U
+#define IE_INTERNER_STRING_BLOCK_SIZE (64U * 1024U)
+
+namespace Insight {
+
+	struct InternedEntry
+	{
+		const char* String;
+		uint32_t Length;
+	};
+
+	// Entries live in fixed-size pages that are never moved or freed, so a
+	// symbol can be resolved without taking the lock.
+	struct InternerStorage
+	{
+		InternerStorage()
+		{
+			for (uint32_t i = 0; i < IE_INTERNER_MAX_PAGES; ++i) {
+				Pages[i].store(nullptr, std::memory_order_relaxed);
+			}
+			InsertLocked(std::string_view("", 0));
+		}
+
+		StringInterner::Symbol InsertLocked(std::string_view String)
+		{
+			const StringInterner::Symbol Id = NumSymbols.load(std::memory_order_relaxed);
+			const uint32_t PageIndex = Id / IE_INTERNER_ENTRIES_PER_PAGE;
+			IE_CORE_ASSERT(PageIndex < IE_INTERNER_MAX_PAGES, "String interner is out of symbols.");
+
+			InternedEntry* pPage = Pages[PageIndex].load(std::memory_order_relaxed);
+			if (!pPage) {
+				pPage = new InternedEntry[IE_INTERNER_ENTRIES_PER_PAGE];
+				Pages[PageIndex].store(pPage, std::memory_order_release);
+			}
+
+			const char* pStored = StoreString(String);
+			pPage[Id % IE_INTERNER_ENTRIES_PER_PAGE] = { pStored, static_cast<uint32_t>(String.size()) };
+			Lookup.emplace(std::string_view(pStored, String.size()), Id);
+
+			NumSymbols.store(Id + 1, std::memory_order_release);
+			return Id;
+		}
+
+		const char* StoreString(std::string_view String)
+		{
+			const size_t Size = String.size() + 1;
+			if (Size > IE_INTERNER_STRING_BLOCK_SIZE) {
+				char* pLarge = new char[Size];
+				memcpy(pLarge, String.data(), String.size());
+				pLarge[String.size()] = '\0';
+				return pLarge;
+			}
+			if (!pBlock || BlockOffset + Size > IE_INTERNER_STRING_BLOCK_SIZE) {
+				pBlock = new char[IE_INTERNER_STRING_BLOCK_SIZE];
+				BlockOffset = 0U;
+			}
+			char* pDest = pBlock + BlockOffset;
+			memcpy(pDest, String.data(), String.size());
+			pDest[String.size()] = '\0';
+			BlockOffset += Size;
+			return pDest;
+		}
+
+		const InternedEntry& GetEntry(StringInterner::Symbol Id) const
+		{
+			IE_CORE_ASSERT(Id < NumSymbols.load(std::memory_order_acquire), "Trying to resolve a symbol that was never interned.");
+			return Pages[Id / IE_INTERNER_ENTRIES_PER_PAGE].load(std::memory_order_acquire)[Id % IE_INTERNER_ENTRIES_PER_PAGE];
+		}
+
+		std::shared_mutex Mutex;
+		std::unordered_map<std::string_view, StringInterner::Symbol> Lookup;
+		std::atomic<InternedEntry*> Pages[IE_INTERNER_MAX_PAGES];
+		std::atomic<uint32_t> NumSymbols{ 0U };
+
+		char* pBlock = nullptr;
+		size_t BlockOffset = 0U;
+	};
+
+	static InternerStorage& GetStorage()
+	{
+		// Intentionally leaked. Symbols may be resolved during static destruction.
+		static InternerStorage* s_pStorage = new InternerStorage();
+		return *s_pStorage;
+	}
+
+	StringInterner::Symbol StringInterner::Intern(std::string_view String)
+	{
+		if (String.empty()) {
+			return EmptySymbol;
+		}
+
+		InternerStorage& Storage = GetStorage();
+		{
+			std::shared_lock<std::shared_mutex> ReadLock(Storage.Mutex);
+			auto Iter = Storage.Lookup.find(String);
+			if (Iter != Storage.Lookup.end()) {
+				return Iter->second;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> WriteLock(Storage.Mutex);
+		// Another thread may have inserted it between the two locks.
+		auto Iter = Storage.Lookup.find(String);
+		if (Iter != Storage.Lookup.end()) {
+			return Iter->second;
+		}
+		return Storage.InsertLocked(String);
+	}
+
+	const char* StringInterner::Resolve(Symbol Id)
+	{
+		return GetStorage().GetEntry(Id).String;
+	}
+
+	uint32_t StringInterner::GetLength(Symbol Id)
+	{
+		return GetStorage().GetEntry(Id).Length;
+	}
+
+	uint32_t StringInterner::GetNumSymbols()
+	{
+		return GetStorage().NumSymbols.load(std::memory_order_acquire);
+	}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <string_view>
+
+/*
+	Global, thread-safe string interning.
+
+	Every unique string is stored once for the lifetime of the application and is
+	identified by a 32-bit symbol. Comparing and hashing symbols is a single integer
+	operation, use them for names, tags and identifiers that are compared far more
+	often than they are edited.
+
+	Example usage:
+		ieSymbol Name("Point Light");
+		if (Name == OtherNode->GetDisplayNameSymbol()) { ... }
+		IE_CORE_INFO("{0}", Name.c_str());
+*/
+
+namespace Insight {
+
+	class INSIGHT_API StringInterner
+	{
+	public:
+		typedef uint32_t Symbol;
+		// The empty string is always symbol zero.
+		static const Symbol EmptySymbol = 0U;
+
+		// Returns the symbol for a string, storing a copy of the string the first time it is seen.
+		static Symbol Intern(std::string_view String);
+		// Returns the string a symbol was created from. Lock-free.
+		static const char* Resolve(Symbol Id);
+		// Returns the length of the string a symbol was created from. Lock-free.
+		static uint32_t GetLength(Symbol Id);
+		// Returns the number of unique strings interned so far.
+		static uint32_t GetNumSymbols();
+	};
+
+	class ieSymbol
+	{
+	public:
+		ieSymbol() : m_Id(StringInterner::EmptySymbol) {}
+		ieSymbol(const char* String) : m_Id(StringInterner::Intern(String ? std::string_view(String) : std::string_view())) {}
+		ieSymbol(const std::string& String) : m_Id(StringInterner::Intern(std::string_view(String))) {}
+		ieSymbol(std::string_view String) : m_Id(StringInterner::Intern(String)) {}
+
+		inline bool operator == (const ieSymbol& Other) const { return m_Id == Other.m_Id; }
+		inline bool operator != (const ieSymbol& Other) const { return m_Id != Other.m_Id; }
+		// Ordering is by creation, not alphabetical. Only meant for sorted containers.
+		inline bool operator < (const ieSymbol& Other) const { return m_Id < Other.m_Id; }
+
+		inline bool IsEmpty() const { return m_Id == StringInterner::EmptySymbol; }
+		inline StringInterner::Symbol GetId() const { return m_Id; }
+
+		inline const char* c_str() const { return StringInterner::Resolve(m_Id); }
+		inline uint32_t Length() const { return StringInterner::GetLength(m_Id); }
+		inline std::string ToString() const { return std::string(c_str(), Length()); }
+
+	private:
+		StringInterner::Symbol m_Id;
+	};
+
+}
+
+namespace std {
+
+	template <>
+	struct hash<Insight::ieSymbol>
+	{
+		size_t operator()(const Insight::ieSymbol& Symbol) const { return static_cast<size_t>(Symbol.GetId()); }
+	};
+
+}
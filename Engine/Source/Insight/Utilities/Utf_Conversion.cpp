@@ -0,0 +1,178 @@
+#include <ie_pch.h>
+
+#include "Utf_Conversion.h"
+
+#include <emmintrin.h>
+
+#define IE_UTF_REPLACEMENT_CHARACTER 0xFFFDU
+
+namespace Insight {
+
+	static_assert(sizeof(wchar_t) == 2, "UTF conversion assumes a 16-bit wchar_t.");
+
+	static inline size_t WriteUtf16(uint32_t CodePoint, wchar_t* pDest)
+	{
+		if (CodePoint < 0x10000U) {
+			pDest[0] = static_cast<wchar_t>(CodePoint);
+			return 1;
+		}
+		CodePoint -= 0x10000U;
+		pDest[0] = static_cast<wchar_t>(0xD800U + (CodePoint >> 10));
+		pDest[1] = static_cast<wchar_t>(0xDC00U + (CodePoint & 0x3FFU));
+		return 2;
+	}
+
+	static inline size_t WriteUtf8(uint32_t CodePoint, char* pDest)
+	{
+		if (CodePoint < 0x80U) {
+			pDest[0] = static_cast<char>(CodePoint);
+			return 1;
+		}
+		if (CodePoint < 0x800U) {
+			pDest[0] = static_cast<char>(0xC0U | (CodePoint >> 6));
+			pDest[1] = static_cast<char>(0x80U | (CodePoint & 0x3FU));
+			return 2;
+		}
+		if (CodePoint < 0x10000U) {
+			pDest[0] = static_cast<char>(0xE0U | (CodePoint >> 12));
+			pDest[1] = static_cast<char>(0x80U | ((CodePoint >> 6) & 0x3FU));
+			pDest[2] = static_cast<char>(0x80U | (CodePoint & 0x3FU));
+			return 3;
+		}
+		pDest[0] = static_cast<char>(0xF0U | (CodePoint >> 18));
+		pDest[1] = static_cast<char>(0x80U | ((CodePoint >> 12) & 0x3FU));
+		pDest[2] = static_cast<char>(0x80U | ((CodePoint >> 6) & 0x3FU));
+		pDest[3] = static_cast<char>(0x80U | (CodePoint & 0x3FU));
+		return 4;
+	}
+
+	// Decodes one code point starting at pSource[Index] and advances Index past it.
+	// Overlong forms, surrogates and truncated sequences decode to the replacement
+	// character and consume a single byte so decoding can resynchronise.
+	static inline uint32_t DecodeUtf8(const uint8_t* pSource, size_t Length, size_t& Index)
+	{
+		const uint8_t Lead = pSource[Index];
+		uint32_t CodePoint;
+		size_t NumContinuation;
+		uint32_t MinCodePoint;
+
+		if (Lead < 0x80U) { Index++; return Lead; }
+		else if ((Lead & 0xE0U) == 0xC0U) { CodePoint = Lead & 0x1FU; NumContinuation = 1; MinCodePoint = 0x80U; }
+		else if ((Lead & 0xF0U) == 0xE0U) { CodePoint = Lead & 0x0FU; NumContinuation = 2; MinCodePoint = 0x800U; }
+		else if ((Lead & 0xF8U) == 0xF0U) { CodePoint = Lead & 0x07U; NumContinuation = 3; MinCodePoint = 0x10000U; }
+		else { Index++; return IE_UTF_REPLACEMENT_CHARACTER; }
+
+		if (Length - Index <= NumContinuation) {
+			Index++;
+			return IE_UTF_REPLACEMENT_CHARACTER;
+		}
+		for (size_t i = 1; i <= NumContinuation; ++i) {
+			const uint8_t Continuation = pSource[Index + i];
+			if ((Continuation & 0xC0U) != 0x80U) {
+				Index++;
+				return IE_UTF_REPLACEMENT_CHARACTER;
+			}
+			CodePoint = (CodePoint << 6) | (Continuation & 0x3FU);
+		}
+		if (CodePoint < MinCodePoint || CodePoint > 0x10FFFFU || (CodePoint >= 0xD800U && CodePoint <= 0xDFFFU)) {
+			Index++;
+			return IE_UTF_REPLACEMENT_CHARACTER;
+		}
+		Index += NumContinuation + 1;
+		return CodePoint;
+	}
+
+	size_t UtfConversion::Utf8ToUtf16(const char* pSource, size_t Length, wchar_t* pDest)
+	{
+		const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pSource);
+		const __m128i Zero = _mm_setzero_si128();
+		size_t SrcIndex = 0;
+		size_t DestIndex = 0;
+
+		while (SrcIndex < Length) {
+			// Widen 16 ASCII bytes at a time. Any byte with the high bit set drops to the scalar path.
+			while (SrcIndex + 16 <= Length) {
+				const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBytes + SrcIndex));
+				if (_mm_movemask_epi8(Chunk) != 0) {
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + DestIndex), _mm_unpacklo_epi8(Chunk, Zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + DestIndex + 8), _mm_unpackhi_epi8(Chunk, Zero));
+				SrcIndex += 16;
+				DestIndex += 16;
+			}
+			if (SrcIndex >= Length) {
+				break;
+			}
+
+			if (pBytes[SrcIndex] < 0x80U) {
+				pDest[DestIndex++] = static_cast<wchar_t>(pBytes[SrcIndex++]);
+			}
+			else {
+				const uint32_t CodePoint = DecodeUtf8(pBytes, Length, SrcIndex);
+				DestIndex += WriteUtf16(CodePoint, pDest + DestIndex);
+			}
+		}
+		return DestIndex;
+	}
+
+	size_t UtfConversion::Utf16ToUtf8(const wchar_t* pSource, size_t Length, char* pDest)
+	{
+		const __m128i NonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+		const __m128i Zero = _mm_setzero_si128();
+		size_t SrcIndex = 0;
+		size_t DestIndex = 0;
+
+		while (SrcIndex < Length) {
+			// Narrow 16 ASCII code units at a time.
+			while (SrcIndex + 16 <= Length) {
+				const __m128i Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + SrcIndex));
+				const __m128i High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + SrcIndex + 8));
+				const __m128i NonAscii = _mm_and_si128(_mm_or_si128(Low, High), NonAsciiMask);
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(NonAscii, Zero)) != 0xFFFF) {
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDest + DestIndex), _mm_packus_epi16(Low, High));
+				SrcIndex += 16;
+				DestIndex += 16;
+			}
+			if (SrcIndex >= Length) {
+				break;
+			}
+
+			uint32_t CodePoint = static_cast<uint16_t>(pSource[SrcIndex++]);
+			if (CodePoint >= 0xD800U && CodePoint <= 0xDBFFU) {
+				const uint32_t Trail = (SrcIndex < Length) ? static_cast<uint16_t>(pSource[SrcIndex]) : 0U;
+				if (Trail >= 0xDC00U && Trail <= 0xDFFFU) {
+					CodePoint = 0x10000U + ((CodePoint - 0xD800U) << 10) + (Trail - 0xDC00U);
+					SrcIndex++;
+				}
+				else {
+					CodePoint = IE_UTF_REPLACEMENT_CHARACTER;
+				}
+			}
+			else if (CodePoint >= 0xDC00U && CodePoint <= 0xDFFFU) {
+				CodePoint = IE_UTF_REPLACEMENT_CHARACTER;
+			}
+			DestIndex += WriteUtf8(CodePoint, pDest + DestIndex);
+		}
+		return DestIndex;
+	}
+
+	std::wstring UtfConversion::Utf8ToUtf16(std::string_view Source)
+	{
+		std::wstring Result;
+		Result.resize(MaxUtf16LengthForUtf8(Source.size()));
+		Result.resize(Utf8ToUtf16(Source.data(), Source.size(), Result.data()));
+		return Result;
+	}
+
+	std::string UtfConversion::Utf16ToUtf8(std::wstring_view Source)
+	{
+		std::string Result;
+		Result.resize(MaxUtf8LengthForUtf16(Source.size()));
+		Result.resize(Utf16ToUtf8(Source.data(), Source.size(), Result.data()));
+		return Result;
+	}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Insight/Core.h>
+
+#include <string_view>
+
+/*
+	Locale independent UTF-8 <-> UTF-16 conversion.
+
+	Runs of ASCII, which is nearly every path and name in a project, are converted
+	16 code units at a time with SSE2. Anything else falls back to a scalar decoder.
+	Malformed input is replaced with U+FFFD rather than failing.
+*/
+
+namespace Insight {
+
+	class INSIGHT_API UtfConversion
+	{
+	public:
+		// Worst case output sizes, in code units, for a source of 'Length' code units.
+		static inline size_t MaxUtf16LengthForUtf8(size_t Length) { return Length; }
+		static inline size_t MaxUtf8LengthForUtf16(size_t Length) { return Length * 3; }
+
+		// Convert into a caller provided buffer large enough for the worst case.
+		// Returns the number of code units written. Does not null terminate.
+		static size_t Utf8ToUtf16(const char* pSource, size_t Length, wchar_t* pDest);
+		static size_t Utf16ToUtf8(const wchar_t* pSource, size_t Length, char* pDest);
+
+		static std::wstring Utf8ToUtf16(std::string_view Source);
+		static std::string Utf16ToUtf8(std::wstring_view Source);
+	};
+
+}
@@ -101,6 +101,11 @@ namespace Insight {
 		m_pDeviceContext->PSSetShader(m_GeometryPassPS.GetShader(), nullptr, 0);
 	}
 
+	void D3D11DeferredShadingTech::SetGeometryPassVertexLayout(eVertexLayout Layout)
+	{
+		m_pDeviceContext->IASetInputLayout((Layout == eVertexLayout::PackedFullPrecisionUV) ? m_pGeometryPassFullPrecisionUVInputLayout.Get() : m_GeometryPassVS.GetInputLayout());
+	}
+
 	void D3D11DeferredShadingTech::BindLightPass()
 	{
 		m_pDeviceContext->IASetInputLayout(m_LightPassVS.GetInputLayout());
@@ -167,17 +172,24 @@ namespace Insight {
 		LPCWSTR PixelShaderFolder = L"Geometry_Pass.pixel.cso";
 #endif 
 
-		D3D11_INPUT_ELEMENT_DESC InputLayout[5] =
+		// Matches PackedVertex3D.
+		D3D11_INPUT_ELEMENT_DESC InputLayout[4] =
 		{
-			{ "POSITION",  0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "TEXCOORD",  0, DXGI_FORMAT_R32G32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "NORMAL",    0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0  },
-			{ "TANGENT",   0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0  },
-			{ "BITANGENT", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0  },
+			{ "POSITION",  0, DXGI_FORMAT_R32G32B32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD",  0, DXGI_FORMAT_R16G16_FLOAT,       0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "NORMAL",    0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0  },
+			{ "TANGENT",   0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0  },
 		};
 		m_GeometryPassVS.Init(m_pDevice, VertexShaderFolder, InputLayout, ARRAYSIZE(InputLayout));
 		m_GeometryPassPS.Init(m_pDevice, PixelShaderFolder);
 
+		// Matches PackedVertex3DFullPrecisionUV.
+		if (!m_pGeometryPassFullPrecisionUVInputLayout) {
+			InputLayout[1].Format = DXGI_FORMAT_R32G32_FLOAT;
+			hr = m_pDevice->CreateInputLayout(InputLayout, ARRAYSIZE(InputLayout), m_GeometryPassVS.GetBuffer()->GetBufferPointer(), m_GeometryPassVS.GetBuffer()->GetBufferSize(), m_pGeometryPassFullPrecisionUVInputLayout.GetAddressOf());
+			ThrowIfFailed(hr, "Failed to create full precision UV input layout for D3D 11 geometry pass.");
+		}
+
 		D3D11_TEXTURE2D_DESC TextureDesc = {};
 		TextureDesc.Width = m_pWindow->GetWidth();
 		TextureDesc.Height = m_pWindow->GetHeight();
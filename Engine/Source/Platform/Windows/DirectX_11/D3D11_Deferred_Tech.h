@@ -3,6 +3,7 @@
 #include <Insight/Core.h>
 
 #include "Platform/Windows/DirectX_11/D3D11_Shader.h"
+#include "Insight/Rendering/Geometry/Vertex.h"
 
 namespace Insight {
 
@@ -44,6 +45,8 @@ namespace Insight {
 
 		void PrepPipelineForRenderPass();
 		void BindGeometryPass();
+		// Select the geometry pass input layout for the meshes drawn next.
+		void SetGeometryPassVertexLayout(eVertexLayout Layout);
 		void BindLightPass();
 		void BindSkyPass();
 		void BindPostFxPass();
@@ -74,6 +77,8 @@ namespace Insight {
 		// -------------
 		VertexShader m_GeometryPassVS;
 		PixelShader m_GeometryPassPS;
+		// m_GeometryPassVS's own input layout matches PackedVertex3D.
+		ComPtr<ID3D11InputLayout> m_pGeometryPassFullPrecisionUVInputLayout = nullptr;
 		//0:  SRV-Albedo(RTV->SRV)
 		//1:  SRV-Normal(RTV->SRV)
 		//2:  SRV-(R)Roughness/(G)Metallic/(B)AO(RTV->SRV)
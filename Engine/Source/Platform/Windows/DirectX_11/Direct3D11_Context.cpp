@@ -52,6 +52,11 @@ namespace Insight {
 		return true;
 	}
 
+	void Direct3D11Context::SetVertexLayoutImpl(eVertexLayout Layout)
+	{
+		m_DeferredShadingTech.SetGeometryPassVertexLayout(Layout);
+	}
+
 	void Direct3D11Context::SetVertexBuffersImpl(uint32_t StartSlot, uint32_t NumBuffers, ieVertexBuffer* pBuffers)
 	{
 		m_pDeviceContext->IASetVertexBuffers(StartSlot, NumBuffers, reinterpret_cast<D3D11VertexBuffer*>(pBuffers)->GetBufferPtr(), reinterpret_cast<D3D11VertexBuffer*>(pBuffers)->GetStridePtr(), reinterpret_cast<D3D11VertexBuffer*>(pBuffers)->GetBufferOffset());
@@ -50,6 +50,7 @@ namespace Insight {
 		// Tells the swapchain to enable full screen rendering.
 		virtual void OnWindowFullScreenImpl() override;
 
+		virtual void SetVertexLayoutImpl(eVertexLayout Layout) override;
 		virtual void SetVertexBuffersImpl(uint32_t StartSlot, uint32_t NumBuffers, ieVertexBuffer* pBuffers) override;
 		virtual void SetIndexBufferImpl(ieIndexBuffer* pBuffer) override;
 		virtual void DrawIndexedInstancedImpl(uint32_t IndexCountPerInstance, uint32_t NumInstances, uint32_t StartIndexLocation, uint32_t BaseVertexLoaction, uint32_t StartInstanceLocation) override;
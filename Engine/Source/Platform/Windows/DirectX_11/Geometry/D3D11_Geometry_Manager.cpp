@@ -70,7 +70,7 @@ namespace Insight {
 
 
 					s_Instance->m_Models[i]->BindResources();
-					s_Instance->m_Models[i]->GetMeshAtIndex(j)->Render(nullptr);
+					s_Instance->m_Models[i]->GetMeshAtIndex(j)->RenderVisible(nullptr);
 				}
 			}
 		}
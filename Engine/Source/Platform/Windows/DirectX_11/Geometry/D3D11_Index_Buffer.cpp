@@ -6,13 +6,11 @@
 
 namespace Insight {
 
-	D3D11IndexBuffer::D3D11IndexBuffer(Indices Indices)
-		: ieIndexBuffer(Indices)
+	D3D11IndexBuffer::D3D11IndexBuffer(std::vector<uint8_t> Data, bool Is16Bit)
+		: ieIndexBuffer(std::move(Data), Is16Bit)
 	{
-		m_NumIndices = static_cast<uint32_t>(Indices.size());
-		m_BufferSize = m_NumIndices * sizeof(uint32_t);
 		m_BufferOffset = 0U;
-		m_Format = DXGI_FORMAT::DXGI_FORMAT_R32_UINT;
+		m_Format = Is16Bit ? DXGI_FORMAT::DXGI_FORMAT_R16_UINT : DXGI_FORMAT::DXGI_FORMAT_R32_UINT;
 
 		CreateResources();
 	}
@@ -34,15 +32,17 @@ namespace Insight {
 		D3D11_BUFFER_DESC IndexBufferDesc;
 		ZeroMemory(&IndexBufferDesc, sizeof(IndexBufferDesc));
 		IndexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-		IndexBufferDesc.ByteWidth = sizeof(DWORD) * m_NumIndices;
+		IndexBufferDesc.ByteWidth = m_BufferSize;
 		IndexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 		IndexBufferDesc.CPUAccessFlags = 0;
 		IndexBufferDesc.MiscFlags = 0;
 
 		D3D11_SUBRESOURCE_DATA indexBufferData;
-		indexBufferData.pSysMem = reinterpret_cast<void*>(m_Indices.data());
+		indexBufferData.pSysMem = reinterpret_cast<void*>(m_Data.data());
 		HRESULT hr = D3D11Context->GetDevice().CreateBuffer(&IndexBufferDesc, &indexBufferData, &m_pIndexBuffer);
 		ThrowIfFailed(hr, "Failed to create index buffer for D3D 11 context.");
+		// CreateBuffer copies the initial data, nothing reads it after this.
+		ReleaseCPUData();
 
 		return true;
 	}
@@ -9,7 +9,7 @@ namespace Insight {
 	class INSIGHT_API D3D11IndexBuffer : public ieIndexBuffer
 	{
 	public:
-		D3D11IndexBuffer(Indices Indices);
+		D3D11IndexBuffer(std::vector<uint8_t> Data, bool Is16Bit);
 		~D3D11IndexBuffer()
 		{
 			Destroy();
@@ -9,13 +9,10 @@ namespace Insight {
 
 
 
-	D3D11VertexBuffer::D3D11VertexBuffer(Verticies Verticies)
+	D3D11VertexBuffer::D3D11VertexBuffer(std::vector<uint8_t> Data, uint32_t Stride)
+		: ieVertexBuffer(std::move(Data), Stride)
 	{
-		m_NumVerticies = static_cast<uint32_t>(Verticies.size());
-		m_BufferSize = m_NumVerticies * sizeof(Vertex3D);
-		m_Stride = sizeof(Vertex3D);
 		m_BufferOffset = 0U;
-		m_Verticies = std::move(Verticies);
 
 		CreateResources();
 	}
@@ -36,15 +33,17 @@ namespace Insight {
 		D3D11_BUFFER_DESC VertexBufferDesc = {};
 		VertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		VertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-		VertexBufferDesc.ByteWidth = m_Stride * m_NumVerticies;
+		VertexBufferDesc.ByteWidth = m_BufferSize;
 		VertexBufferDesc.CPUAccessFlags = 0;
 		VertexBufferDesc.MiscFlags = 0;
 
 		D3D11_SUBRESOURCE_DATA VertexBufferData;
-		VertexBufferData.pSysMem = m_Verticies.data();
+		VertexBufferData.pSysMem = m_Data.data();
 
 		HRESULT hr = D3D11Context->GetDevice().CreateBuffer(&VertexBufferDesc, &VertexBufferData, &m_pVertexBuffer);
 		ThrowIfFailed(hr, "Failed to create vertex buffer for D3D 11 context.");
+		// CreateBuffer copies the initial data, nothing reads it after this.
+		ReleaseCPUData();
 
 		return true;
 	}
@@ -9,7 +9,7 @@ namespace Insight {
 	class INSIGHT_API D3D11VertexBuffer : public ieVertexBuffer
 	{
 	public:
-		D3D11VertexBuffer(Verticies Verticies);
+		D3D11VertexBuffer(std::vector<uint8_t> Data, uint32_t Stride);
 		virtual ~D3D11VertexBuffer()
 		{
 			Destroy();
@@ -17,7 +17,6 @@ namespace Insight {
 		virtual void Destroy() override;
 
 		inline const UINT* GetBufferOffset() { return &m_BufferOffset; }
-		inline const UINT GetStride() const { return m_Stride; }
 		inline const UINT* GetStridePtr() const { return &m_Stride; }
 		inline ID3D11Buffer* const* GetBufferPtr() { return &m_pVertexBuffer; }
 
@@ -26,7 +25,6 @@ namespace Insight {
 
 	private:
 		ID3D11Buffer* m_pVertexBuffer = 0;
-		UINT m_Stride;
 		UINT m_BufferOffset;
 	};
 
@@ -9,7 +9,67 @@
 
 namespace Insight {
 
+	// Bytes taken by every mip level and array slice of a texture. D3D 11 does not report
+	// the driver's allocation size, so padding and alignment are not included.
+	static uint64_t GetTextureSizeInBytes(const D3D11_TEXTURE2D_DESC& Desc)
+	{
+		// Block compressed formats store 4x4 texels per block.
+		uint32_t BytesPerBlock = 0U;
+		uint32_t BytesPerTexel = 4U;
+		switch (Desc.Format) {
+		case DXGI_FORMAT_BC1_TYPELESS: case DXGI_FORMAT_BC1_UNORM: case DXGI_FORMAT_BC1_UNORM_SRGB:
+		case DXGI_FORMAT_BC4_TYPELESS: case DXGI_FORMAT_BC4_UNORM: case DXGI_FORMAT_BC4_SNORM:
+			BytesPerBlock = 8U;
+			break;
+		case DXGI_FORMAT_BC2_TYPELESS: case DXGI_FORMAT_BC2_UNORM: case DXGI_FORMAT_BC2_UNORM_SRGB:
+		case DXGI_FORMAT_BC3_TYPELESS: case DXGI_FORMAT_BC3_UNORM: case DXGI_FORMAT_BC3_UNORM_SRGB:
+		case DXGI_FORMAT_BC5_TYPELESS: case DXGI_FORMAT_BC5_UNORM: case DXGI_FORMAT_BC5_SNORM:
+		case DXGI_FORMAT_BC6H_TYPELESS: case DXGI_FORMAT_BC6H_UF16: case DXGI_FORMAT_BC6H_SF16:
+		case DXGI_FORMAT_BC7_TYPELESS: case DXGI_FORMAT_BC7_UNORM: case DXGI_FORMAT_BC7_UNORM_SRGB:
+			BytesPerBlock = 16U;
+			break;
+		case DXGI_FORMAT_R32G32B32A32_TYPELESS: case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		case DXGI_FORMAT_R32G32B32A32_UINT: case DXGI_FORMAT_R32G32B32A32_SINT:
+			BytesPerTexel = 16U;
+			break;
+		case DXGI_FORMAT_R32G32B32_TYPELESS: case DXGI_FORMAT_R32G32B32_FLOAT:
+		case DXGI_FORMAT_R32G32B32_UINT: case DXGI_FORMAT_R32G32B32_SINT:
+			BytesPerTexel = 12U;
+			break;
+		case DXGI_FORMAT_R16G16B16A16_TYPELESS: case DXGI_FORMAT_R16G16B16A16_FLOAT: case DXGI_FORMAT_R16G16B16A16_UNORM:
+		case DXGI_FORMAT_R16G16B16A16_UINT: case DXGI_FORMAT_R16G16B16A16_SNORM: case DXGI_FORMAT_R16G16B16A16_SINT:
+		case DXGI_FORMAT_R32G32_TYPELESS: case DXGI_FORMAT_R32G32_FLOAT: case DXGI_FORMAT_R32G32_UINT: case DXGI_FORMAT_R32G32_SINT:
+			BytesPerTexel = 8U;
+			break;
+		case DXGI_FORMAT_R16_TYPELESS: case DXGI_FORMAT_R16_FLOAT: case DXGI_FORMAT_R16_UNORM:
+		case DXGI_FORMAT_R16_UINT: case DXGI_FORMAT_R16_SNORM: case DXGI_FORMAT_R16_SINT:
+		case DXGI_FORMAT_R8G8_TYPELESS: case DXGI_FORMAT_R8G8_UNORM: case DXGI_FORMAT_R8G8_UINT:
+		case DXGI_FORMAT_R8G8_SNORM: case DXGI_FORMAT_R8G8_SINT:
+			BytesPerTexel = 2U;
+			break;
+		case DXGI_FORMAT_R8_TYPELESS: case DXGI_FORMAT_R8_UNORM: case DXGI_FORMAT_R8_UINT:
+		case DXGI_FORMAT_R8_SNORM: case DXGI_FORMAT_R8_SINT: case DXGI_FORMAT_A8_UNORM:
+			BytesPerTexel = 1U;
+			break;
+		default:
+			// 8 bit RGBA, 10-10-10-2 and single channel 32 bit formats.
+			break;
+		}
 
+		uint64_t Bytes = 0U;
+		const uint32_t MipLevels = (Desc.MipLevels > 0U) ? Desc.MipLevels : 1U;
+		for (uint32_t Mip = 0; Mip < MipLevels; ++Mip) {
+			const uint64_t Width = (Desc.Width >> Mip) ? (Desc.Width >> Mip) : 1U;
+			const uint64_t Height = (Desc.Height >> Mip) ? (Desc.Height >> Mip) : 1U;
+			if (BytesPerBlock > 0U) {
+				Bytes += ((Width + 3U) / 4U) * ((Height + 3U) / 4U) * BytesPerBlock;
+			}
+			else {
+				Bytes += Width * Height * BytesPerTexel;
+			}
+		}
+		return Bytes * Desc.ArraySize;
+	}
 
 	ieD3D11Texture::ieD3D11Texture(IE_TEXTURE_INFO CreateInfo)
 	{
@@ -19,6 +79,9 @@ namespace Insight {
 
 	ieD3D11Texture::~ieD3D11Texture()
 	{
+		if (m_VideoMemoryBytes > 0U) {
+			MemoryTracker::RecordFree(eMemoryCategory::TextureVideoMemory, m_VideoMemoryBytes);
+		}
 	}
 
 	void ieD3D11Texture::Destroy()
@@ -36,16 +99,15 @@ namespace Insight {
 		m_pDevice = &Context->GetDevice();
 		m_pDeviceContext = &Context->GetDeviceContext();
 
-		std::string Filepath = StringHelper::WideToString(m_TextureInfo.Filepath);
-		m_TextureInfo.DisplayName = StringHelper::GetFilenameFromDirectory(Filepath);
+		m_TextureInfo.DisplayName = m_TextureInfo.Filepath.GetFilename();
 
-		std::string FileExtension = StringHelper::GetFileExtension(Filepath);
-		if (FileExtension == "dds") {
+		if (m_TextureInfo.Filepath.GetExtension() == "dds") {
 			InitDDSTexture();
 		}
 		else {
 			InitTextureFromFile();
 		}
+		RecordVideoMemory();
 
 		m_ShaderRegister = GetShaderRegisterLocation();
 
@@ -54,16 +116,32 @@ namespace Insight {
 
 	void ieD3D11Texture::InitDDSTexture()
 	{
-		HRESULT hr = DirectX::CreateDDSTextureFromFile(m_pDevice.Get(), m_pDeviceContext.Get(), m_TextureInfo.Filepath.c_str(), nullptr, m_pTextureView.GetAddressOf());
+		HRESULT hr = DirectX::CreateDDSTextureFromFile(m_pDevice.Get(), m_pDeviceContext.Get(), m_TextureInfo.Filepath.ToAbsoluteWide().c_str(), nullptr, m_pTextureView.GetAddressOf());
 		ThrowIfFailed(hr, "Failed to load D3D 11 DDS texture from file.");
 	}
 
 	void ieD3D11Texture::InitTextureFromFile()
 	{
-		HRESULT hr = DirectX::CreateWICTextureFromFile(m_pDevice.Get(), m_TextureInfo.Filepath.c_str(), nullptr, m_pTextureView.GetAddressOf());
+		HRESULT hr = DirectX::CreateWICTextureFromFile(m_pDevice.Get(), m_TextureInfo.Filepath.ToAbsoluteWide().c_str(), nullptr, m_pTextureView.GetAddressOf());
 		ThrowIfFailed(hr, "Failed to load D3D 11 WIC texture from file.");
 	}
 
+	void ieD3D11Texture::RecordVideoMemory()
+	{
+		ComPtr<ID3D11Resource> pResource;
+		m_pTextureView->GetResource(pResource.GetAddressOf());
+		ComPtr<ID3D11Texture2D> pTexture;
+		if (FAILED(pResource.As(&pTexture))) {
+			IE_CORE_WARN("Texture \"{0}\" is not a 2D texture, its video memory is not tracked.", m_TextureInfo.DisplayName);
+			return;
+		}
+		D3D11_TEXTURE2D_DESC Desc;
+		pTexture->GetDesc(&Desc);
+
+		m_VideoMemoryBytes = GetTextureSizeInBytes(Desc);
+		MemoryTracker::RecordAllocation(eMemoryCategory::TextureVideoMemory, m_VideoMemoryBytes);
+	}
+
 	uint32_t ieD3D11Texture::GetShaderRegisterLocation()
 	{
 		switch (m_TextureInfo.Type)
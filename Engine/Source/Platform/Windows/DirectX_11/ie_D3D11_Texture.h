@@ -27,12 +27,15 @@ namespace Insight {
 		// Load  generic texture file from disk.
 		void InitTextureFromFile();
 		uint32_t GetShaderRegisterLocation();
+		// Record the size of the created texture against TextureVideoMemory.
+		void RecordVideoMemory();
 	private:
 		ComPtr<ID3D11Device> m_pDevice;
 		ComPtr<ID3D11DeviceContext> m_pDeviceContext;
 
 		ComPtr<ID3D11ShaderResourceView> m_pTextureView;
 		uint32_t m_ShaderRegister;
+		uint64_t m_VideoMemoryBytes = 0U;
 	};
 
 }
@@ -40,6 +40,7 @@ namespace Insight {
 		// Wait until GPU is done consuming all data
 		// before closing all handles and releasing resources
 		WaitForGPU();
+		ReleasePendingUploads();
 
 		if (!m_AllowTearing) {
 			m_pSwapChain->SetFullscreenState(false, NULL);
@@ -213,6 +214,7 @@ namespace Insight {
 		m_pShadowPassCommandList->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
 
 		m_pShadowPassCommandList->SetPipelineState(m_pPipelineStateObject_ShadowPass.Get());
+		m_ActiveVertexLayout = eVertexLayout::Packed;
 		m_pShadowPassCommandList->SetGraphicsRootSignature(m_pRootSignature.Get());
 		m_pShadowPassCommandList->ClearDepthStencilView(m_dsvHeap.hCPU(1), D3D12_CLEAR_FLAG_DEPTH, m_DepthClearValue, 0xff, 0, nullptr);
 
@@ -231,9 +233,11 @@ namespace Insight {
 		ID3D12DescriptorHeap* ppHeaps[] = { m_cbvsrvHeap.pDH.Get() };
 		m_pScenePassCommandList->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
 
+		// The command list was reset with the geometry pass PSO when 'setPSO' is false.
 		if (setPSO) {
 			m_pScenePassCommandList->SetPipelineState(m_pPipelineStateObject_GeometryPass.Get());
 		}
+		m_ActiveVertexLayout = eVertexLayout::Packed;
 
 		for (int i = 0; i < m_NumRTV - 1; i++) {
 			m_pScenePassCommandList->ClearRenderTargetView(m_rtvHeap.hCPU(i), m_ClearColor, 0, nullptr);
@@ -349,6 +353,7 @@ namespace Insight {
 		m_pCommandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
 
 		WaitForGPU();
+		ReleasePendingUploads();
 	}
 
 	void Direct3D12Context::SwapBuffersImpl()
@@ -495,6 +500,22 @@ namespace Insight {
 		m_FullScreenMode = !m_FullScreenMode;
 	}
 
+	void Direct3D12Context::SetVertexLayoutImpl(eVertexLayout Layout)
+	{
+		if (Layout == m_ActiveVertexLayout) {
+			return;
+		}
+		m_ActiveVertexLayout = Layout;
+
+		const bool IsShadowPass = m_pActiveCommandList == m_pShadowPassCommandList;
+		if (Layout == eVertexLayout::PackedFullPrecisionUV) {
+			m_pActiveCommandList->SetPipelineState(IsShadowPass ? m_pPipelineStateObject_ShadowPassFullPrecisionUV.Get() : m_pPipelineStateObject_GeometryPassFullPrecisionUV.Get());
+		}
+		else {
+			m_pActiveCommandList->SetPipelineState(IsShadowPass ? m_pPipelineStateObject_ShadowPass.Get() : m_pPipelineStateObject_GeometryPass.Get());
+		}
+	}
+
 	void Direct3D12Context::SetVertexBuffersImpl(uint32_t StartSlot, uint32_t NumBuffers, ieVertexBuffer* pBuffers)
 	{
 		m_pActiveCommandList->IASetVertexBuffers(StartSlot, NumBuffers, reinterpret_cast<D3D12VertexBuffer*>(pBuffers)->GetVertexBufferView());
@@ -924,13 +945,13 @@ namespace Insight {
 		PixelShaderBytecode.BytecodeLength = pPixelShader->GetBufferSize();
 		PixelShaderBytecode.pShaderBytecode = pPixelShader->GetBufferPointer();
 
-		D3D12_INPUT_ELEMENT_DESC InputLayout[5] =
+		// Matches PackedVertex3D.
+		D3D12_INPUT_ELEMENT_DESC InputLayout[4] =
 		{
-			{ "POSITION",  0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-			{ "TEXCOORD",  0, DXGI_FORMAT_R32G32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-			{ "NORMAL",    0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
-			{ "TANGENT",   0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
-			{ "BITANGENT", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
+			{ "POSITION",  0, DXGI_FORMAT_R32G32B32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD",  0, DXGI_FORMAT_R16G16_FLOAT,       0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "NORMAL",    0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
+			{ "TANGENT",   0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
 		};
 
 		D3D12_INPUT_LAYOUT_DESC InputLayoutDesc = {};
@@ -963,6 +984,12 @@ namespace Insight {
 		hr = m_pDevice->CreateGraphicsPipelineState(&PsoDesc, IID_PPV_ARGS(&m_pPipelineStateObject_ShadowPass));
 		ThrowIfFailed(hr, "Failed to create graphics pipeline state for shadow pass in D3D 12 context.");
 		m_pPipelineStateObject_ShadowPass->SetName(L"PSO Shadow Pass");
+
+		// Matches PackedVertex3DFullPrecisionUV.
+		InputLayout[1].Format = DXGI_FORMAT_R32G32_FLOAT;
+		hr = m_pDevice->CreateGraphicsPipelineState(&PsoDesc, IID_PPV_ARGS(&m_pPipelineStateObject_ShadowPassFullPrecisionUV));
+		ThrowIfFailed(hr, "Failed to create full precision UV graphics pipeline state for shadow pass in D3D 12 context.");
+		m_pPipelineStateObject_ShadowPassFullPrecisionUV->SetName(L"PSO Shadow Pass Full Precision UV");
 	}
 
 	void Direct3D12Context::CreateGeometryPassPSO()
@@ -994,13 +1021,13 @@ namespace Insight {
 		pixelShaderBytecode.BytecodeLength = pPixelShader->GetBufferSize();
 		pixelShaderBytecode.pShaderBytecode = pPixelShader->GetBufferPointer();
 
-		D3D12_INPUT_ELEMENT_DESC inputLayout[5] =
+		// Matches PackedVertex3D.
+		D3D12_INPUT_ELEMENT_DESC inputLayout[4] =
 		{
-			{ "POSITION",  0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-			{ "TEXCOORD",  0, DXGI_FORMAT_R32G32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-			{ "NORMAL",    0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
-			{ "TANGENT",   0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
-			{ "BITANGENT", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
+			{ "POSITION",  0, DXGI_FORMAT_R32G32B32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD",  0, DXGI_FORMAT_R16G16_FLOAT,       0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "NORMAL",    0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
+			{ "TANGENT",   0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0  },
 		};
 
 		D3D12_INPUT_LAYOUT_DESC InputLayoutDesc = {};
@@ -1029,6 +1056,12 @@ namespace Insight {
 		hr = m_pDevice->CreateGraphicsPipelineState(&PsoDesc, IID_PPV_ARGS(&m_pPipelineStateObject_GeometryPass));
 		ThrowIfFailed(hr, "Failed to create graphics pipeline state for geometry pass.");
 		m_pPipelineStateObject_GeometryPass->SetName(L"PSO Geometry Pass");
+
+		// Matches PackedVertex3DFullPrecisionUV.
+		inputLayout[1].Format = DXGI_FORMAT_R32G32_FLOAT;
+		hr = m_pDevice->CreateGraphicsPipelineState(&PsoDesc, IID_PPV_ARGS(&m_pPipelineStateObject_GeometryPassFullPrecisionUV));
+		ThrowIfFailed(hr, "Failed to create full precision UV graphics pipeline state for geometry pass.");
+		m_pPipelineStateObject_GeometryPassFullPrecisionUV->SetName(L"PSO Geometry Pass Full Precision UV");
 	}
 
 	void Direct3D12Context::CreateSkyPassPSO()
@@ -1510,6 +1543,14 @@ namespace Insight {
 		m_FenceValues[m_FrameIndex]++;
 	}
 
+	void Direct3D12Context::ReleasePendingUploads()
+	{
+		for (ID3D12Resource* pResource : m_PendingUploadReleases) {
+			COM_SAFE_RELEASE(pResource);
+		}
+		m_PendingUploadReleases.clear();
+	}
+
 	void Direct3D12Context::UpdateSizeDependentResources()
 	{
 		UpdateViewAndScissor();
@@ -51,6 +51,7 @@ namespace Insight {
 		virtual void OnWindowResizeImpl() override;
 		virtual void OnWindowFullScreenImpl() override;
 
+		virtual void SetVertexLayoutImpl(eVertexLayout Layout) override;
 		virtual void SetVertexBuffersImpl(uint32_t StartSlot, uint32_t NumBuffers, ieVertexBuffer* pBuffers) override;
 		virtual void SetIndexBufferImpl(ieIndexBuffer* pBuffer) override;
 		virtual void DrawIndexedInstancedImpl(uint32_t IndexCountPerInstance, uint32_t NumInstances, uint32_t StartIndexLocation, uint32_t BaseVertexLoaction, uint32_t StartInstanceLocation) override;
@@ -68,6 +69,10 @@ namespace Insight {
 		inline ID3D12Resource& GetConstantBufferPerObjectUploadHeap() const { return *m_PerObjectCBV[m_FrameIndex].Get(); }
 		inline UINT8& GetPerObjectCBVGPUHeapAddress() { return *m_cbvPerObjectGPUAddress[m_FrameIndex]; }
 
+		// Release 'pResource' once the GPU has executed the command lists recorded so far.
+		// Used for upload heaps, whose copies are recorded on the scene pass command list.
+		void ReleaseAfterUpload(ID3D12Resource* pResource) { m_PendingUploadReleases.push_back(pResource); }
+
 		inline ID3D12Resource& GetConstantBufferPerObjectMaterialUploadHeap() const { return *m_PerObjectMaterialAdditivesCBV[m_FrameIndex].Get(); }
 		inline UINT8& GetPerObjectMaterialAdditiveCBVGPUHeapAddress() { return *m_cbvPerObjectMaterialOverridesGPUAddress[m_FrameIndex]; }
 
@@ -129,6 +134,8 @@ namespace Insight {
 		void Cleanup();
 		// Once called CPU will wait for the GPU to finish executing any pending work.
 		void WaitForGPU();
+		// Release the resources given to 'ReleaseAfterUpload'. The GPU must be idle.
+		void ReleasePendingUploads();
 		// Resize render targets and depth stencil. Usually called from 'OnWindowResize'.
 		void UpdateSizeDependentResources();
 		// Update view and scissor rects to new window width and height.
@@ -147,6 +154,7 @@ namespace Insight {
 		UINT64					m_FenceValues[m_FrameBufferCount] = {};
 		HANDLE					m_FenceEvent = {};
 		ComPtr<ID3D12Fence>		m_pFence;
+		std::vector<ID3D12Resource*> m_PendingUploadReleases;
 		static const UINT		m_NumRTV = 5;
 
 		bool		m_WindowResizeComplete = true;
@@ -193,6 +201,10 @@ namespace Insight {
 
 		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_ShadowPass;
 		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_GeometryPass;
+		// Shadow and geometry passes for meshes packed to eVertexLayout::PackedFullPrecisionUV.
+		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_ShadowPassFullPrecisionUV;
+		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_GeometryPassFullPrecisionUV;
+		eVertexLayout						m_ActiveVertexLayout = eVertexLayout::Packed;
 		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_LightingPass;
 		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_SkyPass;
 		ComPtr<ID3D12PipelineState>			m_pPipelineStateObject_PostFxPass;
@@ -71,7 +71,7 @@ namespace Insight {
 						m_pScenePassCommandList->SetGraphicsRootConstantBufferView(4, m_CbvMaterialHeapHandle + (ConstantBufferPerObjectMaterialAlignedSize * m_PerObjectCBDrawOffset));
 
 						m_Models[i]->BindResources();
-						m_Models[i]->GetMeshAtIndex(j)->Render(m_pScenePassCommandList);
+						m_Models[i]->GetMeshAtIndex(j)->RenderVisible(m_pScenePassCommandList);
 
 						m_PerObjectCBDrawOffset++;
 					}
@@ -8,11 +8,9 @@ namespace Insight {
 
 
 
-	D3D12IndexBuffer::D3D12IndexBuffer(Indices Indices)
-		: ieIndexBuffer(Indices)
+	D3D12IndexBuffer::D3D12IndexBuffer(std::vector<uint8_t> Data, bool Is16Bit)
+		: ieIndexBuffer(std::move(Data), Is16Bit)
 	{
-		m_NumIndices = static_cast<uint32_t>(Indices.size());
-		m_BufferSize = m_NumIndices * sizeof(uint32_t);
 		CreateResources();
 	}
 
@@ -54,15 +52,20 @@ namespace Insight {
 		m_pIndexBufferUploadHeap->SetName(L"Index Buffer Upload Resource Heap");
 
 		D3D12_SUBRESOURCE_DATA indexData = {};
-		indexData.pData = reinterpret_cast<BYTE*>(m_Indices.data());
+		indexData.pData = reinterpret_cast<BYTE*>(m_Data.data());
 		indexData.RowPitch = m_BufferSize;
 		indexData.SlicePitch = m_BufferSize;
 
 		Direct3D12Context* graphicsContext = reinterpret_cast<Direct3D12Context*>(&Renderer::Get());
 		UpdateSubresources(&graphicsContext->GetScenePassCommandList(), m_pIndexBuffer, m_pIndexBufferUploadHeap, 0, 0, 1, &indexData);
 
+		// The data is in the upload heap now. The heap itself has to live until the GPU has run the copy.
+		ReleaseCPUData();
+		D3D12Context->ReleaseAfterUpload(m_pIndexBufferUploadHeap);
+		m_pIndexBufferUploadHeap = nullptr;
+
 		m_IndexBufferView.BufferLocation = m_pIndexBuffer->GetGPUVirtualAddress();
-		m_IndexBufferView.Format = DXGI_FORMAT_R32_UINT;
+		m_IndexBufferView.Format = m_Is16Bit ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
 		m_IndexBufferView.SizeInBytes = m_BufferSize;
 
 		D3D12Context->GetScenePassCommandList().ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_pIndexBuffer, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_INDEX_BUFFER));
@@ -9,7 +9,7 @@ namespace Insight {
 	class INSIGHT_API D3D12IndexBuffer : public ieIndexBuffer
 	{
 	public:
-		D3D12IndexBuffer(Indices Indices);
+		D3D12IndexBuffer(std::vector<uint8_t> Data, bool Is16Bit);
 		~D3D12IndexBuffer()
 		{
 			Destroy();
@@ -17,7 +17,6 @@ namespace Insight {
 		virtual void Destroy() override;
 
 		ID3D12Resource& GetIndexBuffer() { return *m_pIndexBuffer; }
-		ID3D12Resource& GetUploadHeap() { return *m_pIndexBufferUploadHeap; }
 		D3D12_INDEX_BUFFER_VIEW& GetIndexBufferView() { return m_IndexBufferView; }
 
 	protected:
@@ -7,11 +7,9 @@
 namespace Insight {
 
 
-	D3D12VertexBuffer::D3D12VertexBuffer(Verticies Verticies)
-		: ieVertexBuffer(Verticies) 
+	D3D12VertexBuffer::D3D12VertexBuffer(std::vector<uint8_t> Data, uint32_t Stride)
+		: ieVertexBuffer(std::move(Data), Stride)
 	{
-		m_NumVerticies = static_cast<uint32_t>(Verticies.size());
-		m_BufferSize = m_NumVerticies * sizeof(Vertex3D);
 		CreateResources();
 	}
 
@@ -53,7 +51,7 @@ namespace Insight {
 		m_pVertexBufferUploadHeap->SetName(L"Vertex Buffer Upload Resource Heap");
 
 		D3D12_SUBRESOURCE_DATA vertexData = {};
-		vertexData.pData = reinterpret_cast<BYTE*>(m_Verticies.data());
+		vertexData.pData = reinterpret_cast<BYTE*>(m_Data.data());
 		vertexData.RowPitch = m_BufferSize;
 		vertexData.SlicePitch = m_BufferSize;
 
@@ -62,8 +60,13 @@ namespace Insight {
 		// recording draw commands still, initializing other assets etc., causing a corruption.
 		UpdateSubresources(&D3D12Context->GetScenePassCommandList(), m_pVertexBuffer, m_pVertexBufferUploadHeap, 0, 0, 1, &vertexData);
 
+		// The data is in the upload heap now. The heap itself has to live until the GPU has run the copy.
+		ReleaseCPUData();
+		D3D12Context->ReleaseAfterUpload(m_pVertexBufferUploadHeap);
+		m_pVertexBufferUploadHeap = nullptr;
+
 		m_VertexBufferView.BufferLocation = m_pVertexBuffer->GetGPUVirtualAddress();
-		m_VertexBufferView.StrideInBytes = sizeof(Vertex3D);
+		m_VertexBufferView.StrideInBytes = m_Stride;
 		m_VertexBufferView.SizeInBytes = m_BufferSize;
 
 		D3D12Context->GetScenePassCommandList().ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_pVertexBuffer, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER));
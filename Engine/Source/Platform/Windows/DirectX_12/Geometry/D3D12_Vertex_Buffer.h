@@ -9,7 +9,7 @@ namespace Insight {
 	class INSIGHT_API D3D12VertexBuffer : public ieVertexBuffer
 	{
 	public:
-		D3D12VertexBuffer(Verticies Verticies);
+		D3D12VertexBuffer(std::vector<uint8_t> Data, uint32_t Stride);
 		virtual ~D3D12VertexBuffer()
 		{
 			Destroy();
@@ -17,7 +17,6 @@ namespace Insight {
 		virtual void Destroy() override;
 
 		ID3D12Resource& GetVertexBuffer() { return *m_pVertexBuffer; }
-		ID3D12Resource& GetUploadHeap() { return *m_pVertexBufferUploadHeap; }
 		D3D12_VERTEX_BUFFER_VIEW* GetVertexBufferView() { return &m_VertexBufferView; }
 
 	protected:
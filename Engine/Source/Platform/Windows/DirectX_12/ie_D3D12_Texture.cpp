@@ -24,6 +24,9 @@ namespace Insight {
 
 	ieD3D12Texture::~ieD3D12Texture()
 	{
+		if (m_VideoMemoryBytes > 0U) {
+			MemoryTracker::RecordFree(eMemoryCategory::TextureVideoMemory, m_VideoMemoryBytes);
+		}
 	}
 
 	void ieD3D12Texture::Destroy()
@@ -40,21 +43,21 @@ namespace Insight {
 	bool ieD3D12Texture::Init(IE_TEXTURE_INFO createInfo, CDescriptorHeapWrapper& srvHeapHandle)
 	{
 		Direct3D12Context* GraphicsContext = reinterpret_cast<Direct3D12Context*>(&Renderer::Get());
-		std::string Filepath = StringHelper::WideToString(createInfo.Filepath);
-
 		m_pCbvSrvHeapStart = &GraphicsContext->GetCBVSRVDescriptorHeap();
 		m_pCommandList = &GraphicsContext->GetScenePassCommandList();
 		m_TextureInfo = createInfo;
-		m_TextureInfo.DisplayName = StringHelper::GetFilenameFromDirectory(Filepath);
+		m_TextureInfo.DisplayName = m_TextureInfo.Filepath.GetFilename();
 
-		std::string FileExtension = StringHelper::GetFileExtension(Filepath);
-		if (FileExtension == "dds") {
+		if (m_TextureInfo.Filepath.GetExtension() == "dds") {
 			InitDDSTexture(srvHeapHandle);
 		}
 		else {
 			InitTextureFromFile(srvHeapHandle);
 		}
 
+		m_VideoMemoryBytes = GraphicsContext->GetDeviceContext().GetResourceAllocationInfo(0, 1, &m_D3DTextureDesc).SizeInBytes;
+		MemoryTracker::RecordAllocation(eMemoryCategory::TextureVideoMemory, m_VideoMemoryBytes);
+
 		m_RootParamIndex = GetRootParameterIndexForTextureType(m_TextureInfo.Type);
 		return true;
 	}
@@ -69,7 +72,7 @@ namespace Insight {
 		ResourceUpload.Begin();
 
 		HRESULT hr;
-		hr = DirectX::CreateDDSTextureFromFile(pDevice, ResourceUpload, m_TextureInfo.Filepath.c_str(), &m_pTexture, m_TextureInfo.GenerateMipMaps, 0, nullptr, &m_TextureInfo.IsCubeMap);
+		hr = DirectX::CreateDDSTextureFromFile(pDevice, ResourceUpload, m_TextureInfo.Filepath.ToAbsoluteWide().c_str(), &m_pTexture, m_TextureInfo.GenerateMipMaps, 0, nullptr, &m_TextureInfo.IsCubeMap);
 		if (FAILED(hr)) {
 			IE_CORE_ERROR("Failed to load DDS texture from file.");
 		}
@@ -106,7 +109,7 @@ namespace Insight {
 		DirectX::ResourceUploadBatch resourceUpload(pDevice);
 		resourceUpload.Begin();
 
-		HRESULT hr = DirectX::CreateWICTextureFromFile(pDevice, resourceUpload, m_TextureInfo.Filepath.c_str(), &m_pTexture, m_TextureInfo.GenerateMipMaps);
+		HRESULT hr = DirectX::CreateWICTextureFromFile(pDevice, resourceUpload, m_TextureInfo.Filepath.ToAbsoluteWide().c_str(), &m_pTexture, m_TextureInfo.GenerateMipMaps);
 		if (FAILED(hr)) {
 			IE_CORE_ERROR("Failed to Create WIC texture from file.");
 		}
@@ -55,6 +55,7 @@ namespace Insight {
 		IE_TEXTURE_INFO				m_TextureInfo = {};
 
 		uint32_t						m_RootParamIndex = 0U;
+		uint64_t						m_VideoMemoryBytes = 0U;
 	private:
 		static uint32_t s_NumSceneTextures;
 
@@ -7,6 +7,7 @@
 
 #include "Insight/Core/Log.h"
 #include "Insight/Utilities/String_Helper.h"
+#include "Insight/Systems/Memory/Frame_Allocator.h"
 #include "Platform/Windows/Window_Resources/Resource.h"
 
 #include "Insight/Events/Key_Event.h"
@@ -210,10 +211,10 @@ namespace Insight {
 
 			if (dataSize > 0)
 			{
-				std::unique_ptr<BYTE[]> rawdata = std::make_unique<BYTE[]>(dataSize);
-				if (GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT, rawdata.get(), &dataSize, sizeof(RAWINPUTHEADER)) == dataSize)
+				BYTE* rawdata = static_cast<BYTE*>(FrameAllocator::Allocate(dataSize, alignof(RAWINPUT)));
+				if (GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT, rawdata, &dataSize, sizeof(RAWINPUTHEADER)) == dataSize)
 				{
-					RAWINPUT* raw = reinterpret_cast<RAWINPUT*>(rawdata.get());
+					RAWINPUT* raw = reinterpret_cast<RAWINPUT*>(rawdata);
 					if (raw->header.dwType == RIM_TYPEMOUSE)
 					{
 						MouseRawMoveEvent event(raw->data.mouse.lLastX, raw->data.mouse.lLastY);
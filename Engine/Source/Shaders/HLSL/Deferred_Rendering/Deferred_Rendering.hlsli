@@ -63,14 +63,26 @@ cbuffer PerObjectAdditive : register(b4)
     float padding5;
 };
 
+/* Vertex Decoding */
+// Normals and tangents arrive as R10G10B10A2_UNORM, see PackedVertex3D. The
+// bitangent is rebuilt from them, the tangent's w holds its handedness.
+float3 DecodeUnitVector(float3 packed)
+{
+    return packed * 2.0 - 1.0;
+}
+
+float3 DecodeBiTangent(float3 normal, float4 packedTangent)
+{
+    return cross(normal, DecodeUnitVector(packedTangent.xyz)) * (packedTangent.w > 0.5 ? 1.0 : -1.0);
+}
+
 /* Shadow Pass */
 struct VS_INPUT_SHADOWPASS
 {
     float3 position : POSITION;
     float2 texCoords : TEXCOORD;
     float3 normal : NORMAL;
-    float3 tangent : TANGENT;
-    float3 biTangent : BITANGENT;
+    float4 tangent : TANGENT;
 };
 
 struct VS_OUTPUT_SHADOWPASS
@@ -99,8 +111,7 @@ struct VS_INPUT_GEOMPASS
     float3 position : POSITION;
     float2 texCoords : TEXCOORD;
     float3 normal : NORMAL;
-    float3 tangent : TANGENT;
-    float3 biTangent : BITANGENT;
+    float4 tangent : TANGENT;
 };
 
 struct VS_OUTPUT_GEOMPASS
@@ -15,9 +15,10 @@ VS_OUTPUT_GEOMPASS main(VS_INPUT_GEOMPASS vs_in)
     vs_out.fragPos = worldPos.xyz;
     vs_out.texCoords = float2((vs_in.texCoords.x + uvOffset.x) * tiling.x, (vs_in.texCoords.y + uvOffset.y) * tiling.y);
     
-    vs_out.normal = normalize(mul(float4(vs_in.normal, 0.0f), world)).xyz;
-    vs_out.tangent = mul(vs_in.tangent, (float3x3) worldView);
-    vs_out.biTangent = mul(vs_in.biTangent, (float3x3) worldView);
+    float3 normal = DecodeUnitVector(vs_in.normal);
+    vs_out.normal = normalize(mul(float4(normal, 0.0f), world)).xyz;
+    vs_out.tangent = mul(DecodeUnitVector(vs_in.tangent.xyz), (float3x3) worldView);
+    vs_out.biTangent = mul(DecodeBiTangent(normal, vs_in.tangent), (float3x3) worldView);
 
 	return vs_out;
 }
@@ -0,0 +1,76 @@
+// Copyright 2020 Garrett Courtney
+
+/*=====================================================================
+
+	Engine Tests
+
+	Runs the checks and micro benchmarks registered with IE_TEST against
+	the engine sources in 'PortableEngineFiles'. Those files have no
+	platform or renderer dependencies, so this builds anywhere premake
+	does, including Linux ("premake5 gmake2"). Exits with 1 if any check
+	failed.
+
+	Example usage:
+		Engine_Tests					Run every test.
+		Engine_Tests MeshoptCodec		Run the tests whose name contains "MeshoptCodec".
+
+ ======================================================================*/
+
+#include "Engine_Tests.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace EngineTests {
+
+	static uint32_t s_NumFailures = 0U;
+
+	std::vector<TestCase>& GetTests()
+	{
+		// Function local so registrars in other files can run before main in any order.
+		static std::vector<TestCase> s_Tests;
+		return s_Tests;
+	}
+
+	void ReportFailure(const char* File, int Line, const char* Expression)
+	{
+		printf("    FAILED %s(%d): %s\n", File, Line, Expression);
+		s_NumFailures++;
+	}
+
+}
+
+int main(int argc, char** argv)
+{
+	using namespace EngineTests;
+
+	const char* Filter = (argc > 1) ? argv[1] : "";
+	std::vector<TestCase> Tests = GetTests();
+	std::sort(Tests.begin(), Tests.end(), [](const TestCase& A, const TestCase& B) { return strcmp(A.Name, B.Name) < 0; });
+
+	uint32_t NumRun = 0U;
+	uint32_t NumFailed = 0U;
+	for (const TestCase& Test : Tests) {
+		if (strstr(Test.Name, Filter) == nullptr) {
+			continue;
+		}
+		printf("[ RUN  ] %s\n", Test.Name);
+		const uint32_t FailuresBefore = s_NumFailures;
+		const Clock::time_point Start = Clock::now();
+		Test.Function();
+		const double Ms = GetElapsedMs(Start, Clock::now());
+
+		const bool Passed = (s_NumFailures == FailuresBefore);
+		printf("[ %s ] %s (%.1fms)\n", Passed ? " OK " : "FAIL", Test.Name, Ms);
+		NumRun++;
+		NumFailed += Passed ? 0U : 1U;
+	}
+
+	if (NumRun == 0U) {
+		fprintf(stderr, "No tests match \"%s\"\n", Filter);
+		return 1;
+	}
+	printf("%u of %u tests passed.\n", NumRun - NumFailed, NumRun);
+	return (NumFailed == 0U) ? 0 : 1;
+}
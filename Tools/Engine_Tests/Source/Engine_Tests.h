@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/*
+	Checks for the engine code listed in 'PortableEngineFiles' (premake5.lua). A check that
+	fails prints its file, line and expression and the test keeps running, so one run reports
+	every broken case. Tests that time something print their figures with 'IE_TEST_REPORT',
+	build the tool in Release for numbers worth comparing.
+
+	Example usage:
+		IE_TEST(MeshoptCodec_VertexRoundTrip)
+		{
+			IE_CHECK(MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), Count, Stride));
+			IE_CHECK_MSG(Decoded == Vertices, "stride %zu, %zu vertices", Stride, Count);
+		}
+*/
+
+namespace EngineTests {
+
+	typedef void (*TestFunction)();
+
+	struct TestCase
+	{
+		const char* Name;
+		TestFunction Function;
+	};
+
+	// Every test registered with IE_TEST, in no particular order.
+	std::vector<TestCase>& GetTests();
+	// Called by the check macros, counts the failure against the running test.
+	void ReportFailure(const char* File, int Line, const char* Expression);
+
+	struct TestRegistrar
+	{
+		TestRegistrar(const char* Name, TestFunction Function) { GetTests().push_back({ Name, Function }); }
+	};
+
+	typedef std::chrono::high_resolution_clock Clock;
+
+	inline double GetElapsedMs(Clock::time_point Start, Clock::time_point End)
+	{
+		return std::chrono::duration<double, std::milli>(End - Start).count();
+	}
+
+	// Small deterministic generator, the same seed gives the same data on every platform
+	// and standard library, unlike the std distributions.
+	struct Random
+	{
+		uint32_t State;
+
+		explicit Random(uint32_t Seed) : State(Seed ? Seed : 1U) {}
+
+		uint32_t Next()
+		{
+			State ^= State << 13;
+			State ^= State >> 17;
+			State ^= State << 5;
+			return State;
+		}
+		// [0, 1)
+		float NextFloat() { return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f); }
+		// [Min, Max)
+		float NextFloat(float Min, float Max) { return Min + (Max - Min) * NextFloat(); }
+	};
+
+}
+
+#define IE_TEST(Name) \
+	static void Name(); \
+	static const ::EngineTests::TestRegistrar s_##Name##Registrar(#Name, &Name); \
+	static void Name()
+
+#define IE_CHECK(Expression) \
+	do { if (!(Expression)) { ::EngineTests::ReportFailure(__FILE__, __LINE__, #Expression); } } while (0)
+
+// Like IE_CHECK, with a printf style description of the case that failed.
+#define IE_CHECK_MSG(Expression, ...) \
+	do { if (!(Expression)) { ::EngineTests::ReportFailure(__FILE__, __LINE__, #Expression); printf("        "); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+#define IE_TEST_REPORT(...) \
+	do { printf("    "); printf(__VA_ARGS__); printf("\n"); } while (0)
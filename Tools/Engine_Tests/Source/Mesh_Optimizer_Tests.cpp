@@ -0,0 +1,111 @@
+#include "Engine_Tests.h"
+#include "Test_Meshes.h"
+
+#include "Insight/Rendering/Geometry/Mesh_Optimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+using namespace Insight;
+
+// A triangle by the bytes of its three vertices, rotated so the smallest vertex comes first.
+// Equal for the same triangle no matter how the vertices are indexed or which corner starts it.
+typedef std::array<std::array<uint8_t, sizeof(Vertex3D)>, 3> TriangleKey;
+
+static std::vector<TriangleKey> GetTriangleMultiset(const Verticies& Vertices, const Indices& MeshIndices)
+{
+	std::vector<TriangleKey> Triangles;
+	Triangles.reserve(MeshIndices.size() / 3U);
+	for (size_t i = 0; i + 2U < MeshIndices.size(); i += 3U) {
+		TriangleKey Key;
+		for (size_t Corner = 0; Corner < 3U; ++Corner) {
+			memcpy(Key[Corner].data(), &Vertices[MeshIndices[i + Corner]], sizeof(Vertex3D));
+		}
+		const size_t First = std::min_element(Key.begin(), Key.end()) - Key.begin();
+		std::rotate(Key.begin(), Key.begin() + First, Key.end());
+		Triangles.push_back(Key);
+	}
+	std::sort(Triangles.begin(), Triangles.end());
+	return Triangles;
+}
+
+IE_TEST(MeshOptimizer_WeldVertices)
+{
+	// Every corner of a grid imported the way Assimp does it, one vertex per triangle corner.
+	const uint32_t Width = 24U, Height = 17U;
+	Verticies Vertices;
+	Indices MeshIndices;
+	TestMeshes::MakeGrid(Width, Height, false, Vertices, MeshIndices);
+	const std::vector<TriangleKey> Before = GetTriangleMultiset(Vertices, MeshIndices);
+
+	const uint32_t NumCorners = Width * Height * 6U;
+	const uint32_t NumUnique = (Width + 1U) * (Height + 1U);
+	IE_CHECK(Vertices.size() == NumCorners);
+	const uint32_t NumRemoved = MeshOptimizer::WeldVertices(Vertices, MeshIndices);
+	IE_CHECK_MSG(NumRemoved == NumCorners - NumUnique, "removed %u, expected %u", NumRemoved, NumCorners - NumUnique);
+	IE_CHECK(Vertices.size() == NumUnique);
+	IE_CHECK(GetTriangleMultiset(Vertices, MeshIndices) == Before);
+
+	// Only bit identical vertices merge, a shared position with another texture coordinate is a seam and stays split.
+	Verticies Seam(6U);
+	Seam[0].Position = ieFloat3(0.0f, 0.0f, 0.0f);
+	Seam[1].Position = Seam[4].Position = ieFloat3(0.0f, 0.0f, 1.0f);
+	Seam[2].Position = Seam[3].Position = ieFloat3(1.0f, 0.0f, 0.0f);
+	Seam[5].Position = ieFloat3(1.0f, 0.0f, 1.0f);
+	Seam[4].TexCoords = ieFloat2(0.5f, 0.0f);
+	Indices SeamIndices = { 0U, 1U, 2U, 3U, 4U, 5U };
+	IE_CHECK(MeshOptimizer::WeldVertices(Seam, SeamIndices) == 1U);
+	IE_CHECK(Seam.size() == 5U);
+}
+
+IE_TEST(MeshOptimizer_OptimizeKeepsTriangles)
+{
+	Verticies Vertices;
+	Indices MeshIndices;
+	TestMeshes::MakeGrid(40U, 40U, false, Vertices, MeshIndices);
+	TestMeshes::ShuffleTriangles(MeshIndices, 7U);
+	const std::vector<TriangleKey> Before = GetTriangleMultiset(Vertices, MeshIndices);
+
+	MeshOptimizer::Optimize(Vertices, MeshIndices);
+	IE_CHECK(Vertices.size() == 41U * 41U);
+	IE_CHECK(MeshIndices.size() == 40U * 40U * 6U);
+	IE_CHECK(GetTriangleMultiset(Vertices, MeshIndices) == Before);
+
+	// OptimizeVertexFetch orders vertices by first use, so the first triangle uses the first three.
+	IE_CHECK(MeshIndices[0] == 0U && MeshIndices[1] == 1U && MeshIndices[2] == 2U);
+	bool IsInRange = true;
+	for (Indices::value_type Index : MeshIndices) {
+		IsInRange &= Index < Vertices.size();
+	}
+	IE_CHECK(IsInRange);
+}
+
+IE_TEST(MeshOptimizer_ImprovesShuffledMesh)
+{
+	struct Case
+	{
+		const char* Name;
+		Verticies Vertices;
+		Indices MeshIndices;
+	};
+	Case Cases[2] = { { "Grid", {}, {} }, { "Sphere", {}, {} } };
+	TestMeshes::MakeGrid(64U, 64U, true, Cases[0].Vertices, Cases[0].MeshIndices);
+	TestMeshes::MakeSphere(48U, 96U, Cases[1].Vertices, Cases[1].MeshIndices);
+
+	for (Case& Mesh : Cases) {
+		TestMeshes::ShuffleTriangles(Mesh.MeshIndices, 11U);
+		const MeshOptimizer::Stats Before = MeshOptimizer::Analyze(Mesh.Vertices, Mesh.MeshIndices);
+		MeshOptimizer::Optimize(Mesh.Vertices, Mesh.MeshIndices);
+		const MeshOptimizer::Stats After = MeshOptimizer::Analyze(Mesh.Vertices, Mesh.MeshIndices);
+		IE_TEST_REPORT("%s: %u triangles, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, overdraw %.3f -> %.3f",
+			Mesh.Name, After.NumTriangles, Before.ACMR, After.ACMR, Before.ATVR, After.ATVR, Before.Overdraw, After.Overdraw);
+
+		IE_CHECK(After.NumTriangles == Before.NumTriangles);
+		// A shuffled mesh misses the 16 entry cache on almost every vertex, an optimized
+		// grid should come close to its ideal of half a vertex per triangle.
+		IE_CHECK_MSG(After.ACMR < 0.8f && After.ACMR < Before.ACMR * 0.5f, "%s: ACMR %.3f -> %.3f", Mesh.Name, Before.ACMR, After.ACMR);
+		IE_CHECK_MSG(After.ATVR < 1.6f && After.ATVR < Before.ATVR * 0.5f, "%s: ATVR %.3f -> %.3f", Mesh.Name, Before.ATVR, After.ATVR);
+		IE_CHECK_MSG(After.Overdraw <= Before.Overdraw * 1.05f, "%s: overdraw %.3f -> %.3f", Mesh.Name, Before.Overdraw, After.Overdraw);
+	}
+}
@@ -0,0 +1,205 @@
+#include "Engine_Tests.h"
+#include "Test_Meshes.h"
+
+#include "Insight/Rendering/Geometry/Meshlet_Culler.h"
+#include "Insight/Rendering/Geometry/Mesh_Optimizer.h"
+
+#include <cmath>
+#include <string>
+
+using namespace Insight;
+
+static Math::ieFloat4x4 MakeIdentity()
+{
+	Math::ieFloat4x4 Identity = {};
+	Identity._11 = Identity._22 = Identity._33 = Identity._44 = 1.0f;
+	return Identity;
+}
+
+// Rotation about y, uniform scale and a translation, row vectors like the engine's matrices.
+static Math::ieFloat4x4 MakeWorld(float Yaw, float ScaleX, float ScaleY, float ScaleZ, const ieFloat3& Translation)
+{
+	Math::ieFloat4x4 World = MakeIdentity();
+	World._11 = cosf(Yaw) * ScaleX;
+	World._13 = -sinf(Yaw) * ScaleX;
+	World._22 = ScaleY;
+	World._31 = sinf(Yaw) * ScaleZ;
+	World._33 = cosf(Yaw) * ScaleZ;
+	World._41 = Translation.x;
+	World._42 = Translation.y;
+	World._43 = Translation.z;
+	return World;
+}
+
+static ieFloat3 TransformPoint(const ieFloat3& P, const Math::ieFloat4x4& M)
+{
+	return ieFloat3(P.x * M._11 + P.y * M._21 + P.z * M._31 + M._41, P.x * M._12 + P.y * M._22 + P.z * M._32 + M._42, P.x * M._13 + P.y * M._23 + P.z * M._33 + M._43);
+}
+
+static ieFloat3 Subtract(const ieFloat3& A, const ieFloat3& B)
+{
+	return ieFloat3(A.x - B.x, A.y - B.y, A.z - B.z);
+}
+
+static ieFloat3 Cross(const ieFloat3& A, const ieFloat3& B)
+{
+	return ieFloat3(A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x);
+}
+
+static float Dot(const ieFloat3& A, const ieFloat3& B)
+{
+	return A.x * B.x + A.y * B.y + A.z * B.z;
+}
+
+IE_TEST(MeshletCuller_AnalyzeViewsCounts)
+{
+	struct Case
+	{
+		const char* Name;
+		Verticies Vertices;
+		Indices MeshIndices;
+		// Frustum and back face culled triangles for each of AnalyzeViews' fourteen eyes. Exact, a
+		// change to the builder or the culler that moves them should update them on purpose.
+		uint32_t ExpectedFrustumCulled[14];
+		uint32_t ExpectedBackFaceCulled[14];
+	};
+	Case Cases[2] = {
+		{ "Grid", {}, {},
+			{ 0, 88, 0, 0, 0, 0, 88, 91, 88, 91, 0, 0, 0, 0 },
+			{ 0, 0, 0, 4608, 0, 0, 0, 0, 4520, 4517, 0, 0, 4608, 4608 } },
+		{ "Sphere", {}, {},
+			{ 1532, 2209, 0, 0, 1868, 1692, 1841, 1759, 448, 624, 1497, 1573, 192, 280 },
+			{ 6676, 6163, 6813, 6200, 6360, 6468, 6738, 6580, 6449, 6759, 7049, 6625, 6744, 6877 } },
+	};
+	TestMeshes::MakeGrid(48U, 48U, true, Cases[0].Vertices, Cases[0].MeshIndices);
+	TestMeshes::MakeSphere(64U, 128U, Cases[1].Vertices, Cases[1].MeshIndices);
+	// Meshlets are built from the optimized order, as Model::Import does.
+	for (Case& Mesh : Cases) {
+		MeshOptimizer::Optimize(Mesh.Vertices, Mesh.MeshIndices);
+	}
+
+	for (const Case& Mesh : Cases) {
+		std::vector<Meshlet> Meshlets;
+		MeshletBuilder::Build(Mesh.Vertices, Mesh.MeshIndices, Meshlets);
+		const std::vector<MeshletCuller::Stats> Views = MeshletCuller::AnalyzeViews(Meshlets);
+		IE_CHECK(Views.size() == 14U);
+
+		std::string Frustum, BackFace;
+		for (size_t i = 0; i < Views.size() && i < 14U; ++i) {
+			IE_CHECK(Views[i].NumTriangles == Mesh.MeshIndices.size() / 3U);
+			Frustum += std::to_string(Views[i].NumFrustumCulled) + " ";
+			BackFace += std::to_string(Views[i].NumBackFaceCulled) + " ";
+			IE_CHECK_MSG(Views[i].NumFrustumCulled == Mesh.ExpectedFrustumCulled[i], "%s view %zu: %u frustum culled, expected %u",
+				Mesh.Name, i, Views[i].NumFrustumCulled, Mesh.ExpectedFrustumCulled[i]);
+			IE_CHECK_MSG(Views[i].NumBackFaceCulled == Mesh.ExpectedBackFaceCulled[i], "%s view %zu: %u back face culled, expected %u",
+				Mesh.Name, i, Views[i].NumBackFaceCulled, Mesh.ExpectedBackFaceCulled[i]);
+		}
+		IE_TEST_REPORT("%s: %zu meshlets, %zu triangles", Mesh.Name, Meshlets.size(), Mesh.MeshIndices.size() / 3U);
+		IE_TEST_REPORT("    frustum culled per view:   %s", Frustum.c_str());
+		IE_TEST_REPORT("    back face culled per view: %s", BackFace.c_str());
+	}
+}
+
+IE_TEST(MeshletCuller_KeepsVisibleTriangles)
+{
+	struct Case
+	{
+		const char* Name;
+		Verticies Vertices;
+		Indices MeshIndices;
+		// Middle of the mesh and how far from it the eyes are placed.
+		ieFloat3 Center;
+		float Extent;
+	};
+	Case Cases[2] = { { "Grid", {}, {}, ieFloat3(24.0f, 0.0f, 24.0f), 40.0f }, { "Sphere", {}, {}, ieFloat3(0.0f, 0.0f, 0.0f), 4.0f } };
+	TestMeshes::MakeGrid(48U, 48U, true, Cases[0].Vertices, Cases[0].MeshIndices);
+	TestMeshes::MakeSphere(64U, 128U, Cases[1].Vertices, Cases[1].MeshIndices);
+	// Meshlets are built from the optimized order, as Model::Import does.
+	for (Case& Mesh : Cases) {
+		MeshOptimizer::Optimize(Mesh.Vertices, Mesh.MeshIndices);
+	}
+
+	const Math::ieFloat4x4 Worlds[3] = {
+		MakeIdentity(),
+		MakeWorld(0.7f, 2.5f, 2.5f, 2.5f, ieFloat3(3.0f, -1.0f, 4.0f)),
+		// Non-uniform, the cones are skipped and only the frustum test runs.
+		MakeWorld(-1.3f, 1.0f, 3.0f, 0.5f, ieFloat3(-2.0f, 0.0f, 1.0f)),
+	};
+
+	EngineTests::Random Rand(23U);
+	for (const Case& Mesh : Cases) {
+		std::vector<Meshlet> Meshlets;
+		MeshletBuilder::Build(Mesh.Vertices, Mesh.MeshIndices, Meshlets);
+		const size_t NumTriangles = Mesh.MeshIndices.size() / 3U;
+
+		// Which way each triangle faces, by its winding turned towards its vertex normals like the builder does.
+		std::vector<float> Facing(NumTriangles);
+		for (size_t t = 0; t < NumTriangles; ++t) {
+			const Vertex3D& A = Mesh.Vertices[Mesh.MeshIndices[t * 3U]];
+			const Vertex3D& B = Mesh.Vertices[Mesh.MeshIndices[t * 3U + 1U]];
+			const Vertex3D& C = Mesh.Vertices[Mesh.MeshIndices[t * 3U + 2U]];
+			const ieFloat3 Normal = Cross(Subtract(B.Position, A.Position), Subtract(C.Position, A.Position));
+			const ieFloat3 VertexNormals(A.Normal.x + B.Normal.x + C.Normal.x, A.Normal.y + B.Normal.y + C.Normal.y, A.Normal.z + B.Normal.z + C.Normal.z);
+			Facing[t] = (Dot(Normal, VertexNormals) < 0.0f) ? -1.0f : 1.0f;
+		}
+
+		uint32_t NumChecked = 0U, NumCulled = 0U;
+		std::vector<ieFloat3> WorldPositions(Mesh.Vertices.size());
+		std::vector<bool> IsKept(NumTriangles);
+		std::vector<MeshletIndexRange> Ranges;
+		for (const Math::ieFloat4x4& World : Worlds) {
+			const ieFloat3 Center = TransformPoint(Mesh.Center, World);
+			for (size_t v = 0; v < Mesh.Vertices.size(); ++v) {
+				WorldPositions[v] = TransformPoint(Mesh.Vertices[v].Position, World);
+			}
+
+			for (uint32_t ViewIndex = 0; ViewIndex < 200U; ++ViewIndex) {
+				// Eyes from inside the mesh's bounds out to several times its size, looking near its center.
+				const float Scale = Mesh.Extent;
+				const ieFloat3 Eye(Center.x + Rand.NextFloat(-1.0f, 1.0f) * Scale, Center.y + Rand.NextFloat(-1.0f, 1.0f) * Scale, Center.z + Rand.NextFloat(-1.0f, 1.0f) * Scale);
+				const ieFloat3 Target(Center.x + Rand.NextFloat(-0.3f, 0.3f) * Scale, Center.y + Rand.NextFloat(-0.3f, 0.3f) * Scale, Center.z + Rand.NextFloat(-0.3f, 0.3f) * Scale);
+				const float FieldOfView = Rand.NextFloat(0.3f, 1.8f);
+				const MeshletCuller::View View = MeshletCuller::MakeLookAtView(Eye, Target, FieldOfView, 0.01f, Scale * 3.0f);
+
+				Ranges.clear();
+				const MeshletCuller::Stats Stats = MeshletCuller::Cull(Meshlets, World, View, Ranges);
+				NumCulled += Stats.NumFrustumCulled + Stats.NumBackFaceCulled;
+				std::fill(IsKept.begin(), IsKept.end(), false);
+				uint32_t NumKept = 0U;
+				for (const MeshletIndexRange& Range : Ranges) {
+					for (uint32_t t = Range.FirstIndex / 3U; t < (Range.FirstIndex + Range.NumIndices) / 3U; ++t) {
+						IsKept[t] = true;
+						++NumKept;
+					}
+				}
+				IE_CHECK(NumKept + Stats.NumFrustumCulled + Stats.NumBackFaceCulled == NumTriangles);
+
+				// A triangle with a corner inside every plane and its front towards the eye is on screen.
+				for (size_t t = 0; t < NumTriangles; ++t) {
+					const ieFloat3& A = WorldPositions[Mesh.MeshIndices[t * 3U]];
+					const ieFloat3& B = WorldPositions[Mesh.MeshIndices[t * 3U + 1U]];
+					const ieFloat3& C = WorldPositions[Mesh.MeshIndices[t * 3U + 2U]];
+					// None of the worlds mirror, so the winding still tells the front from the back.
+					const ieFloat3 Normal = Cross(Subtract(B, A), Subtract(C, A));
+					if (Dot(Normal, Subtract(View.Eye, A)) * Facing[t] <= 0.0f) {
+						continue;
+					}
+					bool IsInside = false;
+					for (const ieFloat3* pCorner : { &A, &B, &C }) {
+						bool IsCornerInside = true;
+						for (const ieFloat4& Plane : View.Planes) {
+							IsCornerInside &= Plane.x * pCorner->x + Plane.y * pCorner->y + Plane.z * pCorner->z + Plane.w >= 0.0f;
+						}
+						IsInside |= IsCornerInside;
+					}
+					if (!IsInside) {
+						continue;
+					}
+					++NumChecked;
+					IE_CHECK_MSG(IsKept[t], "%s: triangle %zu is visible from view %u but was culled", Mesh.Name, t, ViewIndex);
+				}
+			}
+		}
+		IE_TEST_REPORT("%s: %u visible triangles checked, %u culled over %u views", Mesh.Name, NumChecked, NumCulled, 3U * 200U);
+	}
+}
@@ -0,0 +1,253 @@
+#include "Engine_Tests.h"
+
+#include "Insight/Rendering/Geometry/Meshopt_Codec.h"
+
+#include <algorithm>
+#include <cstring>
+
+using Insight::MeshoptCodec;
+
+// Vertex counts around the codec's 16 vertex groups and 256 vertex blocks, and one spanning many blocks.
+static const size_t s_VertexCounts[] = { 0U, 1U, 15U, 16U, 17U, 257U, 5003U };
+// Same counts, in triangles.
+static const size_t s_TriangleCounts[] = { 0U, 1U, 15U, 16U, 17U, 257U, 5003U };
+
+// Vertex data the way meshes look to the codec: some bytes change slowly between
+// neighbours, like positions and texture coordinates, others are noise.
+static std::vector<uint8_t> MakeVertices(size_t VertexCount, size_t VertexSize, uint32_t Seed)
+{
+	EngineTests::Random Rand(Seed);
+	std::vector<uint8_t> Vertices(VertexCount * VertexSize);
+	for (size_t i = 0; i < VertexCount; ++i) {
+		for (size_t k = 0; k < VertexSize; ++k) {
+			uint8_t Value;
+			switch (k % 4U) {
+			case 0U: Value = static_cast<uint8_t>(i + k); break;
+			case 1U: Value = static_cast<uint8_t>((i / 7U) * 3U + Rand.Next() % 3U); break;
+			case 2U: Value = static_cast<uint8_t>(k * 17U); break;
+			default: Value = static_cast<uint8_t>(Rand.Next()); break;
+			}
+			Vertices[i * VertexSize + k] = Value;
+		}
+	}
+	return Vertices;
+}
+
+// A strip of a grid, neighbouring triangles share edges as in real meshes, with every
+// 'RandomEvery'th triangle replaced by random vertices so the codec's other cases run too.
+static std::vector<uint32_t> MakeTriangles(size_t TriangleCount, uint32_t RandomEvery, uint32_t Seed)
+{
+	EngineTests::Random Rand(Seed);
+	const uint32_t GridWidth = 64U;
+	std::vector<uint32_t> Indices;
+	Indices.reserve(TriangleCount * 3U);
+	for (size_t t = 0; t < TriangleCount; ++t) {
+		const uint32_t Quad = static_cast<uint32_t>(t / 2U);
+		const uint32_t X = Quad % GridWidth;
+		const uint32_t Y = Quad / GridWidth;
+		const uint32_t V0 = Y * (GridWidth + 1U) + X;
+		const uint32_t V1 = V0 + 1U;
+		const uint32_t V2 = V0 + GridWidth + 1U;
+		const uint32_t V3 = V2 + 1U;
+		if (RandomEvery != 0U && t % RandomEvery == RandomEvery - 1U) {
+			const uint32_t NumVertices = static_cast<uint32_t>(TriangleCount) + 3U;
+			Indices.insert(Indices.end(), { Rand.Next() % NumVertices, Rand.Next() % NumVertices, Rand.Next() % NumVertices });
+		}
+		else if (t % 2U == 0U) {
+			Indices.insert(Indices.end(), { V0, V2, V1 });
+		}
+		else {
+			Indices.insert(Indices.end(), { V1, V2, V3 });
+		}
+	}
+	return Indices;
+}
+
+static uint32_t ReadIndex(const std::vector<uint8_t>& Indices, size_t i, size_t IndexSize)
+{
+	if (IndexSize == 2U) {
+		uint16_t Index;
+		memcpy(&Index, Indices.data() + i * 2U, sizeof(Index));
+		return Index;
+	}
+	uint32_t Index;
+	memcpy(&Index, Indices.data() + i * 4U, sizeof(Index));
+	return Index;
+}
+
+static std::vector<uint8_t> ToIndexSize(const std::vector<uint32_t>& Indices, size_t IndexSize)
+{
+	std::vector<uint8_t> Bytes(Indices.size() * IndexSize);
+	for (size_t i = 0; i < Indices.size(); ++i) {
+		if (IndexSize == 2U) {
+			const uint16_t Index = static_cast<uint16_t>(Indices[i]);
+			memcpy(Bytes.data() + i * 2U, &Index, sizeof(Index));
+		}
+		else {
+			memcpy(Bytes.data() + i * 4U, &Indices[i], sizeof(uint32_t));
+		}
+	}
+	return Bytes;
+}
+
+// The index codec keeps the triangle order and winding but may start a triangle at another corner.
+static bool IsSameTriangleList(const std::vector<uint8_t>& Source, const std::vector<uint8_t>& Decoded, size_t IndexCount, size_t IndexSize)
+{
+	for (size_t i = 0; i < IndexCount; i += 3U) {
+		const uint32_t A = ReadIndex(Source, i, IndexSize), B = ReadIndex(Source, i + 1U, IndexSize), C = ReadIndex(Source, i + 2U, IndexSize);
+		const uint32_t X = ReadIndex(Decoded, i, IndexSize), Y = ReadIndex(Decoded, i + 1U, IndexSize), Z = ReadIndex(Decoded, i + 2U, IndexSize);
+		if (!((X == A && Y == B && Z == C) || (X == B && Y == C && Z == A) || (X == C && Y == A && Z == B))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Offer the decoder every prefix shorter than 'Encoded', each copied to a buffer of exactly
+// that size so a decoder reading past the end shows up under a memory checker.
+template <typename DecodeType>
+static uint32_t CountAcceptedTruncations(const std::vector<uint8_t>& Encoded, DecodeType&& Decode)
+{
+	uint32_t NumAccepted = 0U;
+	const size_t Step = std::max<size_t>(1U, Encoded.size() / 64U);
+	for (size_t Size = 0; Size < Encoded.size(); Size += (Size + 64U < Encoded.size()) ? Step : 1U) {
+		std::vector<uint8_t> Truncated(Encoded.begin(), Encoded.begin() + Size);
+		NumAccepted += Decode(Truncated.empty() ? nullptr : Truncated.data(), Size) ? 1U : 0U;
+	}
+	return NumAccepted;
+}
+
+IE_TEST(MeshoptCodec_VertexRoundTrip)
+{
+	for (size_t VertexSize = 4U; VertexSize <= 256U; VertexSize += 4U) {
+		for (size_t VertexCount : s_VertexCounts) {
+			const std::vector<uint8_t> Vertices = MakeVertices(VertexCount, VertexSize, static_cast<uint32_t>(VertexSize * 131U + VertexCount));
+			std::vector<uint8_t> Encoded;
+			IE_CHECK_MSG(MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), VertexCount, VertexSize), "stride %zu, %zu vertices", VertexSize, VertexCount);
+
+			// Guard bytes after the output catch a decoder writing past the last vertex.
+			std::vector<uint8_t> Decoded(Vertices.size() + 16U, 0xCDU);
+			const bool Decodes = MeshoptCodec::DecodeVertexBuffer(Decoded.data(), VertexCount, VertexSize, Encoded.data(), Encoded.size());
+			IE_CHECK_MSG(Decodes, "stride %zu, %zu vertices", VertexSize, VertexCount);
+			IE_CHECK_MSG(std::equal(Vertices.begin(), Vertices.end(), Decoded.begin()), "stride %zu, %zu vertices", VertexSize, VertexCount);
+			IE_CHECK_MSG(Decoded[Vertices.size()] == 0xCDU && Decoded.back() == 0xCDU, "stride %zu, %zu vertices", VertexSize, VertexCount);
+		}
+	}
+}
+
+IE_TEST(MeshoptCodec_VertexRejectsTruncated)
+{
+	for (size_t VertexSize : { 4U, 12U, 24U, 28U, 56U, 256U }) {
+		for (size_t VertexCount : s_VertexCounts) {
+			const std::vector<uint8_t> Vertices = MakeVertices(VertexCount, VertexSize, static_cast<uint32_t>(VertexCount + 7U));
+			std::vector<uint8_t> Encoded;
+			MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), VertexCount, VertexSize);
+
+			std::vector<uint8_t> Decoded(Vertices.size());
+			const uint32_t NumAccepted = CountAcceptedTruncations(Encoded, [&](const uint8_t* pData, size_t Size) {
+				return MeshoptCodec::DecodeVertexBuffer(Decoded.data(), VertexCount, VertexSize, pData, Size);
+			});
+			IE_CHECK_MSG(NumAccepted == 0U, "stride %zu, %zu vertices: %u truncated streams decoded", VertexSize, VertexCount, NumAccepted);
+		}
+	}
+
+	// Bad arguments and a wrong header are refused before anything is read.
+	std::vector<uint8_t> Encoded;
+	const std::vector<uint8_t> Vertices = MakeVertices(16U, 16U, 3U);
+	MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), 16U, 16U);
+	std::vector<uint8_t> Decoded(Vertices.size());
+	IE_CHECK(!MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), 16U, 6U));
+	IE_CHECK(!MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), 1U, 260U));
+	IE_CHECK(!MeshoptCodec::DecodeVertexBuffer(Decoded.data(), 16U, 0U, Encoded.data(), Encoded.size()));
+	Encoded[0] ^= 0x40U;
+	IE_CHECK(!MeshoptCodec::DecodeVertexBuffer(Decoded.data(), 16U, 16U, Encoded.data(), Encoded.size()));
+}
+
+IE_TEST(MeshoptCodec_IndexRoundTrip)
+{
+	for (size_t IndexSize : { 2U, 4U }) {
+		for (size_t TriangleCount : s_TriangleCounts) {
+			for (uint32_t RandomEvery : { 0U, 5U, 1U }) {
+				const std::vector<uint8_t> Indices = ToIndexSize(MakeTriangles(TriangleCount, RandomEvery, static_cast<uint32_t>(TriangleCount + RandomEvery)), IndexSize);
+				const size_t IndexCount = TriangleCount * 3U;
+				std::vector<uint8_t> Encoded;
+				IE_CHECK_MSG(MeshoptCodec::EncodeIndexBuffer(Encoded, Indices.data(), IndexCount, IndexSize), "%zu-byte indices, %zu triangles", IndexSize, TriangleCount);
+
+				std::vector<uint8_t> Decoded(Indices.size() + 16U, 0xCDU);
+				const bool Decodes = MeshoptCodec::DecodeIndexBuffer(Decoded.data(), IndexCount, IndexSize, Encoded.data(), Encoded.size());
+				IE_CHECK_MSG(Decodes, "%zu-byte indices, %zu triangles, random every %u", IndexSize, TriangleCount, RandomEvery);
+				IE_CHECK_MSG(IsSameTriangleList(Indices, Decoded, IndexCount, IndexSize), "%zu-byte indices, %zu triangles, random every %u", IndexSize, TriangleCount, RandomEvery);
+				IE_CHECK_MSG(Decoded[Indices.size()] == 0xCDU && Decoded.back() == 0xCDU, "%zu-byte indices, %zu triangles", IndexSize, TriangleCount);
+			}
+		}
+	}
+}
+
+IE_TEST(MeshoptCodec_IndexRejectsTruncated)
+{
+	for (size_t IndexSize : { 2U, 4U }) {
+		for (size_t TriangleCount : s_TriangleCounts) {
+			const std::vector<uint8_t> Indices = ToIndexSize(MakeTriangles(TriangleCount, 5U, static_cast<uint32_t>(TriangleCount)), IndexSize);
+			const size_t IndexCount = TriangleCount * 3U;
+			std::vector<uint8_t> Encoded;
+			MeshoptCodec::EncodeIndexBuffer(Encoded, Indices.data(), IndexCount, IndexSize);
+
+			std::vector<uint8_t> Decoded(Indices.size());
+			const uint32_t NumAccepted = CountAcceptedTruncations(Encoded, [&](const uint8_t* pData, size_t Size) {
+				return MeshoptCodec::DecodeIndexBuffer(Decoded.data(), IndexCount, IndexSize, pData, Size);
+			});
+			IE_CHECK_MSG(NumAccepted == 0U, "%zu-byte indices, %zu triangles: %u truncated streams decoded", IndexSize, TriangleCount, NumAccepted);
+		}
+	}
+
+	std::vector<uint8_t> Encoded;
+	const std::vector<uint8_t> Indices = ToIndexSize(MakeTriangles(4U, 0U, 1U), 4U);
+	IE_CHECK(!MeshoptCodec::EncodeIndexBuffer(Encoded, Indices.data(), 11U, 4U));
+	IE_CHECK(!MeshoptCodec::EncodeIndexBuffer(Encoded, Indices.data(), 12U, 3U));
+	MeshoptCodec::EncodeIndexBuffer(Encoded, Indices.data(), 12U, 4U);
+	std::vector<uint8_t> Decoded(Indices.size());
+	IE_CHECK(!MeshoptCodec::DecodeIndexBuffer(Decoded.data(), 11U, 4U, Encoded.data(), Encoded.size()));
+	Encoded[0] = 0xE2U;
+	IE_CHECK(!MeshoptCodec::DecodeIndexBuffer(Decoded.data(), 12U, 4U, Encoded.data(), Encoded.size()));
+}
+
+IE_TEST(MeshoptCodec_DecodeThroughput)
+{
+	// A packed vertex (24 bytes) and a full Vertex3D (56 bytes), 32-bit indices, repeated
+	// until each figure covers enough time to be stable.
+	const size_t VertexCount = 1U << 18;
+	const size_t TriangleCount = 1U << 19;
+	const int NumRepeats = 8;
+
+	for (size_t VertexSize : { 24U, 56U }) {
+		const std::vector<uint8_t> Vertices = MakeVertices(VertexCount, VertexSize, 17U);
+		std::vector<uint8_t> Encoded;
+		MeshoptCodec::EncodeVertexBuffer(Encoded, Vertices.data(), VertexCount, VertexSize);
+		std::vector<uint8_t> Decoded(Vertices.size());
+
+		bool Decodes = true;
+		const EngineTests::Clock::time_point Start = EngineTests::Clock::now();
+		for (int i = 0; i < NumRepeats; ++i) {
+			Decodes &= MeshoptCodec::DecodeVertexBuffer(Decoded.data(), VertexCount, VertexSize, Encoded.data(), Encoded.size());
+		}
+		const double Ms = EngineTests::GetElapsedMs(Start, EngineTests::Clock::now()) / NumRepeats;
+		IE_CHECK(Decodes && Decoded == Vertices);
+		IE_TEST_REPORT("Vertex buffer, stride %zu: %zu vertices in %.3fms, %.0f MB/s decoded, %.1f%% of raw size.",
+			VertexSize, VertexCount, Ms, Vertices.size() / (Ms * 1000.0), 100.0 * Encoded.size() / Vertices.size());
+	}
+
+	const std::vector<uint8_t> Indices = ToIndexSize(MakeTriangles(TriangleCount, 0U, 23U), 4U);
+	std::vector<uint8_t> Encoded;
+	MeshoptCodec::EncodeIndexBuffer(Encoded, Indices.data(), TriangleCount * 3U, 4U);
+	std::vector<uint8_t> Decoded(Indices.size());
+
+	bool Decodes = true;
+	const EngineTests::Clock::time_point Start = EngineTests::Clock::now();
+	for (int i = 0; i < NumRepeats; ++i) {
+		Decodes &= MeshoptCodec::DecodeIndexBuffer(Decoded.data(), TriangleCount * 3U, 4U, Encoded.data(), Encoded.size());
+	}
+	const double Ms = EngineTests::GetElapsedMs(Start, EngineTests::Clock::now()) / NumRepeats;
+	IE_CHECK(Decodes && IsSameTriangleList(Indices, Decoded, TriangleCount * 3U, 4U));
+	IE_TEST_REPORT("Index buffer: %zu triangles in %.3fms, %.0f MB/s decoded, %.1f%% of raw size.",
+		TriangleCount, Ms, Indices.size() / (Ms * 1000.0), 100.0 * Encoded.size() / Indices.size());
+}
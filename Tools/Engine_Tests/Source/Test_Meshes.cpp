@@ -0,0 +1,121 @@
+#include "Test_Meshes.h"
+
+#include "Engine_Tests.h"
+
+#include <cmath>
+#include <utility>
+
+using namespace Insight;
+
+namespace TestMeshes {
+
+	static ieFloat3 Normalize(float X, float Y, float Z)
+	{
+		const float Length = sqrtf(X * X + Y * Y + Z * Z);
+		return ieFloat3(X / Length, Y / Length, Z / Length);
+	}
+
+	static Vertex3D MakeGridVertex(uint32_t X, uint32_t Z, uint32_t Width, uint32_t Height)
+	{
+		// h = 0.5 * sin(0.4x) * cos(0.3z)
+		const float PositionX = static_cast<float>(X);
+		const float PositionZ = static_cast<float>(Z);
+		const float SlopeX = 0.2f * cosf(0.4f * PositionX) * cosf(0.3f * PositionZ);
+		const float SlopeZ = -0.15f * sinf(0.4f * PositionX) * sinf(0.3f * PositionZ);
+
+		Vertex3D Vertex;
+		Vertex.Position = ieFloat3(PositionX, 0.5f * sinf(0.4f * PositionX) * cosf(0.3f * PositionZ), PositionZ);
+		Vertex.TexCoords = ieFloat2(static_cast<float>(X) / Width, static_cast<float>(Z) / Height);
+		Vertex.Normal = Normalize(-SlopeX, 1.0f, -SlopeZ);
+		Vertex.Tangent = Normalize(1.0f, SlopeX, 0.0f);
+		// cross(Tangent, Normal), the flipped bitangent. The sphere's is not flipped.
+		const ieFloat3& T = Vertex.Tangent;
+		const ieFloat3& N = Vertex.Normal;
+		Vertex.BiTangent = Normalize(T.y * N.z - T.z * N.y, T.z * N.x - T.x * N.z, T.x * N.y - T.y * N.x);
+		return Vertex;
+	}
+
+	void MakeGrid(uint32_t Width, uint32_t Height, bool Welded, Verticies& OutVertices, Indices& OutIndices)
+	{
+		OutVertices.clear();
+		OutIndices.clear();
+		if (Welded) {
+			for (uint32_t Z = 0; Z <= Height; ++Z) {
+				for (uint32_t X = 0; X <= Width; ++X) {
+					OutVertices.push_back(MakeGridVertex(X, Z, Width, Height));
+				}
+			}
+		}
+
+		auto AddCorner = [&](uint32_t X, uint32_t Z) {
+			if (Welded) {
+				OutIndices.push_back(Z * (Width + 1U) + X);
+			}
+			else {
+				OutIndices.push_back(static_cast<uint32_t>(OutVertices.size()));
+				OutVertices.push_back(MakeGridVertex(X, Z, Width, Height));
+			}
+		};
+		for (uint32_t Z = 0; Z < Height; ++Z) {
+			for (uint32_t X = 0; X < Width; ++X) {
+				AddCorner(X, Z);
+				AddCorner(X, Z + 1U);
+				AddCorner(X + 1U, Z);
+
+				AddCorner(X + 1U, Z);
+				AddCorner(X, Z + 1U);
+				AddCorner(X + 1U, Z + 1U);
+			}
+		}
+	}
+
+	void MakeSphere(uint32_t Rings, uint32_t Segments, Verticies& OutVertices, Indices& OutIndices)
+	{
+		const float Pi = 3.14159265f;
+		OutVertices.clear();
+		OutIndices.clear();
+		for (uint32_t Ring = 0; Ring <= Rings; ++Ring) {
+			const float Theta = Pi * Ring / Rings;
+			for (uint32_t Segment = 0; Segment <= Segments; ++Segment) {
+				const float Phi = 2.0f * Pi * Segment / Segments;
+				Vertex3D Vertex;
+				Vertex.Position = ieFloat3(sinf(Theta) * cosf(Phi), cosf(Theta), sinf(Theta) * sinf(Phi));
+				Vertex.TexCoords = ieFloat2(static_cast<float>(Segment) / Segments, static_cast<float>(Ring) / Rings);
+				Vertex.Normal = Vertex.Position;
+				Vertex.Tangent = ieFloat3(-sinf(Phi), 0.0f, cosf(Phi));
+				Vertex.BiTangent = ieFloat3(cosf(Theta) * cosf(Phi), -sinf(Theta), cosf(Theta) * sinf(Phi));
+				OutVertices.push_back(Vertex);
+			}
+		}
+
+		// Corners of each quad, down the rings and around the segments. The triangles that would
+		// collapse into a pole are left out.
+		for (uint32_t Ring = 0; Ring < Rings; ++Ring) {
+			for (uint32_t Segment = 0; Segment < Segments; ++Segment) {
+				const uint32_t V0 = Ring * (Segments + 1U) + Segment;
+				const uint32_t V1 = V0 + 1U;
+				const uint32_t V2 = V0 + Segments + 1U;
+				const uint32_t V3 = V2 + 1U;
+				if (Ring != 0U) {
+					OutIndices.insert(OutIndices.end(), { V0, V1, V2 });
+				}
+				if (Ring != Rings - 1U) {
+					OutIndices.insert(OutIndices.end(), { V1, V3, V2 });
+				}
+			}
+		}
+	}
+
+	void ShuffleTriangles(Indices& InOutIndices, uint32_t Seed)
+	{
+		EngineTests::Random Rand(Seed);
+		const size_t NumTriangles = InOutIndices.size() / 3U;
+		for (size_t i = NumTriangles; i > 1U; --i) {
+			const size_t j = Rand.Next() % i;
+			for (size_t Corner = 0; Corner < 3U; ++Corner) {
+				std::swap(InOutIndices[(i - 1U) * 3U + Corner], InOutIndices[j * 3U + Corner]);
+			}
+		}
+	}
+
+}
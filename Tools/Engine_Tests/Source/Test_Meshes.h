@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Insight/Rendering/Geometry/Vertex_Buffer.h"
+#include "Insight/Rendering/Geometry/Index_Buffer.h"
+
+#include <cstdint>
+
+/*
+	Procedural meshes shared by the geometry tests. Every generator is deterministic, the
+	expected counts in the tests are derived from the same arguments.
+
+	Example usage:
+		Insight::Verticies Vertices;
+		Insight::Indices Indices;
+		TestMeshes::MakeGrid(32U, 32U, false, Vertices, Indices);	// One vertex per face corner, as Assimp imports
+*/
+
+namespace TestMeshes {
+
+	// 'Width' by 'Height' quads over a rolling height field in the xz plane, two triangles each,
+	// facing +y, with orthonormal tangent frames. Welded grids share their (Width + 1) * (Height + 1)
+	// vertices, unwelded ones give every triangle corner its own copy of the vertex.
+	void MakeGrid(uint32_t Width, uint32_t Height, bool Welded, Insight::Verticies& OutVertices, Insight::Indices& OutIndices);
+
+	// Unit sphere of 'Rings' by 'Segments' quads, triangles wound like the grid's so they face
+	// outwards. The texture seam and the poles keep their own vertices.
+	void MakeSphere(uint32_t Rings, uint32_t Segments, Insight::Verticies& OutVertices, Insight::Indices& OutIndices);
+
+	// Reorder the triangles at random, each one keeps its winding.
+	void ShuffleTriangles(Insight::Indices& InOutIndices, uint32_t Seed);
+
+}
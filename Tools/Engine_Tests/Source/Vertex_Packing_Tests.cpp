@@ -0,0 +1,168 @@
+#include "Engine_Tests.h"
+#include "Test_Meshes.h"
+
+#include "Insight/Rendering/Geometry/Vertex_Packing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace Insight;
+
+// Largest angle, in degrees, a unit vector may turn through 10-10-10-2 packing. Each component
+// moves at most half a step of 2/1023, sqrt(3) / 1023 radians or 0.097 degrees across all three.
+// The rebuilt bitangent adds up the normal's and tangent's errors, 0.11 is measured below and
+// 0.12 on imported assets.
+#define IE_TEST_MAX_PACKED_VECTOR_ANGLE 0.15f
+
+static float Dot(const ieFloat3& A, const ieFloat3& B)
+{
+	return A.x * B.x + A.y * B.y + A.z * B.z;
+}
+
+// Degrees between two vectors, zero if either has no length.
+static float AngleBetween(const ieFloat3& A, const ieFloat3& B)
+{
+	const float LengthProduct = sqrtf(Dot(A, A) * Dot(B, B));
+	if (LengthProduct < 1e-12f) {
+		return 0.0f;
+	}
+	const float Cosine = std::min(std::max(Dot(A, B) / LengthProduct, -1.0f), 1.0f);
+	return acosf(Cosine) * (180.0f / 3.14159265f);
+}
+
+static uint32_t FloatBits(float Value)
+{
+	uint32_t Bits;
+	memcpy(&Bits, &Value, sizeof(Bits));
+	return Bits;
+}
+
+static float BitsToFloat(uint32_t Bits)
+{
+	float Value;
+	memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+IE_TEST(VertexPacking_PackingPrecision)
+{
+	struct Case
+	{
+		const char* Name;
+		Verticies Vertices;
+	};
+	Case Cases[3] = { { "Grid", {} }, { "Sphere", {} }, { "Random frames", {} } };
+	Indices Unused;
+	TestMeshes::MakeGrid(64U, 64U, true, Cases[0].Vertices, Unused);
+	TestMeshes::MakeSphere(64U, 128U, Cases[1].Vertices, Unused);
+
+	// Orthonormal frames in every direction, half of them with a flipped bitangent.
+	EngineTests::Random Rand(5U);
+	Cases[2].Vertices.resize(20000U);
+	for (Vertex3D& Vertex : Cases[2].Vertices) {
+		auto RandomUnit = [&Rand]() {
+			ieFloat3 V;
+			float LengthSq;
+			do {
+				V = ieFloat3(Rand.NextFloat(-1.0f, 1.0f), Rand.NextFloat(-1.0f, 1.0f), Rand.NextFloat(-1.0f, 1.0f));
+				LengthSq = Dot(V, V);
+			} while (LengthSq < 0.01f || LengthSq > 1.0f);
+			const float Scale = 1.0f / sqrtf(LengthSq);
+			return ieFloat3(V.x * Scale, V.y * Scale, V.z * Scale);
+		};
+		const ieFloat3 N = RandomUnit();
+		const ieFloat3 R = RandomUnit();
+		// Tangent is R with its normal component removed, bitangent completes the frame.
+		const float RDotN = Dot(R, N);
+		ieFloat3 T(R.x - N.x * RDotN, R.y - N.y * RDotN, R.z - N.z * RDotN);
+		const float TScale = 1.0f / sqrtf(std::max(Dot(T, T), 1e-12f));
+		T = ieFloat3(T.x * TScale, T.y * TScale, T.z * TScale);
+		const float Sign = (Rand.Next() & 1U) ? 1.0f : -1.0f;
+		Vertex.Normal = N;
+		Vertex.Tangent = T;
+		Vertex.BiTangent = ieFloat3((N.y * T.z - N.z * T.y) * Sign, (N.z * T.x - N.x * T.z) * Sign, (N.x * T.y - N.y * T.x) * Sign);
+		Vertex.TexCoords = ieFloat2(Rand.NextFloat(-2.0f, 2.0f), Rand.NextFloat(-2.0f, 2.0f));
+	}
+
+	for (const Case& Mesh : Cases) {
+		float MaxNormalAngle = 0.0f, MaxTangentAngle = 0.0f, MaxBiTangentAngle = 0.0f, MaxTexCoordError = 0.0f;
+		for (const Vertex3D& Vertex : Mesh.Vertices) {
+			const Vertex3D Unpacked = VertexPacking::UnpackVertex(VertexPacking::PackVertex(Vertex));
+			MaxNormalAngle = std::max(MaxNormalAngle, AngleBetween(Vertex.Normal, Unpacked.Normal));
+			MaxTangentAngle = std::max(MaxTangentAngle, AngleBetween(Vertex.Tangent, Unpacked.Tangent));
+			MaxBiTangentAngle = std::max(MaxBiTangentAngle, AngleBetween(Vertex.BiTangent, Unpacked.BiTangent));
+			MaxTexCoordError = std::max(MaxTexCoordError, std::max(fabsf(Vertex.TexCoords.x - Unpacked.TexCoords.x), fabsf(Vertex.TexCoords.y - Unpacked.TexCoords.y)));
+			IE_CHECK(memcmp(&Vertex.Position, &Unpacked.Position, sizeof(ieFloat3)) == 0);
+		}
+		IE_TEST_REPORT("%s: max error normal %.4f deg, tangent %.4f deg, bitangent %.4f deg, uv %.6f",
+			Mesh.Name, MaxNormalAngle, MaxTangentAngle, MaxBiTangentAngle, MaxTexCoordError);
+
+		IE_CHECK_MSG(MaxNormalAngle < IE_TEST_MAX_PACKED_VECTOR_ANGLE, "%s: normal %.4f deg", Mesh.Name, MaxNormalAngle);
+		IE_CHECK_MSG(MaxTangentAngle < IE_TEST_MAX_PACKED_VECTOR_ANGLE, "%s: tangent %.4f deg", Mesh.Name, MaxTangentAngle);
+		IE_CHECK_MSG(MaxBiTangentAngle < IE_TEST_MAX_PACKED_VECTOR_ANGLE, "%s: bitangent %.4f deg", Mesh.Name, MaxBiTangentAngle);
+		IE_CHECK_MSG(MaxTexCoordError <= IE_VERTEX_PACKING_MAX_TEXCOORD_ERROR, "%s: uv %.6f", Mesh.Name, MaxTexCoordError);
+		IE_CHECK(VertexPacking::ChooseLayout(Mesh.Vertices, false) == eVertexLayout::Packed);
+	}
+
+	// Coordinates whose half float error is over the limit, or out of half range, keep full precision.
+	Verticies Tiling(1U);
+	for (float U : { 2.7f, 100.3f, 70000.0f, -3.0009765625f }) {
+		Tiling[0].TexCoords = ieFloat2(U, 0.0f);
+		IE_CHECK_MSG(VertexPacking::ChooseLayout(Tiling, false) == eVertexLayout::PackedFullPrecisionUV, "u %f", U);
+	}
+	Tiling[0].TexCoords = ieFloat2(0.25f, 0.5f);
+	IE_CHECK(VertexPacking::ChooseLayout(Tiling, false) == eVertexLayout::Packed);
+	IE_CHECK(VertexPacking::ChooseLayout(Tiling, true) == eVertexLayout::PackedFullPrecisionUV);
+}
+
+IE_TEST(VertexPacking_FloatToHalfRounding)
+{
+	// Every finite half converts back to itself, with its sign.
+	for (uint32_t Half = 0; Half <= 0xFFFFU; ++Half) {
+		if ((Half & 0x7C00U) == 0x7C00U && (Half & 0x3FFU) != 0U) {
+			continue;
+		}
+		const uint16_t RoundTrip = VertexPacking::FloatToHalf(VertexPacking::HalfToFloat(static_cast<uint16_t>(Half)));
+		IE_CHECK_MSG(RoundTrip == Half, "0x%04X came back as 0x%04X", Half, RoundTrip);
+	}
+
+	// Halfway between two neighbouring halves rounds to the even one, either side of halfway to the
+	// nearer. Runs through the subnormals, the step into the normals and past the largest finite
+	// half, where the halfway point 65520 rounds to infinity.
+	for (uint32_t Half = 0; Half < 0x7C00U; ++Half) {
+		const float Low = VertexPacking::HalfToFloat(static_cast<uint16_t>(Half));
+		const float High = (Half + 1U == 0x7C00U) ? 65536.0f : VertexPacking::HalfToFloat(static_cast<uint16_t>(Half + 1U));
+		const float Middle = (Low + High) * 0.5f;
+		const uint16_t Even = static_cast<uint16_t>((Half & 1U) ? Half + 1U : Half);
+		IE_CHECK_MSG(VertexPacking::FloatToHalf(Middle) == Even, "halfway after 0x%04X", Half);
+		IE_CHECK_MSG(VertexPacking::FloatToHalf(BitsToFloat(FloatBits(Middle) - 1U)) == Half, "below halfway after 0x%04X", Half);
+		IE_CHECK_MSG(VertexPacking::FloatToHalf(BitsToFloat(FloatBits(Middle) + 1U)) == Half + 1U, "above halfway after 0x%04X", Half);
+		IE_CHECK_MSG(VertexPacking::FloatToHalf(-Middle) == (Even | 0x8000U), "negative halfway after 0x%04X", Half);
+	}
+
+	// Subnormals.
+	IE_CHECK(VertexPacking::FloatToHalf(ldexpf(1.0f, -24)) == 0x0001U);
+	IE_CHECK(VertexPacking::FloatToHalf(ldexpf(1.0f, -25)) == 0x0000U);
+	IE_CHECK(VertexPacking::FloatToHalf(ldexpf(1.0f, -26)) == 0x0000U);
+	IE_CHECK(VertexPacking::FloatToHalf(ldexpf(1023.0f, -24)) == 0x03FFU);
+	IE_CHECK(VertexPacking::FloatToHalf(-ldexpf(1.0f, -24)) == 0x8001U);
+	IE_CHECK(VertexPacking::FloatToHalf(1e-30f) == 0x0000U);
+	IE_CHECK(VertexPacking::FloatToHalf(-0.0f) == 0x8000U);
+
+	// Overflow.
+	IE_CHECK(VertexPacking::FloatToHalf(65504.0f) == 0x7BFFU);
+	IE_CHECK(VertexPacking::FloatToHalf(65519.0f) == 0x7BFFU);
+	IE_CHECK(VertexPacking::FloatToHalf(65520.0f) == 0x7C00U);
+	IE_CHECK(VertexPacking::FloatToHalf(1e10f) == 0x7C00U);
+	IE_CHECK(VertexPacking::FloatToHalf(-1e10f) == 0xFC00U);
+	IE_CHECK(VertexPacking::FloatToHalf(INFINITY) == 0x7C00U);
+	IE_CHECK(VertexPacking::FloatToHalf(-INFINITY) == 0xFC00U);
+
+	// NaN stays NaN, including payloads whose set bits are all below the half's mantissa.
+	for (uint32_t Bits : { 0x7FC00000U, 0x7F800001U, 0xFF800001U, 0x7FFFFFFFU }) {
+		const uint16_t Half = VertexPacking::FloatToHalf(BitsToFloat(Bits));
+		IE_CHECK_MSG((Half & 0x7C00U) == 0x7C00U && (Half & 0x3FFU) != 0U, "0x%08X became 0x%04X", Bits, Half);
+		IE_CHECK(std::isnan(VertexPacking::HalfToFloat(Half)));
+	}
+}
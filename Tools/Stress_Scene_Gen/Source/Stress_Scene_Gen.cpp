@@ -0,0 +1,620 @@
+// Copyright 2020 Garrett Courtney
+
+/*=====================================================================
+
+	Stress Scene Generator
+
+	Writes a synthetic scene in the engine's .iescene format, along with the
+	procedural meshes and textures it references, so load, tick and save
+	scaling can be measured on scenes far larger than the sample content.
+	Everything is derived from '-seed', the same arguments always produce
+	the same scene.
+
+	The tool only depends on rapidjson and the standard library so it
+	builds anywhere premake does, including Linux ("premake5 gmake2").
+	Run the generated scene through the engine with "-benchmark <Name>.iescene".
+
+	Example usage:
+		Stress_Scene_Gen -project "C:/Users/Me/Documents/Insight Projects/Development-Project" -name Stress_10k -actors 10000 -meshes 64 -textures 32
+
+ ======================================================================*/
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/prettywriter.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Must match IE_SCENE_ACTORS_PER_CHUNK in File_System.cpp.
+#define STRESS_ACTORS_PER_CHUNK 512U
+// Save generation the scene is written as. Chunk files are named after it the way
+// GetActorChunkFilename in File_System.cpp names them, the engine's first save uses the next one.
+#define STRESS_SAVE_GENERATION 1U
+// Must match the MAX_*_LIGHTS_SUPPORTED limits in Core.h.
+#define STRESS_MAX_POINT_LIGHTS 16U
+#define STRESS_MAX_SPOT_LIGHTS 16U
+#define STRESS_MAX_DIRECTIONAL_LIGHTS 4U
+// Must match Texture::eTextureType.
+#define STRESS_TEXTURE_ALBEDO 0
+#define STRESS_TEXTURE_NORMAL 1
+#define STRESS_TEXTURE_ROUGHNESS 2
+#define STRESS_TEXTURE_METALLIC 3
+#define STRESS_TEXTURE_AO 4
+
+static const float s_Pi = 3.14159265f;
+
+typedef rapidjson::PrettyWriter<rapidjson::StringBuffer> JsonWriter;
+
+struct GeneratorSettings
+{
+	std::string ProjectDirectory = ".";
+	std::string SceneName = "StressScene";
+	uint32_t NumActors = 1000U;
+	// Fraction of the actors that carry static meshes, the rest are empty actors.
+	float MeshActorRatio = 0.9f;
+	uint32_t MeshesPerActor = 1U;
+	uint32_t NumUniqueMeshes = 16U;
+	uint32_t TrianglesPerMesh = 2000U;
+	uint32_t NumUniqueTextures = 8U;
+	uint32_t TextureSize = 256U;
+	uint32_t NumPointLights = 8U;
+	uint32_t NumSpotLights = 4U;
+	uint32_t NumDirectionalLights = 1U;
+	uint32_t Seed = 1337U;
+};
+
+struct GeneratedTexture
+{
+	int Id;
+	int Type;
+	std::string Name;
+	std::string Filepath;
+};
+
+static void PrintUsage()
+{
+	printf(
+		"Usage: Stress_Scene_Gen [options]\n"
+		"  -project <dir>            Project folder holding 'Assets' (default: .)\n"
+		"  -name <name>              Scene name, written to Assets/Scenes/<name>.iescene (default: StressScene)\n"
+		"  -actors <n>               Number of actors, lights excluded (default: 1000)\n"
+		"  -meshActorRatio <0..1>    Fraction of actors with static meshes (default: 0.9)\n"
+		"  -meshesPerActor <n>       Static mesh components per mesh actor (default: 1)\n"
+		"  -meshes <n>               Unique meshes to generate (default: 16)\n"
+		"  -triangles <n>            Approximate triangles per mesh (default: 2000)\n"
+		"  -textures <n>             Unique albedo textures to generate (default: 8)\n"
+		"  -textureSize <n>          Texture width and height in pixels (default: 256)\n"
+		"  -pointLights <n>          Point lights, at most %u (default: 8)\n"
+		"  -spotLights <n>           Spot lights, at most %u (default: 4)\n"
+		"  -directionalLights <n>    Directional lights, at most %u (default: 1)\n"
+		"  -seed <n>                 Random seed (default: 1337)\n",
+		STRESS_MAX_POINT_LIGHTS, STRESS_MAX_SPOT_LIGHTS, STRESS_MAX_DIRECTIONAL_LIGHTS
+	);
+}
+
+static bool ParseArguments(int argc, char** argv, GeneratorSettings& OutSettings)
+{
+	for (int i = 1; i < argc; ++i) {
+		const char* Arg = argv[i];
+		if (strcmp(Arg, "-help") == 0 || strcmp(Arg, "-h") == 0) {
+			return false;
+		}
+		if (i + 1 >= argc) {
+			fprintf(stderr, "Missing value for argument \"%s\"\n", Arg);
+			return false;
+		}
+		const char* Value = argv[++i];
+		const uint32_t UintValue = static_cast<uint32_t>(strtoul(Value, nullptr, 10));
+
+		if (strcmp(Arg, "-project") == 0)					OutSettings.ProjectDirectory = Value;
+		else if (strcmp(Arg, "-name") == 0)					OutSettings.SceneName = Value;
+		else if (strcmp(Arg, "-actors") == 0)				OutSettings.NumActors = UintValue;
+		else if (strcmp(Arg, "-meshActorRatio") == 0)		OutSettings.MeshActorRatio = static_cast<float>(atof(Value));
+		else if (strcmp(Arg, "-meshesPerActor") == 0)		OutSettings.MeshesPerActor = UintValue;
+		else if (strcmp(Arg, "-meshes") == 0)				OutSettings.NumUniqueMeshes = UintValue;
+		else if (strcmp(Arg, "-triangles") == 0)			OutSettings.TrianglesPerMesh = UintValue;
+		else if (strcmp(Arg, "-textures") == 0)				OutSettings.NumUniqueTextures = UintValue;
+		else if (strcmp(Arg, "-textureSize") == 0)			OutSettings.TextureSize = UintValue;
+		else if (strcmp(Arg, "-pointLights") == 0)			OutSettings.NumPointLights = UintValue;
+		else if (strcmp(Arg, "-spotLights") == 0)			OutSettings.NumSpotLights = UintValue;
+		else if (strcmp(Arg, "-directionalLights") == 0)	OutSettings.NumDirectionalLights = UintValue;
+		else if (strcmp(Arg, "-seed") == 0)					OutSettings.Seed = UintValue;
+		else {
+			fprintf(stderr, "Unknown argument \"%s\"\n", Arg);
+			return false;
+		}
+	}
+
+	// The renderer has fixed size light buffers, more lights than it supports would be dropped or overrun them.
+	auto ClampLights = [](uint32_t& Count, uint32_t Max, const char* Name) {
+		if (Count > Max) {
+			printf("Clamping %s from %u to the %u the renderer supports.\n", Name, Count, Max);
+			Count = Max;
+		}
+	};
+	ClampLights(OutSettings.NumPointLights, STRESS_MAX_POINT_LIGHTS, "point lights");
+	ClampLights(OutSettings.NumSpotLights, STRESS_MAX_SPOT_LIGHTS, "spot lights");
+	ClampLights(OutSettings.NumDirectionalLights, STRESS_MAX_DIRECTIONAL_LIGHTS, "directional lights");
+
+	OutSettings.MeshActorRatio = (OutSettings.MeshActorRatio < 0.0f) ? 0.0f : (OutSettings.MeshActorRatio > 1.0f) ? 1.0f : OutSettings.MeshActorRatio;
+	OutSettings.NumUniqueMeshes = (OutSettings.NumUniqueMeshes > 0U) ? OutSettings.NumUniqueMeshes : 1U;
+	OutSettings.NumUniqueTextures = (OutSettings.NumUniqueTextures > 0U) ? OutSettings.NumUniqueTextures : 1U;
+	OutSettings.TextureSize = (OutSettings.TextureSize > 0U) ? OutSettings.TextureSize : 1U;
+	return true;
+}
+
+static bool WriteFile(const fs::path& Filepath, const void* pData, size_t Size)
+{
+	FILE* pFile = fopen(Filepath.string().c_str(), "wb");
+	if (!pFile) {
+		fprintf(stderr, "Failed to create file: %s\n", Filepath.string().c_str());
+		return false;
+	}
+	const bool Succeeded = fwrite(pData, 1, Size, pFile) == Size;
+	fclose(pFile);
+	if (!Succeeded) {
+		fprintf(stderr, "Failed to write file: %s\n", Filepath.string().c_str());
+	}
+	return Succeeded;
+}
+
+static bool WriteJsonFile(const fs::path& Filepath, const rapidjson::StringBuffer& Buffer)
+{
+	return WriteFile(Filepath, Buffer.GetString(), Buffer.GetSize());
+}
+
+// Uncompressed 24 bit bitmap, loaded by the engine through WIC.
+static bool WriteBitmap(const fs::path& Filepath, uint32_t Size, const std::vector<uint8_t>& RGB)
+{
+	const uint32_t RowSize = (Size * 3U + 3U) & ~3U;
+	const uint32_t PixelBytes = RowSize * Size;
+	const uint32_t HeaderSize = 54U;
+
+	std::vector<uint8_t> Bytes(HeaderSize + PixelBytes, 0U);
+	auto Put16 = [&Bytes](size_t Offset, uint16_t Value) { memcpy(&Bytes[Offset], &Value, sizeof(Value)); };
+	auto Put32 = [&Bytes](size_t Offset, uint32_t Value) { memcpy(&Bytes[Offset], &Value, sizeof(Value)); };
+	Bytes[0] = 'B';
+	Bytes[1] = 'M';
+	Put32(2, HeaderSize + PixelBytes);
+	Put32(10, HeaderSize);
+	Put32(14, 40U);
+	Put32(18, Size);
+	Put32(22, Size);
+	Put16(26, 1U);
+	Put16(28, 24U);
+	Put32(34, PixelBytes);
+
+	// Rows are stored bottom up in BGR order.
+	for (uint32_t y = 0; y < Size; ++y) {
+		uint8_t* pRow = &Bytes[HeaderSize + (Size - 1U - y) * RowSize];
+		for (uint32_t x = 0; x < Size; ++x) {
+			const uint8_t* pPixel = &RGB[(y * Size + x) * 3U];
+			pRow[x * 3U + 0U] = pPixel[2];
+			pRow[x * 3U + 1U] = pPixel[1];
+			pRow[x * 3U + 2U] = pPixel[0];
+		}
+	}
+	return WriteFile(Filepath, Bytes.data(), Bytes.size());
+}
+
+// A checkerboard tinted with a random color, each albedo texture is unique.
+static bool GenerateAlbedoTexture(const fs::path& Filepath, uint32_t Size, std::mt19937& Random)
+{
+	std::uniform_int_distribution<int> ColorDist(64, 255);
+	const uint8_t Tint[3] = { (uint8_t)ColorDist(Random), (uint8_t)ColorDist(Random), (uint8_t)ColorDist(Random) };
+	const uint32_t CheckerSize = (Size >= 8U) ? Size / 8U : 1U;
+
+	std::vector<uint8_t> RGB(Size * Size * 3U);
+	for (uint32_t y = 0; y < Size; ++y) {
+		for (uint32_t x = 0; x < Size; ++x) {
+			const bool IsDark = ((x / CheckerSize) + (y / CheckerSize)) & 1U;
+			for (uint32_t c = 0; c < 3U; ++c) {
+				RGB[(y * Size + x) * 3U + c] = IsDark ? Tint[c] / 2U : Tint[c];
+			}
+		}
+	}
+	return WriteBitmap(Filepath, Size, RGB);
+}
+
+static bool GenerateSolidTexture(const fs::path& Filepath, uint8_t R, uint8_t G, uint8_t B)
+{
+	const uint32_t Size = 4U;
+	std::vector<uint8_t> RGB(Size * Size * 3U);
+	for (uint32_t i = 0; i < Size * Size; ++i) {
+		RGB[i * 3U + 0U] = R;
+		RGB[i * 3U + 1U] = G;
+		RGB[i * 3U + 2U] = B;
+	}
+	return WriteBitmap(Filepath, Size, RGB);
+}
+
+// A UV sphere with its radius displaced by a few random waves so every mesh has different geometry.
+static bool GenerateMesh(const fs::path& Filepath, uint32_t TargetTriangles, std::mt19937& Random)
+{
+	// A sphere with R rings and 2R segments has roughly 4R^2 triangles.
+	uint32_t NumRings = static_cast<uint32_t>(std::sqrt(static_cast<float>(TargetTriangles) / 4.0f));
+	NumRings = (NumRings < 3U) ? 3U : NumRings;
+	const uint32_t NumSegments = NumRings * 2U;
+
+	std::uniform_real_distribution<float> PhaseDist(0.0f, 2.0f * s_Pi);
+	std::uniform_real_distribution<float> AmplitudeDist(0.02f, 0.15f);
+	std::uniform_int_distribution<int> FrequencyDist(1, 6);
+	const float PhaseA = PhaseDist(Random), PhaseB = PhaseDist(Random);
+	const float AmplitudeA = AmplitudeDist(Random), AmplitudeB = AmplitudeDist(Random);
+	const int FrequencyA = FrequencyDist(Random), FrequencyB = FrequencyDist(Random);
+
+	std::string Obj;
+	Obj.reserve(static_cast<size_t>(NumRings + 1U) * (NumSegments + 1U) * 96U);
+	Obj += "# Generated by Stress_Scene_Gen\n";
+	char Line[128];
+	for (uint32_t Ring = 0; Ring <= NumRings; ++Ring) {
+		const float V = static_cast<float>(Ring) / NumRings;
+		const float Theta = V * s_Pi;
+		for (uint32_t Segment = 0; Segment <= NumSegments; ++Segment) {
+			const float U = static_cast<float>(Segment) / NumSegments;
+			const float Phi = U * 2.0f * s_Pi;
+			const float Radius = 1.0f
+				+ AmplitudeA * std::sin(FrequencyA * Theta + PhaseA)
+				+ AmplitudeB * std::sin(FrequencyB * Phi + PhaseB) * std::sin(Theta);
+
+			const float Nx = std::sin(Theta) * std::cos(Phi);
+			const float Ny = std::cos(Theta);
+			const float Nz = std::sin(Theta) * std::sin(Phi);
+			snprintf(Line, sizeof(Line), "v %.5f %.5f %.5f\nvt %.5f %.5f\nvn %.5f %.5f %.5f\n", Nx * Radius, Ny * Radius, Nz * Radius, U, 1.0f - V, Nx, Ny, Nz);
+			Obj += Line;
+		}
+	}
+	for (uint32_t Ring = 0; Ring < NumRings; ++Ring) {
+		for (uint32_t Segment = 0; Segment < NumSegments; ++Segment) {
+			// OBJ indices are one based.
+			const uint32_t A = Ring * (NumSegments + 1U) + Segment + 1U;
+			const uint32_t B = A + NumSegments + 1U;
+			snprintf(Line, sizeof(Line), "f %u/%u/%u %u/%u/%u %u/%u/%u\n", A, A, A, B, B, B, A + 1U, A + 1U, A + 1U);
+			Obj += Line;
+			snprintf(Line, sizeof(Line), "f %u/%u/%u %u/%u/%u %u/%u/%u\n", A + 1U, A + 1U, A + 1U, B, B, B, B + 1U, B + 1U, B + 1U);
+			Obj += Line;
+		}
+	}
+	return WriteFile(Filepath, Obj.data(), Obj.size());
+}
+
+static void WriteVector(JsonWriter& Writer, const char* Key, const char* Suffixes, const float* pValues, uint32_t Count)
+{
+	char ElementKey[64];
+	for (uint32_t i = 0; i < Count; ++i) {
+		snprintf(ElementKey, sizeof(ElementKey), "%s%c", Key, Suffixes[i]);
+		Writer.Key(ElementKey);
+		Writer.Double(pValues[i]);
+	}
+}
+
+// Same layout as AActor::WriteTransformToJson.
+static void WriteTransform(JsonWriter& Writer, const float Position[3], const float Rotation[3], const float Scale[3])
+{
+	Writer.StartArray();
+	Writer.StartObject();
+	WriteVector(Writer, "pos", "XYZ", Position, 3U);
+	WriteVector(Writer, "rot", "XYZ", Rotation, 3U);
+	WriteVector(Writer, "sca", "XYZ", Scale, 3U);
+	Writer.EndObject();
+	Writer.EndArray();
+}
+
+// Same layout as StaticMeshComponent::WriteToJson and Material::WriteToJson.
+static void WriteStaticMesh(JsonWriter& Writer, const std::string& MeshPath, int AlbedoId, int NormalId, int MetallicId, int RoughnessId, int AOId)
+{
+	static const float s_Zero[3] = { 0.0f, 0.0f, 0.0f };
+	static const float s_One[3] = { 1.0f, 1.0f, 1.0f };
+
+	Writer.StartObject();
+	Writer.Key("StaticMesh");
+	Writer.StartArray();
+	{
+		Writer.StartObject();
+		Writer.Key("Mesh");
+		Writer.String(MeshPath.c_str());
+		Writer.Key("Enabled");
+		Writer.Bool(true);
+		Writer.Key("LocalTransform");
+		WriteTransform(Writer, s_Zero, s_Zero, s_One);
+		Writer.EndObject();
+
+		Writer.StartObject();
+		Writer.Key("AlbedoMapID");
+		Writer.Int(AlbedoId);
+		Writer.Key("NormalMapID");
+		Writer.Int(NormalId);
+		Writer.Key("MetallicMapID");
+		Writer.Int(MetallicId);
+		Writer.Key("RoughnessMapID");
+		Writer.Int(RoughnessId);
+		Writer.Key("AOMapID");
+		Writer.Int(AOId);
+
+		Writer.Key("uvOffset");
+		Writer.StartArray();
+		Writer.StartObject();
+		Writer.Key("x"); Writer.Double(0.0);
+		Writer.Key("y"); Writer.Double(0.0);
+		Writer.EndObject();
+		Writer.EndArray();
+
+		Writer.Key("Tiling");
+		Writer.StartArray();
+		Writer.StartObject();
+		Writer.Key("u"); Writer.Double(1.0);
+		Writer.Key("v"); Writer.Double(1.0);
+		Writer.EndObject();
+		Writer.EndArray();
+
+		Writer.Key("Color_Override");
+		Writer.StartArray();
+		Writer.StartObject();
+		Writer.Key("r"); Writer.Double(0.0);
+		Writer.Key("g"); Writer.Double(0.0);
+		Writer.Key("b"); Writer.Double(0.0);
+		Writer.EndObject();
+		Writer.EndArray();
+
+		Writer.Key("Metallic_Override");
+		Writer.Double(0.0);
+		Writer.Key("Roughness_Override");
+		Writer.Double(0.0);
+		Writer.EndObject();
+	}
+	Writer.EndArray();
+	Writer.EndObject();
+}
+
+int main(int argc, char** argv)
+{
+	GeneratorSettings Settings;
+	if (!ParseArguments(argc, argv, Settings)) {
+		PrintUsage();
+		return 1;
+	}
+
+	const fs::path AssetsDirectory = fs::path(Settings.ProjectDirectory) / "Assets";
+	const std::string MeshDirectory = "Meshes/Stress/" + Settings.SceneName;
+	const std::string TextureDirectory = "Textures/Stress/" + Settings.SceneName;
+	const fs::path SceneDirectory = AssetsDirectory / "Scenes" / (Settings.SceneName + ".iescene");
+
+	// Start clean so a cooked scene or chunk files left from a previous run are never loaded.
+	std::error_code Error;
+	fs::remove_all(SceneDirectory, Error);
+	fs::remove_all(AssetsDirectory / MeshDirectory, Error);
+	fs::remove_all(AssetsDirectory / TextureDirectory, Error);
+	if (!fs::create_directories(SceneDirectory / "Actors", Error) || !fs::create_directories(AssetsDirectory / MeshDirectory, Error) || !fs::create_directories(AssetsDirectory / TextureDirectory, Error)) {
+		fprintf(stderr, "Failed to create output folders under \"%s\": %s\n", AssetsDirectory.string().c_str(), Error.message().c_str());
+		return 1;
+	}
+
+	std::mt19937 Random(Settings.Seed);
+	char Filename[64];
+
+	// Meshes
+	std::vector<std::string> MeshPaths;
+	MeshPaths.reserve(Settings.NumUniqueMeshes);
+	for (uint32_t i = 0; i < Settings.NumUniqueMeshes; ++i) {
+		snprintf(Filename, sizeof(Filename), "/Mesh_%04u.obj", i);
+		MeshPaths.push_back(MeshDirectory + Filename);
+		if (!GenerateMesh(AssetsDirectory / (MeshDirectory + Filename), Settings.TrianglesPerMesh, Random)) {
+			return 1;
+		}
+	}
+
+	// Textures. Every material needs all five maps, the non albedo maps are shared by the whole scene.
+	std::vector<GeneratedTexture> Textures;
+	int NextTextureId = 1;
+	for (uint32_t i = 0; i < Settings.NumUniqueTextures; ++i) {
+		snprintf(Filename, sizeof(Filename), "/Albedo_%04u.bmp", i);
+		Textures.push_back(GeneratedTexture{ NextTextureId++, STRESS_TEXTURE_ALBEDO, std::string("Albedo_") + std::to_string(i), TextureDirectory + Filename });
+		if (!GenerateAlbedoTexture(AssetsDirectory / (TextureDirectory + Filename), Settings.TextureSize, Random)) {
+			return 1;
+		}
+	}
+	struct SharedMap { int Type; const char* Name; uint8_t R, G, B; };
+	const SharedMap SharedMaps[] = {
+		{ STRESS_TEXTURE_NORMAL, "Normal", 128, 128, 255 },
+		{ STRESS_TEXTURE_METALLIC, "Metallic", 0, 0, 0 },
+		{ STRESS_TEXTURE_ROUGHNESS, "Roughness", 160, 160, 160 },
+		{ STRESS_TEXTURE_AO, "AO", 255, 255, 255 },
+	};
+	int SharedMapIds[5] = {};
+	for (const SharedMap& Map : SharedMaps) {
+		const std::string Path = TextureDirectory + "/" + Map.Name + ".bmp";
+		SharedMapIds[Map.Type] = NextTextureId;
+		Textures.push_back(GeneratedTexture{ NextTextureId++, Map.Type, Map.Name, Path });
+		if (!GenerateSolidTexture(AssetsDirectory / Path, Map.R, Map.G, Map.B)) {
+			return 1;
+		}
+	}
+
+	// Resources.json
+	{
+		rapidjson::StringBuffer Buffer;
+		JsonWriter Writer(Buffer);
+		Writer.StartObject();
+		Writer.Key("Textures");
+		Writer.StartArray();
+		for (const GeneratedTexture& Texture : Textures) {
+			Writer.StartObject();
+			Writer.Key("Name");
+			Writer.String(Texture.Name.c_str());
+			Writer.Key("ID");
+			Writer.Int(Texture.Id);
+			Writer.Key("Filepath");
+			Writer.String(Texture.Filepath.c_str());
+			Writer.Key("Type");
+			Writer.Int(Texture.Type);
+			Writer.Key("GenerateMipMaps");
+			Writer.Bool(Texture.Type == STRESS_TEXTURE_ALBEDO);
+			Writer.EndObject();
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+		if (!WriteJsonFile(SceneDirectory / "Resources.json", Buffer)) {
+			return 1;
+		}
+	}
+
+	// Actors, laid out on a square grid with lights scattered above it.
+	const uint32_t NumLights = Settings.NumDirectionalLights + Settings.NumPointLights + Settings.NumSpotLights;
+	const uint32_t NumTotalActors = NumLights + Settings.NumActors;
+	const uint32_t GridWidth = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(Settings.NumActors > 0U ? Settings.NumActors : 1U))));
+	const float GridSpacing = 6.0f;
+	const float GridExtent = GridWidth * GridSpacing;
+
+	std::uniform_real_distribution<float> UnitDist(0.0f, 1.0f);
+	std::uniform_int_distribution<uint32_t> MeshDist(0U, Settings.NumUniqueMeshes - 1U);
+	std::uniform_int_distribution<uint32_t> AlbedoDist(0U, Settings.NumUniqueTextures - 1U);
+	static const float s_One[3] = { 1.0f, 1.0f, 1.0f };
+
+	std::vector<uint32_t> ChunkSizes;
+	// Relative to the scene folder, as listed in Meta.json.
+	std::vector<std::string> ChunkFiles;
+	rapidjson::StringBuffer ChunkBuffer;
+	JsonWriter ChunkWriter(ChunkBuffer);
+	uint32_t NumMeshActors = 0U;
+	for (uint32_t Actor = 0; Actor < NumTotalActors; ++Actor) {
+		if (Actor % STRESS_ACTORS_PER_CHUNK == 0U) {
+			ChunkBuffer.Clear();
+			ChunkWriter.Reset(ChunkBuffer);
+			ChunkWriter.StartObject();
+			ChunkWriter.Key("Set");
+			ChunkWriter.StartArray();
+			ChunkSizes.push_back(0U);
+		}
+
+		char DisplayName[64];
+		ChunkWriter.StartObject();
+		if (Actor < NumLights) {
+			const float Position[3] = { UnitDist(Random) * GridExtent, 10.0f + UnitDist(Random) * 20.0f, UnitDist(Random) * GridExtent };
+			const float Diffuse[3] = { 0.5f + UnitDist(Random) * 0.5f, 0.5f + UnitDist(Random) * 0.5f, 0.5f + UnitDist(Random) * 0.5f };
+			const char* Type = nullptr;
+			if (Actor < Settings.NumDirectionalLights) {
+				Type = "DirectionalLight";
+				snprintf(DisplayName, sizeof(DisplayName), "DirectionalLight_%u", Actor);
+			}
+			else if (Actor < Settings.NumDirectionalLights + Settings.NumPointLights) {
+				Type = "PointLight";
+				snprintf(DisplayName, sizeof(DisplayName), "PointLight_%u", Actor - Settings.NumDirectionalLights);
+			}
+			else {
+				Type = "SpotLight";
+				snprintf(DisplayName, sizeof(DisplayName), "SpotLight_%u", Actor - Settings.NumDirectionalLights - Settings.NumPointLights);
+			}
+			const bool IsDirectional = (Actor < Settings.NumDirectionalLights);
+			// Directional lights point along their rotation.
+			const float Rotation[3] = { IsDirectional ? 0.3f : 0.0f, IsDirectional ? -0.8f : 0.0f, IsDirectional ? 0.4f : 0.0f };
+
+			ChunkWriter.Key("Type");
+			ChunkWriter.String(Type);
+			ChunkWriter.Key("DisplayName");
+			ChunkWriter.String(DisplayName);
+			ChunkWriter.Key("Transform");
+			WriteTransform(ChunkWriter, Position, Rotation, s_One);
+
+			// Same layout as the lights' reflected property structs.
+			ChunkWriter.Key("Emission");
+			ChunkWriter.StartArray();
+			ChunkWriter.StartObject();
+			WriteVector(ChunkWriter, "diffuse", "RGB", Diffuse, 3U);
+			if (strcmp(Type, "SpotLight") == 0) {
+				const float Direction[3] = { 0.0f, -1.0f, 0.0f };
+				WriteVector(ChunkWriter, "direction", "XYZ", Direction, 3U);
+				ChunkWriter.Key("innerCutoff");
+				ChunkWriter.Double(12.5);
+				ChunkWriter.Key("outerCutoff");
+				ChunkWriter.Double(15.0);
+			}
+			ChunkWriter.Key("strength");
+			ChunkWriter.Double(IsDirectional ? 8.0 : 1.0 + UnitDist(Random) * 4.0);
+			ChunkWriter.EndObject();
+			ChunkWriter.EndArray();
+
+			ChunkWriter.Key("Subobjects");
+			ChunkWriter.StartArray();
+			ChunkWriter.EndArray();
+		}
+		else {
+			const uint32_t Index = Actor - NumLights;
+			const float Position[3] = { (Index % GridWidth) * GridSpacing, 0.0f, (Index / GridWidth) * GridSpacing };
+			const float Rotation[3] = { 0.0f, UnitDist(Random) * 2.0f * s_Pi, 0.0f };
+			const float UniformScale = 0.5f + UnitDist(Random) * 1.5f;
+			const float Scale[3] = { UniformScale, UniformScale, UniformScale };
+			const bool HasMeshes = UnitDist(Random) < Settings.MeshActorRatio;
+			snprintf(DisplayName, sizeof(DisplayName), "Actor_%06u", Index);
+
+			ChunkWriter.Key("Type");
+			ChunkWriter.String("Actor");
+			ChunkWriter.Key("DisplayName");
+			ChunkWriter.String(DisplayName);
+			ChunkWriter.Key("Transform");
+			WriteTransform(ChunkWriter, Position, Rotation, Scale);
+
+			ChunkWriter.Key("Subobjects");
+			ChunkWriter.StartArray();
+			if (HasMeshes) {
+				for (uint32_t m = 0; m < Settings.MeshesPerActor; ++m) {
+					WriteStaticMesh(ChunkWriter, MeshPaths[MeshDist(Random)], Textures[AlbedoDist(Random)].Id,
+						SharedMapIds[STRESS_TEXTURE_NORMAL], SharedMapIds[STRESS_TEXTURE_METALLIC], SharedMapIds[STRESS_TEXTURE_ROUGHNESS], SharedMapIds[STRESS_TEXTURE_AO]);
+				}
+				NumMeshActors++;
+			}
+			ChunkWriter.EndArray();
+		}
+		ChunkWriter.EndObject();
+		ChunkSizes.back()++;
+
+		const bool IsChunkFull = ChunkSizes.back() == STRESS_ACTORS_PER_CHUNK;
+		if (IsChunkFull || Actor + 1U == NumTotalActors) {
+			ChunkWriter.EndArray();
+			ChunkWriter.EndObject();
+			snprintf(Filename, sizeof(Filename), "Actors/Chunk_%04u_%08u.json", static_cast<uint32_t>(ChunkSizes.size() - 1U), STRESS_SAVE_GENERATION);
+			ChunkFiles.push_back(Filename);
+			if (!WriteJsonFile(SceneDirectory / Filename, ChunkBuffer)) {
+				return 1;
+			}
+		}
+	}
+
+	// Meta.json is written last, it lists the chunks.
+	{
+		rapidjson::StringBuffer Buffer;
+		JsonWriter Writer(Buffer);
+		Writer.StartObject();
+		Writer.Key("SceneName");
+		Writer.String(Settings.SceneName.c_str());
+		Writer.Key("SaveGeneration");
+		Writer.Uint(STRESS_SAVE_GENERATION);
+		Writer.Key("ActorChunks");
+		Writer.StartArray();
+		for (size_t i = 0; i < ChunkSizes.size(); ++i) {
+			Writer.StartObject();
+			Writer.Key("File");
+			Writer.String(ChunkFiles[i].c_str());
+			Writer.Key("Actors");
+			Writer.Uint(ChunkSizes[i]);
+			Writer.EndObject();
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+		if (!WriteJsonFile(SceneDirectory / "Meta.json", Buffer)) {
+			return 1;
+		}
+	}
+
+	printf("Generated \"%s\": %u actors (%u with meshes) and %u lights in %u chunks, %u meshes, %u textures.\n",
+		SceneDirectory.string().c_str(), Settings.NumActors, NumMeshActors, NumLights, static_cast<uint32_t>(ChunkSizes.size()), Settings.NumUniqueMeshes, static_cast<uint32_t>(Textures.size()));
+	return 0;
+}
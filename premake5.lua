@@ -28,6 +28,17 @@ IncludeDir["Mono"] = "Engine/Vendor/Mono/include/mono-2.0"
 
 include "Engine/Vendor/ImGui"
 
+-- Engine sources with no platform, renderer or precompiled header dependencies. The
+-- Engine_Tests tool compiles them directly, so they build and are tested on Linux too.
+PortableEngineFiles =
+{
+	"Engine/Source/Insight/Rendering/Geometry/Mesh_Optimizer.cpp",
+	"Engine/Source/Insight/Rendering/Geometry/Meshlet_Builder.cpp",
+	"Engine/Source/Insight/Rendering/Geometry/Meshlet_Culler.cpp",
+	"Engine/Source/Insight/Rendering/Geometry/Meshopt_Codec.cpp",
+	"Engine/Source/Insight/Rendering/Geometry/Vertex_Packing.cpp",
+}
+
 CustomDefines = {}
 CustomDefines["IE_BUILD_DIR"] = "../Bin/" .. outputdir
 CustomDefines["IE_BUILD_CONFIG"] = outputdir
@@ -99,6 +110,12 @@ project ("Engine")
 		"ImGui",
 	}
 
+	filter ("files:" .. table.concat(PortableEngineFiles, " or "))
+		flags
+		{
+			"NoPCH"
+		}
+
 	filter "system:windows"
 		systemversion "latest"
 
@@ -274,4 +291,82 @@ project (gameName)
 		optimize "on"
 		symbols "on"
 
-	
\ No newline at end of file
+	
+-- Stress Scene Generator
+-- Writes synthetic scenes for the engine's "-benchmark" mode. Only depends on
+-- rapidjson so it also builds on Linux with "premake5 gmake2".
+project ("Stress_Scene_Gen")
+	location ("Tools/Stress_Scene_Gen")
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+
+	targetdir ("Bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("Bin-Int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"Tools/%{prj.name}/Source/**.h",
+		"Tools/%{prj.name}/Source/**.cpp",
+	}
+
+	-- Spelled with the on-disk casing, IncludeDir's "Vendor" only resolves on case-insensitive file systems.
+	includedirs
+	{
+		"Engine/vendor/rapidjson/include/",
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "system:linux"
+		links
+		{
+			"stdc++fs"
+		}
+
+	filter "configurations:Debug"
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:not Debug"
+		runtime "Release"
+		optimize "on"
+
+-- Engine Tests
+-- Checks and micro benchmarks for the engine code listed in PortableEngineFiles. Built
+-- like Stress_Scene_Gen, so it also runs on Linux with "premake5 gmake2". Returns a
+-- non-zero exit code if any check fails.
+project ("Engine_Tests")
+	location ("Tools/Engine_Tests")
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+
+	targetdir ("Bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("Bin-Int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"Tools/%{prj.name}/Source/**.h",
+		"Tools/%{prj.name}/Source/**.cpp",
+		PortableEngineFiles,
+	}
+
+	includedirs
+	{
+		"Engine/Source/",
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:not Debug"
+		runtime "Release"
+		optimize "on"